@@ -13,79 +13,324 @@
  *   SRS-EHMS-201: System shall prioritize alerts by severity level
  *   SRS-EHMS-202: System shall support alert inhibit logic
  *   SRS-EHMS-203: System shall log all alert events
+ *   SRS-EHMS-016: System shall resume monitoring from checkpointed state
+ *                 after a power interruption
  */
 
 #include "ehms_types.h"
 #include "alert_manager.h"
+#include "alert_manager_ext.h"
 #include "alert_thresholds.h"
+#include "anomaly_detection.h"
 #include "eicas_interface.h"
 #include "flight_recorder.h"
+#if defined(EHMS_FIXED_POINT_PIPELINE)
+#include "ehms_fixed_point.h"
+#endif
+
+#include <math.h>
+#include <stdatomic.h>
 
 /* ============================================================================
  * PRIVATE CONSTANTS
  * ============================================================================ */
 
+/** @brief Events per consumer queue priority class (power of two) */
 #define ALERT_MAX_QUEUE_SIZE        64U
+#define ALERT_QUEUE_MASK            (ALERT_MAX_QUEUE_SIZE - 1U)
 #define ALERT_DEBOUNCE_CYCLES       3U
-#define ALERT_HYSTERESIS_PERCENT    2.0f
+
+/** @brief Alert levels, EHMS_ALERT_NONE through EHMS_ALERT_WARNING */
+#define ALERT_LEVEL_COUNT           ((uint32_t)EHMS_ALERT_WARNING + 1U)
+
+/** @brief Compiled threshold sets: one per flight phase, then one for unknown phases */
+#define ALERT_PHASE_SET_COUNT       ((uint32_t)EHMS_FLIGHT_PHASE_COUNT + 1U)
+#define ALERT_PHASE_SET_UNKNOWN     ((uint32_t)EHMS_FLIGHT_PHASE_COUNT)
+
+/** @brief Flight phase masks of the threshold table */
+#define ALERT_PHASE(phase)          (1UL << (uint32_t)(phase))
+#define ALERT_PHASES_ALL            (ALERT_PHASE(EHMS_FLIGHT_PHASE_COUNT) - 1UL)
+#define ALERT_PHASES_NONE           0UL
+
+/** @brief Capacity of a compiled threshold band table */
+#define ALERT_MAX_THRESHOLDS        256U
+
+/** @brief Maximum threshold bands of one parameter (width of tracking mask) */
+#define ALERT_MAX_BANDS_PER_PARAM   32U
+
+/** @brief Alert record flags */
+#define ALERT_FLAG_ACTIVE           0x01U
+#define ALERT_FLAG_LATCHED          0x02U
+#define ALERT_FLAG_INHIBITED        0x04U   /* Withheld from EICAS and master alerts */
+
+/** @brief Alert message text length (ehms_alert_t.message) */
+#define ALERT_MESSAGE_LENGTH        64U
+
+/** @brief Queue priority classes, EHMS_ALERT_STATUS through EHMS_ALERT_WARNING */
+#define ALERT_PRIORITY_COUNT        ((uint32_t)EHMS_ALERT_WARNING)
+
+/** @brief Alert event consumers */
+#define ALERT_CONSUMER_EICAS        0U
+#define ALERT_CONSUMER_RECORDER     1U
+#define ALERT_CONSUMER_COUNT        2U
+
+/** @brief Active alert index entry for (engine, param, level) with no alert */
+#define ALERT_NO_SLOT               0xFFU
 
 /* ============================================================================
  * PRIVATE TYPES
  * ============================================================================ */
 
+#if defined(EHMS_FIXED_POINT_PIPELINE)
+/** @brief Threshold comparison operand: raw_value in fixed-point units */
+typedef int32_t alert_value_t;
+#define ALERT_BLOCK_VALUE(block, p)     ((block)->raw_value[p])
+#else
+/** @brief Threshold comparison operand: eng_value */
+typedef float alert_value_t;
+#define ALERT_BLOCK_VALUE(block, p)     ((block)->eng_value[p])
+#endif
+
+/**
+ * @brief Compact alert record
+ *
+ * Level, parameter, ECAM code and message follow from the threshold entry;
+ * the full ehms_alert_t is only assembled when an alert event is posted.
+ */
+typedef struct
+{
+    uint32_t            alert_id;       /* Unique alert identifier */
+    ehms_timestamp_t    onset_time;     /* Alert onset time */
+    ehms_timestamp_t    clear_time;     /* Alert clear time (if cleared) */
+    uint16_t            threshold;      /* s_thresholds index */
+    uint8_t             engine_id;      /* Affected engine */
+    uint8_t             flags;          /* ALERT_FLAG_* */
+} alert_record_t;
+
+/**
+ * @brief Single-producer single-consumer alert event ring
+ *
+ * head is written only by alert detection and tail only by the consumer;
+ * both run freely and are masked on access.
+ */
+typedef struct
+{
+    _Atomic uint32_t    head;           /* Next event to write */
+    _Atomic uint32_t    tail;           /* Next event to deliver */
+    alert_record_t      event[ALERT_MAX_QUEUE_SIZE];
+} alert_event_ring_t;
+
+/**
+ * @brief Event queue of one consumer, one ring per priority class
+ */
 typedef struct
 {
-    ehms_alert_t        alerts[EHMS_MAX_ACTIVE_ALERTS];
+    alert_event_ring_t  ring[ALERT_PRIORITY_COUNT]; /* Indexed by level - STATUS */
+    _Atomic uint32_t    overflow_count;             /* Written by detection */
+    _Atomic uint32_t    high_water;                 /* Written by detection */
+    _Atomic uint32_t    delivered_count;            /* Written by consumer */
+} alert_event_queue_t;
+
+_Static_assert((ALERT_MAX_QUEUE_SIZE & ALERT_QUEUE_MASK) == 0U,
+               "ALERT_MAX_QUEUE_SIZE must be a power of two");
+
+/**
+ * @brief Alert context: alert state and event queues of one aircraft
+ *
+ * Ground contexts have no EICAS consumer; their events are read from the
+ * recorder queue.
+ */
+struct alert_context
+{
+    alert_record_t      alerts[EHMS_MAX_ACTIVE_ALERTS];
+    uint8_t             free_slots[EHMS_MAX_ACTIVE_ALERTS];         /* Free-list stack */
+    uint32_t            free_count;
+    uint8_t             active_slot[EHMS_MAX_ENGINES][EHMS_PARAM_COUNT][ALERT_LEVEL_COUNT];
+    uint8_t             debounce[EHMS_MAX_ENGINES][ALERT_MAX_THRESHOLDS]; /* Per band position */
+    uint32_t            tracked[EHMS_MAX_ENGINES][EHMS_PARAM_COUNT]; /* Bands pending or active */
+    const struct alert_band_table* table[EHMS_MAX_ENGINES];    /* Threshold set in use */
+    uint32_t            phase_set[EHMS_MAX_ENGINES];            /* Index of table[] set */
+    uint32_t            level_count[ALERT_LEVEL_COUNT];
     uint32_t            active_count;
     uint32_t            next_alert_id;
+    uint32_t            raised_levels;  /* Levels raised since last summary update */
     bool                master_caution;
     bool                master_warning;
     ehms_alert_level_t  highest_level;
-} alert_state_t;
+    alert_event_queue_t queue[ALERT_CONSUMER_COUNT]; /* Indexed by ALERT_CONSUMER_* */
+    uint32_t            first_consumer; /* ALERT_CONSUMER_* of the first queue fed */
+};
 
 typedef struct
 {
     ehms_param_id_t     param_id;
     ehms_alert_level_t  level;
     float               threshold;
+    float               hysteresis;     /* Clear margin inside the threshold (eng units) */
     bool                high_limit;     /* true = alert if above, false = alert if below */
+    uint32_t            phases;         /* ALERT_PHASE mask of phases the band applies in */
+    uint32_t            inhibit_phases; /* ALERT_PHASE mask of phases it is inhibited in */
     uint16_t            ecam_code;
     const char*         message;
 } alert_threshold_t;
 
+/**
+ * @brief Threshold bands of one parameter
+ *
+ * Indexes into alert_band_table_t.band. High-limit bands are sorted by
+ * ascending threshold and low-limit bands by descending threshold, so the
+ * bands a value exceeds always form a prefix of each list. The low-limit
+ * list directly follows the high-limit list; a band's position relative to
+ * high_first is its bit in the alert state tracking mask.
+ */
+typedef struct
+{
+    uint16_t            high_first;     /* First high-limit band */
+    uint16_t            high_count;     /* Number of high-limit bands */
+    uint16_t            low_first;      /* First low-limit band */
+    uint16_t            low_count;      /* Number of low-limit bands */
+} alert_param_bands_t;
+
+/**
+ * @brief Threshold table compiled for evaluation, one per threshold set
+ */
+typedef struct alert_band_table
+{
+    alert_value_t       threshold[ALERT_MAX_THRESHOLDS]; /* Band thresholds */
+    alert_value_t       clear_threshold[ALERT_MAX_THRESHOLDS]; /* Hysteresis clear level */
+    uint16_t            band[ALERT_MAX_THRESHOLDS];     /* s_thresholds index of band */
+    alert_param_bands_t param[EHMS_PARAM_COUNT];    /* Bands of each parameter */
+    uint32_t            inhibit[EHMS_PARAM_COUNT];  /* Inhibited bands, bit per position */
+    uint8_t             params[EHMS_PARAM_COUNT];   /* Parameters with bands */
+    uint32_t            param_count;                /* Entries in params */
+} alert_band_table_t;
+
 /* ============================================================================
  * PRIVATE DATA
  * ============================================================================ */
 
-static alert_state_t s_alert_state;
+/** @brief Onboard alert context */
+static alert_context_t s_alert_state;
 
+/**
+ * @brief Alert thresholds
+ *
+ * Each band applies in the flight phases of its phases mask and is
+ * inhibited in those of its inhibit mask: an inhibited alert is raised,
+ * logged and counted, but withheld from EICAS and the master alerts until
+ * the engine enters a phase where the band is not inhibited.
+ */
 static const alert_threshold_t s_thresholds[] = 
 {
-    /* EGT Limits */
-    { EHMS_PARAM_EGT, EHMS_ALERT_CAUTION,  950.0f, true,  0x1001, "ENG %d EGT HIGH" },
-    { EHMS_PARAM_EGT, EHMS_ALERT_WARNING,  1000.0f, true, 0x1002, "ENG %d EGT OVERLIMIT" },
+    /* EGT Limits: takeoff-rated caution limit during takeoff */
+    { EHMS_PARAM_EGT, EHMS_ALERT_CAUTION,  950.0f, 19.0f, true,
+      ALERT_PHASES_ALL & ~ALERT_PHASE(EHMS_FLIGHT_PHASE_TAKEOFF), ALERT_PHASES_NONE,
+      0x1001, "ENG %d EGT HIGH" },
+    { EHMS_PARAM_EGT, EHMS_ALERT_CAUTION,  980.0f, 19.6f, true,
+      ALERT_PHASE(EHMS_FLIGHT_PHASE_TAKEOFF), ALERT_PHASES_NONE,
+      0x1003, "ENG %d EGT HIGH" },
+    { EHMS_PARAM_EGT, EHMS_ALERT_WARNING,  1000.0f, 20.0f, true,
+      ALERT_PHASES_ALL, ALERT_PHASES_NONE, 0x1002, "ENG %d EGT OVERLIMIT" },
     
     /* Oil Pressure Limits */
-    { EHMS_PARAM_OIL_PRESS, EHMS_ALERT_CAUTION,  25.0f, false, 0x2001, "ENG %d OIL PRESS LO" },
-    { EHMS_PARAM_OIL_PRESS, EHMS_ALERT_WARNING,  15.0f, false, 0x2002, "ENG %d OIL PRESS CRIT" },
+    { EHMS_PARAM_OIL_PRESS, EHMS_ALERT_CAUTION,  25.0f, 0.5f, false,
+      ALERT_PHASES_ALL, ALERT_PHASES_NONE, 0x2001, "ENG %d OIL PRESS LO" },
+    { EHMS_PARAM_OIL_PRESS, EHMS_ALERT_WARNING,  15.0f, 0.3f, false,
+      ALERT_PHASES_ALL, ALERT_PHASES_NONE, 0x2002, "ENG %d OIL PRESS CRIT" },
     
     /* Oil Temperature Limits */
-    { EHMS_PARAM_OIL_TEMP, EHMS_ALERT_CAUTION,  140.0f, true, 0x2003, "ENG %d OIL TEMP HI" },
-    { EHMS_PARAM_OIL_TEMP, EHMS_ALERT_WARNING,  155.0f, true, 0x2004, "ENG %d OIL TEMP CRIT" },
+    { EHMS_PARAM_OIL_TEMP, EHMS_ALERT_CAUTION,  140.0f, 2.8f, true,
+      ALERT_PHASES_ALL, ALERT_PHASES_NONE, 0x2003, "ENG %d OIL TEMP HI" },
+    { EHMS_PARAM_OIL_TEMP, EHMS_ALERT_WARNING,  155.0f, 3.1f, true,
+      ALERT_PHASES_ALL, ALERT_PHASES_NONE, 0x2004, "ENG %d OIL TEMP CRIT" },
     
-    /* Vibration Limits */
-    { EHMS_PARAM_VIB_FAN,  EHMS_ALERT_CAUTION,  3.0f, true, 0x3001, "ENG %d FAN VIB HI" },
-    { EHMS_PARAM_VIB_FAN,  EHMS_ALERT_WARNING,  5.0f, true, 0x3002, "ENG %d FAN VIB CRIT" },
-    { EHMS_PARAM_VIB_CORE, EHMS_ALERT_CAUTION,  4.0f, true, 0x3003, "ENG %d CORE VIB HI" },
-    { EHMS_PARAM_VIB_CORE, EHMS_ALERT_WARNING,  6.0f, true, 0x3004, "ENG %d CORE VIB CRIT" },
+    /* Vibration Limits: cautions inhibited during takeoff */
+    { EHMS_PARAM_VIB_FAN,  EHMS_ALERT_CAUTION,  3.0f, 0.06f, true,
+      ALERT_PHASES_ALL, ALERT_PHASE(EHMS_FLIGHT_PHASE_TAKEOFF), 0x3001, "ENG %d FAN VIB HI" },
+    { EHMS_PARAM_VIB_FAN,  EHMS_ALERT_WARNING,  5.0f, 0.1f, true,
+      ALERT_PHASES_ALL, ALERT_PHASES_NONE, 0x3002, "ENG %d FAN VIB CRIT" },
+    { EHMS_PARAM_VIB_CORE, EHMS_ALERT_CAUTION,  4.0f, 0.08f, true,
+      ALERT_PHASES_ALL, ALERT_PHASE(EHMS_FLIGHT_PHASE_TAKEOFF), 0x3003, "ENG %d CORE VIB HI" },
+    { EHMS_PARAM_VIB_CORE, EHMS_ALERT_WARNING,  6.0f, 0.12f, true,
+      ALERT_PHASES_ALL, ALERT_PHASES_NONE, 0x3004, "ENG %d CORE VIB CRIT" },
     
     /* N1/N2 Limits */
-    { EHMS_PARAM_N1, EHMS_ALERT_WARNING, 104.0f, true, 0x4001, "ENG %d N1 OVERLIMIT" },
-    { EHMS_PARAM_N2, EHMS_ALERT_WARNING, 105.0f, true, 0x4002, "ENG %d N2 OVERLIMIT" },
+    { EHMS_PARAM_N1, EHMS_ALERT_WARNING, 104.0f, 2.08f, true,
+      ALERT_PHASES_ALL, ALERT_PHASES_NONE, 0x4001, "ENG %d N1 OVERLIMIT" },
+    { EHMS_PARAM_N2, EHMS_ALERT_WARNING, 105.0f, 2.1f, true,
+      ALERT_PHASES_ALL, ALERT_PHASES_NONE, 0x4002, "ENG %d N2 OVERLIMIT" },
+    
+    /* Multivariate anomaly score: inhibited during takeoff and landing */
+    { EHMS_PARAM_ANOMALY_SCORE, EHMS_ALERT_ADVISORY, ANOMALY_ADVISORY_SCORE, 0.5f, true,
+      ALERT_PHASES_ALL,
+      ALERT_PHASE(EHMS_FLIGHT_PHASE_TAKEOFF) | ALERT_PHASE(EHMS_FLIGHT_PHASE_LANDING),
+      0x5001, "ENG %d ENGINE TREND" },
 };
 
 #define NUM_THRESHOLDS (sizeof(s_thresholds) / sizeof(s_thresholds[0]))
 
+_Static_assert(NUM_THRESHOLDS <= ALERT_MAX_THRESHOLDS, 
+               "threshold table exceeds ALERT_MAX_THRESHOLDS");
+
+/** @brief Compiled threshold sets, indexed by flight phase then ALERT_PHASE_SET_UNKNOWN */
+static alert_band_table_t s_band_tables[ALERT_PHASE_SET_COUNT];
+
+/** @brief Message text of each threshold, rendered per engine at init */
+static char s_message_text[EHMS_MAX_ENGINES][NUM_THRESHOLDS][ALERT_MESSAGE_LENGTH];
+
+/** @brief s_band_tables and s_message_text have been built (shared by all contexts) */
+static bool s_tables_built;
+
+/** @brief Result of compiling s_band_tables */
+static ehms_result_t s_tables_result;
+
+/* ============================================================================
+ * PRIVATE FUNCTION PROTOTYPES
+ * ============================================================================ */
+
+static ehms_result_t alert_setup_context(alert_context_t* ctx, uint32_t first_consumer);
+static ehms_result_t alert_compile_thresholds(void);
+static ehms_result_t alert_compile_set(uint32_t set, alert_band_table_t* table);
+static bool alert_in_set(const alert_threshold_t* thresh, uint32_t set);
+static alert_value_t alert_to_value(uint32_t param, float value, bool high_limit);
+static uint32_t alert_count_exceeded(const alert_value_t* threshold, uint32_t count,
+                                     alert_value_t value, bool high_limit);
+static void alert_update_band(alert_context_t* ctx, const alert_band_table_t* table,
+                              const ehms_engine_block_t* block, uint32_t param,
+                              uint32_t position, bool valid, bool exceeded);
+static void alert_raise(alert_context_t* ctx, const ehms_engine_block_t* block,
+                        uint32_t threshold_index, bool inhibited);
+static void alert_clear(alert_context_t* ctx, const ehms_engine_block_t* block, uint8_t slot);
+static void alert_release_slot(alert_context_t* ctx, uint8_t slot);
+static void alert_post(alert_context_t* ctx, uint8_t slot);
+static void alert_queue_push(alert_event_queue_t* queue, uint32_t priority,
+                             const alert_record_t* event);
+static uint32_t alert_dispatch(alert_context_t* ctx, uint32_t consumer, uint32_t max_events,
+                               ehms_alert_t* events);
+static void alert_expand(const alert_record_t* record, ehms_alert_t* alert);
+static void alert_queue_init(alert_context_t* ctx);
+static void alert_render_messages(void);
+static void alert_update_summary(alert_context_t* ctx);
+static void alert_gather_block(const ehms_engine_snapshot_t* snapshot,
+                               ehms_engine_block_t* block);
+static ehms_result_t alert_check_batch_engine(ehms_engine_id_t engine_id, uint32_t* seen);
+static const alert_band_table_t* alert_select_table(alert_context_t* ctx,
+                                                    const ehms_engine_block_t* block);
+static void alert_change_phase(alert_context_t* ctx, const ehms_engine_block_t* block,
+                               uint32_t set);
+static uint32_t alert_find_band(const alert_band_table_t* table, uint32_t param,
+                                uint32_t threshold_index);
+static void alert_evaluate_block(alert_context_t* ctx, const alert_band_table_t* table,
+                                 const ehms_engine_block_t* block);
+static void alert_evaluate_batch(alert_context_t* ctx, const ehms_engine_block_t* blocks,
+                                 uint32_t count);
+static void alert_visit_bands(alert_context_t* ctx, const alert_band_table_t* table,
+                              const ehms_engine_block_t* block, uint32_t param,
+                              uint32_t exceeded_mask, bool valid);
+static uint32_t alert_find_threshold(const ehms_alert_t* alert);
+static bool alert_restore_record(alert_context_t* ctx, const ehms_timestamp_t* epoch,
+                                 const ehms_packed_alert_t* packed);
+
 /* ============================================================================
  * PUBLIC FUNCTIONS
  * ============================================================================ */
@@ -97,11 +342,38 @@ static const alert_threshold_t s_thresholds[] =
  */
 ehms_result_t alert_init(void)
 {
-    (void)memset(&s_alert_state, 0, sizeof(s_alert_state));
-    s_alert_state.next_alert_id = 1U;
-    s_alert_state.highest_level = EHMS_ALERT_NONE;
+    return alert_setup_context(&s_alert_state, ALERT_CONSUMER_EICAS);
+}
+
+/**
+ * @brief Get the storage size of an alert context
+ * @return Size in bytes
+ */
+uint32_t alert_context_size(void)
+{
+    return (uint32_t)sizeof(alert_context_t);
+}
+
+/**
+ * @brief Initialize an alert context for recorded data
+ * @param[out] ctx Context storage of alert_context_size() bytes
+ * @return EHMS_OK on success
+ * @trace SRS-EHMS-200
+ */
+ehms_result_t alert_ctx_init(alert_context_t* ctx)
+{
+    ehms_result_t result = EHMS_OK;
     
-    return EHMS_OK;
+    if (ctx == NULL)
+    {
+        result = EHMS_ERROR_PARAM;
+    }
+    else
+    {
+        result = alert_setup_context(ctx, ALERT_CONSUMER_RECORDER);
+    }
+    
+    return result;
 }
 
 /**
@@ -111,98 +383,190 @@ ehms_result_t alert_init(void)
  * @trace SRS-EHMS-200, SRS-EHMS-201
  */
 ehms_result_t alert_process_snapshot(const ehms_engine_snapshot_t* snapshot)
+{
+    return alert_ctx_process_snapshot(&s_alert_state, snapshot);
+}
+
+/**
+ * @brief Process parameters of an alert context and generate alerts
+ * @param[in,out] ctx      Alert context
+ * @param[in]     snapshot Current engine snapshot
+ * @return EHMS_OK on success
+ * @trace SRS-EHMS-200, SRS-EHMS-201
+ */
+ehms_result_t alert_ctx_process_snapshot(alert_context_t* ctx,
+                                         const ehms_engine_snapshot_t* snapshot)
 {
     ehms_result_t result = EHMS_OK;
     
-    if (snapshot == NULL)
+    if ((ctx == NULL) || (snapshot == NULL))
     {
         result = EHMS_ERROR_PARAM;
     }
+    else if (snapshot->engine_id >= EHMS_MAX_ENGINES)
+    {
+        result = EHMS_ERROR_RANGE;
+    }
     else
     {
-        /* Check each threshold */
-        for (uint32_t t = 0U; t < NUM_THRESHOLDS; t++)
+        ehms_engine_block_t block;
+        
+        alert_gather_block(snapshot, &block);
+        alert_evaluate_block(ctx, alert_select_table(ctx, &block), &block);
+        alert_update_summary(ctx);
+    }
+    
+    return result;
+}
+
+/**
+ * @brief Process engine parameter block and generate alerts
+ * @param[in] block Current engine parameter block
+ * @return EHMS_OK on success
+ * @trace SRS-EHMS-200, SRS-EHMS-201
+ */
+ehms_result_t alert_process_block(const ehms_engine_block_t* block)
+{
+    return alert_ctx_process_block(&s_alert_state, block);
+}
+
+/**
+ * @brief Process engine parameter block of an alert context and generate alerts
+ * @param[in,out] ctx   Alert context
+ * @param[in]     block Current engine parameter block
+ * @return EHMS_OK on success
+ * @trace SRS-EHMS-200, SRS-EHMS-201
+ */
+ehms_result_t alert_ctx_process_block(alert_context_t* ctx, const ehms_engine_block_t* block)
+{
+    ehms_result_t result = EHMS_OK;
+    
+    if ((ctx == NULL) || (block == NULL))
+    {
+        result = EHMS_ERROR_PARAM;
+    }
+    else if (block->engine_id >= EHMS_MAX_ENGINES)
+    {
+        result = EHMS_ERROR_RANGE;
+    }
+    else
+    {
+        alert_evaluate_block(ctx, alert_select_table(ctx, block), block);
+        alert_update_summary(ctx);
+    }
+    
+    return result;
+}
+
+/**
+ * @brief Process the snapshots of several engines as one batch
+ * @param[in] snapshots Engine snapshots, one per engine
+ * @param[in] count     Number of snapshots
+ * @return EHMS_OK on success
+ * @trace SRS-EHMS-200, SRS-EHMS-201
+ */
+ehms_result_t alert_process_snapshots(const ehms_engine_snapshot_t* snapshots, uint32_t count)
+{
+    return alert_ctx_process_snapshots(&s_alert_state, snapshots, count);
+}
+
+/**
+ * @brief Process the snapshots of several engines of an alert context as one batch
+ * @param[in,out] ctx       Alert context
+ * @param[in]     snapshots Engine snapshots, one per engine
+ * @param[in]     count     Number of snapshots
+ * @return EHMS_OK on success
+ * @trace SRS-EHMS-200, SRS-EHMS-201
+ */
+ehms_result_t alert_ctx_process_snapshots(alert_context_t* ctx,
+                                          const ehms_engine_snapshot_t* snapshots,
+                                          uint32_t count)
+{
+    ehms_result_t result = EHMS_OK;
+    
+    if ((ctx == NULL) || (snapshots == NULL))
+    {
+        result = EHMS_ERROR_PARAM;
+    }
+    else if (count > EHMS_MAX_ENGINES)
+    {
+        result = EHMS_ERROR_RANGE;
+    }
+    else
+    {
+        uint32_t seen = 0U;
+        
+        for (uint32_t e = 0U; (e < count) && (result == EHMS_OK); e++)
         {
-            const alert_threshold_t* thresh = &s_thresholds[t];
-            const ehms_parameter_t* param = &snapshot->parameters[thresh->param_id];
-            
-            /* Skip invalid parameters */
-            if (param->status != EHMS_PARAM_VALID)
-            {
-                continue;
-            }
-            
-            bool exceeded = false;
-            
-            if (thresh->high_limit)
-            {
-                exceeded = (param->eng_value >= thresh->threshold);
-            }
-            else
-            {
-                exceeded = (param->eng_value <= thresh->threshold);
-            }
-            
-            if (exceeded)
-            {
-                /* Check if alert already active */
-                bool already_active = false;
-                for (uint32_t a = 0U; a < s_alert_state.active_count; a++)
-                {
-                    if ((s_alert_state.alerts[a].param_id == thresh->param_id) &&
-                        (s_alert_state.alerts[a].engine_id == snapshot->engine_id) &&
-                        (s_alert_state.alerts[a].level == thresh->level))
-                    {
-                        already_active = true;
-                        break;
-                    }
-                }
-                
-                if (!already_active && (s_alert_state.active_count < EHMS_MAX_ACTIVE_ALERTS))
-                {
-                    /* Create new alert */
-                    ehms_alert_t* new_alert = &s_alert_state.alerts[s_alert_state.active_count];
-                    
-                    new_alert->alert_id = s_alert_state.next_alert_id++;
-                    new_alert->level = thresh->level;
-                    new_alert->engine_id = snapshot->engine_id;
-                    new_alert->param_id = thresh->param_id;
-                    new_alert->onset_time = snapshot->sample_time;
-                    new_alert->is_active = true;
-                    new_alert->is_latched = (thresh->level >= EHMS_ALERT_WARNING);
-                    new_alert->ecam_code = thresh->ecam_code;
-                    
-                    (void)snprintf(new_alert->message, sizeof(new_alert->message),
-                                  thresh->message, (int)snapshot->engine_id + 1);
-                    
-                    s_alert_state.active_count++;
-                    
-                    /* Update master alerts */
-                    if (thresh->level >= EHMS_ALERT_WARNING)
-                    {
-                        s_alert_state.master_warning = true;
-                    }
-                    else if (thresh->level >= EHMS_ALERT_CAUTION)
-                    {
-                        s_alert_state.master_caution = true;
-                    }
-                    
-                    /* Update highest level */
-                    if (thresh->level > s_alert_state.highest_level)
-                    {
-                        s_alert_state.highest_level = thresh->level;
-                    }
-                    
-                    /* Send to EICAS */
-                    (void)eicas_post_message(new_alert);
-                    
-                    /* Log to flight recorder */
-                    (void)recorder_log_alert(new_alert);
-                }
-            }
+            result = alert_check_batch_engine(snapshots[e].engine_id, &seen);
+        }
+    }
+    
+    if ((result == EHMS_OK) && (count > 0U))
+    {
+        ehms_engine_block_t blocks[EHMS_MAX_ENGINES];
+        
+        for (uint32_t e = 0U; e < count; e++)
+        {
+            alert_gather_block(&snapshots[e], &blocks[e]);
+        }
+        
+        alert_evaluate_batch(ctx, blocks, count);
+        alert_update_summary(ctx);
+    }
+    
+    return result;
+}
+
+/**
+ * @brief Process the parameter blocks of several engines as one batch
+ * @param[in] blocks Engine parameter blocks, one per engine
+ * @param[in] count  Number of blocks
+ * @return EHMS_OK on success
+ * @trace SRS-EHMS-200, SRS-EHMS-201
+ */
+ehms_result_t alert_process_blocks(const ehms_engine_block_t* blocks, uint32_t count)
+{
+    return alert_ctx_process_blocks(&s_alert_state, blocks, count);
+}
+
+/**
+ * @brief Process the parameter blocks of several engines of an alert context as one batch
+ * @param[in,out] ctx    Alert context
+ * @param[in]     blocks Engine parameter blocks, one per engine
+ * @param[in]     count  Number of blocks
+ * @return EHMS_OK on success
+ * @trace SRS-EHMS-200, SRS-EHMS-201
+ */
+ehms_result_t alert_ctx_process_blocks(alert_context_t* ctx, const ehms_engine_block_t* blocks,
+                                       uint32_t count)
+{
+    ehms_result_t result = EHMS_OK;
+    
+    if ((ctx == NULL) || (blocks == NULL))
+    {
+        result = EHMS_ERROR_PARAM;
+    }
+    else if (count > EHMS_MAX_ENGINES)
+    {
+        result = EHMS_ERROR_RANGE;
+    }
+    else
+    {
+        uint32_t seen = 0U;
+        
+        for (uint32_t e = 0U; (e < count) && (result == EHMS_OK); e++)
+        {
+            result = alert_check_batch_engine(blocks[e].engine_id, &seen);
         }
     }
     
+    if ((result == EHMS_OK) && (count > 0U))
+    {
+        alert_evaluate_batch(ctx, blocks, count);
+        alert_update_summary(ctx);
+    }
+    
     return result;
 }
 
@@ -212,7 +576,17 @@ ehms_result_t alert_process_snapshot(const ehms_engine_snapshot_t* snapshot)
  */
 uint32_t alert_get_active_count(void)
 {
-    return s_alert_state.active_count;
+    return alert_ctx_get_active_count(&s_alert_state);
+}
+
+/**
+ * @brief Get active alert count of an alert context
+ * @param[in] ctx Alert context
+ * @return Number of active alerts, 0 if ctx is NULL
+ */
+uint32_t alert_ctx_get_active_count(const alert_context_t* ctx)
+{
+    return (ctx != NULL) ? ctx->active_count : 0U;
 }
 
 /**
@@ -221,7 +595,17 @@ uint32_t alert_get_active_count(void)
  */
 ehms_alert_level_t alert_get_highest_level(void)
 {
-    return s_alert_state.highest_level;
+    return alert_ctx_get_highest_level(&s_alert_state);
+}
+
+/**
+ * @brief Get highest active alert level of an alert context
+ * @param[in] ctx Alert context
+ * @return Highest alert level, EHMS_ALERT_NONE if ctx is NULL
+ */
+ehms_alert_level_t alert_ctx_get_highest_level(const alert_context_t* ctx)
+{
+    return (ctx != NULL) ? ctx->highest_level : EHMS_ALERT_NONE;
 }
 
 /**
@@ -230,7 +614,17 @@ ehms_alert_level_t alert_get_highest_level(void)
  */
 bool alert_is_master_warning(void)
 {
-    return s_alert_state.master_warning;
+    return alert_ctx_is_master_warning(&s_alert_state);
+}
+
+/**
+ * @brief Check master warning status of an alert context
+ * @param[in] ctx Alert context
+ * @return true if master warning active
+ */
+bool alert_ctx_is_master_warning(const alert_context_t* ctx)
+{
+    return (ctx != NULL) && ctx->master_warning;
 }
 
 /**
@@ -239,27 +633,1338 @@ bool alert_is_master_warning(void)
  */
 bool alert_is_master_caution(void)
 {
-    return s_alert_state.master_caution;
+    return alert_ctx_is_master_caution(&s_alert_state);
 }
 
 /**
- * @brief Acknowledge and clear master caution/warning
- * @param[in] level Level to acknowledge
- * @return EHMS_OK on success
- * @trace SRS-EHMS-202
+ * @brief Check master caution status of an alert context
+ * @param[in] ctx Alert context
+ * @return true if master caution active
  */
-ehms_result_t alert_acknowledge(ehms_alert_level_t level)
+bool alert_ctx_is_master_caution(const alert_context_t* ctx)
 {
-    if (level >= EHMS_ALERT_WARNING)
-    {
-        s_alert_state.master_warning = false;
-    }
-    else if (level >= EHMS_ALERT_CAUTION)
+    return (ctx != NULL) && ctx->master_caution;
+}
+
+/**
+ * @brief Get the display text of an alert
+ * @param[in] engine_id Engine the alert was raised for
+ * @param[in] ecam_code ECAM/EICAS code of the alert
+ * @return Message text, or NULL if no threshold has the code
+ * @trace SRS-EHMS-200
+ */
+const char* alert_get_message_text(ehms_engine_id_t engine_id, uint16_t ecam_code)
+{
+    const char* text = NULL;
+    
+    if (engine_id < EHMS_MAX_ENGINES)
     {
-        s_alert_state.master_caution = false;
+        for (uint32_t t = 0U; t < NUM_THRESHOLDS; t++)
+        {
+            if (s_thresholds[t].ecam_code == ecam_code)
+            {
+                text = s_message_text[engine_id][t];
+                break;
+            }
+        }
     }
     
-    return EHMS_OK;
+    return text;
+}
+
+/**
+ * @brief Deliver queued alert events to EICAS
+ * @param[in] max_events Maximum number of events to deliver
+ * @return Number of events delivered
+ * @trace SRS-EHMS-201
+ */
+uint32_t alert_dispatch_eicas(uint32_t max_events)
+{
+    return alert_dispatch(&s_alert_state, ALERT_CONSUMER_EICAS, max_events, NULL);
+}
+
+/**
+ * @brief Deliver queued alert events to the flight recorder
+ * @param[in] max_events Maximum number of events to deliver
+ * @return Number of events delivered
+ * @trace SRS-EHMS-201
+ */
+uint32_t alert_dispatch_recorder(uint32_t max_events)
+{
+    return alert_dispatch(&s_alert_state, ALERT_CONSUMER_RECORDER, max_events, NULL);
+}
+
+/**
+ * @brief Read queued alert events of an alert context
+ * @param[in,out] ctx        Alert context
+ * @param[out]    events     Receives the events
+ * @param[in]     max_events Capacity of events
+ * @return Number of events read
+ * @trace SRS-EHMS-201
+ */
+uint32_t alert_ctx_read_events(alert_context_t* ctx, ehms_alert_t* events, uint32_t max_events)
+{
+    uint32_t count = 0U;
+    
+    if ((ctx != NULL) && (events != NULL))
+    {
+        count = alert_dispatch(ctx, ALERT_CONSUMER_RECORDER, max_events, events);
+    }
+    
+    return count;
+}
+
+/**
+ * @brief Get alert event queue statistics
+ * @param[out] stats Pointer to receive statistics
+ * @return EHMS_OK on success
+ * @trace SRS-EHMS-201
+ */
+ehms_result_t alert_get_queue_statistics(alert_queue_statistics_t* stats)
+{
+    return alert_ctx_get_queue_statistics(&s_alert_state, stats);
+}
+
+/**
+ * @brief Get alert event queue statistics of an alert context
+ * @param[in]  ctx   Alert context
+ * @param[out] stats Pointer to receive statistics
+ * @return EHMS_OK on success
+ * @trace SRS-EHMS-201
+ */
+ehms_result_t alert_ctx_get_queue_statistics(const alert_context_t* ctx,
+                                             alert_queue_statistics_t* stats)
+{
+    ehms_result_t result = EHMS_OK;
+    
+    if ((ctx == NULL) || (stats == NULL))
+    {
+        result = EHMS_ERROR_PARAM;
+    }
+    else
+    {
+        alert_consumer_statistics_t* out[ALERT_CONSUMER_COUNT] = 
+        {
+            &stats->eicas, &stats->recorder
+        };
+        
+        for (uint32_t c = 0U; c < ALERT_CONSUMER_COUNT; c++)
+        {
+            const alert_event_queue_t* queue = &ctx->queue[c];
+            uint32_t pending = 0U;
+            
+            for (uint32_t p = 0U; p < ALERT_PRIORITY_COUNT; p++)
+            {
+                pending += atomic_load_explicit(&queue->ring[p].head, memory_order_acquire) - 
+                           atomic_load_explicit(&queue->ring[p].tail, memory_order_acquire);
+            }
+            
+            out[c]->pending = pending;
+            out[c]->delivered = atomic_load_explicit(&queue->delivered_count, 
+                                                     memory_order_relaxed);
+            out[c]->overflow_count = atomic_load_explicit(&queue->overflow_count, 
+                                                          memory_order_relaxed);
+            out[c]->high_water = atomic_load_explicit(&queue->high_water, 
+                                                      memory_order_relaxed);
+        }
+    }
+    
+    return result;
+}
+
+/**
+ * @brief Acknowledge and clear master caution/warning
+ * @param[in] level Level to acknowledge
+ * @return EHMS_OK on success
+ * @trace SRS-EHMS-202
+ */
+ehms_result_t alert_acknowledge(ehms_alert_level_t level)
+{
+    alert_context_t* ctx = &s_alert_state;
+    
+    if (level >= EHMS_ALERT_WARNING)
+    {
+        ctx->master_warning = false;
+    }
+    else if (level >= EHMS_ALERT_CAUTION)
+    {
+        ctx->master_caution = false;
+    }
+    
+    /* Reset latched alerts whose condition has cleared */
+    for (uint32_t slot = 0U; slot < EHMS_MAX_ACTIVE_ALERTS; slot++)
+    {
+        const alert_record_t* alert = &ctx->alerts[slot];
+        
+        if (((alert->flags & (ALERT_FLAG_ACTIVE | ALERT_FLAG_LATCHED)) == ALERT_FLAG_LATCHED) && 
+            (s_thresholds[alert->threshold].level <= level))
+        {
+            alert_release_slot(ctx, (uint8_t)slot);
+        }
+    }
+    
+    alert_update_summary(ctx);
+    
+    return EHMS_OK;
+}
+
+/**
+ * @brief Save the latched alerts of the onboard context for a warm start
+ * @param[in]  epoch Calendar time at packed time zero
+ * @param[out] state Receives the alert state
+ * @return EHMS_OK on success, EHMS_ERROR_PARAM for a NULL pointer,
+ *         EHMS_ERROR_RANGE if an alert time is outside the packed range
+ * @trace SRS-EHMS-016
+ */
+ehms_result_t alert_save_warm_state(const ehms_timestamp_t* epoch, alert_warm_state_t* state)
+{
+    ehms_result_t result = EHMS_OK;
+    const alert_context_t* ctx = &s_alert_state;
+    
+    if ((epoch == NULL) || (state == NULL))
+    {
+        result = EHMS_ERROR_PARAM;
+    }
+    else
+    {
+        (void)memset(state, 0, sizeof(*state));
+        state->next_alert_id = ctx->next_alert_id;
+        state->master_caution = ctx->master_caution ? 1U : 0U;
+        state->master_warning = ctx->master_warning ? 1U : 0U;
+        
+        for (uint32_t eng = 0U; eng < EHMS_MAX_ENGINES; eng++)
+        {
+            state->phase_set[eng] = (uint8_t)ctx->phase_set[eng];
+        }
+        
+        for (uint32_t slot = 0U; slot < EHMS_MAX_ACTIVE_ALERTS; slot++)
+        {
+            const alert_record_t* record = &ctx->alerts[slot];
+            ehms_packed_alert_t* packed = &state->alerts[state->alert_count];
+            ehms_alert_t alert;
+            
+            if ((record->flags & ALERT_FLAG_LATCHED) == 0U)
+            {
+                continue;
+            }
+            
+            alert_expand(record, &alert);
+            
+            if (ehms_pack_alert(&alert, epoch, packed) == EHMS_OK)
+            {
+                state->alert_count++;
+            }
+            else
+            {
+                (void)memset(packed, 0, sizeof(*packed));
+                result = EHMS_ERROR_RANGE;
+            }
+        }
+    }
+    
+    return result;
+}
+
+/**
+ * @brief Restore the latched alerts saved by alert_save_warm_state
+ * @param[in] epoch Calendar time at packed time zero, as saved
+ * @param[in] state Saved alert state
+ * @return EHMS_OK on success, EHMS_ERROR_PARAM for a NULL pointer,
+ *         EHMS_ERROR_BUSY if alerts have already been raised,
+ *         EHMS_ERROR_RANGE for an invalid state or an unmatched alert
+ * @trace SRS-EHMS-016
+ */
+ehms_result_t alert_restore_warm_state(const ehms_timestamp_t* epoch,
+                                       const alert_warm_state_t* state)
+{
+    ehms_result_t result = EHMS_OK;
+    alert_context_t* ctx = &s_alert_state;
+    
+    if ((epoch == NULL) || (state == NULL))
+    {
+        result = EHMS_ERROR_PARAM;
+    }
+    else if (ctx->active_count > 0U)
+    {
+        result = EHMS_ERROR_BUSY;
+    }
+    else if ((state->alert_count > EHMS_MAX_ACTIVE_ALERTS) ||
+             (state->master_caution > 1U) || (state->master_warning > 1U))
+    {
+        result = EHMS_ERROR_RANGE;
+    }
+    else
+    {
+        for (uint32_t eng = 0U; eng < EHMS_MAX_ENGINES; eng++)
+        {
+            if ((uint32_t)state->phase_set[eng] >= ALERT_PHASE_SET_COUNT)
+            {
+                result = EHMS_ERROR_RANGE;
+            }
+        }
+    }
+    
+    if (result == EHMS_OK)
+    {
+        /* Band positions depend on the threshold set */
+        for (uint32_t eng = 0U; eng < EHMS_MAX_ENGINES; eng++)
+        {
+            ctx->phase_set[eng] = (uint32_t)state->phase_set[eng];
+            ctx->table[eng] = &s_band_tables[state->phase_set[eng]];
+        }
+        
+        for (uint32_t i = 0U; i < state->alert_count; i++)
+        {
+            if (!alert_restore_record(ctx, epoch, &state->alerts[i]))
+            {
+                result = EHMS_ERROR_RANGE;
+            }
+        }
+        
+        ctx->next_alert_id = state->next_alert_id;
+        ctx->master_caution = (state->master_caution != 0U);
+        ctx->master_warning = (state->master_warning != 0U);
+        alert_update_summary(ctx);
+    }
+    
+    return result;
+}
+
+/* ============================================================================
+ * PRIVATE FUNCTIONS
+ * ============================================================================ */
+
+/**
+ * @brief Clear an alert context
+ *
+ * The first context initialized also renders the message text and
+ * compiles the threshold sets, which every context then shares.
+ *
+ * @param[out] ctx            Alert context
+ * @param[in]  first_consumer ALERT_CONSUMER_EICAS, or ALERT_CONSUMER_RECORDER
+ *                            for a context without EICAS
+ * @return EHMS_OK, or the result of compiling the threshold sets
+ */
+static ehms_result_t alert_setup_context(alert_context_t* ctx, uint32_t first_consumer)
+{
+    (void)memset(ctx, 0, sizeof(*ctx));
+    ctx->next_alert_id = 1U;
+    ctx->highest_level = EHMS_ALERT_NONE;
+    ctx->first_consumer = first_consumer;
+    (void)memset(ctx->active_slot, (int)ALERT_NO_SLOT, sizeof(ctx->active_slot));
+    
+    /* All slots free; lowest slot index is allocated first */
+    for (uint32_t i = 0U; i < EHMS_MAX_ACTIVE_ALERTS; i++)
+    {
+        ctx->free_slots[i] = (uint8_t)(EHMS_MAX_ACTIVE_ALERTS - 1U - i);
+    }
+    ctx->free_count = EHMS_MAX_ACTIVE_ALERTS;
+    
+    alert_queue_init(ctx);
+    
+    if (!s_tables_built)
+    {
+        alert_render_messages();
+        s_tables_result = alert_compile_thresholds();
+        s_tables_built = true;
+    }
+    
+    /* Engines start on the ground set */
+    for (uint32_t eng = 0U; eng < EHMS_MAX_ENGINES; eng++)
+    {
+        ctx->phase_set[eng] = (uint32_t)EHMS_FLIGHT_PHASE_GROUND;
+        ctx->table[eng] = &s_band_tables[EHMS_FLIGHT_PHASE_GROUND];
+    }
+    
+    return s_tables_result;
+}
+
+/**
+ * @brief Compile s_thresholds into one band table per threshold set
+ *
+ * @return EHMS_OK on success, EHMS_ERROR_CONFIG if a parameter has more
+ *         than ALERT_MAX_BANDS_PER_PARAM thresholds in a set
+ */
+static ehms_result_t alert_compile_thresholds(void)
+{
+    ehms_result_t result = EHMS_OK;
+    
+    for (uint32_t set = 0U; set < ALERT_PHASE_SET_COUNT; set++)
+    {
+        if (alert_compile_set(set, &s_band_tables[set]) != EHMS_OK)
+        {
+            result = EHMS_ERROR_CONFIG;
+        }
+    }
+    
+    return result;
+}
+
+/**
+ * @brief Compile the thresholds of one set into per-parameter sorted band lists
+ *
+ * Parameters are evaluated in order of their first threshold table entry
+ * in the set, so alerts raised by one block are created in table order.
+ * Clear levels and inhibit masks are resolved here, so evaluation in a
+ * phase reads nothing but its own table.
+ *
+ * @param[in]  set   Flight phase, or ALERT_PHASE_SET_UNKNOWN
+ * @param[out] table Receives the compiled table
+ * @return EHMS_OK on success, EHMS_ERROR_CONFIG if a parameter has more
+ *         than ALERT_MAX_BANDS_PER_PARAM thresholds
+ */
+static ehms_result_t alert_compile_set(uint32_t set, alert_band_table_t* table)
+{
+    ehms_result_t result = EHMS_OK;
+    uint16_t next = 0U;
+    
+    (void)memset(table, 0, sizeof(*table));
+    
+    for (uint32_t t = 0U; t < NUM_THRESHOLDS; t++)
+    {
+        uint32_t p = (uint32_t)s_thresholds[t].param_id;
+        alert_param_bands_t* bands = &table->param[p];
+        
+        /* Compile each parameter at its first table entry in the set */
+        if (((bands->high_count + bands->low_count) > 0U) || 
+            !alert_in_set(&s_thresholds[t], set))
+        {
+            continue;
+        }
+        
+        table->params[table->param_count] = (uint8_t)p;
+        table->param_count++;
+        
+        for (uint32_t direction = 0U; direction < 2U; direction++)
+        {
+            bool high_limit = (direction == 0U);
+            uint16_t first = next;
+            
+            /* Insertion sort keeps table order between equal thresholds */
+            for (uint32_t u = t; u < NUM_THRESHOLDS; u++)
+            {
+                if ((s_thresholds[u].param_id != (ehms_param_id_t)p) || 
+                    (s_thresholds[u].high_limit != high_limit) ||
+                    !alert_in_set(&s_thresholds[u], set))
+                {
+                    continue;
+                }
+                
+                float eng_threshold = s_thresholds[u].threshold;
+                float hysteresis = s_thresholds[u].hysteresis;
+                alert_value_t threshold = alert_to_value(p, eng_threshold, high_limit);
+                uint16_t i = next;
+                
+                while ((i > first) && 
+                       (high_limit ? (table->threshold[i - 1U] > threshold) : 
+                                     (table->threshold[i - 1U] < threshold)))
+                {
+                    table->threshold[i] = table->threshold[i - 1U];
+                    table->clear_threshold[i] = table->clear_threshold[i - 1U];
+                    table->band[i] = table->band[i - 1U];
+                    i--;
+                }
+                
+                /* Clear level lies inside the threshold by the hysteresis */
+                table->threshold[i] = threshold;
+                table->clear_threshold[i] = 
+                    alert_to_value(p, high_limit ? (eng_threshold - hysteresis) : 
+                                                   (eng_threshold + hysteresis), high_limit);
+                table->band[i] = (uint16_t)u;
+                next++;
+            }
+            
+            if (high_limit)
+            {
+                bands->high_first = first;
+                bands->high_count = (uint16_t)(next - first);
+            }
+            else
+            {
+                bands->low_first = first;
+                bands->low_count = (uint16_t)(next - first);
+            }
+        }
+        
+        if ((uint32_t)(bands->high_count + bands->low_count) > ALERT_MAX_BANDS_PER_PARAM)
+        {
+            result = EHMS_ERROR_CONFIG;
+        }
+        else if (set != ALERT_PHASE_SET_UNKNOWN)
+        {
+            for (uint32_t b = 0U; b < (uint32_t)(bands->high_count + bands->low_count); b++)
+            {
+                uint32_t u = table->band[bands->high_first + b];
+                
+                if ((s_thresholds[u].inhibit_phases & ALERT_PHASE(set)) != 0U)
+                {
+                    table->inhibit[p] |= 1UL << b;
+                }
+            }
+        }
+    }
+    
+    return result;
+}
+
+/**
+ * @brief Check whether a threshold belongs to a set
+ *
+ * The unknown-phase set holds every band of every phase, none inhibited,
+ * so a flight phase outside ehms_flight_phase_t never hides an exceedance.
+ */
+static bool alert_in_set(const alert_threshold_t* thresh, uint32_t set)
+{
+    return (set == ALERT_PHASE_SET_UNKNOWN) ? (thresh->phases != ALERT_PHASES_NONE) : 
+                                              ((thresh->phases & ALERT_PHASE(set)) != 0U);
+}
+
+/**
+ * @brief Convert an engineering threshold to the comparison operand
+ *
+ * High-limit thresholds compare value >= threshold and clear on
+ * value < clear level, low-limit thresholds the reverse. In raw units the
+ * high-limit levels round up and the low-limit levels round down, so
+ * integer comparisons select exactly the raw values the engineering
+ * comparisons would.
+ */
+static alert_value_t alert_to_value(uint32_t param, float value, bool high_limit)
+{
+#if defined(EHMS_FIXED_POINT_PIPELINE)
+    return high_limit ? ehms_raw_ceil((ehms_param_id_t)param, value) : 
+                        ehms_raw_floor((ehms_param_id_t)param, value);
+#else
+    (void)param;
+    (void)high_limit;
+    return value;
+#endif
+}
+
+/**
+ * @brief Count the bands of a sorted list that a value exceeds
+ *
+ * Binary search for the end of the exceeded prefix. NaN exceeds no band.
+ */
+static uint32_t alert_count_exceeded(const alert_value_t* threshold,
+                                     uint32_t count,
+                                     alert_value_t value,
+                                     bool high_limit)
+{
+    uint32_t low = 0U;
+    uint32_t high = count;
+    
+    while (low < high)
+    {
+        uint32_t mid = low + ((high - low) / 2U);
+        bool exceeded = high_limit ? (value >= threshold[mid]) : (value <= threshold[mid]);
+        
+        if (exceeded)
+        {
+            low = mid + 1U;
+        }
+        else
+        {
+            high = mid;
+        }
+    }
+    
+    return low;
+}
+
+/**
+ * @brief Get the threshold set of a block's flight phase
+ *
+ * The phase is the one acquisition latched for the cycle, from
+ * daq_set_flight_phase in flight or from the recording on the ground.
+ * The set is switched when the engine's flight phase changes; otherwise
+ * this is one comparison.
+ *
+ * @param[in,out] ctx Alert context
+ * @param[in] block Engine parameter block
+ * @return Compiled band table to evaluate the block against
+ * @trace SRS-EHMS-202
+ */
+static const alert_band_table_t* alert_select_table(alert_context_t* ctx,
+                                                    const ehms_engine_block_t* block)
+{
+    uint32_t set = (block->flight_phase < (uint32_t)EHMS_FLIGHT_PHASE_COUNT) ? 
+                   block->flight_phase : ALERT_PHASE_SET_UNKNOWN;
+    
+    if (set != ctx->phase_set[block->engine_id])
+    {
+        alert_change_phase(ctx, block, set);
+    }
+    
+    return ctx->table[block->engine_id];
+}
+
+/**
+ * @brief Switch an engine to the threshold set of a new flight phase
+ *
+ * Band positions differ between sets, so onset and clear debounces
+ * restart and the tracking mask is rebuilt from the engine's alerts.
+ * Active alerts whose band is not in the new set are cleared. Alerts
+ * whose inhibit ends are posted to EICAS; an alert already displayed is
+ * not withdrawn when its band becomes inhibited.
+ *
+ * @param[in,out] ctx Alert context
+ * @param[in] block Engine parameter block in the new phase
+ * @param[in] set   New threshold set
+ * @trace SRS-EHMS-202
+ */
+static void alert_change_phase(alert_context_t* ctx, const ehms_engine_block_t* block,
+                               uint32_t set)
+{
+    uint32_t eng = (uint32_t)block->engine_id;
+    const alert_band_table_t* table = &s_band_tables[set];
+    
+    (void)memset(ctx->debounce[eng], 0, sizeof(ctx->debounce[eng]));
+    (void)memset(ctx->tracked[eng], 0, sizeof(ctx->tracked[eng]));
+    
+    for (uint32_t slot = 0U; slot < EHMS_MAX_ACTIVE_ALERTS; slot++)
+    {
+        alert_record_t* alert = &ctx->alerts[slot];
+        
+        if ((alert->flags == 0U) || ((uint32_t)alert->engine_id != eng))
+        {
+            continue;
+        }
+        
+        const alert_threshold_t* thresh = &s_thresholds[alert->threshold];
+        uint32_t param = (uint32_t)thresh->param_id;
+        uint32_t b = alert_find_band(table, param, alert->threshold);
+        
+        if (b >= ALERT_MAX_BANDS_PER_PARAM)
+        {
+            if ((alert->flags & ALERT_FLAG_ACTIVE) != 0U)
+            {
+                alert_clear(ctx, block, (uint8_t)slot);
+            }
+        }
+        else
+        {
+            ctx->tracked[eng][param] |= 1UL << b;
+            
+            if (((alert->flags & ALERT_FLAG_INHIBITED) != 0U) && 
+                ((table->inhibit[param] & (1UL << b)) == 0U))
+            {
+                alert->flags &= (uint8_t)~ALERT_FLAG_INHIBITED;
+                
+                if ((alert->flags & ALERT_FLAG_ACTIVE) != 0U)
+                {
+                    ctx->raised_levels |= 1UL << (uint32_t)thresh->level;
+                    
+                    if (ctx->first_consumer == ALERT_CONSUMER_EICAS)
+                    {
+                        alert_queue_push(&ctx->queue[ALERT_CONSUMER_EICAS], 
+                                         (uint32_t)thresh->level - (uint32_t)EHMS_ALERT_STATUS, 
+                                         alert);
+                    }
+                }
+            }
+        }
+    }
+    
+    ctx->phase_set[eng] = set;
+    ctx->table[eng] = table;
+}
+
+/**
+ * @brief Find the band of a threshold in a compiled table
+ * @return Band position relative to high_first, or ALERT_MAX_BANDS_PER_PARAM
+ *         if the threshold is not in the table
+ */
+static uint32_t alert_find_band(const alert_band_table_t* table, uint32_t param,
+                                uint32_t threshold_index)
+{
+    const alert_param_bands_t* bands = &table->param[param];
+    uint32_t position = ALERT_MAX_BANDS_PER_PARAM;
+    
+    for (uint32_t b = 0U; b < (uint32_t)(bands->high_count + bands->low_count); b++)
+    {
+        if (table->band[bands->high_first + b] == (uint16_t)threshold_index)
+        {
+            position = b;
+            break;
+        }
+    }
+    
+    return position;
+}
+
+/**
+ * @brief Evaluate thresholds against an engine parameter block
+ *
+ * Only bands that are exceeded, debouncing or active are visited, so the
+ * cost per parameter is one binary search per limit direction plus the
+ * bands currently in play.
+ *
+ * @param[in,out] ctx Alert context
+ * @param[in] table Threshold set of the block's flight phase
+ * @param[in] block Engine parameter block (eng_value, status and header)
+ * @trace SRS-EHMS-200, SRS-EHMS-201
+ */
+static void alert_evaluate_block(alert_context_t* ctx, const alert_band_table_t* table,
+                                 const ehms_engine_block_t* block)
+{
+    /* Check each parameter that has threshold bands */
+    for (uint32_t i = 0U; i < table->param_count; i++)
+    {
+        uint32_t p = table->params[i];
+        const alert_param_bands_t* bands = &table->param[p];
+        alert_value_t value = ALERT_BLOCK_VALUE(block, p);
+        uint32_t exceeded_mask = 0U;
+        bool valid = (block->status[p] == (uint8_t)EHMS_PARAM_VALID);
+        
+        if (valid)
+        {
+            uint32_t high = alert_count_exceeded(&table->threshold[bands->high_first],
+                                                 bands->high_count, value, true);
+            uint32_t low = alert_count_exceeded(&table->threshold[bands->low_first],
+                                                bands->low_count, value, false);
+            
+            exceeded_mask = (uint32_t)((1ULL << high) - 1ULL) | 
+                            ((uint32_t)((1ULL << low) - 1ULL) << bands->high_count);
+        }
+        
+        alert_visit_bands(ctx, table, block, p, exceeded_mask, valid);
+    }
+}
+
+/**
+ * @brief Evaluate thresholds against the parameter blocks of several engines
+ *
+ * Each parameter is gathered across the engines of the batch and every
+ * band threshold is compared against all engines at once in a branch-free
+ * loop the compiler can vectorize. With few bands per parameter this is
+ * cheaper than one binary search per engine. Engines in different flight
+ * phases have different threshold sets and are evaluated one at a time.
+ *
+ * @param[in,out] ctx Alert context
+ * @param[in] blocks Engine parameter blocks, distinct engines
+ * @param[in] count  Number of blocks (1..EHMS_MAX_ENGINES)
+ * @trace SRS-EHMS-200, SRS-EHMS-201
+ */
+static void alert_evaluate_batch(alert_context_t* ctx, const ehms_engine_block_t* blocks,
+                                 uint32_t count)
+{
+    const alert_band_table_t* tables[EHMS_MAX_ENGINES] = { NULL };
+    bool shared = true;
+    
+    for (uint32_t e = 0U; e < count; e++)
+    {
+        tables[e] = alert_select_table(ctx, &blocks[e]);
+        shared = shared && (tables[e] == tables[0]);
+    }
+    
+    const alert_band_table_t* table = tables[0];
+    
+    for (uint32_t e = 0U; (e < count) && !shared; e++)
+    {
+        alert_evaluate_block(ctx, tables[e], &blocks[e]);
+    }
+    
+    for (uint32_t i = 0U; (i < table->param_count) && shared; i++)
+    {
+        uint32_t p = table->params[i];
+        const alert_param_bands_t* bands = &table->param[p];
+        alert_value_t value[EHMS_MAX_ENGINES];
+        uint32_t valid_mask[EHMS_MAX_ENGINES];
+        uint32_t exceeded_mask[EHMS_MAX_ENGINES];
+        
+        for (uint32_t e = 0U; e < count; e++)
+        {
+            value[e] = ALERT_BLOCK_VALUE(&blocks[e], p);
+            valid_mask[e] = 0U - (uint32_t)(blocks[e].status[p] == (uint8_t)EHMS_PARAM_VALID);
+            exceeded_mask[e] = 0U;
+        }
+        
+        for (uint32_t b = 0U; b < bands->high_count; b++)
+        {
+            alert_value_t threshold = table->threshold[bands->high_first + b];
+            
+            for (uint32_t e = 0U; e < count; e++)
+            {
+                exceeded_mask[e] |= (uint32_t)(value[e] >= threshold) << b;
+            }
+        }
+        
+        for (uint32_t b = 0U; b < bands->low_count; b++)
+        {
+            alert_value_t threshold = table->threshold[bands->low_first + b];
+            uint32_t bit = bands->high_count + b;
+            
+            for (uint32_t e = 0U; e < count; e++)
+            {
+                exceeded_mask[e] |= (uint32_t)(value[e] <= threshold) << bit;
+            }
+        }
+        
+        for (uint32_t e = 0U; e < count; e++)
+        {
+            alert_visit_bands(ctx, table, &blocks[e], p, exceeded_mask[e] & valid_mask[e], 
+                              valid_mask[e] != 0U);
+        }
+    }
+}
+
+/**
+ * @brief Visit exceeded bands and bands already debouncing or active
+ * @param[in,out] ctx       Alert context
+ * @param[in] table         Threshold set of the block's flight phase
+ * @param[in] block         Engine parameter block
+ * @param[in] param         Parameter
+ * @param[in] exceeded_mask Exceeded bands, bit per position from high_first
+ * @param[in] valid         Parameter status is valid
+ */
+static void alert_visit_bands(alert_context_t* ctx, const alert_band_table_t* table,
+                              const ehms_engine_block_t* block,
+                              uint32_t param,
+                              uint32_t exceeded_mask,
+                              bool valid)
+{
+    uint32_t first = table->param[param].high_first;
+    uint32_t work = exceeded_mask | ctx->tracked[block->engine_id][param];
+    
+    while (work != 0U)
+    {
+        uint32_t b = (uint32_t)__builtin_ctz(work);
+        
+        work &= work - 1U;
+        
+        alert_update_band(ctx, table, block, param, first + b, valid, 
+                          ((exceeded_mask >> b) & 1U) != 0U);
+    }
+}
+
+/**
+ * @brief Advance onset or clear debounce of one band
+ *
+ * An alert is raised once its threshold has been exceeded for
+ * ALERT_DEBOUNCE_CYCLES consecutive evaluations, and cleared once the value
+ * has been back inside the threshold by the band's hysteresis for as many
+ * evaluations. Invalid data restarts both debounces; active alerts hold
+ * until valid data clears them.
+ *
+ * @param[in,out] ctx   Alert context
+ * @param[in] table     Threshold set of the block's flight phase
+ * @param[in] block     Engine parameter block
+ * @param[in] param     Parameter of the band
+ * @param[in] position  Band position in the compiled band table
+ * @param[in] valid     Parameter status is valid
+ * @param[in] exceeded  Band threshold is exceeded by the parameter value
+ * @trace SRS-EHMS-200
+ */
+static void alert_update_band(alert_context_t* ctx, const alert_band_table_t* table,
+                              const ehms_engine_block_t* block,
+                              uint32_t param,
+                              uint32_t position,
+                              bool valid,
+                              bool exceeded)
+{
+    alert_value_t value = ALERT_BLOCK_VALUE(block, param);
+    uint32_t t = table->band[position];
+    const alert_threshold_t* thresh = &s_thresholds[t];
+    uint32_t bit = 1UL << (position - table->param[param].high_first);
+    uint8_t* debounce = &ctx->debounce[block->engine_id][position];
+    uint8_t slot = ctx->active_slot[block->engine_id][param][thresh->level];
+    
+    if ((slot == ALERT_NO_SLOT) || (ctx->alerts[slot].threshold != (uint16_t)t))
+    {
+        /* Onset debounce */
+        if (exceeded && (slot == ALERT_NO_SLOT))
+        {
+            (*debounce)++;
+            ctx->tracked[block->engine_id][param] |= bit;
+            
+            if (*debounce >= ALERT_DEBOUNCE_CYCLES)
+            {
+                *debounce = 0U;
+                alert_raise(ctx, block, t, (table->inhibit[param] & bit) != 0U);
+            }
+        }
+        else
+        {
+            *debounce = 0U;
+            ctx->tracked[block->engine_id][param] &= ~bit;
+        }
+    }
+    else if ((ctx->alerts[slot].flags & ALERT_FLAG_ACTIVE) == 0U)
+    {
+        /* Latched alert awaiting acknowledgement */
+        *debounce = 0U;
+        if (exceeded)
+        {
+            alert_record_t* alert = &ctx->alerts[slot];
+            
+            alert->flags |= ALERT_FLAG_ACTIVE;
+            (void)memset(&alert->clear_time, 0, sizeof(alert->clear_time));
+            if ((alert->flags & ALERT_FLAG_INHIBITED) == 0U)
+            {
+                ctx->raised_levels |= 1UL << (uint32_t)thresh->level;
+            }
+            
+            alert_post(ctx, slot);
+        }
+    }
+    else
+    {
+        /* Clear debounce with hysteresis */
+        bool cleared = valid && 
+                       (thresh->high_limit ? (value < table->clear_threshold[position]) : 
+                                             (value > table->clear_threshold[position]));
+        
+        if (cleared)
+        {
+            (*debounce)++;
+            
+            if (*debounce >= ALERT_DEBOUNCE_CYCLES)
+            {
+                *debounce = 0U;
+                alert_clear(ctx, block, slot);
+            }
+        }
+        else
+        {
+            *debounce = 0U;
+        }
+    }
+}
+
+/**
+ * @brief Create the alert for a debounced threshold exceedance
+ * @param[in,out] ctx         Alert context
+ * @param[in] block           Engine parameter block that exceeded the threshold
+ * @param[in] threshold_index Exceeded s_thresholds entry
+ * @param[in] inhibited       Band is inhibited in the engine's flight phase
+ * @trace SRS-EHMS-200, SRS-EHMS-201, SRS-EHMS-202
+ */
+static void alert_raise(alert_context_t* ctx, const ehms_engine_block_t* block,
+                        uint32_t threshold_index, bool inhibited)
+{
+    const alert_threshold_t* thresh = &s_thresholds[threshold_index];
+    
+    if (ctx->free_count > 0U)
+    {
+        /* Create new alert in a free slot */
+        ctx->free_count--;
+        uint8_t slot = ctx->free_slots[ctx->free_count];
+        alert_record_t* new_alert = &ctx->alerts[slot];
+        
+        new_alert->alert_id = ctx->next_alert_id++;
+        new_alert->onset_time = block->sample_time;
+        (void)memset(&new_alert->clear_time, 0, sizeof(new_alert->clear_time));
+        new_alert->threshold = (uint16_t)threshold_index;
+        new_alert->engine_id = (uint8_t)block->engine_id;
+        new_alert->flags = ALERT_FLAG_ACTIVE;
+        if (thresh->level >= EHMS_ALERT_WARNING)
+        {
+            new_alert->flags |= ALERT_FLAG_LATCHED;
+        }
+        if (inhibited)
+        {
+            new_alert->flags |= ALERT_FLAG_INHIBITED;
+        }
+        else
+        {
+            ctx->raised_levels |= 1UL << (uint32_t)thresh->level;
+        }
+        
+        ctx->active_slot[block->engine_id][thresh->param_id][thresh->level] = slot;
+        ctx->level_count[thresh->level]++;
+        ctx->active_count++;
+        
+        /* Queue for EICAS and flight recorder */
+        alert_post(ctx, slot);
+    }
+}
+
+/**
+ * @brief Clear an active alert whose condition has cleared
+ *
+ * The clear is posted to EICAS and logged. Non-latched alerts release
+ * their slot; latched alerts stay displayed until acknowledged.
+ *
+ * @param[in,out] ctx Alert context
+ * @param[in] block Engine parameter block that cleared the condition
+ * @param[in] slot  Alert slot
+ * @trace SRS-EHMS-200, SRS-EHMS-203
+ */
+static void alert_clear(alert_context_t* ctx, const ehms_engine_block_t* block, uint8_t slot)
+{
+    alert_record_t* alert = &ctx->alerts[slot];
+    
+    alert->flags &= (uint8_t)~ALERT_FLAG_ACTIVE;
+    alert->clear_time = block->sample_time;
+    
+    alert_post(ctx, slot);
+    
+    if ((alert->flags & ALERT_FLAG_LATCHED) == 0U)
+    {
+        alert_release_slot(ctx, slot);
+    }
+}
+
+/**
+ * @brief Return an alert slot to the free list
+ */
+static void alert_release_slot(alert_context_t* ctx, uint8_t slot)
+{
+    alert_record_t* alert = &ctx->alerts[slot];
+    const alert_threshold_t* thresh = &s_thresholds[alert->threshold];
+    
+    ctx->active_slot[alert->engine_id][thresh->param_id][thresh->level] = ALERT_NO_SLOT;
+    ctx->level_count[thresh->level]--;
+    ctx->active_count--;
+    ctx->free_slots[ctx->free_count] = slot;
+    ctx->free_count++;
+    
+    /* Mark the slot unused for alert_acknowledge */
+    alert->flags = 0U;
+}
+
+/**
+ * @brief Find the threshold an alert was raised by
+ * @return s_thresholds index, or NUM_THRESHOLDS if no threshold matches
+ */
+static uint32_t alert_find_threshold(const ehms_alert_t* alert)
+{
+    uint32_t found = NUM_THRESHOLDS;
+    
+    for (uint32_t t = 0U; t < NUM_THRESHOLDS; t++)
+    {
+        if ((s_thresholds[t].param_id == alert->param_id) &&
+            (s_thresholds[t].level == alert->level) &&
+            (s_thresholds[t].ecam_code == alert->ecam_code))
+        {
+            found = t;
+            break;
+        }
+    }
+    
+    return found;
+}
+
+/**
+ * @brief Restore one saved latched alert into a free slot
+ *
+ * An active alert resumes its clear debounce in the engine's threshold
+ * set; an alert awaiting acknowledgement may belong to a band of another
+ * set and is then not tracked, as after alert_change_phase.
+ *
+ * @param[in,out] ctx    Alert context
+ * @param[in]     epoch  Calendar time at packed time zero
+ * @param[in]     packed Saved alert
+ * @return true if the alert was restored
+ * @trace SRS-EHMS-016
+ */
+static bool alert_restore_record(alert_context_t* ctx, const ehms_timestamp_t* epoch,
+                                 const ehms_packed_alert_t* packed)
+{
+    ehms_alert_t alert;
+    uint32_t t = NUM_THRESHOLDS;
+    uint32_t b = ALERT_MAX_BANDS_PER_PARAM;
+    bool restored = false;
+    
+    if ((ehms_unpack_alert(packed, epoch, NULL, &alert) == EHMS_OK) &&
+        ((uint32_t)alert.engine_id < EHMS_MAX_ENGINES) && alert.is_latched)
+    {
+        t = alert_find_threshold(&alert);
+    }
+    
+    if (t < NUM_THRESHOLDS)
+    {
+        b = alert_find_band(ctx->table[alert.engine_id], (uint32_t)alert.param_id, t);
+    }
+    
+    if ((t < NUM_THRESHOLDS) && ((b < ALERT_MAX_BANDS_PER_PARAM) || !alert.is_active) &&
+        (ctx->free_count > 0U) &&
+        (ctx->active_slot[alert.engine_id][alert.param_id][alert.level] == ALERT_NO_SLOT))
+    {
+        ctx->free_count--;
+        uint8_t slot = ctx->free_slots[ctx->free_count];
+        alert_record_t* record = &ctx->alerts[slot];
+        
+        record->alert_id = alert.alert_id;
+        record->onset_time = alert.onset_time;
+        record->clear_time = alert.clear_time;
+        record->threshold = (uint16_t)t;
+        record->engine_id = (uint8_t)alert.engine_id;
+        record->flags = ALERT_FLAG_LATCHED;
+        if (alert.is_active)
+        {
+            record->flags |= ALERT_FLAG_ACTIVE;
+        }
+        if (alert.is_inhibited)
+        {
+            record->flags |= ALERT_FLAG_INHIBITED;
+        }
+        if (b < ALERT_MAX_BANDS_PER_PARAM)
+        {
+            ctx->tracked[alert.engine_id][alert.param_id] |= 1UL << b;
+        }
+        
+        ctx->active_slot[alert.engine_id][alert.param_id][alert.level] = slot;
+        ctx->level_count[alert.level]++;
+        ctx->active_count++;
+        
+        /* The recorder logged the alert before the interruption; EICAS shows it again */
+        if (!alert.is_inhibited && (ctx->first_consumer == ALERT_CONSUMER_EICAS))
+        {
+            alert_queue_push(&ctx->queue[ALERT_CONSUMER_EICAS],
+                             (uint32_t)alert.level - (uint32_t)EHMS_ALERT_STATUS, record);
+        }
+        
+        restored = true;
+    }
+    
+    return restored;
+}
+
+/**
+ * @brief Gather the fields used by threshold evaluation from a snapshot
+ */
+static void alert_gather_block(const ehms_engine_snapshot_t* snapshot,
+                               ehms_engine_block_t* block)
+{
+    block->engine_id = snapshot->engine_id;
+    block->sample_time = snapshot->sample_time;
+    block->flight_phase = snapshot->flight_phase;
+    
+    for (uint32_t p = 0U; p < EHMS_PARAM_COUNT; p++)
+    {
+        block->eng_value[p] = snapshot->parameters[p].eng_value;
+        block->raw_value[p] = snapshot->parameters[p].raw_value;
+        block->status[p] = (uint8_t)snapshot->parameters[p].status;
+    }
+}
+
+/**
+ * @brief Check the engine identifier of one batch entry
+ *
+ * A batch holds at most one entry per engine, so every debounce advances
+ * at most once per batch.
+ *
+ * @param[in]     engine_id Engine identifier of the entry
+ * @param[in,out] seen      Engines of the preceding entries
+ * @return EHMS_OK, EHMS_ERROR_RANGE for an invalid engine, EHMS_ERROR_PARAM
+ *         for a repeated engine
+ */
+static ehms_result_t alert_check_batch_engine(ehms_engine_id_t engine_id, uint32_t* seen)
+{
+    ehms_result_t result = EHMS_OK;
+    
+    if (engine_id >= EHMS_MAX_ENGINES)
+    {
+        result = EHMS_ERROR_RANGE;
+    }
+    else if ((*seen & (1UL << (uint32_t)engine_id)) != 0U)
+    {
+        result = EHMS_ERROR_PARAM;
+    }
+    else
+    {
+        *seen |= 1UL << (uint32_t)engine_id;
+    }
+    
+    return result;
+}
+
+/**
+ * @brief Queue an alert event for EICAS and the flight recorder
+ *
+ * The event is a copy of the record at the time of the state change, so
+ * the slot may be released or reused before the event is delivered.
+ * Events of inhibited alerts, and all events of a context without EICAS,
+ * are only logged.
+ */
+static void alert_post(alert_context_t* ctx, uint8_t slot)
+{
+    const alert_record_t* record = &ctx->alerts[slot];
+    uint32_t priority = (uint32_t)s_thresholds[record->threshold].level - 
+                        (uint32_t)EHMS_ALERT_STATUS;
+    uint32_t first = ((record->flags & ALERT_FLAG_INHIBITED) != 0U) ? 
+                     ALERT_CONSUMER_RECORDER : ctx->first_consumer;
+    
+    for (uint32_t c = first; c < ALERT_CONSUMER_COUNT; c++)
+    {
+        alert_queue_push(&ctx->queue[c], priority, record);
+    }
+}
+
+/**
+ * @brief Append an event to a consumer queue (alert detection only)
+ *
+ * A full ring drops the new event and counts an overflow. Each priority
+ * class has its own ring, so lower-priority traffic cannot displace
+ * warnings.
+ */
+static void alert_queue_push(alert_event_queue_t* queue, uint32_t priority,
+                             const alert_record_t* event)
+{
+    alert_event_ring_t* ring = &queue->ring[priority];
+    uint32_t head = atomic_load_explicit(&ring->head, memory_order_relaxed);
+    uint32_t depth = head - atomic_load_explicit(&ring->tail, memory_order_acquire);
+    
+    if (depth >= ALERT_MAX_QUEUE_SIZE)
+    {
+        (void)atomic_fetch_add_explicit(&queue->overflow_count, 1U, memory_order_relaxed);
+    }
+    else
+    {
+        ring->event[head & ALERT_QUEUE_MASK] = *event;
+        atomic_store_explicit(&ring->head, head + 1U, memory_order_release);
+        
+        if ((depth + 1U) > atomic_load_explicit(&queue->high_water, memory_order_relaxed))
+        {
+            atomic_store_explicit(&queue->high_water, depth + 1U, memory_order_relaxed);
+        }
+    }
+}
+
+/**
+ * @brief Deliver queued events of one consumer, highest priority first
+ *
+ * Events are passed to the consumer, or stored in events if it is not NULL.
+ */
+static uint32_t alert_dispatch(alert_context_t* ctx, uint32_t consumer, uint32_t max_events,
+                               ehms_alert_t* events)
+{
+    alert_event_queue_t* queue = &ctx->queue[consumer];
+    uint32_t delivered = 0U;
+    
+    for (uint32_t p = ALERT_PRIORITY_COUNT; (p > 0U) && (delivered < max_events); p--)
+    {
+        alert_event_ring_t* ring = &queue->ring[p - 1U];
+        uint32_t tail = atomic_load_explicit(&ring->tail, memory_order_relaxed);
+        uint32_t head = atomic_load_explicit(&ring->head, memory_order_acquire);
+        
+        while ((tail != head) && (delivered < max_events))
+        {
+            ehms_alert_t alert;
+            
+            alert_expand(&ring->event[tail & ALERT_QUEUE_MASK], &alert);
+            tail++;
+            atomic_store_explicit(&ring->tail, tail, memory_order_release);
+            
+            if (events != NULL)
+            {
+                events[delivered] = alert;
+            }
+            else if (consumer == ALERT_CONSUMER_EICAS)
+            {
+                (void)eicas_post_message(&alert);
+            }
+            else
+            {
+                (void)recorder_log_alert(&alert);
+            }
+            delivered++;
+        }
+    }
+    
+    (void)atomic_fetch_add_explicit(&queue->delivered_count, delivered, memory_order_relaxed);
+    
+    return delivered;
+}
+
+/**
+ * @brief Expand a compact alert record into the interface alert structure
+ *
+ * The message text is copied from the table rendered at init; with
+ * EHMS_ALERT_LAZY_MESSAGE it is left empty for consumers to render through
+ * alert_get_message_text.
+ */
+static void alert_expand(const alert_record_t* record, ehms_alert_t* alert)
+{
+    const alert_threshold_t* thresh = &s_thresholds[record->threshold];
+    
+    alert->alert_id = record->alert_id;
+    alert->level = thresh->level;
+    alert->engine_id = (ehms_engine_id_t)record->engine_id;
+    alert->param_id = thresh->param_id;
+    alert->onset_time = record->onset_time;
+    alert->clear_time = record->clear_time;
+    alert->is_active = ((record->flags & ALERT_FLAG_ACTIVE) != 0U);
+    alert->is_latched = ((record->flags & ALERT_FLAG_LATCHED) != 0U);
+    alert->is_inhibited = ((record->flags & ALERT_FLAG_INHIBITED) != 0U);
+    alert->ecam_code = thresh->ecam_code;
+#if defined(EHMS_ALERT_LAZY_MESSAGE)
+    alert->message[0] = '\0';
+#else
+    (void)memcpy(alert->message, s_message_text[record->engine_id][record->threshold],
+                 sizeof(alert->message));
+#endif
+}
+
+/**
+ * @brief Empty every consumer queue and clear the queue statistics
+ */
+static void alert_queue_init(alert_context_t* ctx)
+{
+    for (uint32_t c = 0U; c < ALERT_CONSUMER_COUNT; c++)
+    {
+        alert_event_queue_t* queue = &ctx->queue[c];
+        
+        for (uint32_t p = 0U; p < ALERT_PRIORITY_COUNT; p++)
+        {
+            atomic_init(&queue->ring[p].head, 0U);
+            atomic_init(&queue->ring[p].tail, 0U);
+        }
+        atomic_init(&queue->overflow_count, 0U);
+        atomic_init(&queue->high_water, 0U);
+        atomic_init(&queue->delivered_count, 0U);
+    }
+}
+
+/**
+ * @brief Render every threshold message for every engine
+ */
+static void alert_render_messages(void)
+{
+    for (uint32_t eng = 0U; eng < EHMS_MAX_ENGINES; eng++)
+    {
+        for (uint32_t t = 0U; t < NUM_THRESHOLDS; t++)
+        {
+            (void)snprintf(s_message_text[eng][t], ALERT_MESSAGE_LENGTH,
+                          s_thresholds[t].message, (int)eng + 1);
+        }
+    }
+}
+
+/**
+ * @brief Update master caution/warning and the highest level
+ *
+ * Run once per processing call or batch rather than per alert. Master
+ * flags are set for the levels raised since the previous update; the
+ * highest level is recomputed from the per-level alert counts.
+ */
+static void alert_update_summary(alert_context_t* ctx)
+{
+    ehms_alert_level_t level = EHMS_ALERT_NONE;
+    uint32_t raised = ctx->raised_levels;
+    
+    /* Update master alerts */
+    if ((raised >> (uint32_t)EHMS_ALERT_WARNING) != 0U)
+    {
+        ctx->master_warning = true;
+    }
+    if ((raised & (1UL << (uint32_t)EHMS_ALERT_CAUTION)) != 0U)
+    {
+        ctx->master_caution = true;
+    }
+    ctx->raised_levels = 0U;
+    
+    for (uint32_t l = ALERT_LEVEL_COUNT - 1U; l > (uint32_t)EHMS_ALERT_NONE; l--)
+    {
+        if (ctx->level_count[l] > 0U)
+        {
+            level = (ehms_alert_level_t)l;
+            break;
+        }
+    }
+    
+    ctx->highest_level = level;
 }
 
 /* END OF FILE */
@@ -0,0 +1,382 @@
+/**
+ * @file alert_manager_ext.h
+ * @brief EHMS Alert Management Module - Extended Interface
+ *
+ * @copyright Copyright (c) 2026 AeroTech Avionics Inc.
+ * @note This file is subject to DO-178C Level B certification requirements
+ *
+ * CSCI: EHMS-ALERTS
+ * CSC: ALERT-MANAGER
+ *
+ * Supplements alert_manager.h with entry points that consume the
+ * structure-of-arrays engine parameter block, alert message text, the
+ * asynchronous delivery of alert events to EICAS and the flight recorder,
+ * and the latched alert state carried over a warm start.
+ *
+ * The alert_ctx_ functions run the same alert processing on a caller-owned
+ * context, so that recorded data from several aircraft can be reprocessed
+ * on the ground in parallel, one context per log. A context has no EICAS
+ * consumer: every event is queued for alert_ctx_read_events only.
+ *
+ * Requirements Trace:
+ *   SRS-EHMS-200: System shall generate alerts within 100ms of threshold exceedance
+ *   SRS-EHMS-201: System shall prioritize alerts by severity level
+ */
+
+#ifndef ALERT_MANAGER_EXT_H
+#define ALERT_MANAGER_EXT_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* ============================================================================
+ * INCLUDES
+ * ============================================================================ */
+#include "ehms_types.h"
+#include "ehms_packed.h"
+
+/* ============================================================================
+ * TYPES
+ * ============================================================================ */
+
+/**
+ * @brief Alert event queue statistics of one consumer
+ */
+typedef struct
+{
+    uint32_t            pending;                /**< Events awaiting delivery */
+    uint32_t            delivered;              /**< Events delivered since init */
+    uint32_t            overflow_count;         /**< Events dropped, queue full */
+    uint32_t            high_water;             /**< Deepest priority ring fill */
+} alert_consumer_statistics_t;
+
+/**
+ * @brief Alert event queue statistics
+ */
+typedef struct
+{
+    alert_consumer_statistics_t eicas;          /**< EICAS consumer */
+    alert_consumer_statistics_t recorder;       /**< Flight recorder consumer */
+} alert_queue_statistics_t;
+
+/**
+ * @brief Alert processing context
+ *
+ * Holds the alert records, debounce state and event queues of one
+ * processing stream. The onboard context is internal to alert_manager.c;
+ * further contexts are allocated by the caller with alert_context_size()
+ * bytes. Distinct contexts may be used concurrently from different
+ * threads. The threshold tables are shared and built by the first call of
+ * alert_init or alert_ctx_init, which shall complete before contexts are
+ * used concurrently.
+ */
+typedef struct alert_context alert_context_t;
+
+/**
+ * @brief Latched alert state carried over a warm start
+ *
+ * Holds the latched alerts, active or awaiting acknowledgement, in packed
+ * form with times from a caller-chosen epoch, and the threshold set each
+ * engine was evaluated against: its flight phase, or EHMS_FLIGHT_PHASE_COUNT
+ * for an unknown phase. Alerts that are not latched are raised again by
+ * their debounce if their condition persists.
+ */
+typedef struct
+{
+    uint32_t            next_alert_id;          /**< Identifier of the next alert raised */
+    uint32_t            alert_count;            /**< Entries of alerts used */
+    uint8_t             master_caution;         /**< Master caution set (0 or 1) */
+    uint8_t             master_warning;         /**< Master warning set (0 or 1) */
+    uint8_t             phase_set[EHMS_MAX_ENGINES]; /**< Threshold set of each engine */
+    uint16_t            reserved;               /**< Zero */
+    ehms_packed_alert_t alerts[EHMS_MAX_ACTIVE_ALERTS]; /**< Latched alerts */
+} alert_warm_state_t;
+
+/* ============================================================================
+ * FUNCTION PROTOTYPES
+ * ============================================================================ */
+
+/**
+ * @brief Process an engine parameter block and generate alerts
+ *
+ * Equivalent to alert_process_snapshot for the structure-of-arrays form
+ * published by the data acquisition module.
+ *
+ * @param[in] block  Current engine parameter block
+ * @return EHMS_OK on success, error code otherwise
+ *
+ * @trace SRS-EHMS-200, SRS-EHMS-201
+ */
+ehms_result_t alert_process_block(const ehms_engine_block_t* block);
+
+/**
+ * @brief Process the snapshots of several engines as one batch
+ *
+ * Equivalent to alert_process_snapshot for each snapshot in turn, except
+ * that each threshold is evaluated across all engines of the batch at
+ * once and master caution/warning and the highest level are updated once
+ * per batch. Each engine may appear at most once.
+ *
+ * @param[in] snapshots  Engine snapshots
+ * @param[in] count      Number of snapshots (0..EHMS_MAX_ENGINES)
+ * @return EHMS_OK on success, EHMS_ERROR_RANGE for an invalid engine or
+ *         count, EHMS_ERROR_PARAM for a NULL pointer or repeated engine
+ *
+ * @trace SRS-EHMS-200, SRS-EHMS-201
+ */
+ehms_result_t alert_process_snapshots(const ehms_engine_snapshot_t* snapshots, uint32_t count);
+
+/**
+ * @brief Process the parameter blocks of several engines as one batch
+ *
+ * Structure-of-arrays form of alert_process_snapshots.
+ *
+ * @param[in] blocks  Engine parameter blocks
+ * @param[in] count   Number of blocks (0..EHMS_MAX_ENGINES)
+ * @return EHMS_OK on success, EHMS_ERROR_RANGE for an invalid engine or
+ *         count, EHMS_ERROR_PARAM for a NULL pointer or repeated engine
+ *
+ * @trace SRS-EHMS-200, SRS-EHMS-201
+ */
+ehms_result_t alert_process_blocks(const ehms_engine_block_t* blocks, uint32_t count);
+
+/**
+ * @brief Get the display text of an alert
+ *
+ * Message templates are rendered for every engine once at alert_init, so
+ * alert detection does no text formatting. Consumers built with
+ * EHMS_ALERT_LAZY_MESSAGE receive alerts with an empty message field and
+ * obtain the text here.
+ *
+ * @param[in] engine_id  Engine the alert was raised for
+ * @param[in] ecam_code  ECAM/EICAS code of the alert
+ * @return Message text, or NULL if no threshold has the code
+ *
+ * @trace SRS-EHMS-200
+ */
+const char* alert_get_message_text(ehms_engine_id_t engine_id, uint16_t ecam_code);
+
+/**
+ * @brief Deliver queued alert events to EICAS
+ *
+ * Alert processing queues every alert onset, clear and reactivation for
+ * each consumer instead of calling it directly. Called from the EICAS
+ * display task; events are delivered warnings first, then cautions,
+ * advisories and status messages, in order of occurrence within a level.
+ *
+ * @param[in] max_events  Maximum number of events to deliver
+ * @return Number of events delivered
+ *
+ * @trace SRS-EHMS-201
+ */
+uint32_t alert_dispatch_eicas(uint32_t max_events);
+
+/**
+ * @brief Deliver queued alert events to the flight recorder
+ *
+ * Called from the flight recorder task; same ordering as
+ * alert_dispatch_eicas.
+ *
+ * @param[in] max_events  Maximum number of events to deliver
+ * @return Number of events delivered
+ *
+ * @trace SRS-EHMS-201
+ */
+uint32_t alert_dispatch_recorder(uint32_t max_events);
+
+/**
+ * @brief Get alert event queue statistics
+ *
+ * @param[out] stats  Pointer to receive statistics
+ * @return EHMS_OK on success, error code otherwise
+ *
+ * @trace SRS-EHMS-201
+ */
+ehms_result_t alert_get_queue_statistics(alert_queue_statistics_t* stats);
+
+/**
+ * @brief Save the latched alerts of the onboard context for a warm start
+ *
+ * @param[in]  epoch  Calendar time at packed time zero
+ * @param[out] state  Receives the alert state; every byte is written
+ * @return EHMS_OK on success, EHMS_ERROR_PARAM for a NULL pointer,
+ *         EHMS_ERROR_RANGE if an alert time is outside the packed range
+ *         from epoch (that alert is left out, the others are saved)
+ *
+ * @trace SRS-EHMS-016
+ */
+ehms_result_t alert_save_warm_state(const ehms_timestamp_t* epoch, alert_warm_state_t* state);
+
+/**
+ * @brief Restore the latched alerts saved by alert_save_warm_state
+ *
+ * Called after alert_init, before any block is processed. Each alert is
+ * matched to its threshold by parameter, level and ECAM code and resumes
+ * its clear debounce or acknowledgement; alert identifiers and the master
+ * caution and warning continue from the saved state. Restored alerts are
+ * posted to EICAS again, but not to the recorder, which has logged them.
+ *
+ * @param[in] epoch  Calendar time at packed time zero, as saved
+ * @param[in] state  Saved alert state
+ * @return EHMS_OK on success, EHMS_ERROR_PARAM for a NULL pointer,
+ *         EHMS_ERROR_BUSY if alerts have already been raised,
+ *         EHMS_ERROR_RANGE for an invalid state or an alert that matches
+ *         no threshold (that alert is left out, the others are restored)
+ *
+ * @trace SRS-EHMS-016
+ */
+ehms_result_t alert_restore_warm_state(const ehms_timestamp_t* epoch,
+                                       const alert_warm_state_t* state);
+
+/**
+ * @brief Get the storage size of an alert context
+ *
+ * @return Size in bytes
+ */
+uint32_t alert_context_size(void);
+
+/**
+ * @brief Initialize an alert context for recorded data
+ *
+ * Equivalent to alert_init for a caller-owned context, except that events
+ * are queued for alert_ctx_read_events instead of EICAS and the flight
+ * recorder.
+ *
+ * @param[out] ctx  Context storage of alert_context_size() bytes
+ * @return EHMS_OK on success, EHMS_ERROR_PARAM if ctx is NULL, error code
+ *         of the threshold table build otherwise
+ *
+ * @trace SRS-EHMS-200
+ */
+ehms_result_t alert_ctx_init(alert_context_t* ctx);
+
+/**
+ * @brief Process parameters of an alert context and generate alerts
+ *
+ * Context form of alert_process_snapshot.
+ *
+ * @param[in,out] ctx       Alert context
+ * @param[in]     snapshot  Current engine snapshot
+ * @return EHMS_OK on success, EHMS_ERROR_PARAM for a NULL pointer,
+ *         EHMS_ERROR_RANGE for an invalid engine
+ *
+ * @trace SRS-EHMS-200, SRS-EHMS-201
+ */
+ehms_result_t alert_ctx_process_snapshot(alert_context_t* ctx,
+                                         const ehms_engine_snapshot_t* snapshot);
+
+/**
+ * @brief Process an engine parameter block of an alert context
+ *
+ * Context form of alert_process_block.
+ *
+ * @param[in,out] ctx    Alert context
+ * @param[in]     block  Current engine parameter block
+ * @return EHMS_OK on success, EHMS_ERROR_PARAM for a NULL pointer,
+ *         EHMS_ERROR_RANGE for an invalid engine
+ *
+ * @trace SRS-EHMS-200, SRS-EHMS-201
+ */
+ehms_result_t alert_ctx_process_block(alert_context_t* ctx, const ehms_engine_block_t* block);
+
+/**
+ * @brief Process the snapshots of several engines of an alert context
+ *
+ * Context form of alert_process_snapshots.
+ *
+ * @param[in,out] ctx        Alert context
+ * @param[in]     snapshots  Engine snapshots
+ * @param[in]     count      Number of snapshots (0..EHMS_MAX_ENGINES)
+ * @return As alert_process_snapshots; EHMS_ERROR_PARAM if ctx is NULL
+ *
+ * @trace SRS-EHMS-200, SRS-EHMS-201
+ */
+ehms_result_t alert_ctx_process_snapshots(alert_context_t* ctx,
+                                          const ehms_engine_snapshot_t* snapshots,
+                                          uint32_t count);
+
+/**
+ * @brief Process the parameter blocks of several engines of an alert context
+ *
+ * Context form of alert_process_blocks.
+ *
+ * @param[in,out] ctx     Alert context
+ * @param[in]     blocks  Engine parameter blocks
+ * @param[in]     count   Number of blocks (0..EHMS_MAX_ENGINES)
+ * @return As alert_process_blocks; EHMS_ERROR_PARAM if ctx is NULL
+ *
+ * @trace SRS-EHMS-200, SRS-EHMS-201
+ */
+ehms_result_t alert_ctx_process_blocks(alert_context_t* ctx, const ehms_engine_block_t* blocks,
+                                       uint32_t count);
+
+/**
+ * @brief Get the active alert count of an alert context
+ *
+ * @param[in] ctx  Alert context
+ * @return Number of active alerts, 0 if ctx is NULL
+ */
+uint32_t alert_ctx_get_active_count(const alert_context_t* ctx);
+
+/**
+ * @brief Get the highest active alert level of an alert context
+ *
+ * @param[in] ctx  Alert context
+ * @return Highest alert level, EHMS_ALERT_NONE if ctx is NULL
+ */
+ehms_alert_level_t alert_ctx_get_highest_level(const alert_context_t* ctx);
+
+/**
+ * @brief Check the master warning status of an alert context
+ *
+ * @param[in] ctx  Alert context
+ * @return true if master warning active
+ */
+bool alert_ctx_is_master_warning(const alert_context_t* ctx);
+
+/**
+ * @brief Check the master caution status of an alert context
+ *
+ * @param[in] ctx  Alert context
+ * @return true if master caution active
+ */
+bool alert_ctx_is_master_caution(const alert_context_t* ctx);
+
+/**
+ * @brief Read the queued alert events of an alert context
+ *
+ * Same ordering as alert_dispatch_recorder: warnings first, then
+ * cautions, advisories and status messages, in order of occurrence within
+ * a level. Events are removed from the queue as they are read.
+ *
+ * @param[in,out] ctx         Alert context
+ * @param[out]    events      Receives the events
+ * @param[in]     max_events  Capacity of events
+ * @return Number of events read, 0 for a NULL pointer
+ *
+ * @trace SRS-EHMS-201
+ */
+uint32_t alert_ctx_read_events(alert_context_t* ctx, ehms_alert_t* events, uint32_t max_events);
+
+/**
+ * @brief Get the alert event queue statistics of an alert context
+ *
+ * The EICAS statistics of a recorded data context are always zero.
+ *
+ * @param[in]  ctx    Alert context
+ * @param[out] stats  Pointer to receive statistics
+ * @return EHMS_OK on success, EHMS_ERROR_PARAM for a NULL pointer
+ *
+ * @trace SRS-EHMS-201
+ */
+ehms_result_t alert_ctx_get_queue_statistics(const alert_context_t* ctx,
+                                             alert_queue_statistics_t* stats);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ALERT_MANAGER_EXT_H */
+
+/* END OF FILE */
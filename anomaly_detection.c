@@ -0,0 +1,278 @@
+/**
+ * @file anomaly_detection.c
+ * @brief EHMS Multivariate Engine Anomaly Detection
+ *
+ * @copyright Copyright (c) 2026 AeroTech Avionics Inc.
+ * @note DO-178C Level B - Safety Critical Software
+ *
+ * CSCI: EHMS-CORE
+ * CSC: ANOMALY-DETECTION
+ *
+ * Requirements Trace:
+ *   SRS-EHMS-035: System shall assess engine health
+ *   SRS-EHMS-062: System shall detect anomalous engine behaviour
+ */
+
+/* ============================================================================
+ * INCLUDES
+ * ============================================================================ */
+#include "anomaly_detection.h"
+
+#include <math.h>
+#include <string.h>
+
+/* ============================================================================
+ * PRIVATE TYPES
+ * ============================================================================ */
+
+/**
+ * @brief Score filter of one engine
+ */
+typedef struct
+{
+    float                   smoothed;           /**< Filtered squared distance */
+    uint32_t                phase;              /**< Phase the filter was started in */
+    bool                    tracking;           /**< Filter holds a value */
+} anomaly_filter_t;
+
+/**
+ * @brief Module state structure
+ */
+typedef struct
+{
+    bool                    is_initialized;
+    anomaly_model_t         model;
+    anomaly_filter_t        filter[EHMS_ENGINE_COUNT];
+} anomaly_state_t;
+
+/* ============================================================================
+ * PRIVATE DATA
+ * ============================================================================ */
+
+/** @brief Module state - static allocation for safety */
+static anomaly_state_t s_anomaly_state;
+
+/* ============================================================================
+ * PRIVATE FUNCTION PROTOTYPES
+ * ============================================================================ */
+
+static ehms_result_t anomaly_validate_model(const anomaly_model_t* model);
+static float anomaly_distance_sq(const anomaly_baseline_t* baseline, const float* features);
+static ehms_health_status_t anomaly_health(float score);
+
+/* ============================================================================
+ * PUBLIC FUNCTIONS
+ * ============================================================================ */
+
+/**
+ * @brief Load the anomaly model and reset every engine's filter
+ * @trace SRS-EHMS-062
+ */
+ehms_result_t anomaly_init(const anomaly_model_t* model)
+{
+    ehms_result_t result = EHMS_OK;
+    
+    if (model == NULL)
+    {
+        result = EHMS_ERROR_PARAM;
+    }
+    else
+    {
+        result = anomaly_validate_model(model);
+    }
+    
+    if (result == EHMS_OK)
+    {
+        (void)memset(&s_anomaly_state, 0, sizeof(s_anomaly_state));
+        s_anomaly_state.model = *model;
+        s_anomaly_state.is_initialized = true;
+    }
+    
+    return result;
+}
+
+/**
+ * @brief Score one cycle of an engine
+ * @trace SRS-EHMS-035, SRS-EHMS-062
+ */
+ehms_result_t anomaly_evaluate(ehms_engine_id_t engine_id,
+                               uint32_t flight_phase,
+                               const float* features,
+                               bool features_valid,
+                               anomaly_result_t* result)
+{
+    ehms_result_t status = EHMS_OK;
+    
+    if ((features == NULL) || (result == NULL))
+    {
+        status = EHMS_ERROR_PARAM;
+    }
+    else if (engine_id >= EHMS_ENGINE_COUNT)
+    {
+        status = EHMS_ERROR_RANGE;
+    }
+    else if (!s_anomaly_state.is_initialized)
+    {
+        status = EHMS_ERROR_NOT_INIT;
+    }
+    else
+    {
+        anomaly_filter_t* filter = &s_anomaly_state.filter[engine_id];
+        
+        if (features_valid && (flight_phase < ANOMALY_PHASE_COUNT) &&
+            s_anomaly_state.model.phase[flight_phase].defined)
+        {
+            float d2 = anomaly_distance_sq(&s_anomaly_state.model.phase[flight_phase],
+                                           features);
+            
+            /* A new phase is scored against a new baseline: restart the filter */
+            if (!filter->tracking || (filter->phase != flight_phase))
+            {
+                filter->smoothed = d2;
+                filter->phase = flight_phase;
+                filter->tracking = true;
+            }
+            else
+            {
+                filter->smoothed += s_anomaly_state.model.smoothing * (d2 - filter->smoothed);
+            }
+            
+            result->score = sqrtf(filter->smoothed);
+            result->distance = sqrtf(d2);
+            result->status = EHMS_PARAM_VALID;
+            result->health = anomaly_health(result->score);
+        }
+        else
+        {
+            filter->tracking = false;
+            
+            result->score = 0.0f;
+            result->distance = 0.0f;
+            result->status = EHMS_PARAM_NCD;
+            result->health = EHMS_HEALTH_NORMAL;
+        }
+    }
+    
+    return status;
+}
+
+/**
+ * @brief Score one engine snapshot
+ * @trace SRS-EHMS-062
+ */
+ehms_result_t anomaly_evaluate_snapshot(const ehms_engine_snapshot_t* snapshot,
+                                        anomaly_result_t* result)
+{
+    ehms_result_t status = EHMS_OK;
+    
+    if (snapshot == NULL)
+    {
+        status = EHMS_ERROR_PARAM;
+    }
+    else
+    {
+        float features[ANOMALY_FEATURE_COUNT];
+        bool valid = true;
+        
+        for (uint32_t f = 0U; f < ANOMALY_FEATURE_COUNT; f++)
+        {
+            const ehms_parameter_t* param = &snapshot->parameters[f];
+            
+            features[f] = param->eng_value;
+            valid = valid && EHMS_PARAM_IS_VALID(param->status);
+        }
+        
+        status = anomaly_evaluate(snapshot->engine_id, snapshot->flight_phase,
+                                  features, valid, result);
+    }
+    
+    return status;
+}
+
+/* ============================================================================
+ * PRIVATE FUNCTIONS
+ * ============================================================================ */
+
+/**
+ * @brief Check the smoothing weight and every defined baseline
+ *
+ * A whitening factor with a zero or negative diagonal does not describe a
+ * positive definite covariance.
+ */
+static ehms_result_t anomaly_validate_model(const anomaly_model_t* model)
+{
+    ehms_result_t result = EHMS_OK;
+    
+    if (!((model->smoothing > 0.0f) && (model->smoothing <= 1.0f)))
+    {
+        result = EHMS_ERROR_CONFIG;
+    }
+    
+    for (uint32_t ph = 0U; (ph < ANOMALY_PHASE_COUNT) && (result == EHMS_OK); ph++)
+    {
+        const anomaly_baseline_t* baseline = &model->phase[ph];
+        
+        for (uint32_t f = 0U; (f < ANOMALY_FEATURE_COUNT) && baseline->defined; f++)
+        {
+            if (!(baseline->whiten[ANOMALY_WHITEN_INDEX(f, f)] > 0.0f))
+            {
+                result = EHMS_ERROR_CONFIG;
+                break;
+            }
+        }
+    }
+    
+    return result;
+}
+
+/**
+ * @brief Squared Mahalanobis distance of the features from a baseline
+ *
+ * Loop bounds are constants, so the operation count does not depend on data.
+ */
+static float anomaly_distance_sq(const anomaly_baseline_t* baseline, const float* features)
+{
+    float deviation[ANOMALY_FEATURE_COUNT];
+    float d2 = 0.0f;
+    
+    for (uint32_t f = 0U; f < ANOMALY_FEATURE_COUNT; f++)
+    {
+        deviation[f] = features[f] - baseline->mean[f];
+    }
+    
+    for (uint32_t row = 0U; row < ANOMALY_FEATURE_COUNT; row++)
+    {
+        const float* coeff = &baseline->whiten[ANOMALY_WHITEN_INDEX(row, 0U)];
+        float z = 0.0f;
+        
+        for (uint32_t col = 0U; col <= row; col++)
+        {
+            z += coeff[col] * deviation[col];
+        }
+        
+        d2 += z * z;
+    }
+    
+    return d2;
+}
+
+/**
+ * @brief Health assessment of a valid score
+ */
+static ehms_health_status_t anomaly_health(float score)
+{
+    ehms_health_status_t health = EHMS_HEALTH_NORMAL;
+    
+    if (score >= ANOMALY_ADVISORY_SCORE)
+    {
+        health = EHMS_HEALTH_CAUTION;
+    }
+    else if (score >= ANOMALY_MONITOR_SCORE)
+    {
+        health = EHMS_HEALTH_MONITOR;
+    }
+    
+    return health;
+}
+
+/* END OF FILE */
@@ -0,0 +1,178 @@
+/**
+ * @file anomaly_detection.h
+ * @brief EHMS Multivariate Engine Anomaly Detection
+ *
+ * @copyright Copyright (c) 2026 AeroTech Avionics Inc.
+ * @note This file is subject to DO-178C Level B certification requirements
+ *
+ * CSCI: EHMS-CORE
+ * CSC: ANOMALY-DETECTION
+ *
+ * Requirements Trace:
+ *   SRS-EHMS-035: System shall assess engine health
+ *   SRS-EHMS-062: System shall detect anomalous engine behaviour
+ *
+ * Each acquisition cycle the N1, N2, EGT and FF of an engine are scored
+ * against a baseline of the current flight phase by their Mahalanobis
+ * distance
+ *
+ *     d^2 = (x - mean)^T * inverse(covariance) * (x - mean) = |L * (x - mean)|^2
+ *
+ * where L is the lower triangular whitening factor with L^T * L equal to
+ * the inverse covariance. Baselines are computed offline from fleet data
+ * and loaded with the engine profile; anomaly_init copies them into module
+ * state, so evaluation reads one contiguous 60 byte baseline per engine.
+ *
+ * d^2 is smoothed across cycles by an exponential filter that restarts
+ * when the flight phase changes or the inputs become invalid. The score is
+ * the square root of the smoothed d^2, in standard deviations: about
+ * sqrt(ANOMALY_FEATURE_COUNT) for an engine matching its baseline.
+ *
+ * Evaluation performs a fixed number of operations regardless of the data
+ * (ANOMALY_FEATURE_COUNT subtractions, ANOMALY_WHITEN_COUNT multiply-adds
+ * and one square root), so its execution time bound is that of one pass.
+ */
+
+#ifndef ANOMALY_DETECTION_H
+#define ANOMALY_DETECTION_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* ============================================================================
+ * INCLUDES
+ * ============================================================================ */
+#include "ehms_types.h"
+
+/* ============================================================================
+ * CONSTANTS
+ * ============================================================================ */
+
+/** @brief Flight phases with a baseline slot (flight_phase 0 .. count - 1) */
+#define ANOMALY_PHASE_COUNT                 ((uint32_t)EHMS_FLIGHT_PHASE_COUNT)
+
+/** @brief Score at and above which health is EHMS_HEALTH_MONITOR */
+#define ANOMALY_MONITOR_SCORE               3.0f
+
+/** @brief Score at and above which health is EHMS_HEALTH_CAUTION and an advisory is raised */
+#define ANOMALY_ADVISORY_SCORE              4.0f
+
+/* ============================================================================
+ * TYPES
+ * ============================================================================ */
+
+/**
+ * @brief Scored parameters, in model coefficient order
+ */
+typedef enum
+{
+    ANOMALY_FEATURE_N1      = 0U,   /**< EHMS_PARAM_N1 */
+    ANOMALY_FEATURE_N2      = 1U,   /**< EHMS_PARAM_N2 */
+    ANOMALY_FEATURE_EGT     = 2U,   /**< EHMS_PARAM_EGT */
+    ANOMALY_FEATURE_FF      = 3U,   /**< EHMS_PARAM_FF */
+    ANOMALY_FEATURE_COUNT   = 4U
+} anomaly_feature_t;
+
+_Static_assert(((uint32_t)ANOMALY_FEATURE_N1 == (uint32_t)EHMS_PARAM_N1) &&
+               ((uint32_t)ANOMALY_FEATURE_N2 == (uint32_t)EHMS_PARAM_N2) &&
+               ((uint32_t)ANOMALY_FEATURE_EGT == (uint32_t)EHMS_PARAM_EGT) &&
+               ((uint32_t)ANOMALY_FEATURE_FF == (uint32_t)EHMS_PARAM_FF),
+               "Feature f shall be parameter f");
+
+/** @brief Coefficients of the whitening factor (packed lower triangle) */
+#define ANOMALY_WHITEN_COUNT                ((ANOMALY_FEATURE_COUNT * \
+                                              (ANOMALY_FEATURE_COUNT + 1U)) / 2U)
+
+/** @brief Position of L[row][col], col <= row, in anomaly_baseline_t.whiten */
+#define ANOMALY_WHITEN_INDEX(row, col)      ((((row) * ((row) + 1U)) / 2U) + (col))
+
+/**
+ * @brief Baseline of one flight phase
+ */
+typedef struct
+{
+    float               mean[ANOMALY_FEATURE_COUNT];    /**< Feature means (engineering units) */
+    float               whiten[ANOMALY_WHITEN_COUNT];   /**< L, row-major lower triangle */
+    bool                defined;                        /**< Phase has a baseline */
+} anomaly_baseline_t;
+
+/**
+ * @brief Anomaly model
+ */
+typedef struct
+{
+    anomaly_baseline_t  phase[ANOMALY_PHASE_COUNT];     /**< Baselines by flight_phase */
+    float               smoothing;                      /**< Filter weight of each cycle (0, 1] */
+} anomaly_model_t;
+
+/**
+ * @brief Result of one evaluation
+ */
+typedef struct
+{
+    float                   score;              /**< Smoothed distance (standard deviations) */
+    float                   distance;           /**< Distance of this cycle alone */
+    ehms_param_status_t     status;             /**< VALID, or NCD if not assessed */
+    ehms_health_status_t    health;             /**< NORMAL unless VALID and above a score limit */
+} anomaly_result_t;
+
+/* ============================================================================
+ * FUNCTION PROTOTYPES
+ * ============================================================================ */
+
+/**
+ * @brief Load the anomaly model and reset every engine's filter
+ *
+ * @param[in] model  Model; every defined baseline shall have a positive
+ *                   whitening diagonal
+ * @return EHMS_OK on success, EHMS_ERROR_CONFIG if the model is invalid,
+ *         error code otherwise
+ *
+ * @trace SRS-EHMS-062
+ */
+ehms_result_t anomaly_init(const anomaly_model_t* model);
+
+/**
+ * @brief Score one cycle of an engine
+ *
+ * The result is NCD, and the filter restarts, if the features are not
+ * valid or the flight phase has no baseline.
+ *
+ * @param[in]  engine_id       Engine identifier
+ * @param[in]  flight_phase    Current flight phase
+ * @param[in]  features        Feature values, indexed by anomaly_feature_t
+ * @param[in]  features_valid  true if every feature is VALID
+ * @param[out] result          Receives the result
+ * @return EHMS_OK on success, error code otherwise
+ *
+ * @trace SRS-EHMS-035
+ * @trace SRS-EHMS-062
+ */
+ehms_result_t anomaly_evaluate(ehms_engine_id_t engine_id,
+                               uint32_t flight_phase,
+                               const float* features,
+                               bool features_valid,
+                               anomaly_result_t* result);
+
+/**
+ * @brief Score one engine snapshot
+ *
+ * Takes the features and their validity from the snapshot parameters.
+ *
+ * @param[in]  snapshot  Engine snapshot
+ * @param[out] result    Receives the result
+ * @return EHMS_OK on success, error code otherwise
+ *
+ * @trace SRS-EHMS-062
+ */
+ehms_result_t anomaly_evaluate_snapshot(const ehms_engine_snapshot_t* snapshot,
+                                        anomaly_result_t* result);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ANOMALY_DETECTION_H */
+
+/* END OF FILE */
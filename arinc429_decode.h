@@ -0,0 +1,122 @@
+/**
+ * @file arinc429_decode.h
+ * @brief ARINC 429 BNR and BCD Data Field Decoding
+ *
+ * @copyright Copyright (c) 2026 AeroTech Avionics Inc.
+ * @note This file is subject to DO-178C Level B certification requirements
+ *
+ * CSCI: EHMS-CORE
+ * CSC: DATA-ACQUISITION
+ *
+ * Requirements Trace:
+ *   SRS-EHMS-100: System shall acquire engine parameters at 100Hz
+ *   SRS-EHMS-101: System shall validate all incoming data
+ *
+ * arinc429_word_t.data holds word bits 11-29 right-justified. Decoding
+ * yields the value in counts of the label's resolution, so that
+ * engineering value = counts * scale_factor + offset.
+ *
+ * BNR: bit 29 (data bit 18) is the sign of a two's complement value whose
+ * significant bits run down from bit 28; bits below them are pad. Data
+ * already sign-extended by the driver decodes identically.
+ *
+ * BCD: up to five digits, the first in bits 27-29 (0-7) and the others in
+ * 4-bit groups below; bits below the last digit are pad. The value is
+ * negative when the SSM is ARINC429_SSM_BCD_MINUS.
+ *
+ * Parameter tables call these with constant widths, so each encoding is
+ * compiled to its own shift and mask sequence.
+ */
+
+#ifndef ARINC429_DECODE_H
+#define ARINC429_DECODE_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* ============================================================================
+ * INCLUDES
+ * ============================================================================ */
+#include "ehms_types.h"
+
+/* ============================================================================
+ * CONSTANTS
+ * ============================================================================ */
+
+/** @brief Data field width (bits 11-29) */
+#define ARINC429_DATA_BITS                  19U
+#define ARINC429_DATA_MASK                  ((1UL << ARINC429_DATA_BITS) - 1UL)
+
+/** @brief Significant bits of a BNR value below the sign bit (1 .. 18) */
+#define ARINC429_BNR_MAX_BITS               (ARINC429_DATA_BITS - 1U)
+
+/** @brief Digits of a BCD value (1 .. 5) */
+#define ARINC429_BCD_MAX_DIGITS             5U
+
+/** @brief SSM of a negative BCD value */
+#define ARINC429_SSM_BCD_MINUS              3U
+
+/* ============================================================================
+ * FUNCTIONS
+ * ============================================================================ */
+
+/**
+ * @brief Decode a BNR data field
+ *
+ * @param[in] data  Data field
+ * @param[in] bits  Significant bits (1 .. ARINC429_BNR_MAX_BITS)
+ * @return Value in counts of the least significant bit
+ */
+static inline int32_t arinc429_decode_bnr(int32_t data, uint32_t bits)
+{
+    uint32_t field = (uint32_t)data & ARINC429_DATA_MASK;
+    uint32_t magnitude = (field & ((1UL << ARINC429_BNR_MAX_BITS) - 1UL)) >>
+                         (ARINC429_BNR_MAX_BITS - bits);
+    int32_t sign_weight = ((field >> ARINC429_BNR_MAX_BITS) != 0U) ? (int32_t)(1UL << bits) : 0;
+    
+    return (int32_t)magnitude - sign_weight;
+}
+
+/**
+ * @brief Decode a BCD data field
+ *
+ * @param[in]  data    Data field
+ * @param[in]  ssm     Sign/status matrix of the word
+ * @param[in]  digits  Digits (1 .. ARINC429_BCD_MAX_DIGITS)
+ * @param[out] counts  Receives the value in counts of the last digit
+ * @return true if every digit is 0-9, false otherwise (counts unchanged)
+ */
+static inline bool arinc429_decode_bcd(int32_t data, uint32_t ssm, uint32_t digits,
+                                       int32_t* counts)
+{
+    uint32_t field = (uint32_t)data & ARINC429_DATA_MASK;
+    uint32_t shift = ARINC429_DATA_BITS - 3U;
+    uint32_t value = (field >> shift) & 0x7U;
+    bool valid = true;
+    
+    for (uint32_t d = 1U; d < digits; d++)
+    {
+        uint32_t digit = 0U;
+        
+        shift -= 4U;
+        digit = (field >> shift) & 0xFU;
+        valid = valid && (digit <= 9U);
+        value = (value * 10U) + digit;
+    }
+    
+    if (valid)
+    {
+        *counts = (ssm == ARINC429_SSM_BCD_MINUS) ? -(int32_t)value : (int32_t)value;
+    }
+    
+    return valid;
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ARINC429_DECODE_H */
+
+/* END OF FILE */
@@ -0,0 +1,154 @@
+/**
+ * @file bench_crc32.c
+ * @brief Host Throughput Benchmark for CRC-32 Integrity Engine
+ *
+ * @copyright Copyright (c) 2026 AeroTech Avionics Inc.
+ *
+ * Measures each CRC-32 backend over an ehms_engine_snapshot_t sized buffer
+ * against the original bit-serial algorithm and reports throughput and the
+ * per-cycle cost for a four-engine configuration (two CRC passes per engine).
+ *
+ * Usage: bench_crc32 [iterations]
+ */
+
+#define _POSIX_C_SOURCE 200809L
+
+#include "ehms_crc32.h"
+#include "ehms_types.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+/* ============================================================================
+ * CONSTANTS
+ * ============================================================================ */
+
+#define BENCH_DEFAULT_ITERATIONS    200000UL
+#define BENCH_BUFFER_SIZE           ((uint32_t)sizeof(ehms_engine_snapshot_t))
+#define BENCH_CRC_PER_CYCLE         (2U * EHMS_MAX_ENGINES)
+
+/* ============================================================================
+ * TYPES
+ * ============================================================================ */
+
+typedef uint32_t (*bench_crc_fn_t)(uint32_t crc, const void* data, uint32_t length);
+
+typedef struct
+{
+    const char*     name;
+    bench_crc_fn_t  update;
+} bench_backend_t;
+
+/* ============================================================================
+ * DATA
+ * ============================================================================ */
+
+static uint8_t s_buffer[BENCH_BUFFER_SIZE];
+
+/* ============================================================================
+ * FUNCTIONS
+ * ============================================================================ */
+
+/**
+ * @brief Original bit-serial algorithm (baseline)
+ */
+static uint32_t bench_update_bitwise(uint32_t crc, const void* data, uint32_t length)
+{
+    const uint8_t* bytes = (const uint8_t*)data;
+    
+    for (uint32_t i = 0U; i < length; i++)
+    {
+        crc ^= bytes[i];
+        for (uint8_t bit = 0U; bit < 8U; bit++)
+        {
+            if ((crc & 1U) != 0U)
+            {
+                crc = (crc >> 1U) ^ EHMS_CRC32_POLYNOMIAL;
+            }
+            else
+            {
+                crc >>= 1U;
+            }
+        }
+    }
+    
+    return crc;
+}
+
+static double bench_now_ns(void)
+{
+    struct timespec ts;
+    (void)clock_gettime(CLOCK_MONOTONIC, &ts);
+    
+    return ((double)ts.tv_sec * 1.0e9) + (double)ts.tv_nsec;
+}
+
+static const bench_backend_t s_backends[] =
+{
+    { "bitwise (baseline)", bench_update_bitwise },
+    { "table",              ehms_crc32_update_table },
+    { "slicing-by-8",       ehms_crc32_update_slicing8 },
+#if defined(__ARM_FEATURE_CRC32)
+    { "armv8 crc32",        ehms_crc32_update_armv8 },
+#endif
+};
+
+#define BENCH_BACKEND_COUNT (sizeof(s_backends) / sizeof(s_backends[0]))
+
+int main(int argc, char* argv[])
+{
+    unsigned long iterations = BENCH_DEFAULT_ITERATIONS;
+    uint32_t reference;
+    int status = 0;
+    
+    if (argc > 1)
+    {
+        iterations = strtoul(argv[1], NULL, 10);
+    }
+    
+    for (uint32_t i = 0U; i < BENCH_BUFFER_SIZE; i++)
+    {
+        s_buffer[i] = (uint8_t)((i * 31U) + 7U);
+    }
+    
+    reference = ~bench_update_bitwise(EHMS_CRC32_INITIAL, s_buffer, BENCH_BUFFER_SIZE);
+    
+    (void)printf("CRC-32 benchmark: %u-byte snapshot, %lu iterations\n",
+                 (unsigned)BENCH_BUFFER_SIZE, iterations);
+    (void)printf("%-20s %12s %12s %16s %s\n",
+                 "backend", "MB/s", "ns/snapshot", "us/cycle (4 eng)", "result");
+    
+    for (uint32_t b = 0U; b < BENCH_BACKEND_COUNT; b++)
+    {
+        volatile uint32_t sink = 0U;
+        uint32_t crc = ~s_backends[b].update(EHMS_CRC32_INITIAL, s_buffer,
+                                             BENCH_BUFFER_SIZE);
+        double start = bench_now_ns();
+        
+        for (unsigned long n = 0UL; n < iterations; n++)
+        {
+            sink ^= s_backends[b].update(EHMS_CRC32_INITIAL, s_buffer,
+                                         BENCH_BUFFER_SIZE);
+        }
+        
+        double elapsed = bench_now_ns() - start;
+        double ns_per = elapsed / (double)iterations;
+        double mbps = ((double)BENCH_BUFFER_SIZE * 1.0e3) / ns_per;
+        
+        (void)sink;
+        (void)printf("%-20s %12.1f %12.1f %16.2f %s\n",
+                     s_backends[b].name, mbps, ns_per,
+                     (ns_per * (double)BENCH_CRC_PER_CYCLE) / 1.0e3,
+                     (crc == reference) ? "match" : "MISMATCH");
+        
+        if (crc != reference)
+        {
+            status = 1;
+        }
+    }
+    
+    return status;
+}
+
+/* END OF FILE */
@@ -0,0 +1,391 @@
+/**
+ * @file bench_fleet.c
+ * @brief Host Fleet Reprocessing Throughput Benchmark
+ *
+ * @copyright Copyright (c) 2026 AeroTech Avionics Inc.
+ *
+ * Records a batch of synthetic flights through the onboard acquisition
+ * pipeline into recorder stream chunks (replay_engine.c standing in for
+ * the buses), then reprocesses the batch with fleet_run on one worker and
+ * on increasing worker counts, reporting for each:
+ *
+ *   - elapsed time, samples per second and speed-up over one worker
+ *   - logs stolen between worker queues
+ *   - the batch digest, a CRC-32 of every log's result; it shall not
+ *     depend on the number of workers
+ *
+ * Flights differ in length, so that the largest-first dealing and the
+ * stealing between queues are exercised. Each flight is the A320neo
+ * synthetic profile with its own noise seed and an EGT excursion through
+ * the caution limit every ten seconds.
+ *
+ * Usage: bench_fleet [logs] [cycles] [max-workers]
+ */
+
+#define _POSIX_C_SOURCE 200809L
+
+#include "fleet_batch.h"
+#include "replay_engine.h"
+#include "recorder_stream.h"
+#include "ehms_types.h"
+#include "ehms_crc32.h"
+#include "data_acquisition.h"
+#include "data_acquisition_ext.h"
+#include "arinc429_driver.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+/* ============================================================================
+ * CONSTANTS
+ * ============================================================================ */
+
+#define BENCH_DEFAULT_LOGS          32UL
+#define BENCH_DEFAULT_CYCLES        6000UL
+#define BENCH_ENGINES               2U
+#define BENCH_SAMPLE_RATE_HZ        100U
+
+/** @brief Excursion every 10 s lasting 0.5 s */
+#define BENCH_EXCURSION_PERIOD      1000U
+#define BENCH_EXCURSION_CYCLES      50U
+
+#define BENCH_SEED                  0x45484D53UL
+
+/* ============================================================================
+ * TYPES
+ * ============================================================================ */
+
+/**
+ * @brief Chunks of one recorded flight
+ */
+typedef struct
+{
+    rs_chunk_t*     chunk;
+    uint32_t        count;
+    uint32_t        capacity;
+} bench_log_t;
+
+/* ============================================================================
+ * DATA
+ * ============================================================================ */
+
+/**
+ * @brief A320neo engine interface traffic, counts of the label resolution
+ *
+ * As bench_pipeline.c.
+ */
+static const replay_source_t s_a320neo_sources[] =
+{
+    /* bus,                 ch, label,  encoding,            width, nominal, noise, excursion */
+    { REPLAY_BUS_ARINC429,   0U, 0o310U, REPLAY_ENCODING_BNR, 18U,     850,     5,       0 },
+    { REPLAY_BUS_ARINC429,   0U, 0o311U, REPLAY_ENCODING_BNR, 18U,     920,     4,       0 },
+    { REPLAY_BUS_ARINC429,   0U, 0o312U, REPLAY_ENCODING_BNR, 18U,     640,     6,     330 },
+    { REPLAY_BUS_ARINC429,   0U, 0o313U, REPLAY_ENCODING_BCD,  5U,   24000,    50,       0 },
+    { REPLAY_BUS_ARINC429,   0U, 0o314U, REPLAY_ENCODING_BNR, 18U,     270,     2,       0 },
+    { REPLAY_BUS_ARINC429,   0U, 0o315U, REPLAY_ENCODING_BNR, 18U,     550,     5,       0 },
+    { REPLAY_BUS_ARINC429,   0U, 0o316U, REPLAY_ENCODING_BNR,  8U,      36,     0,       0 },
+    { REPLAY_BUS_ARINC429,   0U, 0o321U, REPLAY_ENCODING_BNR, 18U,    1300,     3,       0 },
+    { REPLAY_BUS_ARINC429,   1U, 0o310U, REPLAY_ENCODING_BNR, 18U,     850,     5,       0 },
+    { REPLAY_BUS_ARINC429,   1U, 0o311U, REPLAY_ENCODING_BNR, 18U,     920,     4,       0 },
+    { REPLAY_BUS_ARINC429,   1U, 0o312U, REPLAY_ENCODING_BNR, 18U,     640,     6,     330 },
+    { REPLAY_BUS_ARINC429,   1U, 0o313U, REPLAY_ENCODING_BCD,  5U,   24000,    50,       0 },
+    { REPLAY_BUS_ARINC429,   1U, 0o314U, REPLAY_ENCODING_BNR, 18U,     270,     2,       0 },
+    { REPLAY_BUS_ARINC429,   1U, 0o315U, REPLAY_ENCODING_BNR, 18U,     550,     5,       0 },
+    { REPLAY_BUS_ARINC429,   1U, 0o316U, REPLAY_ENCODING_BNR,  8U,      36,     0,       0 },
+    { REPLAY_BUS_ARINC429,   1U, 0o321U, REPLAY_ENCODING_BNR, 18U,    1300,     3,       0 },
+    { REPLAY_BUS_ARINC429,   2U, 0o317U, REPLAY_ENCODING_BNR, 18U,    1200,    50,       0 },
+    { REPLAY_BUS_ARINC429,   2U, 0o320U, REPLAY_ENCODING_BNR, 18U,    1600,    50,       0 },
+    { REPLAY_BUS_ARINC429,   3U, 0o317U, REPLAY_ENCODING_BNR, 18U,    1200,    50,       0 },
+    { REPLAY_BUS_ARINC429,   3U, 0o320U, REPLAY_ENCODING_BNR, 18U,    1600,    50,       0 },
+    
+    /* Vibration subaddress: fan, core */
+    { REPLAY_BUS_MILSTD1553, 5U, 0U,     REPLAY_ENCODING_WORD, 16U,   1200,    50,       0 },
+    { REPLAY_BUS_MILSTD1553, 5U, 1U,     REPLAY_ENCODING_WORD, 16U,   1600,    50,       0 },
+};
+
+#define BENCH_SOURCE_COUNT  (sizeof(s_a320neo_sources) / sizeof(s_a320neo_sources[0]))
+
+/* ============================================================================
+ * FUNCTIONS
+ * ============================================================================ */
+
+static double bench_now_s(void)
+{
+    struct timespec ts;
+    (void)clock_gettime(CLOCK_MONOTONIC, &ts);
+    
+    return (double)ts.tv_sec + ((double)ts.tv_nsec / 1.0e9);
+}
+
+/**
+ * @brief Move the sealed chunks of every engine into the log
+ */
+static int bench_take_chunks(bench_log_t* log)
+{
+    int status = 0;
+    
+    for (uint32_t eng = 0U; (eng < BENCH_ENGINES) && (status == 0); eng++)
+    {
+        bool available = true;
+        
+        while ((status == 0) && available)
+        {
+            if (log->count == log->capacity)
+            {
+                uint32_t capacity = (log->capacity > 0U) ? (log->capacity * 2U) : 16U;
+                rs_chunk_t* grown = realloc(log->chunk, capacity * sizeof(*grown));
+                
+                if (grown == NULL)
+                {
+                    status = 1;
+                    break;
+                }
+                log->chunk = grown;
+                log->capacity = capacity;
+            }
+            
+            (void)rs_take_chunk((ehms_engine_id_t)eng, &log->chunk[log->count], &available);
+            log->count += available ? 1U : 0U;
+        }
+    }
+    
+    return status;
+}
+
+/**
+ * @brief Record one synthetic flight of the given length
+ */
+static int bench_record_flight(uint32_t seed, unsigned long cycles, bench_log_t* log)
+{
+    replay_profile_t profile;
+    daq_config_t config;
+    int status = 0;
+    
+    (void)memset(&profile, 0, sizeof(profile));
+    profile.sources = s_a320neo_sources;
+    profile.source_count = (uint32_t)BENCH_SOURCE_COUNT;
+    profile.engine_count = BENCH_ENGINES;
+    profile.repeat = 1U;
+    profile.excursion_period = BENCH_EXCURSION_PERIOD;
+    profile.excursion_cycles = BENCH_EXCURSION_CYCLES;
+    profile.seed = seed;
+    
+    (void)memset(&config, 0, sizeof(config));
+    config.sample_rate_hz = BENCH_SAMPLE_RATE_HZ;
+    config.engine_count = BENCH_ENGINES;
+    
+    for (uint8_t i = 0U; i < EHMS_ARINC429_BUS_COUNT; i++)
+    {
+        config.arinc_config[i].speed = ARINC429_HIGH_SPEED;
+        config.arinc_config[i].parity = ARINC429_ODD_PARITY;
+    }
+    
+    (void)memset(log, 0, sizeof(*log));
+    
+    if ((replay_start_profile(&profile) != EHMS_OK) || (daq_init(&config) != EHMS_OK) ||
+        (rs_init() != EHMS_OK))
+    {
+        (void)fprintf(stderr, "recording pipeline initialization failed\n");
+        status = 1;
+    }
+    
+    for (unsigned long c = 0UL; (c < cycles) && (status == 0); c++)
+    {
+        (void)replay_step();
+        (void)daq_execute_cycle();
+        
+        for (uint32_t eng = 0U; eng < BENCH_ENGINES; eng++)
+        {
+            const ehms_engine_block_t* block = NULL;
+            
+            if (daq_acquire_block_view((ehms_engine_id_t)eng, &block) == EHMS_OK)
+            {
+                (void)rs_append(block, (uint32_t)((c + 1UL) * REPLAY_CYCLE_MS));
+                (void)daq_release_block_view((ehms_engine_id_t)eng, block);
+            }
+        }
+        
+        status = bench_take_chunks(log);
+    }
+    
+    for (uint32_t eng = 0U; (eng < BENCH_ENGINES) && (status == 0); eng++)
+    {
+        (void)rs_flush((ehms_engine_id_t)eng);
+        status = bench_take_chunks(log);
+    }
+    
+    return status;
+}
+
+/**
+ * @brief Worker counts measured: powers of two, then max_workers
+ */
+static long bench_next_workers(long workers, long max_workers)
+{
+    long next = workers * 2L;
+    
+    if ((workers < max_workers) && (next > max_workers))
+    {
+        next = max_workers;
+    }
+    
+    return next;
+}
+
+/**
+ * @brief CRC-32 of every log result, in log order
+ */
+static uint32_t bench_batch_digest(const fleet_log_result_t* results, uint32_t count)
+{
+    uint32_t crc = EHMS_CRC32_INITIAL;
+    
+    for (uint32_t i = 0U; i < count; i++)
+    {
+        const fleet_log_result_t* r = &results[i];
+#if defined(DAQ_TREND_ENGINE)
+        uint32_t fold[6] = { (uint32_t)r->result, r->samples, r->alert_events,
+                             r->corrupt_chunks, r->digest, r->trend_digest };
+#else
+        uint32_t fold[5] = { (uint32_t)r->result, r->samples, r->alert_events,
+                             r->corrupt_chunks, r->digest };
+#endif
+        
+        crc = ehms_crc32_update(crc, fold, (uint32_t)sizeof(fold));
+    }
+    
+    return crc ^ EHMS_CRC32_INITIAL;
+}
+
+int main(int argc, char* argv[])
+{
+    unsigned long log_count = BENCH_DEFAULT_LOGS;
+    unsigned long cycles = BENCH_DEFAULT_CYCLES;
+    long max_workers = sysconf(_SC_NPROCESSORS_ONLN);
+    bench_log_t* logs = NULL;
+    fleet_log_t* batch = NULL;
+    fleet_log_result_t* results = NULL;
+    uint32_t reference_digest = 0U;
+    double reference_s = 0.0;
+    uint64_t chunk_total = 0U;
+    bool identical = true;
+    int status = 0;
+    
+    if (argc > 1)
+    {
+        log_count = strtoul(argv[1], NULL, 10);
+    }
+    
+    if (argc > 2)
+    {
+        cycles = strtoul(argv[2], NULL, 10);
+    }
+    
+    if (argc > 3)
+    {
+        max_workers = strtol(argv[3], NULL, 10);
+    }
+    
+    if (max_workers < 1L)
+    {
+        max_workers = 1L;
+    }
+    else if (max_workers > (long)FLEET_MAX_WORKERS)
+    {
+        max_workers = (long)FLEET_MAX_WORKERS;
+    }
+    
+    if ((log_count == 0UL) || (log_count > 100000UL))
+    {
+        log_count = BENCH_DEFAULT_LOGS;
+    }
+    
+    logs = calloc(log_count, sizeof(*logs));
+    batch = calloc(log_count, sizeof(*batch));
+    results = calloc(log_count, sizeof(*results));
+    
+    if ((logs == NULL) || (batch == NULL) || (results == NULL))
+    {
+        (void)fprintf(stderr, "out of memory\n");
+        status = 1;
+    }
+    
+    (void)replay_set_virtual_time(true);
+    
+    /* Flights of 1/4 to 7/4 of the nominal length */
+    for (unsigned long i = 0UL; (i < log_count) && (status == 0); i++)
+    {
+        unsigned long length = (cycles * (1UL + ((i * 5UL) % 7UL))) / 4UL;
+        
+        status = bench_record_flight((uint32_t)(BENCH_SEED + i), length, &logs[i]);
+        batch[i].chunks = logs[i].chunk;
+        batch[i].chunk_count = logs[i].count;
+        batch[i].epoch.year = 2026U;
+        batch[i].epoch.month = 1U;
+        batch[i].epoch.day = 1U;
+        chunk_total += logs[i].count;
+    }
+    
+    if (status == 0)
+    {
+        (void)printf("Fleet reprocessing benchmark: %lu logs, %llu chunks (%.1f MiB), "
+                     "%u engines, %lu nominal cycles\n", log_count,
+                     (unsigned long long)chunk_total,
+                     ((double)chunk_total * (double)RS_CHUNK_BYTES) / (1024.0 * 1024.0),
+                     (unsigned)BENCH_ENGINES, cycles);
+        (void)printf("%7s %10s %12s %8s %7s  %s\n", "workers", "seconds", "samples/s",
+                     "speed-up", "steals", "digest");
+    }
+    
+    for (long workers = 1L; (workers <= max_workers) && (status == 0);
+         workers = bench_next_workers(workers, max_workers))
+    {
+        fleet_run_statistics_t stats;
+        double start = bench_now_s();
+        ehms_result_t ran = fleet_run(batch, (uint32_t)log_count, (uint32_t)workers, results,
+                                      &stats);
+        double elapsed = bench_now_s() - start;
+        uint32_t digest = bench_batch_digest(results, (uint32_t)log_count);
+        
+        if ((ran != EHMS_OK) || (stats.failed_logs > 0U))
+        {
+            (void)fprintf(stderr, "fleet run failed (%d, %u logs)\n", (int)ran,
+                          (unsigned)stats.failed_logs);
+            status = 1;
+        }
+        else
+        {
+            if (workers == 1L)
+            {
+                reference_digest = digest;
+                reference_s = elapsed;
+            }
+            identical = identical && (digest == reference_digest);
+            
+            (void)printf("%7ld %10.3f %12.0f %8.2f %7u  %08X\n", workers, elapsed,
+                         (elapsed > 0.0) ? ((double)stats.samples / elapsed) : 0.0,
+                         (elapsed > 0.0) ? (reference_s / elapsed) : 0.0,
+                         (unsigned)stats.steals, (unsigned)digest);
+        }
+    }
+    
+    if (status == 0)
+    {
+        (void)printf("\nDeterminism: %s\n", identical ? "match" : "MISMATCH");
+        status = identical ? 0 : 1;
+    }
+    
+    for (unsigned long i = 0UL; (logs != NULL) && (i < log_count); i++)
+    {
+        free(logs[i].chunk);
+    }
+    free(logs);
+    free(batch);
+    free(results);
+    
+    return status;
+}
+
+/* END OF FILE */
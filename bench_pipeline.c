@@ -0,0 +1,418 @@
+/**
+ * @file bench_pipeline.c
+ * @brief Host Replay Throughput Benchmark for the Acquisition and Alert Pipeline
+ *
+ * @copyright Copyright (c) 2026 AeroTech Avionics Inc.
+ *
+ * Replays bus traffic through daq_execute_cycle, daq_get_engine_snapshot,
+ * alert_process_snapshot and the EICAS and recorder dispatchers faster than
+ * real time (replay_engine.c stands in for the drivers and consumers) and
+ * reports, for one to four engines and increasing bus load:
+ *
+ *   - cycles per second of the whole pipeline
+ *   - mean and maximum latency of each phase: ARINC 429 reads, 1553 reads,
+ *     validation, snapshot packing with CRC and publication (from
+ *     daq_get_timing_statistics), snapshot read, threshold evaluation and
+ *     alert fan-out
+ *   - alert events, FIFO overruns and the replay digest from a second pass on
+ *     the virtual timebase; these depend on the traffic alone, so the digest
+ *     changes between commits only when pipeline output changes
+ *
+ * followed by the sizes of the per-engine interface structures. Parameter
+ * and threshold counts are fixed at compile time (EHMS_PARAM_COUNT and the
+ * threshold table), so load is scaled by engine count, by transmitting
+ * each label several times per cycle and by adding unrouted labels that
+ * the FIFO read path shall discard.
+ *
+ * Without a trace the A320neo synthetic profile is replayed, with an EGT
+ * excursion through the caution limit every ten seconds.
+ *
+ * Usage: bench_pipeline [cycles] [trace-file]
+ */
+
+#define _POSIX_C_SOURCE 200809L
+
+#include "replay_engine.h"
+#include "ehms_types.h"
+#include "data_acquisition.h"
+#include "data_acquisition_ext.h"
+#include "alert_manager.h"
+#include "alert_manager_ext.h"
+#include "arinc429_driver.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+/* ============================================================================
+ * CONSTANTS
+ * ============================================================================ */
+
+#define BENCH_DEFAULT_CYCLES        20000UL
+#define BENCH_SAMPLE_RATE_HZ        100U
+
+/** @brief Excursion every 10 s lasting 0.5 s */
+#define BENCH_EXCURSION_PERIOD      1000U
+#define BENCH_EXCURSION_CYCLES      50U
+
+#define BENCH_SEED                  0x45484D53UL
+
+/* ============================================================================
+ * TYPES
+ * ============================================================================ */
+
+/**
+ * @brief Pipeline phases timed by the benchmark
+ */
+typedef enum
+{
+    BENCH_PHASE_SNAPSHOT    = 0U,   /**< daq_get_engine_snapshot, all engines */
+    BENCH_PHASE_THRESHOLD   = 1U,   /**< alert_process_snapshot, all engines */
+    BENCH_PHASE_FANOUT      = 2U,   /**< EICAS and recorder dispatch */
+    BENCH_PHASE_COUNT       = 3U
+} bench_phase_t;
+
+typedef struct
+{
+    double          total_ns;
+    double          max_ns;
+} bench_timing_t;
+
+/**
+ * @brief Bus load case
+ */
+typedef struct
+{
+    const char*     name;
+    uint32_t        repeat;             /**< Transmissions per label per cycle */
+    uint32_t        unrouted_labels;    /**< Extra labels per bus per cycle */
+} bench_load_t;
+
+/**
+ * @brief Result of one replay
+ */
+typedef struct
+{
+    double                  cycles_per_s;
+    uint32_t                cycles;
+    daq_timing_statistics_t daq;
+    bench_timing_t          phase[BENCH_PHASE_COUNT];
+    replay_statistics_t     replay;
+} bench_result_t;
+
+/* ============================================================================
+ * DATA
+ * ============================================================================ */
+
+/**
+ * @brief A320neo engine interface traffic, counts of the label resolution
+ *
+ * Every ARINC 429 label is transmitted on its primary and backup bus.
+ */
+static const replay_source_t s_a320neo_sources[] =
+{
+    /* bus,                 ch, label,  encoding,            width, nominal, noise, excursion */
+    { REPLAY_BUS_ARINC429,   0U, 0o310U, REPLAY_ENCODING_BNR, 18U,     850,     5,       0 },
+    { REPLAY_BUS_ARINC429,   0U, 0o311U, REPLAY_ENCODING_BNR, 18U,     920,     4,       0 },
+    { REPLAY_BUS_ARINC429,   0U, 0o312U, REPLAY_ENCODING_BNR, 18U,     640,     6,     330 },
+    { REPLAY_BUS_ARINC429,   0U, 0o313U, REPLAY_ENCODING_BCD,  5U,   24000,    50,       0 },
+    { REPLAY_BUS_ARINC429,   0U, 0o314U, REPLAY_ENCODING_BNR, 18U,     270,     2,       0 },
+    { REPLAY_BUS_ARINC429,   0U, 0o315U, REPLAY_ENCODING_BNR, 18U,     550,     5,       0 },
+    { REPLAY_BUS_ARINC429,   0U, 0o316U, REPLAY_ENCODING_BNR,  8U,      36,     0,       0 },
+    { REPLAY_BUS_ARINC429,   0U, 0o321U, REPLAY_ENCODING_BNR, 18U,    1300,     3,       0 },
+    { REPLAY_BUS_ARINC429,   1U, 0o310U, REPLAY_ENCODING_BNR, 18U,     850,     5,       0 },
+    { REPLAY_BUS_ARINC429,   1U, 0o311U, REPLAY_ENCODING_BNR, 18U,     920,     4,       0 },
+    { REPLAY_BUS_ARINC429,   1U, 0o312U, REPLAY_ENCODING_BNR, 18U,     640,     6,     330 },
+    { REPLAY_BUS_ARINC429,   1U, 0o313U, REPLAY_ENCODING_BCD,  5U,   24000,    50,       0 },
+    { REPLAY_BUS_ARINC429,   1U, 0o314U, REPLAY_ENCODING_BNR, 18U,     270,     2,       0 },
+    { REPLAY_BUS_ARINC429,   1U, 0o315U, REPLAY_ENCODING_BNR, 18U,     550,     5,       0 },
+    { REPLAY_BUS_ARINC429,   1U, 0o316U, REPLAY_ENCODING_BNR,  8U,      36,     0,       0 },
+    { REPLAY_BUS_ARINC429,   1U, 0o321U, REPLAY_ENCODING_BNR, 18U,    1300,     3,       0 },
+    { REPLAY_BUS_ARINC429,   2U, 0o317U, REPLAY_ENCODING_BNR, 18U,    1200,    50,       0 },
+    { REPLAY_BUS_ARINC429,   2U, 0o320U, REPLAY_ENCODING_BNR, 18U,    1600,    50,       0 },
+    { REPLAY_BUS_ARINC429,   3U, 0o317U, REPLAY_ENCODING_BNR, 18U,    1200,    50,       0 },
+    { REPLAY_BUS_ARINC429,   3U, 0o320U, REPLAY_ENCODING_BNR, 18U,    1600,    50,       0 },
+    
+    /* Vibration subaddress: fan, core */
+    { REPLAY_BUS_MILSTD1553, 5U, 0U,     REPLAY_ENCODING_WORD, 16U,   1200,    50,       0 },
+    { REPLAY_BUS_MILSTD1553, 5U, 1U,     REPLAY_ENCODING_WORD, 16U,   1600,    50,       0 },
+};
+
+#define BENCH_SOURCE_COUNT  (sizeof(s_a320neo_sources) / sizeof(s_a320neo_sources[0]))
+
+static const bench_load_t s_loads[] =
+{
+    { "nominal",     1U,  0U },
+    { "4x bus",      4U, 16U },
+    { "16x bus",    16U, 64U },
+};
+
+#define BENCH_LOAD_COUNT    (sizeof(s_loads) / sizeof(s_loads[0]))
+
+static const char* const s_daq_phase_names[DAQ_PHASE_COUNT] =
+{
+    "arinc429", "1553", "validate", "crc+pub", "daq cycle"
+};
+
+static const char* const s_bench_phase_names[BENCH_PHASE_COUNT] =
+{
+    "snapshot", "threshold", "fan-out"
+};
+
+static ehms_engine_snapshot_t s_snapshots[EHMS_MAX_ENGINES];
+
+/* ============================================================================
+ * FUNCTIONS
+ * ============================================================================ */
+
+static double bench_now_ns(void)
+{
+    struct timespec ts;
+    (void)clock_gettime(CLOCK_MONOTONIC, &ts);
+    
+    return ((double)ts.tv_sec * 1.0e9) + (double)ts.tv_nsec;
+}
+
+static void bench_record(bench_timing_t* timing, double start, double end)
+{
+    double elapsed = end - start;
+    
+    timing->total_ns += elapsed;
+    if (elapsed > timing->max_ns)
+    {
+        timing->max_ns = elapsed;
+    }
+}
+
+/**
+ * @brief Replay up to max_cycles cycles of the started trace or profile
+ */
+static int bench_replay(uint32_t engine_count, unsigned long max_cycles, bench_result_t* out)
+{
+    daq_config_t config;
+    int status = 0;
+    
+    (void)memset(&config, 0, sizeof(config));
+    (void)memset(out, 0, sizeof(*out));
+    config.sample_rate_hz = BENCH_SAMPLE_RATE_HZ;
+    config.engine_count = engine_count;
+    
+    for (uint8_t i = 0U; i < EHMS_ARINC429_BUS_COUNT; i++)
+    {
+        config.arinc_config[i].speed = ARINC429_HIGH_SPEED;
+        config.arinc_config[i].parity = ARINC429_ODD_PARITY;
+    }
+    
+    if ((daq_init(&config) != EHMS_OK) || (alert_init() != EHMS_OK))
+    {
+        (void)fprintf(stderr, "pipeline initialization failed\n");
+        status = 1;
+    }
+    
+    double start = bench_now_ns();
+    
+    while ((status == 0) && (out->cycles < max_cycles) && replay_step())
+    {
+        (void)daq_execute_cycle();
+        
+        double t0 = bench_now_ns();
+        
+        for (uint32_t eng = 0U; eng < engine_count; eng++)
+        {
+            (void)daq_get_engine_snapshot((ehms_engine_id_t)eng, &s_snapshots[eng]);
+        }
+        
+        double t1 = bench_now_ns();
+        
+        for (uint32_t eng = 0U; eng < engine_count; eng++)
+        {
+            (void)alert_process_snapshot(&s_snapshots[eng]);
+        }
+        
+        double t2 = bench_now_ns();
+        
+        (void)alert_dispatch_eicas(UINT32_MAX);
+        (void)alert_dispatch_recorder(UINT32_MAX);
+        
+        double t3 = bench_now_ns();
+        
+        bench_record(&out->phase[BENCH_PHASE_SNAPSHOT], t0, t1);
+        bench_record(&out->phase[BENCH_PHASE_THRESHOLD], t1, t2);
+        bench_record(&out->phase[BENCH_PHASE_FANOUT], t2, t3);
+        
+        for (uint32_t eng = 0U; eng < engine_count; eng++)
+        {
+            replay_digest_update(&s_snapshots[eng].crc32, (uint32_t)sizeof(uint32_t));
+        }
+        
+        out->cycles++;
+    }
+    
+    double elapsed = bench_now_ns() - start;
+    
+    out->cycles_per_s = (elapsed > 0.0) ? (((double)out->cycles * 1.0e9) / elapsed) : 0.0;
+    (void)daq_get_timing_statistics(&out->daq);
+    (void)replay_get_statistics(&out->replay);
+    
+    return status;
+}
+
+static void bench_print_header(void)
+{
+    (void)printf("%-4s %-8s %10s", "eng", "load", "cycles/s");
+    
+    for (uint32_t p = 0U; p < (uint32_t)DAQ_PHASE_COUNT; p++)
+    {
+        (void)printf(" %13s", s_daq_phase_names[p]);
+    }
+    
+    for (uint32_t p = 0U; p < (uint32_t)BENCH_PHASE_COUNT; p++)
+    {
+        (void)printf(" %13s", s_bench_phase_names[p]);
+    }
+    
+    (void)printf(" %8s %8s %8s  %s\n", "eicas", "recorder", "overrun", "digest");
+}
+
+static void bench_print_result(uint32_t engine_count, const char* load,
+                               const bench_result_t* result,
+                               const replay_statistics_t* replay)
+{
+    double cycles = (result->cycles > 0U) ? (double)result->cycles : 1.0;
+    
+    (void)printf("%-4u %-8s %10.0f", (unsigned)engine_count, load, result->cycles_per_s);
+    
+    /* Mean/max in microseconds */
+    for (uint32_t p = 0U; p < (uint32_t)DAQ_PHASE_COUNT; p++)
+    {
+        (void)printf("  %5.2f/%6.2f", (double)result->daq.phase[p].mean_ns / 1.0e3,
+                     (double)result->daq.phase[p].max_ns / 1.0e3);
+    }
+    
+    for (uint32_t p = 0U; p < (uint32_t)BENCH_PHASE_COUNT; p++)
+    {
+        (void)printf("  %5.2f/%6.2f", (result->phase[p].total_ns / cycles) / 1.0e3,
+                     result->phase[p].max_ns / 1.0e3);
+    }
+    
+    (void)printf(" %8u %8u %8u  %08X\n", (unsigned)replay->eicas_events,
+                 (unsigned)replay->recorder_events, (unsigned)replay->fifo_overruns,
+                 (unsigned)replay->digest);
+}
+
+static void bench_print_footprint(void)
+{
+    (void)printf("\nInterface footprint (bytes)\n");
+    (void)printf("  %-32s %8u\n", "ehms_engine_snapshot_t",
+                 (unsigned)sizeof(ehms_engine_snapshot_t));
+    (void)printf("  %-32s %8u\n", "ehms_engine_block_t",
+                 (unsigned)sizeof(ehms_engine_block_t));
+    (void)printf("  %-32s %8u\n", "ehms_alert_t", (unsigned)sizeof(ehms_alert_t));
+    (void)printf("  %-32s %8u\n", "snapshots copied per cycle (4 eng)",
+                 (unsigned)(sizeof(ehms_engine_snapshot_t) * EHMS_MAX_ENGINES));
+}
+
+int main(int argc, char* argv[])
+{
+    unsigned long max_cycles = BENCH_DEFAULT_CYCLES;
+    const char* trace = NULL;
+    replay_profile_t profile;
+    bench_result_t timed;
+    bench_result_t verified;
+    uint32_t reference_digest = 0U;
+    bool virtual_time = (replay_set_virtual_time(true) == EHMS_OK);
+    int status = 0;
+    
+    if (argc > 1)
+    {
+        max_cycles = strtoul(argv[1], NULL, 10);
+    }
+    
+    if (argc > 2)
+    {
+        trace = argv[2];
+    }
+    
+    (void)memset(&profile, 0, sizeof(profile));
+    profile.sources = s_a320neo_sources;
+    profile.source_count = (uint32_t)BENCH_SOURCE_COUNT;
+    profile.excursion_period = BENCH_EXCURSION_PERIOD;
+    profile.excursion_cycles = BENCH_EXCURSION_CYCLES;
+    profile.seed = BENCH_SEED;
+    
+    (void)printf("Pipeline replay benchmark: %s, up to %lu cycles, mean/max us per cycle\n",
+                 (trace != NULL) ? trace : "A320neo synthetic profile", max_cycles);
+    bench_print_header();
+    
+    for (uint32_t engines = 1U; (engines <= EHMS_MAX_ENGINES) && (status == 0); engines++)
+    {
+        uint32_t load_count = (trace != NULL) ? 1U : (uint32_t)BENCH_LOAD_COUNT;
+        
+        for (uint32_t l = 0U; (l < load_count) && (status == 0); l++)
+        {
+            ehms_result_t started;
+            
+            if (trace != NULL)
+            {
+                started = replay_load_trace(trace, engines);
+            }
+            else
+            {
+                profile.engine_count = engines;
+                profile.repeat = s_loads[l].repeat;
+                profile.unrouted_labels = s_loads[l].unrouted_labels;
+                started = replay_start_profile(&profile);
+            }
+            
+            if (started != EHMS_OK)
+            {
+                (void)fprintf(stderr, "cannot start replay (%d)\n", (int)started);
+                status = 1;
+            }
+            else
+            {
+                (void)replay_set_virtual_time(false);
+                status = bench_replay(engines, max_cycles, &timed);
+                verified = timed;
+                
+                /* Counts and digest from the virtual timebase depend on the traffic alone */
+                if ((status == 0) && virtual_time)
+                {
+                    replay_rewind();
+                    (void)replay_set_virtual_time(true);
+                    status = bench_replay(engines, max_cycles, &verified);
+                }
+                
+                bench_print_result(engines, (trace != NULL) ? "trace" : s_loads[l].name,
+                                   &timed, &verified.replay);
+                reference_digest = verified.replay.digest;
+            }
+        }
+    }
+    
+    /* Replay the last case again: identical traffic shall produce an identical digest */
+    if ((status == 0) && virtual_time)
+    {
+        replay_rewind();
+        status = bench_replay(EHMS_MAX_ENGINES, max_cycles, &verified);
+        
+        (void)printf("\nDeterminism: %s\n",
+                     (verified.replay.digest == reference_digest) ? "match" : "MISMATCH");
+        
+        if (verified.replay.digest != reference_digest)
+        {
+            status = 1;
+        }
+    }
+    else if (status == 0)
+    {
+        (void)printf("\nDeterminism: not checked (hardware timebase)\n");
+    }
+    
+    bench_print_footprint();
+    
+    return status;
+}
+
+/* END OF FILE */
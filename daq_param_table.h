@@ -0,0 +1,137 @@
+/**
+ * @file daq_param_table.h
+ * @brief EHMS Parameter Configuration Table (airbus_a320neo)
+ *
+ * @copyright Copyright (c) 2026 AeroTech Avionics Inc.
+ * @note This file is subject to DO-178C Level B certification requirements
+ *
+ * GENERATED by tools/gen_param_table.py from config/oem_configurations/airbus_a320neo.json.
+ * Do not edit; change the OEM configuration and regenerate.
+ *
+ * CSCI: EHMS-CORE
+ * CSC: DATA-ACQUISITION
+ *
+ * Requirements Trace:
+ *   SRS-EHMS-100: System shall acquire engine parameters at 100Hz
+ *   SRS-EHMS-103: System shall support redundant data sources
+ *
+ * Airbus A320neo, CFM LEAP-1A / PW1100G-JM engine interface.
+ *
+ * Private to data_acquisition.c, which is its only includer.
+ */
+
+#ifndef DAQ_PARAM_TABLE_H
+#define DAQ_PARAM_TABLE_H
+
+/* ============================================================================
+ * INCLUDES
+ * ============================================================================ */
+#include "ehms_types.h"
+#include "data_acquisition.h"
+#include "arinc429_driver.h"
+#include "arinc429_decode.h"
+
+/* ============================================================================
+ * CONSTANTS
+ * ============================================================================ */
+
+/** @brief Platform the table was generated for */
+#define DAQ_PARAM_TABLE_PLATFORM            "airbus_a320neo"
+
+/** @brief Alignment of the generated tables (cache line) */
+#ifndef DAQ_PARAM_TABLE_ALIGN
+#define DAQ_PARAM_TABLE_ALIGN               64U
+#endif
+
+/* ============================================================================
+ * TYPES
+ * ============================================================================ */
+
+/**
+ * @brief Data field encodings of the platform's labels
+ */
+typedef enum
+{
+    DAQ_ENCODING_UNUSED     = 0U,   /**< Parameter not acquired over ARINC 429 */
+    DAQ_ENCODING_BNR18      = 1U,   /**< BNR, 18 significant bits */
+    DAQ_ENCODING_BCD5       = 2U,   /**< BCD, 5 digits */
+    DAQ_ENCODING_BNR8       = 3U,   /**< BNR, 8 significant bits */
+    DAQ_ENCODING_COUNT      = 4U
+} daq_encoding_t;
+
+/* ============================================================================
+ * DATA
+ * ============================================================================ */
+
+/** @brief Parameter configuration table */
+static _Alignas(DAQ_PARAM_TABLE_ALIGN)
+const daq_param_config_t s_param_config[EHMS_PARAM_COUNT] =
+{
+    /* param_id, arinc_label, bus_primary, bus_backup, scale_factor, offset */
+    [EHMS_PARAM_N1]        = { EHMS_PARAM_N1,        0o310, 0, 1, 0.1f,   0.0f    },
+    [EHMS_PARAM_N2]        = { EHMS_PARAM_N2,        0o311, 0, 1, 0.1f,   0.0f    },
+    [EHMS_PARAM_EGT]       = { EHMS_PARAM_EGT,       0o312, 0, 1, 1.0f,   0.0f    },
+    [EHMS_PARAM_FF]        = { EHMS_PARAM_FF,        0o313, 0, 1, 0.1f,   0.0f    },
+    [EHMS_PARAM_OIL_TEMP]  = { EHMS_PARAM_OIL_TEMP,  0o314, 0, 1, 0.5f,   -40.0f  },
+    [EHMS_PARAM_OIL_PRESS] = { EHMS_PARAM_OIL_PRESS, 0o315, 0, 1, 0.1f,   0.0f    },
+    [EHMS_PARAM_OIL_QTY]   = { EHMS_PARAM_OIL_QTY,   0o316, 0, 1, 0.5f,   0.0f    },
+    [EHMS_PARAM_VIB_FAN]   = { EHMS_PARAM_VIB_FAN,   0o317, 2, 3, 0.001f, 0.0f    },
+    [EHMS_PARAM_VIB_CORE]  = { EHMS_PARAM_VIB_CORE,  0o320, 2, 3, 0.001f, 0.0f    },
+    [EHMS_PARAM_EPR]       = { EHMS_PARAM_EPR,       0o321, 0, 1, 0.001f, 0.0f    },
+};
+
+/** @brief Data field encoding of each parameter, daq_encoding_t */
+static _Alignas(DAQ_PARAM_TABLE_ALIGN)
+const uint8_t s_param_encoding[EHMS_PARAM_COUNT] =
+{
+    [EHMS_PARAM_N1]        = (uint8_t)DAQ_ENCODING_BNR18,
+    [EHMS_PARAM_N2]        = (uint8_t)DAQ_ENCODING_BNR18,
+    [EHMS_PARAM_EGT]       = (uint8_t)DAQ_ENCODING_BNR18,
+    [EHMS_PARAM_FF]        = (uint8_t)DAQ_ENCODING_BCD5,
+    [EHMS_PARAM_OIL_TEMP]  = (uint8_t)DAQ_ENCODING_BNR18,
+    [EHMS_PARAM_OIL_PRESS] = (uint8_t)DAQ_ENCODING_BNR18,
+    [EHMS_PARAM_OIL_QTY]   = (uint8_t)DAQ_ENCODING_BNR8,
+    [EHMS_PARAM_VIB_FAN]   = (uint8_t)DAQ_ENCODING_BNR18,
+    [EHMS_PARAM_VIB_CORE]  = (uint8_t)DAQ_ENCODING_BNR18,
+    [EHMS_PARAM_EPR]       = (uint8_t)DAQ_ENCODING_BNR18,
+};
+
+/* ============================================================================
+ * FUNCTIONS
+ * ============================================================================ */
+
+/**
+ * @brief Decode the data field of a received word
+ *
+ * @param[in]  param   Parameter the word's label is routed to
+ * @param[in]  word    Received word
+ * @param[out] counts  Receives the value in counts of the parameter's resolution
+ * @return true if the data field is valid for the parameter's encoding
+ */
+static inline bool daq_decode_arinc429_word(uint32_t param, const arinc429_word_t* word,
+                                            int32_t* counts)
+{
+    bool valid = true;
+    
+    switch ((daq_encoding_t)s_param_encoding[param])
+    {
+        case DAQ_ENCODING_BNR18:
+            *counts = arinc429_decode_bnr(word->data, 18U);
+            break;
+        case DAQ_ENCODING_BCD5:
+            valid = arinc429_decode_bcd(word->data, word->ssm, 5U, counts);
+            break;
+        case DAQ_ENCODING_BNR8:
+            *counts = arinc429_decode_bnr(word->data, 8U);
+            break;
+        default:
+            valid = false;
+            break;
+    }
+    
+    return valid;
+}
+
+#endif /* DAQ_PARAM_TABLE_H */
+
+/* END OF FILE */
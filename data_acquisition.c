@@ -24,11 +24,31 @@
 #include "ehms_types.h"
 #include "ehms_config.h"
 #include "data_acquisition.h"
+#include "data_acquisition_ext.h"
+#include "daq_param_table.h"
 #include "arinc429_driver.h"
 #include "milstd1553_driver.h"
 #include "parameter_database.h"
 #include "error_handler.h"
+#include "ehms_crc32.h"
+#include "ehms_timebase.h"
+#include "param_validation.h"
+#if defined(EHMS_FIXED_POINT_PIPELINE)
+#include "ehms_fixed_point.h"
+#endif
+#if defined(DAQ_VIBRATION_BURST)
+#include "vibration_analysis.h"
+#endif
+#if defined(DAQ_TREND_ENGINE)
+#include "trend_engine.h"
+#endif
+#if defined(DAQ_ANOMALY_DETECTION)
+#include "anomaly_detection.h"
+#endif
 
+#include <math.h>
+#include <stdatomic.h>
+#include <stddef.h>
 #include <string.h>
 
 /* ============================================================================
@@ -38,14 +58,74 @@
 /** @brief Data staleness timeout in milliseconds */
 #define DAQ_STALE_TIMEOUT_MS            100U
 
+/** @brief Minor cycles per major frame (1 s at the 100 Hz minor cycle) */
+#define DAQ_MAJOR_FRAME_CYCLES          100U
+
+/** @brief Milliseconds per day (calendar timestamp derivation) */
+#define DAQ_MS_PER_DAY                  86400000L
+
 /** @brief Maximum consecutive failures before source marked failed */
 #define DAQ_MAX_CONSECUTIVE_FAILURES    5U
 
+/** @brief Cycles between recovery probes of an inactive primary source (1s) */
+#define DAQ_SOURCE_PROBE_CYCLES         100U
+
 /** @brief Acquisition cycle period in microseconds (10ms = 100Hz) */
 #define DAQ_CYCLE_PERIOD_US             10000U
 
-/** @brief CRC polynomial for data validation */
-#define DAQ_CRC32_POLYNOMIAL            0xEDB88320UL
+/** @brief Cycle deadline in nanoseconds */
+#define DAQ_CYCLE_DEADLINE_NS           (DAQ_CYCLE_PERIOD_US * 1000U)
+
+/** @brief Snapshot CRC segments: header, one per parameter, trailer */
+#define DAQ_CRC_SEGMENT_COUNT           (EHMS_PARAM_COUNT + 2U)
+
+/** @brief CRC segment covering engine_id, sample_time and flight_phase */
+#define DAQ_CRC_SEGMENT_HEADER          0U
+
+/** @brief CRC segment covering health_status */
+#define DAQ_CRC_SEGMENT_TRAILER         (EHMS_PARAM_COUNT + 1U)
+
+/** @brief CRC segment covering one parameters[] entry */
+#define DAQ_CRC_SEGMENT_PARAM(p)        ((p) + 1U)
+
+/** @brief Mask with every CRC segment set; defined for all 64 segments */
+#define DAQ_CRC_SEGMENT_ALL             (~0ULL >> (64U - DAQ_CRC_SEGMENT_COUNT))
+
+/** @brief Published snapshot buffers per engine (triple buffering) */
+#define DAQ_PUBLISH_BUFFER_COUNT        3U
+
+/** @brief Publication control word: published buffer index field */
+#define DAQ_PUBLISH_INDEX_MASK          0x000000FFUL
+
+/** @brief Publication control word: reader count field of buffer b */
+#define DAQ_PUBLISH_READER_SHIFT(b)     (8U + ((b) * 8U))
+#define DAQ_PUBLISH_READER_MASK(b)      (0xFFUL << DAQ_PUBLISH_READER_SHIFT(b))
+#define DAQ_PUBLISH_READER_ONE(b)       (1UL << DAQ_PUBLISH_READER_SHIFT(b))
+
+/** @brief Number of ARINC 429 labels (8-bit label field) */
+#define DAQ_ARINC429_LABEL_COUNT        256U
+
+/** @brief Label value marking an unconfigured parameter table entry */
+#define DAQ_ARINC429_LABEL_UNUSED       0U
+
+/** @brief Label index entry for labels not routed to any parameter */
+#define DAQ_ARINC429_NO_SLOT            0xFFU
+
+#if defined(DAQ_VIBRATION_BURST)
+/** @brief 1553 subaddresses carrying the fan and core waveform bursts */
+#define DAQ_1553_SA_VIB_BURST_FAN       6U
+#define DAQ_1553_SA_VIB_BURST_CORE      7U
+#endif
+
+/** @brief Snapshot bytes covered by the CRC (everything before crc32) */
+#define DAQ_SNAPSHOT_CRC_LENGTH         (sizeof(ehms_engine_snapshot_t) - sizeof(uint32_t))
+
+#if defined(DAQ_PARALLEL_ENGINES)
+/** @brief Places state written by one core on cache lines of its own */
+#define DAQ_CORE_ALIGNED                _Alignas(DAQ_CACHE_LINE_BYTES)
+#else
+#define DAQ_CORE_ALIGNED
+#endif
 
 /* ============================================================================
  * PRIVATE TYPES
@@ -66,56 +146,396 @@ typedef struct
 } daq_source_info_t;
 
 /**
- * @brief Module state structure
+ * @brief Acquisition rate groups
+ */
+typedef enum
+{
+    DAQ_RATE_100HZ          = 0U,   /**< Every minor cycle */
+    DAQ_RATE_50HZ           = 1U,   /**< Every 2nd minor cycle */
+    DAQ_RATE_10HZ           = 2U,   /**< Every 10th minor cycle */
+    DAQ_RATE_1HZ            = 3U,   /**< Once per major frame */
+    DAQ_RATE_GROUP_COUNT    = 4U
+} daq_rate_group_id_t;
+
+/**
+ * @brief Rate group definition
+ */
+typedef struct
+{
+    uint32_t            divisor;                /**< Minor cycles per read */
+    uint32_t            stale_timeout_ms;       /**< Age at which data is stale */
+} daq_rate_group_t;
+
+/**
+ * @brief Minor/major frame read schedule
+ *
+ * Built at initialization. A parameter of a group read every d-th minor
+ * cycle is given an offset within those d cycles so each group's reads are
+ * spread evenly across the major frame.
+ */
+typedef struct
+{
+    uint64_t            due_slots[DAQ_MAJOR_FRAME_CYCLES][EHMS_ARINC429_BUS_COUNT]; /**< Primary slots read per minor cycle */
+    uint32_t            stale_timeout_ms[EHMS_PARAM_COUNT];  /**< Per-parameter staleness */
+} daq_schedule_t;
+
+/**
+ * @brief ARINC 429 routing table for one bus
+ *
+ * Built at initialization from s_param_config. Lists the parameters whose
+ * primary or backup source is the bus, in table order, and maps each label
+ * received on the bus to its routing slot.
+ */
+typedef struct
+{
+    uint32_t            count;                  /**< Routed parameters */
+    uint64_t            primary_mask;           /**< Slots with bus as primary */
+    uint8_t             param[EHMS_PARAM_COUNT]; /**< Parameter of each slot */
+    uint8_t             label[EHMS_PARAM_COUNT]; /**< Label of each slot */
+    uint8_t             label_slot[DAQ_ARINC429_LABEL_COUNT]; /**< Label index */
+} daq_arinc429_route_t;
+
+#if defined(DAQ_ARINC429_FIFO_READ)
+/**
+ * @brief Words drained from one bus receive FIFO in the current cycle
+ *
+ * The FIFO is drained once per cycle; every engine acquiring from the bus
+ * in that cycle is served from this latch.
+ */
+typedef struct
+{
+    uint32_t            cycle;                  /**< Cycle of last drain */
+    ehms_result_t       result;                 /**< Result of last drain */
+    uint64_t            received;               /**< Slots received */
+    arinc429_word_t     word[EHMS_PARAM_COUNT]; /**< Latest word per slot */
+} daq_arinc429_rx_t;
+#endif
+
+/**
+ * @brief Snapshot CRC segment layout
+ */
+typedef struct
+{
+    uint32_t            offset;                 /**< Byte offset in snapshot */
+    uint32_t            length;                 /**< Segment length in bytes */
+    ehms_crc32_shift_t  shift;                  /**< Shift over bytes after segment */
+} daq_crc_segment_t;
+
+/**
+ * @brief Incremental snapshot CRC state
+ *
+ * The snapshot CRC is the XOR of the per-segment contributions with the
+ * initial-value term, so a changed segment is folded in by XOR-ing out its
+ * old contribution and XOR-ing in the new one.
+ */
+typedef struct
+{
+    uint32_t            contribution[DAQ_CRC_SEGMENT_COUNT]; /**< Shifted segment CRCs */
+    uint32_t            combined;               /**< XOR of all contributions */
+    uint64_t            dirty_mask;             /**< Segments written this cycle */
+} daq_snapshot_crc_t;
+
+/**
+ * @brief Working state of one engine
+ *
+ * Everything an engine's processing writes during a cycle, kept together
+ * so that with DAQ_PARALLEL_ENGINES each lane starts on its own cache line
+ * and the cores processing neighbouring engines never share a line.
+ */
+typedef struct
+{
+    DAQ_CORE_ALIGNED
+    ehms_engine_block_t     block;              /**< Parameter block (SoA) */
+    ehms_engine_snapshot_t  snapshot;           /**< Snapshot being assembled */
+    daq_snapshot_crc_t      crc;                /**< Incremental snapshot CRC */
+#if defined(DAQ_ANOMALY_DETECTION)
+    ehms_health_status_t    health;             /**< Assessed health_status */
+#endif
+#if defined(DAQ_VIBRATION_BURST)
+    bool                    vib_pending;        /**< Bursts read, analysis due */
+#endif
+} daq_engine_lane_t;
+
+/**
+ * @brief Published copy of one engine's data
+ */
+typedef struct
+{
+    ehms_engine_snapshot_t  snapshot;           /**< External (AoS) form */
+    ehms_engine_block_t     block;              /**< Internal (SoA) form */
+} daq_published_t;
+
+/**
+ * @brief Lock-free snapshot publication (one writer, many readers)
+ *
+ * The acquisition task assembles each snapshot in its engine lane and copies
+ * it, with its parameter block, into a back buffer that is neither
+ * published nor held by a reader, then flips the published index. A single
+ * control word carries the published index and a reader count per buffer,
+ * so a reader pins the buffer it was handed in the same atomic step that
+ * selects it and the writer can never reuse a buffer while it is being
+ * read.
+ */
+typedef struct
+{
+    DAQ_CORE_ALIGNED
+    daq_published_t         buffers[DAQ_PUBLISH_BUFFER_COUNT]; /**< Published copies */
+    _Atomic uint32_t        control;            /**< Index and reader counts */
+    uint32_t                publish_skips;      /**< Cycles with no free buffer */
+} daq_publication_t;
+
+/**
+ * @brief Precompiled parameter range limits
+ *
+ * Dense min/max vectors indexed by ehms_param_id_t, compiled from the
+ * parameter database. Parameters without database limits hold unbounded
+ * limits, which the validation kernel never reports as out of range.
+ * Fixed-point builds compile the limits to raw units instead.
+ */
+typedef struct
+{
+#if defined(EHMS_FIXED_POINT_PIPELINE)
+    int32_t                 min_raw[EHMS_PARAM_COUNT];  /**< Lower limits (raw) */
+    int32_t                 max_raw[EHMS_PARAM_COUNT];  /**< Upper limits (raw) */
+#else
+    float                   min_value[EHMS_PARAM_COUNT]; /**< Lower limits */
+    float                   max_value[EHMS_PARAM_COUNT]; /**< Upper limits */
+#endif
+    uint32_t                generation;         /**< Generation compiled from */
+} daq_limits_cache_t;
+
+#if defined(EHMS_FIXED_POINT_PIPELINE)
+/**
+ * @brief Bus data to fixed-point conversion, raw = data * scale + offset
+ *
+ * Compiled at init from the scale factor and offset of each parameter.
+ */
+typedef struct
+{
+    int32_t                 scale[EHMS_PARAM_COUNT];    /**< Raw units per data count */
+    int32_t                 offset[EHMS_PARAM_COUNT];   /**< Raw units at data zero */
+} daq_fixed_scaling_t;
+#endif
+
+/**
+ * @brief Phase execution-time accumulator (timebase ticks)
+ */
+typedef struct
+{
+    uint32_t                samples;            /**< Cycles measured */
+    uint32_t                min_ticks;          /**< Shortest duration */
+    uint32_t                max_ticks;          /**< Longest duration */
+    uint64_t                total_ticks;        /**< Sum of durations */
+    uint32_t                histogram[DAQ_TIMING_HISTOGRAM_BINS]; /**< log2(ticks) */
+} daq_phase_accum_t;
+
+/**
+ * @brief Cycle timing state
+ */
+typedef struct
+{
+    daq_phase_accum_t       phase[DAQ_PHASE_COUNT]; /**< Per-phase accumulators */
+    uint32_t                deadline_ticks;     /**< Cycle deadline */
+    uint32_t                overrun_count;      /**< Cycles exceeding deadline */
+    uint32_t                last_overrun_cycle; /**< Cycle of last overrun */
+} daq_timing_t;
+
+#if defined(DAQ_PARALLEL_ENGINES)
+/**
+ * @brief Cycle state of one acquisition core
+ */
+typedef struct
+{
+    DAQ_CORE_ALIGNED
+    uint32_t                phase_ticks[DAQ_PHASE_COUNT]; /**< Phases of this cycle */
+} daq_core_state_t;
+
+/**
+ * @brief Cycle barrier of the acquisition cores
+ *
+ * The last core to arrive clears the count and advances the generation,
+ * releasing the cores waiting on the generation they arrived in.
  */
 typedef struct
+{
+    DAQ_CORE_ALIGNED
+    _Atomic uint32_t        arrived;            /**< Cores arrived in this generation */
+    _Atomic uint32_t        generation;         /**< Barrier passes completed */
+} daq_barrier_t;
+
+#endif
+/**
+ * @brief Acquisition context: the complete state of one aircraft's acquisition
+ *
+ * The onboard module state is one static context; ground processing
+ * allocates one per aircraft log (daq_context_size).
+ */
+struct daq_context
 {
     bool                        is_initialized;
     ehms_system_state_t         state;
     uint32_t                    cycle_count;
     uint32_t                    current_time_ms;
+    uint32_t                    cycle_start_ticks;  /**< Timebase at current_time_ms */
+    ehms_timestamp_t            cycle_time;         /**< Calendar time at current_time_ms */
     daq_source_info_t           sources[EHMS_ARINC429_BUS_COUNT];
-    ehms_engine_snapshot_t      engine_data[EHMS_MAX_ENGINES];
+    daq_arinc429_route_t        arinc_routes[EHMS_ARINC429_BUS_COUNT];
+    daq_schedule_t              schedule;
+#if defined(DAQ_ARINC429_FIFO_READ)
+    daq_arinc429_rx_t           arinc_rx[EHMS_ARINC429_BUS_COUNT];
+#endif
+    daq_engine_lane_t           lane[EHMS_MAX_ENGINES];
+    _Atomic uint32_t            flight_phase[EHMS_MAX_ENGINES]; /**< Latest daq_set_flight_phase */
+    daq_limits_cache_t          limits;
+#if defined(EHMS_FIXED_POINT_PIPELINE)
+    daq_fixed_scaling_t         fixed_scaling;
+#endif
+    daq_publication_t           publication[EHMS_MAX_ENGINES];
+    daq_crc_segment_t           crc_segments[DAQ_CRC_SEGMENT_COUNT];
+    uint32_t                    crc_preset;
+    daq_timing_t                timing;
+#if defined(DAQ_TREND_ENGINE)
+    trend_context_t*            trend;              /**< daq_ctx_set_trend_context */
+#endif
+#if defined(DAQ_PARALLEL_ENGINES)
+    daq_core_state_t            core[DAQ_CORE_COUNT];
+    daq_barrier_t               barrier;
+#endif
     ehms_result_t               last_error;
-} daq_module_state_t;
+};
 
 /* ============================================================================
  * PRIVATE DATA
  * ============================================================================ */
 
-/** @brief Module state - static allocation for safety */
-static daq_module_state_t s_daq_state;
-
-/** @brief Parameter configuration table */
-static const daq_param_config_t s_param_config[EHMS_PARAM_COUNT] = 
-{
-    /* param_id,           arinc_label, bus_primary, bus_backup, scale_factor, offset */
-    { EHMS_PARAM_N1,       0o310,       0,           1,          0.1f,         0.0f   },
-    { EHMS_PARAM_N2,       0o311,       0,           1,          0.1f,         0.0f   },
-    { EHMS_PARAM_EGT,      0o312,       0,           1,          1.0f,         0.0f   },
-    { EHMS_PARAM_FF,       0o313,       0,           1,          0.1f,         0.0f   },
-    { EHMS_PARAM_OIL_TEMP, 0o314,       0,           1,          0.5f,         -40.0f },
-    { EHMS_PARAM_OIL_PRESS,0o315,       0,           1,          0.1f,         0.0f   },
-    { EHMS_PARAM_OIL_QTY,  0o316,       0,           1,          0.5f,         0.0f   },
-    { EHMS_PARAM_VIB_FAN,  0o317,       2,           3,          0.001f,       0.0f   },
-    { EHMS_PARAM_VIB_CORE, 0o320,       2,           3,          0.001f,       0.0f   },
-    { EHMS_PARAM_EPR,      0o321,       0,           1,          0.001f,       0.0f   },
-    /* ... remaining parameters configured similarly */
+/** @brief Onboard acquisition context - static allocation for safety */
+static daq_context_t s_daq_state;
+
+/** @brief Parameter limits generation, advanced on configuration change */
+static _Atomic uint32_t s_daq_limits_generation;
+
+/** @brief Rate group definitions, indexed by daq_rate_group_id_t */
+static const daq_rate_group_t s_rate_groups[DAQ_RATE_GROUP_COUNT] = 
+{
+    /* divisor, stale_timeout_ms */
+    { 1U,       DAQ_STALE_TIMEOUT_MS },
+    { 2U,       DAQ_STALE_TIMEOUT_MS },
+    { 10U,      300U                 },
+    { 100U,     3000U                },
+};
+
+/** @brief Rate group of each parameter (unlisted parameters: 100 Hz) */
+static const uint8_t s_param_rate_group[EHMS_PARAM_COUNT] = 
+{
+    DAQ_RATE_100HZ,     /* EHMS_PARAM_N1 */
+    DAQ_RATE_100HZ,     /* EHMS_PARAM_N2 */
+    DAQ_RATE_100HZ,     /* EHMS_PARAM_EGT */
+    DAQ_RATE_50HZ,      /* EHMS_PARAM_FF */
+    DAQ_RATE_10HZ,      /* EHMS_PARAM_OIL_TEMP */
+    DAQ_RATE_50HZ,      /* EHMS_PARAM_OIL_PRESS */
+    DAQ_RATE_1HZ,       /* EHMS_PARAM_OIL_QTY */
+    DAQ_RATE_100HZ,     /* EHMS_PARAM_VIB_FAN */
+    DAQ_RATE_100HZ,     /* EHMS_PARAM_VIB_CORE */
+    DAQ_RATE_100HZ,     /* EHMS_PARAM_EPR */
+    DAQ_RATE_100HZ,     /* EHMS_PARAM_ITT */
+    DAQ_RATE_50HZ,      /* EHMS_PARAM_THRUST */
+    DAQ_RATE_10HZ,      /* EHMS_PARAM_BLEED_PRESS */
+    DAQ_RATE_10HZ,      /* EHMS_PARAM_BLEED_TEMP */
+    DAQ_RATE_10HZ,      /* EHMS_PARAM_START_VALVE */
+    DAQ_RATE_10HZ,      /* EHMS_PARAM_FUEL_VALVE */
+};
+
+#if defined(DAQ_VIBRATION_BURST)
+/** @brief Burst subaddress of each vib_sensor_t */
+static const uint8_t s_vib_burst_subaddress[VIB_SENSOR_COUNT] = 
+{
+    DAQ_1553_SA_VIB_BURST_FAN,
+    DAQ_1553_SA_VIB_BURST_CORE,
+};
+
+/** @brief Scalar parameter whose bus scaling applies to each vib_sensor_t */
+static const uint8_t s_vib_sensor_param[VIB_SENSOR_COUNT] = 
+{
+    EHMS_PARAM_VIB_FAN,
+    EHMS_PARAM_VIB_CORE,
 };
 
+_Static_assert(EHMS_PARAM_VIB_CORE_N2 == (EHMS_PARAM_VIB_FAN_N1 + VIB_BAND_COUNT - 1U),
+               "Order band parameters shall follow vibration band order");
+#endif
+
+_Static_assert(DAQ_CRC_SEGMENT_COUNT <= 64U,
+               "Every CRC segment shall have a bit in the uint64_t dirty masks");
+
+_Static_assert((DAQ_MAJOR_FRAME_CYCLES % 100U) == 0U, 
+               "Rate group divisors (1, 2, 10, 100) shall divide the major frame");
+
+#if defined(DAQ_PARALLEL_ENGINES)
+_Static_assert((DAQ_CORE_COUNT >= 1U) && (DAQ_CORE_COUNT <= EHMS_MAX_ENGINES),
+               "Every acquisition core shall have an engine slot to process");
+#endif
+
 /* ============================================================================
  * PRIVATE FUNCTION PROTOTYPES
  * ============================================================================ */
 
 static ehms_result_t daq_validate_config(const daq_config_t* config);
-static ehms_result_t daq_init_sources(void);
-static ehms_result_t daq_read_arinc429_data(uint8_t bus_id, ehms_engine_id_t engine);
-static ehms_result_t daq_read_1553_data(ehms_engine_id_t engine);
-static ehms_result_t daq_validate_parameter(ehms_parameter_t* param);
-static ehms_result_t daq_check_staleness(ehms_parameter_t* param);
-static ehms_result_t daq_select_source(ehms_param_id_t param_id, uint8_t* selected_bus);
-static uint32_t daq_calculate_crc32(const void* data, uint32_t length);
-static void daq_update_statistics(uint8_t bus_id, bool success);
+static ehms_result_t daq_setup_context(daq_context_t* ctx);
+static ehms_result_t daq_init_sources(daq_context_t* ctx);
+static void daq_build_arinc429_routes(daq_context_t* ctx);
+static void daq_build_schedule(daq_context_t* ctx);
+static void daq_begin_cycle(daq_context_t* ctx, uint32_t cycle_start);
+static void daq_read_engine(daq_context_t* ctx, ehms_engine_id_t engine, uint32_t* phase_ticks);
+static void daq_process_engine(daq_context_t* ctx, ehms_engine_id_t engine,
+                               uint32_t* phase_ticks);
+static void daq_end_cycle(daq_context_t* ctx, uint32_t cycle_start, uint32_t* phase_ticks);
+#if defined(DAQ_PARALLEL_ENGINES)
+static void daq_barrier_wait(daq_barrier_t* barrier);
+#endif
+static ehms_result_t daq_read_arinc429_data(daq_context_t* ctx, ehms_engine_id_t engine);
+static ehms_result_t daq_fetch_arinc429_word(daq_context_t* ctx, uint8_t bus_id, uint32_t label,
+                                             arinc429_word_t* word);
+static void daq_store_arinc429_word(daq_context_t* ctx, uint8_t bus_id, ehms_engine_id_t engine,
+                                    uint32_t param, const arinc429_word_t* word,
+                                    uint32_t sample_ms);
+static uint32_t daq_sample_time_ms(daq_context_t* ctx);
+static void daq_calendar_time(daq_context_t* ctx, uint32_t time_ms, ehms_timestamp_t* timestamp);
+static void daq_step_day(ehms_timestamp_t* timestamp, bool forward);
+#if defined(DAQ_ARINC429_FIFO_READ)
+static void daq_drain_arinc429_fifo(daq_context_t* ctx, uint8_t bus_id);
+#endif
+static ehms_result_t daq_read_1553_data(daq_context_t* ctx, ehms_engine_id_t engine);
+#if defined(DAQ_VIBRATION_BURST)
+static ehms_result_t daq_read_vibration_burst(daq_context_t* ctx, ehms_engine_id_t engine);
+static void daq_analyse_vibration(daq_context_t* ctx, ehms_engine_id_t engine);
+static float daq_shaft_speed_pct(const ehms_engine_block_t* block, uint32_t param);
+#endif
+#if defined(DAQ_ANOMALY_DETECTION)
+static void daq_score_anomaly(daq_context_t* ctx, ehms_engine_id_t engine);
+#endif
+static void daq_build_limits_cache(daq_context_t* ctx);
+static void daq_refresh_limits(daq_context_t* ctx);
+static void daq_validate_block(daq_context_t* ctx, ehms_engine_id_t engine);
+#if defined(EHMS_FIXED_POINT_PIPELINE)
+static ehms_result_t daq_build_fixed_scaling(daq_context_t* ctx);
+#endif
+static void daq_scale_value(daq_context_t* ctx, ehms_engine_block_t* block, uint32_t param,
+                            int32_t data);
+static ehms_result_t daq_select_source(daq_context_t* ctx, ehms_param_id_t param_id,
+                                       uint8_t* selected_bus);
+static void daq_update_statistics(daq_context_t* ctx, uint8_t bus_id, bool success);
+static void daq_reset_timing(daq_context_t* ctx);
+static void daq_record_phase(daq_context_t* ctx, daq_phase_t phase, uint32_t ticks);
+static uint32_t daq_ticks_to_ns(uint64_t ticks);
+static void daq_init_snapshot_crc(daq_context_t* ctx);
+static void daq_pack_snapshot(daq_context_t* ctx, ehms_engine_id_t engine);
+static uint32_t daq_segment_crc(daq_context_t* ctx, ehms_engine_id_t engine, uint32_t segment);
+static void daq_update_snapshot_crc(daq_context_t* ctx, ehms_engine_id_t engine);
+static void daq_publish_snapshot(daq_context_t* ctx, ehms_engine_id_t engine);
+static ehms_result_t daq_acquire_published(daq_context_t* ctx, ehms_engine_id_t engine,
+                                           uint32_t* index);
+static ehms_result_t daq_release_published(daq_context_t* ctx, ehms_engine_id_t engine,
+                                           uint32_t index);
 
 /* ============================================================================
  * PUBLIC FUNCTIONS
@@ -146,13 +566,29 @@ ehms_result_t daq_init(const daq_config_t* config)
     
     if (result == EHMS_OK)
     {
-        /* Clear module state */
-        (void)memset(&s_daq_state, 0, sizeof(s_daq_state));
+        /* Start the cycle timebase */
+        ehms_timebase_init();
         
-        /* Initialize data sources */
-        result = daq_init_sources();
+        /* Clear and configure the onboard context */
+        result = daq_setup_context(&s_daq_state);
     }
-    
+
+#if defined(DAQ_VIBRATION_BURST)
+    if (result == EHMS_OK)
+    {
+        /* Clear waveform rings and order bands */
+        (void)vib_init();
+    }
+
+#endif
+#if defined(DAQ_TREND_ENGINE)
+    if (result == EHMS_OK)
+    {
+        /* Clear trend statistics and aggregate rings */
+        (void)trend_init();
+    }
+
+#endif
     if (result == EHMS_OK)
     {
         /* Initialize ARINC 429 interfaces */
@@ -183,6 +619,77 @@ ehms_result_t daq_init(const daq_config_t* config)
     return result;
 }
 
+/**
+ * @brief Get the storage size of an acquisition context
+ * 
+ * @return Size in bytes
+ */
+uint32_t daq_context_size(void)
+{
+    return (uint32_t)sizeof(daq_context_t);
+}
+
+/**
+ * @brief Initialize an acquisition context for recorded data
+ * 
+ * @param[out] ctx    Context storage of daq_context_size() bytes
+ * @param[in]  epoch  Calendar time at sample time zero
+ * @return EHMS_OK on success, error code otherwise
+ * 
+ * @trace SRS-EHMS-105
+ */
+ehms_result_t daq_ctx_init(daq_context_t* ctx, const ehms_timestamp_t* epoch)
+{
+    ehms_result_t result = EHMS_OK;
+    
+    if ((ctx == NULL) || (epoch == NULL))
+    {
+        result = EHMS_ERROR_PARAM;
+    }
+    else
+    {
+        result = daq_setup_context(ctx);
+    }
+    
+    if (result == EHMS_OK)
+    {
+        /* The context clock starts at sample time zero */
+        ctx->cycle_time = *epoch;
+        ctx->is_initialized = true;
+        ctx->state = EHMS_STATE_INIT;
+    }
+    
+    return result;
+}
+
+#if defined(DAQ_TREND_ENGINE)
+/**
+ * @brief Attach a trend context to an acquisition context
+ * 
+ * @param[in,out] ctx    Acquisition context
+ * @param[in]     trend  Trend context, or NULL
+ * @return EHMS_OK on success, error code otherwise
+ * 
+ * @trace SRS-EHMS-061
+ */
+ehms_result_t daq_ctx_set_trend_context(daq_context_t* ctx, trend_context_t* trend)
+{
+    ehms_result_t result = EHMS_OK;
+    
+    if (ctx == NULL)
+    {
+        result = EHMS_ERROR_PARAM;
+    }
+    else
+    {
+        ctx->trend = trend;
+    }
+    
+    return result;
+}
+
+#endif
+
 /**
  * @brief Execute one acquisition cycle
  * 
@@ -195,401 +702,2268 @@ ehms_result_t daq_init(const daq_config_t* config)
  */
 ehms_result_t daq_execute_cycle(void)
 {
+    daq_context_t* ctx = &s_daq_state;
     ehms_result_t result = EHMS_OK;
-    ehms_result_t engine_result;
+    uint32_t cycle_start = ehms_timebase_read();
+    uint32_t phase_ticks[DAQ_PHASE_COUNT] = { 0U };
     
     /* Check initialization */
-    if (!s_daq_state.is_initialized)
+    if (!ctx->is_initialized)
     {
         result = EHMS_ERROR_NOT_INIT;
     }
     else
     {
-        /* Update cycle timestamp */
-        s_daq_state.current_time_ms = system_get_time_ms();
-        s_daq_state.cycle_count++;
+        daq_begin_cycle(ctx, cycle_start);
         
         /* Acquire data for each engine */
         for (ehms_engine_id_t eng = EHMS_ENGINE_1; 
              eng < (ehms_engine_id_t)config_get_engine_count(); 
              eng++)
         {
-            /* Read ARINC 429 data */
-            engine_result = daq_read_arinc429_data(
-                s_param_config[0].bus_primary, eng);
-            
-            if (engine_result != EHMS_OK)
-            {
-                /* Try backup source */
-                engine_result = daq_read_arinc429_data(
-                    s_param_config[0].bus_backup, eng);
-            }
-            
-            /* Read 1553 data (vibration, discrete) */
-            if (engine_result == EHMS_OK)
-            {
-                engine_result = daq_read_1553_data(eng);
-            }
-            
-            /* Validate all parameters */
-            for (uint32_t p = 0U; p < EHMS_PARAM_COUNT; p++)
-            {
-                ehms_parameter_t* param = 
-                    &s_daq_state.engine_data[eng].parameters[p];
-                
-                (void)daq_validate_parameter(param);
-                (void)daq_check_staleness(param);
-            }
-            
-            /* Calculate snapshot CRC */
-            s_daq_state.engine_data[eng].crc32 = daq_calculate_crc32(
-                &s_daq_state.engine_data[eng],
-                sizeof(ehms_engine_snapshot_t) - sizeof(uint32_t));
-            
-            /* Update snapshot timestamp */
-            s_daq_state.engine_data[eng].sample_time = 
-                system_get_timestamp();
+            daq_read_engine(ctx, eng, phase_ticks);
+            daq_process_engine(ctx, eng, phase_ticks);
         }
+        
+        daq_end_cycle(ctx, cycle_start, phase_ticks);
     }
     
     return result;
 }
 
+#if defined(DAQ_PARALLEL_ENGINES)
 /**
- * @brief Get current engine snapshot data
+ * @brief Execute one acquisition cycle on one core
  * 
- * @param[in]  engine_id  Engine identifier
- * @param[out] snapshot   Pointer to receive snapshot data
+ * @param[in] core  Core index
  * @return EHMS_OK on success, error code otherwise
  * 
- * @trace SRS-EHMS-110
+ * @trace SRS-EHMS-100
+ * @trace SRS-EHMS-101
  */
-ehms_result_t daq_get_engine_snapshot(ehms_engine_id_t engine_id,
-                                       ehms_engine_snapshot_t* snapshot)
+ehms_result_t daq_execute_cycle_core(uint32_t core)
 {
+    daq_context_t* ctx = &s_daq_state;
     ehms_result_t result = EHMS_OK;
+    uint32_t cycle_start = ehms_timebase_read();
     
-    /* Validate parameters */
-    if (snapshot == NULL)
+    if (core >= DAQ_CORE_COUNT)
     {
         result = EHMS_ERROR_PARAM;
     }
-    else if (engine_id >= EHMS_ENGINE_COUNT)
-    {
-        result = EHMS_ERROR_RANGE;
-    }
-    else if (!s_daq_state.is_initialized)
+    else if (!ctx->is_initialized)
     {
         result = EHMS_ERROR_NOT_INIT;
     }
     else
     {
-        /* Verify CRC before copying */
-        uint32_t calc_crc = daq_calculate_crc32(
-            &s_daq_state.engine_data[engine_id],
-            sizeof(ehms_engine_snapshot_t) - sizeof(uint32_t));
+        uint32_t* phase_ticks = ctx->core[core].phase_ticks;
+        uint32_t engine_count = config_get_engine_count();
         
-        if (calc_crc != s_daq_state.engine_data[engine_id].crc32)
+        /* The bus interfaces and source statistics have one owner: core 0
+         * reads every engine, in the order of the serial cycle */
+        if (core == 0U)
         {
-            result = EHMS_ERROR_CRC;
-            error_report(ERR_MODULE_DAQ, ERR_SEVERITY_MAJOR,
-                        ERR_CODE_CRC_MISMATCH, (uint32_t)engine_id);
+            (void)memset(phase_ticks, 0, sizeof(ctx->core[core].phase_ticks));
+            daq_begin_cycle(ctx, cycle_start);
+            
+            for (uint32_t eng = 0U; eng < engine_count; eng++)
+            {
+                daq_read_engine(ctx, (ehms_engine_id_t)eng, phase_ticks);
+            }
         }
-        else
+        
+        daq_barrier_wait(&ctx->barrier);
+        
+        /* Static assignment: engine e is processed on core e % DAQ_CORE_COUNT,
+         * touching only its own lane and its own trend, vibration and
+         * anomaly state */
+        for (uint32_t eng = core; eng < engine_count; eng += DAQ_CORE_COUNT)
         {
-            /* Copy snapshot data */
-            (void)memcpy(snapshot, &s_daq_state.engine_data[engine_id],
-                        sizeof(ehms_engine_snapshot_t));
+            daq_process_engine(ctx, (ehms_engine_id_t)eng, phase_ticks);
+        }
+        
+        daq_barrier_wait(&ctx->barrier);
+        
+        /* Every engine is published; merge the phase sums of all cores and
+         * clear them before any core can pass the next cycle's first barrier */
+        if (core == 0U)
+        {
+            for (uint32_t c = 1U; c < DAQ_CORE_COUNT; c++)
+            {
+                for (uint32_t phase = 0U; phase < DAQ_PHASE_CYCLE; phase++)
+                {
+                    phase_ticks[phase] += ctx->core[c].phase_ticks[phase];
+                }
+                
+                (void)memset(ctx->core[c].phase_ticks, 0, sizeof(ctx->core[c].phase_ticks));
+            }
+            
+            daq_end_cycle(ctx, cycle_start, phase_ticks);
         }
     }
     
     return result;
 }
 
+#endif
+
 /**
- * @brief Get single parameter value
+ * @brief Process one recorded sample of an engine through an acquisition context
  * 
- * @param[in]  engine_id  Engine identifier
- * @param[in]  param_id   Parameter identifier
- * @param[out] param      Pointer to receive parameter data
+ * The recorded values stand in for the bus reads of one acquisition cycle
+ * at the sample time: samples recorded valid are validated against the
+ * context's limits like received data, other statuses are kept, and the
+ * engine's snapshot is packed, CRC-stamped and published as in flight,
+ * then folded into the attached trend context (DAQ_TREND_ENGINE).
+ * 
+ * @param[in,out] ctx           Acquisition context
+ * @param[in]     engine_id     Engine identifier
+ * @param[in]     time_ms       Sample time; not earlier than the previous sample
+ * @param[in]     flight_phase  Recorded ehms_flight_phase_t
+ * @param[in]     raw_value     Recorded raw values (EHMS_PARAM_COUNT)
+ * @param[in]     status        Recorded ehms_param_status_t values (EHMS_PARAM_COUNT)
  * @return EHMS_OK on success, error code otherwise
  * 
- * @trace SRS-EHMS-111
+ * @trace SRS-EHMS-101
+ * @trace SRS-EHMS-102
  */
-ehms_result_t daq_get_parameter(ehms_engine_id_t engine_id,
-                                 ehms_param_id_t param_id,
-                                 ehms_parameter_t* param)
+ehms_result_t daq_ctx_process_sample(daq_context_t* ctx,
+                                      ehms_engine_id_t engine_id,
+                                      uint32_t time_ms,
+                                      uint32_t flight_phase,
+                                      const int32_t* raw_value,
+                                      const uint8_t* status)
 {
     ehms_result_t result = EHMS_OK;
     
     /* Validate parameters */
-    if (param == NULL)
+    if ((ctx == NULL) || (raw_value == NULL) || (status == NULL))
     {
         result = EHMS_ERROR_PARAM;
     }
     else if ((engine_id >= EHMS_ENGINE_COUNT) || 
-             (param_id >= EHMS_PARAM_COUNT))
+             (flight_phase >= (uint32_t)EHMS_FLIGHT_PHASE_COUNT))
     {
         result = EHMS_ERROR_RANGE;
     }
-    else if (!s_daq_state.is_initialized)
+    else if (!ctx->is_initialized)
     {
         result = EHMS_ERROR_NOT_INIT;
     }
     else
     {
-        /* Copy parameter data */
-        (void)memcpy(param, 
-                    &s_daq_state.engine_data[engine_id].parameters[param_id],
-                    sizeof(ehms_parameter_t));
+        ehms_engine_block_t* block = &ctx->lane[engine_id].block;
+        uint64_t changed = 0ULL;
+        
+        /* Advance the context clock to the sample */
+        daq_calendar_time(ctx, time_ms, &ctx->cycle_time);
+        ctx->current_time_ms = time_ms;
+        ctx->cycle_count++;
+        
+        daq_refresh_limits(ctx);
+        block->flight_phase = flight_phase;
+        
+        /* Recorded raw values are fixed-point units in fixed-point builds, else bus counts */
+        for (uint32_t p = 0U; p < EHMS_PARAM_COUNT; p++)
+        {
+            int32_t old_raw = block->raw_value[p];
+            uint8_t old_status = block->status[p];
+
+#if defined(EHMS_FIXED_POINT_PIPELINE)
+            block->raw_value[p] = raw_value[p];
+#else
+            daq_scale_value(ctx, block, p, raw_value[p]);
+#endif
+            block->status[p] = status[p];
+            if (status[p] == (uint8_t)EHMS_PARAM_VALID)
+            {
+                block->timestamp_ms[p] = time_ms;
+            }
+            
+            changed |= (uint64_t)((block->raw_value[p] != old_raw) || 
+                                  (block->status[p] != old_status)) << p;
+        }
+        
+        ctx->lane[engine_id].crc.dirty_mask |= 
+            (changed << DAQ_CRC_SEGMENT_PARAM(0U)) | (1ULL << DAQ_CRC_SEGMENT_HEADER);
+        
+        daq_validate_block(ctx, engine_id);
+        
+        block->sample_time = ctx->cycle_time;
+        daq_pack_snapshot(ctx, engine_id);
+        daq_update_snapshot_crc(ctx, engine_id);
+        daq_publish_snapshot(ctx, engine_id);
+
+#if defined(DAQ_TREND_ENGINE)
+        if (ctx->trend != NULL)
+        {
+            /* Fold the published sample into the attached trend statistics */
+            (void)trend_ctx_update(ctx->trend, block, time_ms);
+        }
+
+#endif
     }
     
     return result;
 }
 
 /**
- * @brief Get data acquisition statistics
+ * @brief Get current engine snapshot data
  * 
- * @param[out] stats  Pointer to receive statistics
+ * @param[in]  engine_id  Engine identifier
+ * @param[out] snapshot   Pointer to receive snapshot data
  * @return EHMS_OK on success, error code otherwise
+ * 
+ * @trace SRS-EHMS-110
  */
-ehms_result_t daq_get_statistics(daq_statistics_t* stats)
+ehms_result_t daq_get_engine_snapshot(ehms_engine_id_t engine_id,
+                                       ehms_engine_snapshot_t* snapshot)
 {
-    ehms_result_t result = EHMS_OK;
-    
-    if (stats == NULL)
-    {
+    return daq_ctx_get_engine_snapshot(&s_daq_state, engine_id, snapshot);
+}
+
+/**
+ * @brief Get current engine snapshot data
+ * 
+ * @param[in]  ctx        Acquisition context
+ * @param[in]  engine_id  Engine identifier
+ * @param[out] snapshot   Pointer to receive snapshot data
+ * @return EHMS_OK on success, error code otherwise
+ * 
+ * @trace SRS-EHMS-110
+ */
+ehms_result_t daq_ctx_get_engine_snapshot(daq_context_t* ctx,
+                                          ehms_engine_id_t engine_id,
+                                          ehms_engine_snapshot_t* snapshot)
+{
+    ehms_result_t result = EHMS_OK;
+    
+    /* Validate parameters */
+    if ((ctx == NULL) || (snapshot == NULL))
+    {
+        result = EHMS_ERROR_PARAM;
+    }
+    else if (engine_id >= EHMS_ENGINE_COUNT)
+    {
+        result = EHMS_ERROR_RANGE;
+    }
+    else if (!ctx->is_initialized)
+    {
+        result = EHMS_ERROR_NOT_INIT;
+    }
+    else
+    {
+        /* Pin the published buffer; it is complete and CRC-stamped */
+        uint32_t index;
+        
+        result = daq_acquire_published(ctx, engine_id, &index);
+        
+        if (result == EHMS_OK)
+        {
+            (void)memcpy(snapshot, 
+                        &ctx->publication[engine_id].buffers[index].snapshot,
+                        sizeof(ehms_engine_snapshot_t));
+            
+            (void)daq_release_published(ctx, engine_id, index);
+        }
+    }
+    
+    return result;
+}
+
+/**
+ * @brief Get single parameter value
+ * 
+ * @param[in]  engine_id  Engine identifier
+ * @param[in]  param_id   Parameter identifier
+ * @param[out] param      Pointer to receive parameter data
+ * @return EHMS_OK on success, error code otherwise
+ * 
+ * @trace SRS-EHMS-111
+ */
+ehms_result_t daq_get_parameter(ehms_engine_id_t engine_id,
+                                 ehms_param_id_t param_id,
+                                 ehms_parameter_t* param)
+{
+    return daq_ctx_get_parameter(&s_daq_state, engine_id, param_id, param);
+}
+
+/**
+ * @brief Get single parameter value
+ * 
+ * @param[in]  ctx        Acquisition context
+ * @param[in]  engine_id  Engine identifier
+ * @param[in]  param_id   Parameter identifier
+ * @param[out] param      Pointer to receive parameter data
+ * @return EHMS_OK on success, error code otherwise
+ * 
+ * @trace SRS-EHMS-111
+ */
+ehms_result_t daq_ctx_get_parameter(daq_context_t* ctx,
+                                    ehms_engine_id_t engine_id,
+                                    ehms_param_id_t param_id,
+                                    ehms_parameter_t* param)
+{
+    ehms_result_t result = EHMS_OK;
+    
+    /* Validate parameters */
+    if ((ctx == NULL) || (param == NULL))
+    {
+        result = EHMS_ERROR_PARAM;
+    }
+    else if ((engine_id >= EHMS_ENGINE_COUNT) || 
+             (param_id >= EHMS_PARAM_COUNT))
+    {
+        result = EHMS_ERROR_RANGE;
+    }
+    else if (!ctx->is_initialized)
+    {
+        result = EHMS_ERROR_NOT_INIT;
+    }
+    else
+    {
+        uint32_t index;
+        
+        result = daq_acquire_published(ctx, engine_id, &index);
+        
+        if (result == EHMS_OK)
+        {
+            /* Copy parameter data */
+            (void)memcpy(param, 
+                        &ctx->publication[engine_id].buffers[index].snapshot.parameters[param_id],
+                        sizeof(ehms_parameter_t));
+            
+            (void)daq_release_published(ctx, engine_id, index);
+        }
+    }
+    
+    return result;
+}
+
+/**
+ * @brief Borrow a read-only view of the published engine snapshot
+ * 
+ * @param[in]  engine_id  Engine identifier
+ * @param[out] view       Receives pointer to the published snapshot
+ * @return EHMS_OK on success, error code otherwise
+ * 
+ * @trace SRS-EHMS-110
+ */
+ehms_result_t daq_acquire_snapshot_view(ehms_engine_id_t engine_id,
+                                         const ehms_engine_snapshot_t** view)
+{
+    return daq_ctx_acquire_snapshot_view(&s_daq_state, engine_id, view);
+}
+
+/**
+ * @brief Borrow a read-only view of the published engine snapshot
+ * 
+ * @param[in]  ctx        Acquisition context
+ * @param[in]  engine_id  Engine identifier
+ * @param[out] view       Receives pointer to the published snapshot
+ * @return EHMS_OK on success, error code otherwise
+ * 
+ * @trace SRS-EHMS-110
+ */
+ehms_result_t daq_ctx_acquire_snapshot_view(daq_context_t* ctx,
+                                            ehms_engine_id_t engine_id,
+                                            const ehms_engine_snapshot_t** view)
+{
+    ehms_result_t result = EHMS_OK;
+    
+    /* Validate parameters */
+    if ((ctx == NULL) || (view == NULL))
+    {
+        result = EHMS_ERROR_PARAM;
+    }
+    else if (engine_id >= EHMS_ENGINE_COUNT)
+    {
+        result = EHMS_ERROR_RANGE;
+    }
+    else if (!ctx->is_initialized)
+    {
+        result = EHMS_ERROR_NOT_INIT;
+    }
+    else
+    {
+        uint32_t index;
+        
+        result = daq_acquire_published(ctx, engine_id, &index);
+        
+        if (result == EHMS_OK)
+        {
+            *view = &ctx->publication[engine_id].buffers[index].snapshot;
+        }
+    }
+    
+    if ((result != EHMS_OK) && (view != NULL))
+    {
+        *view = NULL;
+    }
+    
+    return result;
+}
+
+/**
+ * @brief Return a view obtained from daq_acquire_snapshot_view
+ * 
+ * @param[in] engine_id  Engine identifier the view was acquired for
+ * @param[in] view       View to release
+ * @return EHMS_OK on success, error code otherwise
+ * 
+ * @trace SRS-EHMS-110
+ */
+ehms_result_t daq_release_snapshot_view(ehms_engine_id_t engine_id,
+                                         const ehms_engine_snapshot_t* view)
+{
+    return daq_ctx_release_snapshot_view(&s_daq_state, engine_id, view);
+}
+
+/**
+ * @brief Return a view obtained from daq_acquire_snapshot_view
+ * 
+ * @param[in] ctx        Acquisition context
+ * @param[in] engine_id  Engine identifier the view was acquired for
+ * @param[in] view       View to release
+ * @return EHMS_OK on success, error code otherwise
+ * 
+ * @trace SRS-EHMS-110
+ */
+ehms_result_t daq_ctx_release_snapshot_view(daq_context_t* ctx,
+                                            ehms_engine_id_t engine_id,
+                                            const ehms_engine_snapshot_t* view)
+{
+    ehms_result_t result = EHMS_ERROR_PARAM;
+    
+    if (ctx == NULL)
+    {
+        result = EHMS_ERROR_PARAM;
+    }
+    else if (engine_id >= EHMS_ENGINE_COUNT)
+    {
+        result = EHMS_ERROR_RANGE;
+    }
+    else if (!ctx->is_initialized)
+    {
+        result = EHMS_ERROR_NOT_INIT;
+    }
+    else
+    {
+        /* Map the view back to its buffer; reject foreign pointers */
+        for (uint32_t b = 0U; b < DAQ_PUBLISH_BUFFER_COUNT; b++)
+        {
+            if (view == &ctx->publication[engine_id].buffers[b].snapshot)
+            {
+                result = daq_release_published(ctx, engine_id, b);
+                break;
+            }
+        }
+    }
+    
+    return result;
+}
+
+/**
+ * @brief Borrow a read-only view of the published engine parameter block
+ * 
+ * @param[in]  engine_id  Engine identifier
+ * @param[out] view       Receives pointer to the published parameter block
+ * @return EHMS_OK on success, error code otherwise
+ * 
+ * @trace SRS-EHMS-110
+ */
+ehms_result_t daq_acquire_block_view(ehms_engine_id_t engine_id,
+                                      const ehms_engine_block_t** view)
+{
+    return daq_ctx_acquire_block_view(&s_daq_state, engine_id, view);
+}
+
+/**
+ * @brief Borrow a read-only view of the published engine parameter block
+ * 
+ * @param[in]  ctx        Acquisition context
+ * @param[in]  engine_id  Engine identifier
+ * @param[out] view       Receives pointer to the published parameter block
+ * @return EHMS_OK on success, error code otherwise
+ * 
+ * @trace SRS-EHMS-110
+ */
+ehms_result_t daq_ctx_acquire_block_view(daq_context_t* ctx,
+                                         ehms_engine_id_t engine_id,
+                                         const ehms_engine_block_t** view)
+{
+    ehms_result_t result = EHMS_OK;
+    
+    /* Validate parameters */
+    if ((ctx == NULL) || (view == NULL))
+    {
+        result = EHMS_ERROR_PARAM;
+    }
+    else if (engine_id >= EHMS_ENGINE_COUNT)
+    {
+        result = EHMS_ERROR_RANGE;
+    }
+    else if (!ctx->is_initialized)
+    {
+        result = EHMS_ERROR_NOT_INIT;
+    }
+    else
+    {
+        uint32_t index;
+        
+        result = daq_acquire_published(ctx, engine_id, &index);
+        
+        if (result == EHMS_OK)
+        {
+            *view = &ctx->publication[engine_id].buffers[index].block;
+        }
+    }
+    
+    if ((result != EHMS_OK) && (view != NULL))
+    {
+        *view = NULL;
+    }
+    
+    return result;
+}
+
+/**
+ * @brief Return a view obtained from daq_acquire_block_view
+ * 
+ * @param[in] engine_id  Engine identifier the view was acquired for
+ * @param[in] view       View to release
+ * @return EHMS_OK on success, error code otherwise
+ * 
+ * @trace SRS-EHMS-110
+ */
+ehms_result_t daq_release_block_view(ehms_engine_id_t engine_id,
+                                      const ehms_engine_block_t* view)
+{
+    return daq_ctx_release_block_view(&s_daq_state, engine_id, view);
+}
+
+/**
+ * @brief Return a view obtained from daq_acquire_block_view
+ * 
+ * @param[in] ctx        Acquisition context
+ * @param[in] engine_id  Engine identifier the view was acquired for
+ * @param[in] view       View to release
+ * @return EHMS_OK on success, error code otherwise
+ * 
+ * @trace SRS-EHMS-110
+ */
+ehms_result_t daq_ctx_release_block_view(daq_context_t* ctx,
+                                         ehms_engine_id_t engine_id,
+                                         const ehms_engine_block_t* view)
+{
+    ehms_result_t result = EHMS_ERROR_PARAM;
+    
+    if (ctx == NULL)
+    {
         result = EHMS_ERROR_PARAM;
     }
-    else
+    else if (engine_id >= EHMS_ENGINE_COUNT)
+    {
+        result = EHMS_ERROR_RANGE;
+    }
+    else if (!ctx->is_initialized)
+    {
+        result = EHMS_ERROR_NOT_INIT;
+    }
+    else
+    {
+        for (uint32_t b = 0U; b < DAQ_PUBLISH_BUFFER_COUNT; b++)
+        {
+            if (view == &ctx->publication[engine_id].buffers[b].block)
+            {
+                result = daq_release_published(ctx, engine_id, b);
+                break;
+            }
+        }
+    }
+    
+    return result;
+}
+
+/**
+ * @brief Read engineering values and status of a list of parameters
+ * 
+ * @param[in]  engine_id  Engine identifier
+ * @param[in]  param_ids  Parameter identifiers to read
+ * @param[in]  count      Number of identifiers
+ * @param[out] values     Receives eng_value of each parameter
+ * @param[out] status     Receives status of each parameter
+ * @return EHMS_OK on success, error code otherwise
+ * 
+ * @trace SRS-EHMS-111
+ */
+ehms_result_t daq_get_parameter_values(ehms_engine_id_t engine_id,
+                                        const ehms_param_id_t* param_ids,
+                                        uint32_t count,
+                                        float* values,
+                                        ehms_param_status_t* status)
+{
+    return daq_ctx_get_parameter_values(&s_daq_state, engine_id, param_ids, count, values, status);
+}
+
+/**
+ * @brief Read engineering values and status of a list of parameters
+ * 
+ * @param[in]  ctx        Acquisition context
+ * @param[in]  engine_id  Engine identifier
+ * @param[in]  param_ids  Parameter identifiers to read
+ * @param[in]  count      Number of identifiers
+ * @param[out] values     Receives eng_value of each parameter
+ * @param[out] status     Receives status of each parameter
+ * @return EHMS_OK on success, error code otherwise
+ * 
+ * @trace SRS-EHMS-111
+ */
+ehms_result_t daq_ctx_get_parameter_values(daq_context_t* ctx,
+                                           ehms_engine_id_t engine_id,
+                                           const ehms_param_id_t* param_ids,
+                                           uint32_t count,
+                                           float* values,
+                                           ehms_param_status_t* status)
+{
+    ehms_result_t result = EHMS_OK;
+    
+    /* Validate parameters */
+    if ((ctx == NULL) || (param_ids == NULL) || (values == NULL) || (status == NULL))
+    {
+        result = EHMS_ERROR_PARAM;
+    }
+    else if (engine_id >= EHMS_ENGINE_COUNT)
+    {
+        result = EHMS_ERROR_RANGE;
+    }
+    else if (!ctx->is_initialized)
+    {
+        result = EHMS_ERROR_NOT_INIT;
+    }
+    else
+    {
+        for (uint32_t i = 0U; i < count; i++)
+        {
+            if (param_ids[i] >= EHMS_PARAM_COUNT)
+            {
+                result = EHMS_ERROR_RANGE;
+                break;
+            }
+        }
+    }
+    
+    if (result == EHMS_OK)
+    {
+        uint32_t index;
+        
+        result = daq_acquire_published(ctx, engine_id, &index);
+        
+        if (result == EHMS_OK)
+        {
+            const ehms_engine_block_t* block = 
+                &ctx->publication[engine_id].buffers[index].block;
+            
+            for (uint32_t i = 0U; i < count; i++)
+            {
+                values[i] = block->eng_value[param_ids[i]];
+                status[i] = (ehms_param_status_t)block->status[param_ids[i]];
+            }
+            
+            (void)daq_release_published(ctx, engine_id, index);
+        }
+    }
+    
+    return result;
+}
+
+/**
+ * @brief Notify the acquisition task that parameter limits have changed
+ * 
+ * Advances the limits generation; the next acquisition cycle recompiles
+ * its limits cache before validating any parameter. Callable from any
+ * task, including before daq_init.
+ * 
+ * @trace SRS-EHMS-101
+ */
+void daq_notify_limits_changed(void)
+{
+    (void)atomic_fetch_add_explicit(&s_daq_limits_generation, 1U, 
+                                    memory_order_release);
+}
+
+/**
+ * @brief Set the flight phase of an engine
+ * 
+ * Stores the phase for the acquisition task, which latches it into the
+ * engine's parameter block at the start of the engine's processing in the
+ * next cycle. Callable from any task after daq_init.
+ * 
+ * @param[in] engine_id  Engine identifier
+ * @param[in] phase      Flight phase
+ * @return EHMS_OK on success, error code otherwise
+ * 
+ * @trace SRS-EHMS-202
+ */
+ehms_result_t daq_set_flight_phase(ehms_engine_id_t engine_id, ehms_flight_phase_t phase)
+{
+    ehms_result_t result = EHMS_OK;
+    
+    if ((engine_id >= EHMS_ENGINE_COUNT) || ((uint32_t)phase >= (uint32_t)EHMS_FLIGHT_PHASE_COUNT))
+    {
+        result = EHMS_ERROR_RANGE;
+    }
+    else if (!s_daq_state.is_initialized)
+    {
+        result = EHMS_ERROR_NOT_INIT;
+    }
+    else
+    {
+        atomic_store_explicit(&s_daq_state.flight_phase[engine_id], (uint32_t)phase,
+                              memory_order_relaxed);
+    }
+    
+    return result;
+}
+
+/**
+ * @brief Get data acquisition statistics
+ * 
+ * @param[out] stats  Pointer to receive statistics
+ * @return EHMS_OK on success, error code otherwise
+ */
+ehms_result_t daq_get_statistics(daq_statistics_t* stats)
+{
+    ehms_result_t result = EHMS_OK;
+    
+    if (stats == NULL)
+    {
+        result = EHMS_ERROR_PARAM;
+    }
+    else
+    {
+        stats->cycle_count = s_daq_state.cycle_count;
+        stats->current_time_ms = s_daq_state.current_time_ms;
+        
+        for (uint8_t i = 0U; i < EHMS_ARINC429_BUS_COUNT; i++)
+        {
+            stats->source_samples[i] = s_daq_state.sources[i].total_samples;
+            stats->source_errors[i] = s_daq_state.sources[i].error_samples;
+        }
+    }
+    
+    return result;
+}
+
+/**
+ * @brief Get acquisition cycle timing statistics
+ * 
+ * @param[out] stats  Pointer to receive timing statistics
+ * @return EHMS_OK on success, error code otherwise
+ * 
+ * @trace SRS-EHMS-100
+ */
+ehms_result_t daq_get_timing_statistics(daq_timing_statistics_t* stats)
+{
+    ehms_result_t result = EHMS_OK;
+    
+    if (stats == NULL)
+    {
+        result = EHMS_ERROR_PARAM;
+    }
+    else if (!s_daq_state.is_initialized)
+    {
+        result = EHMS_ERROR_NOT_INIT;
+    }
+    else
+    {
+        const daq_timing_t* timing = &s_daq_state.timing;
+        
+        for (uint32_t phase = 0U; phase < DAQ_PHASE_COUNT; phase++)
+        {
+            const daq_phase_accum_t* accum = &timing->phase[phase];
+            daq_phase_timing_t* out = &stats->phase[phase];
+            
+            out->samples = accum->samples;
+            out->min_ns = (accum->samples > 0U) ? daq_ticks_to_ns(accum->min_ticks) : 0U;
+            out->max_ns = daq_ticks_to_ns(accum->max_ticks);
+            out->mean_ns = (accum->samples > 0U) ? 
+                           daq_ticks_to_ns(accum->total_ticks / accum->samples) : 0U;
+            (void)memcpy(out->histogram, accum->histogram, sizeof(out->histogram));
+        }
+        
+        stats->timebase_hz = ehms_timebase_hz();
+        stats->deadline_ns = DAQ_CYCLE_DEADLINE_NS;
+        stats->overrun_count = timing->overrun_count;
+        stats->last_overrun_cycle = timing->last_overrun_cycle;
+    }
+    
+    return result;
+}
+
+/**
+ * @brief Clear acquisition cycle timing statistics
+ * 
+ * @return EHMS_OK on success, error code otherwise
+ * 
+ * @trace SRS-EHMS-100
+ */
+ehms_result_t daq_reset_timing_statistics(void)
+{
+    ehms_result_t result = EHMS_OK;
+    
+    if (!s_daq_state.is_initialized)
+    {
+        result = EHMS_ERROR_NOT_INIT;
+    }
+    else
+    {
+        daq_reset_timing(&s_daq_state);
+    }
+    
+    return result;
+}
+
+/**
+ * @brief Save the source health of the onboard context for a warm start
+ *
+ * @param[out] state  Receives the source health
+ * @return EHMS_OK on success, error code otherwise
+ *
+ * @trace SRS-EHMS-016
+ * @trace SRS-EHMS-103
+ */
+ehms_result_t daq_save_warm_state(daq_warm_state_t* state)
+{
+    ehms_result_t result = EHMS_OK;
+    
+    if (state == NULL)
+    {
+        result = EHMS_ERROR_PARAM;
+    }
+    else if (!s_daq_state.is_initialized)
+    {
+        result = EHMS_ERROR_NOT_INIT;
+    }
+    else
+    {
+        (void)memset(state, 0, sizeof(*state));
+        
+        for (uint8_t i = 0U; i < EHMS_ARINC429_BUS_COUNT; i++)
+        {
+            const daq_source_info_t* source = &s_daq_state.sources[i];
+            
+            state->source[i].is_active = source->is_active ? 1U : 0U;
+            state->source[i].failure_count = source->failure_count;
+            state->source[i].total_samples = source->total_samples;
+            state->source[i].error_samples = source->error_samples;
+        }
+    }
+    
+    return result;
+}
+
+/**
+ * @brief Restore source health saved by daq_save_warm_state
+ *
+ * Primary roles and bus identifiers come from the configuration and are
+ * not restored; last_update_ms stays at zero, as the clock has restarted.
+ *
+ * @param[in] state  Saved source health
+ * @return EHMS_OK on success, EHMS_ERROR_RANGE for an invalid entry,
+ *         error code otherwise
+ *
+ * @trace SRS-EHMS-016
+ * @trace SRS-EHMS-103
+ */
+ehms_result_t daq_restore_warm_state(const daq_warm_state_t* state)
+{
+    ehms_result_t result = EHMS_OK;
+    
+    if (state == NULL)
+    {
+        result = EHMS_ERROR_PARAM;
+    }
+    else if (!s_daq_state.is_initialized)
+    {
+        result = EHMS_ERROR_NOT_INIT;
+    }
+    else
+    {
+        for (uint8_t i = 0U; i < EHMS_ARINC429_BUS_COUNT; i++)
+        {
+            const daq_source_health_t* health = &state->source[i];
+            
+            /* An inactive source has failed at least DAQ_MAX_CONSECUTIVE_FAILURES times */
+            if ((health->is_active > 1U) ||
+                ((health->is_active == 0U) &&
+                 (health->failure_count < DAQ_MAX_CONSECUTIVE_FAILURES)) ||
+                (health->error_samples > health->total_samples))
+            {
+                result = EHMS_ERROR_RANGE;
+            }
+        }
+    }
+    
+    if (result == EHMS_OK)
+    {
+        for (uint8_t i = 0U; i < EHMS_ARINC429_BUS_COUNT; i++)
+        {
+            daq_source_info_t* source = &s_daq_state.sources[i];
+            
+            source->is_active = (state->source[i].is_active != 0U);
+            source->failure_count = state->source[i].failure_count;
+            source->total_samples = state->source[i].total_samples;
+            source->error_samples = state->source[i].error_samples;
+        }
+    }
+    
+    return result;
+}
+
+/* ============================================================================
+ * PRIVATE FUNCTIONS
+ * ============================================================================ */
+
+/**
+ * @brief Validate configuration structure
+ */
+static ehms_result_t daq_validate_config(const daq_config_t* config)
+{
+    ehms_result_t result = EHMS_OK;
+    
+    if (config->sample_rate_hz > EHMS_MAX_SAMPLE_RATE_HZ)
+    {
+        result = EHMS_ERROR_RANGE;
+    }
+    else if (config->engine_count > EHMS_MAX_ENGINES)
+    {
+        result = EHMS_ERROR_RANGE;
+    }
+    
+    return result;
+}
+
+/**
+ * @brief Clear a context and compile its tables from the configuration
+ *
+ * Everything but bus and timebase initialization, so onboard and ground
+ * contexts are configured identically.
+ */
+static ehms_result_t daq_setup_context(daq_context_t* ctx)
+{
+    ehms_result_t result = EHMS_OK;
+    
+    /* Clear context state */
+    (void)memset(ctx, 0, sizeof(*ctx));
+    
+    /* Initialize data sources */
+    result = daq_init_sources(ctx);
+
+#if defined(EHMS_FIXED_POINT_PIPELINE)
+    if (result == EHMS_OK)
+    {
+        /* Compile bus data conversion to fixed-point units */
+        result = daq_build_fixed_scaling(ctx);
+    }
+#endif
+    
+    if (result == EHMS_OK)
+    {
+        /* Compile parameter limits for the validation pass */
+        daq_build_limits_cache(ctx);
+        
+        /* Route ARINC 429 labels to parameter slots */
+        daq_build_arinc429_routes(ctx);
+        
+        /* Spread rate group reads across the major frame */
+        daq_build_schedule(ctx);
+        
+        /* Start cycle timing */
+        daq_reset_timing(ctx);
+        
+        /* Establish snapshot headers and their integrity CRCs */
+        daq_init_snapshot_crc(ctx);
+
+#if defined(DAQ_PARALLEL_ENGINES)
+        /* Open the cycle barrier of the acquisition cores */
+        atomic_init(&ctx->barrier.arrived, 0U);
+        atomic_init(&ctx->barrier.generation, 0U);
+#endif
+    }
+    
+    return result;
+}
+
+/**
+ * @brief Initialize data source tracking
+ */
+static ehms_result_t daq_init_sources(daq_context_t* ctx)
+{
+    for (uint8_t i = 0U; i < EHMS_ARINC429_BUS_COUNT; i++)
+    {
+        ctx->sources[i].is_active = true;
+        ctx->sources[i].is_primary = (i < 2U);
+        ctx->sources[i].bus_id = i;
+        ctx->sources[i].last_update_ms = 0U;
+        ctx->sources[i].failure_count = 0U;
+        ctx->sources[i].total_samples = 0U;
+        ctx->sources[i].error_samples = 0U;
+    }
+    
+    return EHMS_OK;
+}
+
+/**
+ * @brief Build the per-bus ARINC 429 routing tables and label indexes
+ */
+static void daq_build_arinc429_routes(daq_context_t* ctx)
+{
+    for (uint8_t bus = 0U; bus < EHMS_ARINC429_BUS_COUNT; bus++)
+    {
+        (void)memset(ctx->arinc_routes[bus].label_slot, 
+                     (int)DAQ_ARINC429_NO_SLOT, 
+                     sizeof(ctx->arinc_routes[bus].label_slot));
+    }
+    
+    for (uint32_t p = 0U; p < EHMS_PARAM_COUNT; p++)
+    {
+        uint8_t buses[2] = { s_param_config[p].bus_primary, s_param_config[p].bus_backup };
+        uint32_t label = s_param_config[p].arinc_label;
+        
+        if ((label == DAQ_ARINC429_LABEL_UNUSED) || (label >= DAQ_ARINC429_LABEL_COUNT))
+        {
+            continue;
+        }
+        
+        for (uint32_t role = 0U; role < 2U; role++)
+        {
+            uint8_t bus = buses[role];
+            
+            if ((bus >= EHMS_ARINC429_BUS_COUNT) || ((role == 1U) && (bus == buses[0])))
+            {
+                continue;
+            }
+            
+            daq_arinc429_route_t* route = &ctx->arinc_routes[bus];
+            
+            /* First table entry wins if a label is configured twice */
+            if (route->label_slot[label] == DAQ_ARINC429_NO_SLOT)
+            {
+                route->label_slot[label] = (uint8_t)route->count;
+                route->param[route->count] = (uint8_t)p;
+                route->label[route->count] = (uint8_t)label;
+                if (role == 0U)
+                {
+                    route->primary_mask |= 1ULL << route->count;
+                }
+                route->count++;
+            }
+        }
+    }
+}
+
+/**
+ * @brief Build the minor/major frame read schedule
+ *
+ * Members of a group read every d-th minor cycle take offsets 0..d-1 in
+ * table order, so a slow group adds about 1/d of its reads to each cycle.
+ */
+static void daq_build_schedule(daq_context_t* ctx)
+{
+    uint32_t offset[EHMS_PARAM_COUNT];
+    uint32_t members[DAQ_RATE_GROUP_COUNT] = { 0U };
+    
+    (void)memset(&ctx->schedule, 0, sizeof(ctx->schedule));
+    
+    for (uint32_t p = 0U; p < EHMS_PARAM_COUNT; p++)
+    {
+        uint32_t group = s_param_rate_group[p];
+        
+        offset[p] = members[group] % s_rate_groups[group].divisor;
+        members[group]++;
+        ctx->schedule.stale_timeout_ms[p] = s_rate_groups[group].stale_timeout_ms;
+    }
+    
+    for (uint8_t bus = 0U; bus < EHMS_ARINC429_BUS_COUNT; bus++)
+    {
+        const daq_arinc429_route_t* route = &ctx->arinc_routes[bus];
+        
+        for (uint32_t slot = 0U; slot < route->count; slot++)
+        {
+            uint32_t p = route->param[slot];
+            uint32_t divisor = s_rate_groups[s_param_rate_group[p]].divisor;
+            
+            if ((route->primary_mask & (1ULL << slot)) == 0ULL)
+            {
+                continue;
+            }
+            
+            for (uint32_t minor = offset[p]; minor < DAQ_MAJOR_FRAME_CYCLES; minor += divisor)
+            {
+                ctx->schedule.due_slots[minor][bus] |= 1ULL << slot;
+            }
+        }
+    }
+}
+
+/**
+ * @brief Start an acquisition cycle
+ *
+ * Latches the cycle time, from which sample times are offsets, and
+ * recompiles the range limits if the configuration has changed.
+ */
+static void daq_begin_cycle(daq_context_t* ctx, uint32_t cycle_start)
+{
+    ctx->current_time_ms = system_get_time_ms();
+    ctx->cycle_start_ticks = cycle_start;
+    ctx->cycle_time = system_get_timestamp();
+    ctx->cycle_count++;
+    
+    daq_refresh_limits(ctx);
+}
+
+/**
+ * @brief Read one engine's bus data
+ *
+ * ARINC 429 parameters are read with failover per parameter, then the
+ * 1553 data if every ARINC 429 parameter was received.
+ */
+static void daq_read_engine(daq_context_t* ctx, ehms_engine_id_t engine, uint32_t* phase_ticks)
+{
+    uint32_t t0 = ehms_timebase_read();
+    
+    ehms_result_t result = daq_read_arinc429_data(ctx, engine);
+    
+    uint32_t t1 = ehms_timebase_read();
+    
+    /* Read 1553 data (vibration, discrete) */
+    if (result == EHMS_OK)
+    {
+        (void)daq_read_1553_data(ctx, engine);
+    }
+    
+    uint32_t t2 = ehms_timebase_read();
+    
+    phase_ticks[DAQ_PHASE_ARINC429] += t1 - t0;
+    phase_ticks[DAQ_PHASE_MILSTD1553] += t2 - t1;
+}
+
+/**
+ * @brief Process one engine's data read this cycle
+ *
+ * Touches only the engine's lane, publication and per-engine module
+ * state, so different engines may be processed on different cores.
+ */
+static void daq_process_engine(daq_context_t* ctx, ehms_engine_id_t engine,
+                               uint32_t* phase_ticks)
+{
+    ehms_engine_block_t* block = &ctx->lane[engine].block;
+    uint32_t t0 = ehms_timebase_read();
+    
+    /* One flight phase for the whole of the engine's cycle */
+    block->flight_phase = atomic_load_explicit(&ctx->flight_phase[engine],
+                                               memory_order_relaxed);
+
+#if defined(DAQ_VIBRATION_BURST)
+    /* Analyse the bursts against this cycle's shaft speeds */
+    daq_analyse_vibration(ctx, engine);
+
+#endif
+    /* Validate all parameters (range, then staleness) */
+    daq_validate_block(ctx, engine);
+
+#if defined(DAQ_ANOMALY_DETECTION)
+    /* Score the validated parameters against the flight phase baseline */
+    daq_score_anomaly(ctx, engine);
+
+#endif
+    uint32_t t1 = ehms_timebase_read();
+    
+    /* Update snapshot timestamp (covered by the CRC) */
+    daq_calendar_time(ctx, daq_sample_time_ms(ctx), &block->sample_time);
+    ctx->lane[engine].crc.dirty_mask |= 
+        (1ULL << DAQ_CRC_SEGMENT_HEADER);
+    
+    /* Produce external snapshot from changed block entries */
+    daq_pack_snapshot(ctx, engine);
+    
+    /* Fold changed segments into snapshot CRC */
+    daq_update_snapshot_crc(ctx, engine);
+    
+    /* Make the completed snapshot visible to consumers */
+    daq_publish_snapshot(ctx, engine);
+
+#if defined(DAQ_TREND_ENGINE)
+    /* Fold the cycle's new samples into the trend statistics */
+    (void)trend_update(block, ctx->current_time_ms);
+
+#endif
+    uint32_t t2 = ehms_timebase_read();
+    
+    phase_ticks[DAQ_PHASE_VALIDATION] += t1 - t0;
+    phase_ticks[DAQ_PHASE_INTEGRITY] += t2 - t1;
+}
+
+/**
+ * @brief Record the cycle's phase durations and check the deadline
+ */
+static void daq_end_cycle(daq_context_t* ctx, uint32_t cycle_start, uint32_t* phase_ticks)
+{
+    phase_ticks[DAQ_PHASE_CYCLE] = ehms_timebase_read() - cycle_start;
+    
+    for (uint32_t phase = 0U; phase < DAQ_PHASE_COUNT; phase++)
+    {
+        daq_record_phase(ctx, (daq_phase_t)phase, phase_ticks[phase]);
+    }
+    
+    if (phase_ticks[DAQ_PHASE_CYCLE] > ctx->timing.deadline_ticks)
+    {
+        ctx->timing.overrun_count++;
+        ctx->timing.last_overrun_cycle = ctx->cycle_count;
+    }
+}
+
+#if defined(DAQ_PARALLEL_ENGINES)
+/**
+ * @brief Wait until every acquisition core has reached the barrier
+ *
+ * The acquire-release pass orders everything a core wrote before arriving
+ * before everything the other cores read after leaving.
+ */
+static void daq_barrier_wait(daq_barrier_t* barrier)
+{
+    uint32_t generation = atomic_load_explicit(&barrier->generation, memory_order_acquire);
+    uint32_t arrived = atomic_fetch_add_explicit(&barrier->arrived, 1U, memory_order_acq_rel);
+    
+    if (arrived == (DAQ_CORE_COUNT - 1U))
+    {
+        atomic_store_explicit(&barrier->arrived, 0U, memory_order_relaxed);
+        atomic_store_explicit(&barrier->generation, generation + 1U, memory_order_release);
+    }
+    else
+    {
+        while (atomic_load_explicit(&barrier->generation, memory_order_acquire) == generation)
+        {
+            /* Spin; the partition schedule releases all cores together */
+        }
+    }
+}
+
+#endif
+/**
+ * @brief Read ARINC 429 data for specified engine
+ *
+ * Each parameter is read from the source chosen by daq_select_source. A
+ * label that fails on its primary bus is re-fetched from its backup bus in
+ * the same cycle; labels that were received are not read again.
+ *
+ * @return EHMS_OK if every parameter was received from some source,
+ *         otherwise the result of the last failed read
+ */
+static ehms_result_t daq_read_arinc429_data(daq_context_t* ctx, ehms_engine_id_t engine)
+{
+    ehms_result_t result = EHMS_OK;
+    arinc429_word_t word;
+    uint32_t minor = ctx->cycle_count % DAQ_MAJOR_FRAME_CYCLES;
+    
+    for (uint8_t bus = 0U; bus < EHMS_ARINC429_BUS_COUNT; bus++)
+    {
+        const daq_arinc429_route_t* route = &ctx->arinc_routes[bus];
+        uint64_t due = ctx->schedule.due_slots[minor][bus];
+        uint32_t sample_ms = daq_sample_time_ms(ctx);
+        
+        /* Primary slots due in this minor cycle, in slot order */
+        while (due != 0ULL)
+        {
+            uint32_t slot = (uint32_t)__builtin_ctzll(due);
+            
+            due &= due - 1ULL;
+            
+            uint32_t p = route->param[slot];
+            uint8_t backup = s_param_config[p].bus_backup;
+            uint8_t selected;
+            ehms_result_t read_result = daq_select_source(ctx, (ehms_param_id_t)p, &selected);
+            
+            if (read_result == EHMS_OK)
+            {
+                read_result = daq_fetch_arinc429_word(ctx, selected, route->label[slot], &word);
+                daq_update_statistics(ctx, selected, (read_result == EHMS_OK));
+                
+                /* Re-fetch only this label from the backup bus */
+                if ((read_result != EHMS_OK) && (selected == bus) && 
+                    (backup != bus) && (backup < EHMS_ARINC429_BUS_COUNT))
+                {
+                    selected = backup;
+                    read_result = daq_fetch_arinc429_word(ctx, selected, route->label[slot], &word);
+                    daq_update_statistics(ctx, selected, (read_result == EHMS_OK));
+                }
+            }
+            
+            if (read_result == EHMS_OK)
+            {
+                daq_store_arinc429_word(ctx, selected, engine, p, &word, sample_ms);
+            }
+            else
+            {
+                result = read_result;
+            }
+        }
+    }
+    
+    return result;
+}
+
+/**
+ * @brief Fetch the current word for a label from a bus
+ *
+ * With DAQ_ARINC429_FIFO_READ the word is taken from the receive FIFO
+ * drained once per cycle; otherwise the label is read from the driver.
+ */
+static ehms_result_t daq_fetch_arinc429_word(daq_context_t* ctx, uint8_t bus_id,
+                                             uint32_t label,
+                                             arinc429_word_t* word)
+{
+    ehms_result_t result;
+
+#if defined(DAQ_ARINC429_FIFO_READ)
+    const daq_arinc429_rx_t* rx = &ctx->arinc_rx[bus_id];
+    uint8_t slot = ctx->arinc_routes[bus_id].label_slot[label];
+    
+    if (rx->cycle != ctx->cycle_count)
+    {
+        daq_drain_arinc429_fifo(ctx, bus_id);
+    }
+    
+    if ((slot != DAQ_ARINC429_NO_SLOT) && ((rx->received & (1ULL << slot)) != 0ULL))
+    {
+        *word = rx->word[slot];
+        result = EHMS_OK;
+    }
+    else
+    {
+        result = (rx->result != EHMS_OK) ? rx->result : EHMS_ERROR_TIMEOUT;
+    }
+#else
+    (void)ctx;
+    result = arinc429_read(bus_id, label, word);
+#endif
+    
+    return result;
+}
+
+/**
+ * @brief Convert a received ARINC 429 word into its parameter block entry
+ *
+ * The data field is decoded by the parameter's generated encoding routine
+ * (daq_param_table.h) and scaled to the parameter's value.
+ */
+static void daq_store_arinc429_word(daq_context_t* ctx, uint8_t bus_id,
+                                    ehms_engine_id_t engine,
+                                    uint32_t param,
+                                    const arinc429_word_t* word,
+                                    uint32_t sample_ms)
+{
+    ehms_engine_block_t* block = &ctx->lane[engine].block;
+    int32_t counts = 0;
+    
+    /* A data field its encoding cannot represent fails the sample */
+    if (daq_decode_arinc429_word(param, word, &counts))
+    {
+        daq_scale_value(ctx, block, param, counts);
+        block->status[param] = (uint8_t)EHMS_PARAM_VALID;
+    }
+    else
+    {
+        block->status[param] = (uint8_t)EHMS_PARAM_FAILED;
+    }
+    block->source_bus[param] = bus_id;
+    block->timestamp_ms[param] = sample_ms;
+    
+    ctx->lane[engine].crc.dirty_mask |= 
+        (1ULL << DAQ_CRC_SEGMENT_PARAM(param));
+}
+
+#if defined(DAQ_ARINC429_FIFO_READ)
+/**
+ * @brief Drain a bus receive FIFO and dispatch words by label
+ *
+ * A single driver call returns every word received since the last drain.
+ * Words are dispatched through the label index; a label received more than
+ * once keeps its latest word and labels not routed on the bus are dropped.
+ */
+static void daq_drain_arinc429_fifo(daq_context_t* ctx, uint8_t bus_id)
+{
+    daq_arinc429_rx_t* rx = &ctx->arinc_rx[bus_id];
+    const daq_arinc429_route_t* route = &ctx->arinc_routes[bus_id];
+    arinc429_word_t fifo[ARINC429_FIFO_DEPTH];
+    uint32_t word_count = 0U;
+    
+    rx->cycle = ctx->cycle_count;
+    rx->received = 0ULL;
+    rx->result = arinc429_read_fifo(bus_id, fifo, ARINC429_FIFO_DEPTH, &word_count);
+    
+    if (rx->result == EHMS_OK)
+    {
+        for (uint32_t i = 0U; (i < word_count) && (i < ARINC429_FIFO_DEPTH); i++)
+        {
+            uint8_t slot = route->label_slot[fifo[i].label & (DAQ_ARINC429_LABEL_COUNT - 1U)];
+            
+            if (slot != DAQ_ARINC429_NO_SLOT)
+            {
+                rx->word[slot] = fifo[i];
+                rx->received |= 1ULL << slot;
+            }
+        }
+    }
+}
+#endif
+
+/**
+ * @brief Read MIL-STD-1553B data
+ */
+static ehms_result_t daq_read_1553_data(daq_context_t* ctx, ehms_engine_id_t engine)
+{
+    ehms_result_t result;
+    milstd1553_message_t msg;
+    
+    /* Read vibration data (subaddress 5) */
+    result = milstd1553_read_subaddress(5U, &msg);
+    
+    if (result == EHMS_OK)
+    {
+        /* Parse vibration data from message */
+        ehms_engine_block_t* block = &ctx->lane[engine].block;
+        
+        uint32_t sample_ms = daq_sample_time_ms(ctx);
+        
+        daq_scale_value(ctx, block, EHMS_PARAM_VIB_FAN, (int32_t)msg.data[0]);
+        block->status[EHMS_PARAM_VIB_FAN] = (uint8_t)EHMS_PARAM_VALID;
+        block->timestamp_ms[EHMS_PARAM_VIB_FAN] = sample_ms;
+        
+        daq_scale_value(ctx, block, EHMS_PARAM_VIB_CORE, (int32_t)msg.data[1]);
+        block->status[EHMS_PARAM_VIB_CORE] = (uint8_t)EHMS_PARAM_VALID;
+        block->timestamp_ms[EHMS_PARAM_VIB_CORE] = sample_ms;
+        
+        ctx->lane[engine].crc.dirty_mask |= 
+            (1ULL << DAQ_CRC_SEGMENT_PARAM(EHMS_PARAM_VIB_FAN)) |
+            (1ULL << DAQ_CRC_SEGMENT_PARAM(EHMS_PARAM_VIB_CORE));
+    }
+
+#if defined(DAQ_VIBRATION_BURST)
+    if (result == EHMS_OK)
+    {
+        result = daq_read_vibration_burst(ctx, engine);
+    }
+#endif
+    
+    return result;
+}
+
+#if defined(DAQ_VIBRATION_BURST)
+/**
+ * @brief Read vibration waveform bursts into the engine's sample rings
+ *
+ * Each sensor's burst subaddress carries the samples of one acquisition
+ * cycle. The buffered samples are analysed by daq_analyse_vibration once
+ * the cycle's bus reads are complete.
+ */
+static ehms_result_t daq_read_vibration_burst(daq_context_t* ctx, ehms_engine_id_t engine)
+{
+    ehms_result_t result = EHMS_OK;
+    milstd1553_message_t msg;
+    
+    for (uint32_t s = 0U; s < VIB_SENSOR_COUNT; s++)
+    {
+        ehms_result_t read_result = milstd1553_read_subaddress(s_vib_burst_subaddress[s], &msg);
+        
+        if (read_result == EHMS_OK)
+        {
+            uint32_t words = (msg.word_count < VIB_BURST_WORDS) ? 
+                             (uint32_t)msg.word_count : VIB_BURST_WORDS;
+            
+            /* Ring overruns are reported through vib_get_statistics */
+            (void)vib_write_samples(engine, (vib_sensor_t)s, msg.data, words);
+        }
+        else
+        {
+            result = read_result;
+        }
+    }
+    
+    ctx->lane[engine].vib_pending = true;
+    
+    return result;
+}
+
+/**
+ * @brief Analyse buffered vibration samples and publish completed order bands
+ *
+ * Samples read this cycle are analysed against the shaft speeds read from
+ * ARINC 429; a band parameter is written only in the cycle its block
+ * completes and otherwise ages like any other sample. Nothing is done in
+ * a cycle whose bursts were not read.
+ */
+static void daq_analyse_vibration(daq_context_t* ctx, ehms_engine_id_t engine)
+{
+    ehms_engine_block_t* block = &ctx->lane[engine].block;
+    float shaft_speed_pct[VIB_ORDER_COUNT];
+    uint32_t completed = 0U;
+    
+    if (ctx->lane[engine].vib_pending)
+    {
+        ctx->lane[engine].vib_pending = false;
+        
+        shaft_speed_pct[VIB_ORDER_N1] = daq_shaft_speed_pct(block, EHMS_PARAM_N1);
+        shaft_speed_pct[VIB_ORDER_N2] = daq_shaft_speed_pct(block, EHMS_PARAM_N2);
+        
+        (void)vib_process(engine, shaft_speed_pct, &completed);
+    }
+    
+    uint32_t sample_ms = daq_sample_time_ms(ctx);
+    
+    while (completed != 0U)
+    {
+        uint32_t b = (uint32_t)__builtin_ctz(completed);
+        uint32_t p = EHMS_PARAM_VIB_FAN_N1 + b;
+        uint32_t source = s_vib_sensor_param[b / VIB_ORDER_COUNT];
+        vib_band_t band;
+        
+        completed &= completed - 1U;
+        
+        (void)vib_get_band(engine, (vib_sensor_t)(b / VIB_ORDER_COUNT), 
+                           (vib_order_t)(b % VIB_ORDER_COUNT), &band);
+        
+        /* Amplitudes carry the sensor's bus scaling without its offset */
+        int32_t counts = (int32_t)lroundf(band.amplitude);
+#if defined(EHMS_FIXED_POINT_PIPELINE)
+        block->raw_value[p] = counts * ctx->fixed_scaling.scale[source];
+#else
+        block->raw_value[p] = counts;
+        block->eng_value[p] = (float)counts * s_param_config[source].scale_factor;
+#endif
+        block->status[p] = (uint8_t)band.status;
+        block->timestamp_ms[p] = sample_ms;
+        
+        ctx->lane[engine].crc.dirty_mask |= 1ULL << DAQ_CRC_SEGMENT_PARAM(p);
+    }
+}
+
+/**
+ * @brief Shaft speed for order tracking; 0 unless the parameter is valid
+ */
+static float daq_shaft_speed_pct(const ehms_engine_block_t* block, uint32_t param)
+{
+    float speed = 0.0f;
+    
+    if (block->status[param] == (uint8_t)EHMS_PARAM_VALID)
     {
-        stats->cycle_count = s_daq_state.cycle_count;
-        stats->current_time_ms = s_daq_state.current_time_ms;
+#if defined(EHMS_FIXED_POINT_PIPELINE)
+        speed = ehms_raw_to_eng((ehms_param_id_t)param, block->raw_value[param]);
+#else
+        speed = block->eng_value[param];
+#endif
+    }
+    
+    return speed;
+}
+#endif
+
+#if defined(DAQ_ANOMALY_DETECTION)
+/**
+ * @brief Score the validated cycle and assess engine health
+ *
+ * The cycle is scored against the baseline of the flight phase latched
+ * from daq_set_flight_phase. The score is stored as
+ * EHMS_PARAM_ANOMALY_SCORE, on which the alert manager raises the
+ * advisory, and the assessment becomes the snapshot health_status. The
+ * score is NCD until the engine profile has loaded the anomaly model, and
+ * in phases the model has no baseline for.
+ */
+static void daq_score_anomaly(daq_context_t* ctx, ehms_engine_id_t engine)
+{
+    ehms_engine_block_t* block = &ctx->lane[engine].block;
+    float features[ANOMALY_FEATURE_COUNT];
+    bool valid = true;
+    anomaly_result_t anomaly;
+    
+    for (uint32_t f = 0U; f < ANOMALY_FEATURE_COUNT; f++)
+    {
+        valid = valid && (block->status[f] == (uint8_t)EHMS_PARAM_VALID);
+#if defined(EHMS_FIXED_POINT_PIPELINE)
+        features[f] = ehms_raw_to_eng((ehms_param_id_t)f, block->raw_value[f]);
+#else
+        features[f] = block->eng_value[f];
+#endif
+    }
+    
+    if (anomaly_evaluate(engine, block->flight_phase, features, valid, &anomaly) != EHMS_OK)
+    {
+        anomaly.score = 0.0f;
+        anomaly.status = EHMS_PARAM_NCD;
+        anomaly.health = EHMS_HEALTH_NORMAL;
+    }
+    
+    /* Ratio resolution in both pipelines */
+    block->raw_value[EHMS_PARAM_ANOMALY_SCORE] = 
+        (int32_t)lroundf(anomaly.score * (float)EHMS_RATIO_SCALE_FACTOR);
+#if !defined(EHMS_FIXED_POINT_PIPELINE)
+    block->eng_value[EHMS_PARAM_ANOMALY_SCORE] = anomaly.score;
+#endif
+    block->status[EHMS_PARAM_ANOMALY_SCORE] = (uint8_t)anomaly.status;
+    block->timestamp_ms[EHMS_PARAM_ANOMALY_SCORE] = daq_sample_time_ms(ctx);
+    
+    ctx->lane[engine].crc.dirty_mask |= 
+        1ULL << DAQ_CRC_SEGMENT_PARAM(EHMS_PARAM_ANOMALY_SCORE);
+    
+    if (anomaly.health != ctx->lane[engine].health)
+    {
+        ctx->lane[engine].health = anomaly.health;
+        ctx->lane[engine].crc.dirty_mask |= 1ULL << DAQ_CRC_SEGMENT_TRAILER;
+    }
+}
+#endif
+
+/**
+ * @brief Compile parameter range limits into the limits cache
+ *
+ * The generation is sampled before the database is read, so a change
+ * notified while the cache is being compiled triggers another rebuild on
+ * the next cycle rather than being lost.
+ */
+static void daq_build_limits_cache(daq_context_t* ctx)
+{
+    param_limits_t limits;
+    uint32_t generation = atomic_load_explicit(&s_daq_limits_generation, 
+                                               memory_order_acquire);
+    
+    for (uint32_t p = 0U; p < EHMS_PARAM_COUNT; p++)
+    {
+        if (param_db_get_limits((ehms_param_id_t)p, &limits) != EHMS_OK)
+        {
+            limits.min_value = -INFINITY;
+            limits.max_value = INFINITY;
+        }
+
+#if defined(EHMS_FIXED_POINT_PIPELINE)
+        /* value < min <=> raw < ceil(min); value > max <=> raw > floor(max) */
+        ctx->limits.min_raw[p] = ehms_raw_ceil((ehms_param_id_t)p, limits.min_value);
+        ctx->limits.max_raw[p] = ehms_raw_floor((ehms_param_id_t)p, limits.max_value);
+#else
+        ctx->limits.min_value[p] = limits.min_value;
+        ctx->limits.max_value[p] = limits.max_value;
+#endif
+    }
+    
+    ctx->limits.generation = generation;
+}
+
+/**
+ * @brief Recompile the limits cache if the configuration has changed
+ */
+static void daq_refresh_limits(daq_context_t* ctx)
+{
+    if (atomic_load_explicit(&s_daq_limits_generation, memory_order_acquire) != 
+        ctx->limits.generation)
+    {
+        daq_build_limits_cache(ctx);
+    }
+}
+
+/**
+ * @brief Validate all parameters of an engine block (range, then staleness)
+ *
+ * Parameters whose status changes are marked for repacking.
+ */
+static void daq_validate_block(daq_context_t* ctx, ehms_engine_id_t engine)
+{
+    ehms_engine_block_t* block = &ctx->lane[engine].block;
+#if defined(EHMS_FIXED_POINT_PIPELINE)
+    uint64_t changed = param_validate_batch_fixed(block->status,
+                                                  block->raw_value,
+                                                  block->timestamp_ms,
+                                                  ctx->limits.min_raw,
+                                                  ctx->limits.max_raw,
+                                                  ctx->current_time_ms,
+                                                  ctx->schedule.stale_timeout_ms,
+                                                  EHMS_PARAM_COUNT);
+#else
+    uint64_t changed = param_validate_batch(block->status,
+                                            block->eng_value,
+                                            block->timestamp_ms,
+                                            ctx->limits.min_value,
+                                            ctx->limits.max_value,
+                                            ctx->current_time_ms,
+                                            ctx->schedule.stale_timeout_ms,
+                                            EHMS_PARAM_COUNT);
+#endif
+    
+    ctx->lane[engine].crc.dirty_mask |= (changed << DAQ_CRC_SEGMENT_PARAM(0U));
+}
+
+#if defined(EHMS_FIXED_POINT_PIPELINE)
+/**
+ * @brief Compile bus data conversion to fixed-point units
+ *
+ * Each parameter's scale factor and offset shall be whole multiples of its
+ * fixed-point resolution, so that conversion is exact in integers.
+ *
+ * @return EHMS_OK, or EHMS_ERROR_CONFIG if a parameter's scaling is finer
+ *         than its fixed-point resolution
+ */
+static ehms_result_t daq_build_fixed_scaling(daq_context_t* ctx)
+{
+    ehms_result_t result = EHMS_OK;
+    
+    for (uint32_t p = 0U; p < EHMS_PARAM_COUNT; p++)
+    {
+        double scale = ehms_raw_scale((ehms_param_id_t)p, s_param_config[p].scale_factor);
+        double offset = ehms_raw_scale((ehms_param_id_t)p, s_param_config[p].offset);
         
-        for (uint8_t i = 0U; i < EHMS_ARINC429_BUS_COUNT; i++)
+        if ((scale != floor(scale)) || (offset != floor(offset)))
         {
-            stats->source_samples[i] = s_daq_state.sources[i].total_samples;
-            stats->source_errors[i] = s_daq_state.sources[i].error_samples;
+            result = EHMS_ERROR_CONFIG;
+            break;
         }
+        
+        ctx->fixed_scaling.scale[p] = (int32_t)scale;
+        ctx->fixed_scaling.offset[p] = (int32_t)offset;
     }
     
     return result;
 }
+#endif
 
-/* ============================================================================
- * PRIVATE FUNCTIONS
- * ============================================================================ */
+/**
+ * @brief Store bus data as the value of a parameter block entry
+ *
+ * Fixed-point builds store only raw_value in fixed-point units; the
+ * engineering value is produced when the snapshot is packed.
+ */
+static void daq_scale_value(daq_context_t* ctx, ehms_engine_block_t* block, uint32_t param,
+                            int32_t data)
+{
+#if defined(EHMS_FIXED_POINT_PIPELINE)
+    block->raw_value[param] = (data * ctx->fixed_scaling.scale[param]) + 
+                              ctx->fixed_scaling.offset[param];
+#else
+    (void)ctx;
+    block->raw_value[param] = data;
+    block->eng_value[param] = ((float)data * s_param_config[param].scale_factor) + 
+                              s_param_config[param].offset;
+#endif
+}
 
 /**
- * @brief Validate configuration structure
+ * @brief Select the source bus for a parameter from source health
+ *
+ * The primary bus is used while it is active. Once it has been marked
+ * inactive the backup bus is used, unless the backup is inactive too; the
+ * primary is still probed every DAQ_SOURCE_PROBE_CYCLES so that it can
+ * recover. A failed probe fails over to the backup in the same cycle.
  */
-static ehms_result_t daq_validate_config(const daq_config_t* config)
+static ehms_result_t daq_select_source(daq_context_t* ctx, ehms_param_id_t param_id,
+                                       uint8_t* selected_bus)
 {
     ehms_result_t result = EHMS_OK;
     
-    if (config->sample_rate_hz > EHMS_MAX_SAMPLE_RATE_HZ)
+    if ((param_id >= EHMS_PARAM_COUNT) || 
+        (s_param_config[param_id].bus_primary >= EHMS_ARINC429_BUS_COUNT))
     {
         result = EHMS_ERROR_RANGE;
     }
-    else if (config->engine_count > EHMS_MAX_ENGINES)
+    else
     {
-        result = EHMS_ERROR_RANGE;
+        uint8_t primary = s_param_config[param_id].bus_primary;
+        uint8_t backup = s_param_config[param_id].bus_backup;
+        bool use_backup = (!ctx->sources[primary].is_active) && 
+                          (backup < EHMS_ARINC429_BUS_COUNT) && 
+                          (backup != primary) && 
+                          ctx->sources[backup].is_active && 
+                          ((ctx->cycle_count % DAQ_SOURCE_PROBE_CYCLES) != 0U);
+        
+        *selected_bus = use_backup ? backup : primary;
     }
     
     return result;
 }
 
 /**
- * @brief Initialize data source tracking
+ * @brief Update source statistics
  */
-static ehms_result_t daq_init_sources(void)
+static void daq_update_statistics(daq_context_t* ctx, uint8_t bus_id, bool success)
 {
-    for (uint8_t i = 0U; i < EHMS_ARINC429_BUS_COUNT; i++)
+    if (bus_id < EHMS_ARINC429_BUS_COUNT)
+    {
+        ctx->sources[bus_id].total_samples++;
+        ctx->sources[bus_id].last_update_ms = ctx->current_time_ms;
+        
+        if (!success)
+        {
+            ctx->sources[bus_id].error_samples++;
+            ctx->sources[bus_id].failure_count++;
+            
+            if (ctx->sources[bus_id].failure_count >= 
+                DAQ_MAX_CONSECUTIVE_FAILURES)
+            {
+                ctx->sources[bus_id].is_active = false;
+            }
+        }
+        else
+        {
+            ctx->sources[bus_id].failure_count = 0U;
+            ctx->sources[bus_id].is_active = true;
+        }
+    }
+}
+
+/**
+ * @brief Clear timing accumulators and derive the deadline in ticks
+ */
+static void daq_reset_timing(daq_context_t* ctx)
+{
+    daq_timing_t* timing = &ctx->timing;
+    
+    (void)memset(timing, 0, sizeof(*timing));
+    
+    for (uint32_t phase = 0U; phase < DAQ_PHASE_COUNT; phase++)
     {
-        s_daq_state.sources[i].is_active = true;
-        s_daq_state.sources[i].is_primary = (i < 2U);
-        s_daq_state.sources[i].bus_id = i;
-        s_daq_state.sources[i].last_update_ms = 0U;
-        s_daq_state.sources[i].failure_count = 0U;
-        s_daq_state.sources[i].total_samples = 0U;
-        s_daq_state.sources[i].error_samples = 0U;
+        timing->phase[phase].min_ticks = UINT32_MAX;
     }
     
-    return EHMS_OK;
+    timing->deadline_ticks = (uint32_t)(((uint64_t)ehms_timebase_hz() * DAQ_CYCLE_PERIOD_US) 
+                                        / 1000000ULL);
 }
 
 /**
- * @brief Read ARINC 429 data for specified engine
+ * @brief Fold one phase duration into its accumulator
+ *
+ * Kept to compares and a leading-zero count so it can run every cycle;
+ * conversion to nanoseconds happens when statistics are read.
  */
-static ehms_result_t daq_read_arinc429_data(uint8_t bus_id, 
-                                             ehms_engine_id_t engine)
+static void daq_record_phase(daq_context_t* ctx, daq_phase_t phase, uint32_t ticks)
 {
-    ehms_result_t result = EHMS_OK;
-    arinc429_word_t word;
+    daq_phase_accum_t* accum = &ctx->timing.phase[phase];
+    uint32_t bin = 0U;
     
-    for (uint32_t p = 0U; p < EHMS_PARAM_COUNT; p++)
+    if (ticks != 0U)
     {
-        if (s_param_config[p].bus_primary == bus_id)
+        bin = 32U - (uint32_t)__builtin_clz(ticks);
+        if (bin >= DAQ_TIMING_HISTOGRAM_BINS)
         {
-            /* Read ARINC 429 word */
-            result = arinc429_read(bus_id, s_param_config[p].arinc_label, &word);
-            
-            if (result == EHMS_OK)
+            bin = DAQ_TIMING_HISTOGRAM_BINS - 1U;
+        }
+    }
+    
+    accum->samples++;
+    accum->total_ticks += ticks;
+    accum->histogram[bin]++;
+    
+    if (ticks < accum->min_ticks)
+    {
+        accum->min_ticks = ticks;
+    }
+    if (ticks > accum->max_ticks)
+    {
+        accum->max_ticks = ticks;
+    }
+}
+
+/**
+ * @brief Convert a timebase tick count to nanoseconds (saturating)
+ */
+static uint32_t daq_ticks_to_ns(uint64_t ticks)
+{
+    uint32_t hz = ehms_timebase_hz();
+    uint64_t ns = 0ULL;
+    
+    if (hz != 0U)
+    {
+        ns = ((ticks / hz) * 1000000000ULL) + (((ticks % hz) * 1000000000ULL) / hz);
+    }
+    
+    return (ns > UINT32_MAX) ? UINT32_MAX : (uint32_t)ns;
+}
+
+/**
+ * @brief Monotonic sample time in milliseconds
+ *
+ * The cycle time read at the start of the cycle advanced by the timebase
+ * ticks elapsed since; taken once per bus read batch.
+ */
+static uint32_t daq_sample_time_ms(daq_context_t* ctx)
+{
+    uint32_t ticks_per_ms = ehms_timebase_hz() / 1000U;
+    uint32_t elapsed_ms = 0U;
+    
+    if (ticks_per_ms != 0U)
+    {
+        elapsed_ms = (ehms_timebase_read() - ctx->cycle_start_ticks) / ticks_per_ms;
+    }
+    
+    return ctx->current_time_ms + elapsed_ms;
+}
+
+/**
+ * @brief Derive the calendar form of a monotonic sample time
+ *
+ * Offsets the calendar time of the current cycle by the difference of the
+ * sample time from the cycle time. Used only where samples leave the
+ * module in their external form.
+ *
+ * @param[in]  ctx        Acquisition context
+ * @param[in]  time_ms    Monotonic sample time
+ * @param[out] timestamp  Receives the calendar timestamp
+ */
+static void daq_calendar_time(daq_context_t* ctx, uint32_t time_ms, ehms_timestamp_t* timestamp)
+{
+    const ehms_timestamp_t* base = &ctx->cycle_time;
+    int64_t day_ms = ((((((int64_t)base->hour * 60) + (int64_t)base->minute) * 60) + 
+                       (int64_t)base->second) * 1000) + (int64_t)base->millisecond;
+    
+    *timestamp = *base;
+    day_ms += (int64_t)(int32_t)(time_ms - ctx->current_time_ms);
+    
+    while (day_ms < 0)
+    {
+        day_ms += DAQ_MS_PER_DAY;
+        daq_step_day(timestamp, false);
+    }
+    while (day_ms >= DAQ_MS_PER_DAY)
+    {
+        day_ms -= DAQ_MS_PER_DAY;
+        daq_step_day(timestamp, true);
+    }
+    
+    timestamp->millisecond = (uint16_t)(day_ms % 1000);
+    timestamp->second = (uint8_t)((day_ms / 1000) % 60);
+    timestamp->minute = (uint8_t)((day_ms / 60000) % 60);
+    timestamp->hour = (uint8_t)(day_ms / 3600000);
+}
+
+/**
+ * @brief Move a calendar date one day forward or back (years 2000-2099)
+ */
+static void daq_step_day(ehms_timestamp_t* timestamp, bool forward)
+{
+    static const uint8_t days_in_month[12] = 
+    {
+        31U, 28U, 31U, 30U, 31U, 30U, 31U, 31U, 30U, 31U, 30U, 31U
+    };
+    uint32_t month = ((timestamp->month >= 1U) && (timestamp->month <= 12U)) ? 
+                     timestamp->month : 1U;
+    uint32_t leap = ((timestamp->year % 4U) == 0U) ? 1U : 0U;
+    uint32_t days = days_in_month[month - 1U] + ((month == 2U) ? leap : 0U);
+    
+    if (forward)
+    {
+        if (timestamp->day < days)
+        {
+            timestamp->day++;
+        }
+        else
+        {
+            timestamp->day = 1U;
+            if (month < 12U)
             {
-                /* Convert to parameter */
-                ehms_parameter_t* param = 
-                    &s_daq_state.engine_data[engine].parameters[p];
-                
-                param->param_id = (ehms_param_id_t)p;
-                param->raw_value = word.data;
-                param->eng_value = (float)word.data * s_param_config[p].scale_factor
-                                 + s_param_config[p].offset;
-                param->source_bus = bus_id;
-                param->status = EHMS_PARAM_VALID;
-                param->timestamp = system_get_timestamp();
-                
-                daq_update_statistics(bus_id, true);
+                timestamp->month = (uint8_t)(month + 1U);
             }
             else
             {
-                daq_update_statistics(bus_id, false);
+                timestamp->month = 1U;
+                timestamp->year++;
             }
         }
     }
-    
-    return result;
+    else
+    {
+        if (timestamp->day > 1U)
+        {
+            timestamp->day--;
+        }
+        else if (month > 1U)
+        {
+            month--;
+            timestamp->month = (uint8_t)month;
+            timestamp->day = (uint8_t)(days_in_month[month - 1U] + ((month == 2U) ? leap : 0U));
+        }
+        else
+        {
+            timestamp->month = 12U;
+            timestamp->day = 31U;
+            timestamp->year--;
+        }
+    }
 }
 
 /**
- * @brief Read MIL-STD-1553B data
+ * @brief Build CRC segment layout and compute initial snapshot CRCs
+ *
+ * Segment shift operators are built from the end of the snapshot backwards
+ * by composition, so initialization cost does not grow with snapshot size.
  */
-static ehms_result_t daq_read_1553_data(ehms_engine_id_t engine)
+static void daq_init_snapshot_crc(daq_context_t* ctx)
 {
-    ehms_result_t result;
-    milstd1553_message_t msg;
+    ehms_crc32_shift_t param_shift;
+    const uint32_t param_base = (uint32_t)offsetof(ehms_engine_snapshot_t, parameters);
+    const uint32_t param_size = (uint32_t)sizeof(ehms_parameter_t);
+    const uint32_t trailer_offset = (uint32_t)offsetof(ehms_engine_snapshot_t, health_status);
+    daq_crc_segment_t* segments = ctx->crc_segments;
     
-    /* Read vibration data (subaddress 5) */
-    result = milstd1553_read_subaddress(5U, &msg);
+    /* Segment extents */
+    segments[DAQ_CRC_SEGMENT_HEADER].offset = 0U;
+    segments[DAQ_CRC_SEGMENT_HEADER].length = param_base;
     
-    if (result == EHMS_OK)
+    for (uint32_t p = 0U; p < EHMS_PARAM_COUNT; p++)
     {
-        /* Parse vibration data from message */
-        ehms_parameter_t* vib_fan = 
-            &s_daq_state.engine_data[engine].parameters[EHMS_PARAM_VIB_FAN];
-        ehms_parameter_t* vib_core = 
-            &s_daq_state.engine_data[engine].parameters[EHMS_PARAM_VIB_CORE];
+        segments[DAQ_CRC_SEGMENT_PARAM(p)].offset = param_base + (p * param_size);
+        segments[DAQ_CRC_SEGMENT_PARAM(p)].length = param_size;
+    }
+    
+    segments[DAQ_CRC_SEGMENT_TRAILER].offset = trailer_offset;
+    segments[DAQ_CRC_SEGMENT_TRAILER].length = 
+        (uint32_t)DAQ_SNAPSHOT_CRC_LENGTH - trailer_offset;
+    
+    /* Shift operators: trailer is last, each earlier segment is followed
+     * by the segment after it plus that segment's own shift */
+    ehms_crc32_shift_init(&segments[DAQ_CRC_SEGMENT_TRAILER].shift, 0U);
+    ehms_crc32_shift_init(&segments[EHMS_PARAM_COUNT].shift, 
+                          segments[DAQ_CRC_SEGMENT_TRAILER].length + 
+                          (trailer_offset - (param_base + (EHMS_PARAM_COUNT * param_size))));
+    ehms_crc32_shift_init(&param_shift, param_size);
+    
+    for (uint32_t seg = EHMS_PARAM_COUNT; seg > DAQ_CRC_SEGMENT_HEADER; seg--)
+    {
+        ehms_crc32_shift_compose(&segments[seg - 1U].shift, 
+                                 &param_shift, &segments[seg].shift);
+    }
+    
+    /* Contribution of the initial register value */
+    ctx->crc_preset = ehms_crc32_zeros(EHMS_CRC32_INITIAL, 
+                                              (uint32_t)DAQ_SNAPSHOT_CRC_LENGTH);
+    
+    for (uint8_t eng = 0U; eng < EHMS_MAX_ENGINES; eng++)
+    {
+        ctx->lane[eng].block.engine_id = (ehms_engine_id_t)eng;
         
-        vib_fan->raw_value = msg.data[0];
-        vib_fan->eng_value = (float)msg.data[0] * 0.001f;
-        vib_fan->status = EHMS_PARAM_VALID;
+        ctx->lane[eng].crc.dirty_mask = DAQ_CRC_SEGMENT_ALL;
+        daq_pack_snapshot(ctx, (ehms_engine_id_t)eng);
+        daq_update_snapshot_crc(ctx, (ehms_engine_id_t)eng);
         
-        vib_core->raw_value = msg.data[1];
-        vib_core->eng_value = (float)msg.data[1] * 0.001f;
-        vib_core->status = EHMS_PARAM_VALID;
+        /* Buffer 0 is published with no readers */
+        (void)memcpy(&ctx->publication[eng].buffers[0].snapshot,
+                    &ctx->lane[eng].snapshot,
+                    sizeof(ehms_engine_snapshot_t));
+        (void)memcpy(&ctx->publication[eng].buffers[0].block,
+                    &ctx->lane[eng].block,
+                    sizeof(ehms_engine_block_t));
+        atomic_init(&ctx->publication[eng].control, 0U);
     }
-    
-    return result;
 }
 
 /**
- * @brief Validate parameter against limits
+ * @brief Refresh the external snapshot from the engine parameter block
+ *
+ * Only header, parameter and (with DAQ_ANOMALY_DETECTION) trailer entries
+ * marked dirty this cycle are rewritten.
+ * Fields are assigned individually so structure padding, which is covered
+ * by the CRC, keeps its initial zero value.
  */
-static ehms_result_t daq_validate_parameter(ehms_parameter_t* param)
+static void daq_pack_snapshot(daq_context_t* ctx, ehms_engine_id_t engine)
 {
-    ehms_result_t result = EHMS_OK;
+    ehms_engine_block_t* block = &ctx->lane[engine].block;
+    ehms_engine_snapshot_t* snapshot = &ctx->lane[engine].snapshot;
+    uint64_t dirty = ctx->lane[engine].crc.dirty_mask;
     
-    /* Get limits from database */
-    param_limits_t limits;
-    if (param_db_get_limits(param->param_id, &limits) == EHMS_OK)
+    if ((dirty & (1ULL << DAQ_CRC_SEGMENT_HEADER)) != 0ULL)
     {
-        if ((param->eng_value < limits.min_value) ||
-            (param->eng_value > limits.max_value))
+        snapshot->engine_id = block->engine_id;
+        snapshot->sample_time = block->sample_time;
+        snapshot->flight_phase = block->flight_phase;
+    }
+    
+    for (uint32_t p = 0U; p < EHMS_PARAM_COUNT; p++)
+    {
+        if ((dirty & (1ULL << DAQ_CRC_SEGMENT_PARAM(p))) != 0ULL)
         {
-            param->status = EHMS_PARAM_FAILED;
-            result = EHMS_ERROR_RANGE;
+            ehms_parameter_t* param = &snapshot->parameters[p];
+
+#if defined(EHMS_FIXED_POINT_PIPELINE)
+            /* Engineering units are produced only for consumers */
+            block->eng_value[p] = ehms_raw_to_eng((ehms_param_id_t)p, block->raw_value[p]);
+#endif
+            param->param_id = (ehms_param_id_t)p;
+            param->status = (ehms_param_status_t)block->status[p];
+            param->raw_value = block->raw_value[p];
+            param->eng_value = block->eng_value[p];
+            daq_calendar_time(ctx, block->timestamp_ms[p], &param->timestamp);
+            param->source_bus = block->source_bus[p];
         }
     }
-    
-    return result;
+
+#if defined(DAQ_ANOMALY_DETECTION)
+    if ((dirty & (1ULL << DAQ_CRC_SEGMENT_TRAILER)) != 0ULL)
+    {
+        snapshot->health_status = ctx->lane[engine].health;
+    }
+#endif
 }
 
 /**
- * @brief Check for stale data
+ * @brief Calculate the shifted CRC contribution of one snapshot segment
  */
-static ehms_result_t daq_check_staleness(ehms_parameter_t* param)
+static uint32_t daq_segment_crc(daq_context_t* ctx, ehms_engine_id_t engine, uint32_t segment)
 {
-    ehms_result_t result = EHMS_OK;
-    uint32_t param_age_ms;
+    const uint8_t* base = (const uint8_t*)&ctx->lane[engine].snapshot;
+    const daq_crc_segment_t* seg = &ctx->crc_segments[segment];
     
-    /* Calculate age of data */
-    param_age_ms = s_daq_state.current_time_ms - 
-                   timestamp_to_ms(&param->timestamp);
+    return ehms_crc32_shift_apply(&seg->shift,
+        ehms_crc32_update(0U, &base[seg->offset], seg->length));
+}
+
+/**
+ * @brief Fold segments written this cycle into the snapshot CRC
+ *
+ * @trace SRS-EHMS-108
+ */
+static void daq_update_snapshot_crc(daq_context_t* ctx, ehms_engine_id_t engine)
+{
+    daq_snapshot_crc_t* crc = &ctx->lane[engine].crc;
     
-    if (param_age_ms > DAQ_STALE_TIMEOUT_MS)
+    for (uint32_t seg = 0U; seg < DAQ_CRC_SEGMENT_COUNT; seg++)
     {
-        if (param->status == EHMS_PARAM_VALID)
+        if (((crc->dirty_mask >> seg) & 1ULL) != 0ULL)
         {
-            param->status = EHMS_PARAM_STALE;
+            uint32_t contribution = daq_segment_crc(ctx, engine, seg);
+            
+            crc->combined ^= crc->contribution[seg] ^ contribution;
+            crc->contribution[seg] = contribution;
         }
-        result = EHMS_ERROR_TIMEOUT;
     }
     
-    return result;
+    crc->dirty_mask = 0ULL;
+    
+    ctx->lane[engine].snapshot.crc32 = ~(ctx->crc_preset ^ crc->combined);
 }
 
 /**
- * @brief Calculate CRC-32
+ * @brief Publish the working snapshot of an engine
+ *
+ * Called only from the acquisition task. If both unpublished buffers are
+ * still pinned by readers the previous snapshot stays published and the
+ * skip is counted; the working copy is published on the next cycle.
  */
-static uint32_t daq_calculate_crc32(const void* data, uint32_t length)
+static void daq_publish_snapshot(daq_context_t* ctx, ehms_engine_id_t engine)
 {
-    const uint8_t* bytes = (const uint8_t*)data;
-    uint32_t crc = 0xFFFFFFFFUL;
+    daq_publication_t* pub = &ctx->publication[engine];
+    uint32_t control = atomic_load_explicit(&pub->control, memory_order_acquire);
+    uint32_t published = control & DAQ_PUBLISH_INDEX_MASK;
+    uint32_t back = DAQ_PUBLISH_BUFFER_COUNT;
     
-    for (uint32_t i = 0U; i < length; i++)
+    /* Readers only pin the published buffer, so a free back buffer found
+     * here cannot gain a reader until it is itself published */
+    for (uint32_t b = 0U; b < DAQ_PUBLISH_BUFFER_COUNT; b++)
     {
-        crc ^= bytes[i];
-        for (uint8_t bit = 0U; bit < 8U; bit++)
+        if ((b != published) && ((control & DAQ_PUBLISH_READER_MASK(b)) == 0UL))
         {
-            if ((crc & 1U) != 0U)
-            {
-                crc = (crc >> 1U) ^ DAQ_CRC32_POLYNOMIAL;
-            }
-            else
-            {
-                crc >>= 1U;
-            }
+            back = b;
+            break;
         }
     }
     
-    return ~crc;
+    if (back < DAQ_PUBLISH_BUFFER_COUNT)
+    {
+        (void)memcpy(&pub->buffers[back].snapshot, &ctx->lane[engine].snapshot,
+                    sizeof(ehms_engine_snapshot_t));
+        (void)memcpy(&pub->buffers[back].block, &ctx->lane[engine].block,
+                    sizeof(ehms_engine_block_t));
+        
+        /* Only the writer modifies the index field, so XOR replaces it
+         * without disturbing concurrent reader count updates */
+        (void)atomic_fetch_xor_explicit(&pub->control, published ^ back,
+                                        memory_order_release);
+    }
+    else
+    {
+        pub->publish_skips++;
+    }
 }
 
 /**
- * @brief Update source statistics
+ * @brief Pin the currently published snapshot buffer of an engine
+ *
+ * The compare-exchange only repeats if the control word changed between
+ * load and exchange; the snapshot data itself is never re-read.
+ *
+ * @param[in]  ctx     Acquisition context
+ * @param[in]  engine  Engine identifier
+ * @param[out] index   Pinned buffer index
+ * @return EHMS_OK, or EHMS_ERROR_BUSY if the reader count is saturated
  */
-static void daq_update_statistics(uint8_t bus_id, bool success)
+static ehms_result_t daq_acquire_published(daq_context_t* ctx, ehms_engine_id_t engine,
+                                           uint32_t* index)
 {
-    if (bus_id < EHMS_ARINC429_BUS_COUNT)
+    ehms_result_t result = EHMS_OK;
+    daq_publication_t* pub = &ctx->publication[engine];
+    uint32_t control = atomic_load_explicit(&pub->control, memory_order_acquire);
+    uint32_t desired;
+    uint32_t published;
+    
+    do
     {
-        s_daq_state.sources[bus_id].total_samples++;
-        s_daq_state.sources[bus_id].last_update_ms = s_daq_state.current_time_ms;
+        published = control & DAQ_PUBLISH_INDEX_MASK;
         
-        if (!success)
+        if ((control & DAQ_PUBLISH_READER_MASK(published)) == 
+            DAQ_PUBLISH_READER_MASK(published))
         {
-            s_daq_state.sources[bus_id].error_samples++;
-            s_daq_state.sources[bus_id].failure_count++;
-            
-            if (s_daq_state.sources[bus_id].failure_count >= 
-                DAQ_MAX_CONSECUTIVE_FAILURES)
-            {
-                s_daq_state.sources[bus_id].is_active = false;
-            }
+            result = EHMS_ERROR_BUSY;
+            break;
         }
-        else
+        
+        desired = control + DAQ_PUBLISH_READER_ONE(published);
+    } while (!atomic_compare_exchange_weak_explicit(&pub->control, &control, desired,
+                                                    memory_order_acquire,
+                                                    memory_order_acquire));
+    
+    *index = published;
+    
+    return result;
+}
+
+/**
+ * @brief Unpin a snapshot buffer obtained from daq_acquire_published
+ *
+ * A buffer with no reader was not pinned; decrementing its count would
+ * borrow from the next buffer's count field, so the release is refused.
+ *
+ * @param[in] ctx     Acquisition context
+ * @param[in] engine  Engine identifier
+ * @param[in] index   Pinned buffer index
+ * @return EHMS_OK, or EHMS_ERROR_PARAM if the buffer holds no reader
+ */
+static ehms_result_t daq_release_published(daq_context_t* ctx, ehms_engine_id_t engine,
+                                           uint32_t index)
+{
+    ehms_result_t result = EHMS_OK;
+    daq_publication_t* pub = &ctx->publication[engine];
+    uint32_t control = atomic_load_explicit(&pub->control, memory_order_relaxed);
+    uint32_t desired;
+    
+    do
+    {
+        if ((control & DAQ_PUBLISH_READER_MASK(index)) == 0UL)
         {
-            s_daq_state.sources[bus_id].failure_count = 0U;
+            result = EHMS_ERROR_PARAM;
+            break;
         }
-    }
+        
+        desired = control - DAQ_PUBLISH_READER_ONE(index);
+    } while (!atomic_compare_exchange_weak_explicit(&pub->control, &control, desired,
+                                                    memory_order_release,
+                                                    memory_order_relaxed));
+    
+    return result;
 }
 
 /* END OF FILE */
@@ -0,0 +1,492 @@
+/**
+ * @file data_acquisition_ext.h
+ * @brief EHMS Data Acquisition Module - Extended Interface
+ *
+ * @copyright Copyright (c) 2026 AeroTech Avionics Inc.
+ * @note This file is subject to DO-178C Level B certification requirements
+ *
+ * CSCI: EHMS-CORE
+ * CSC: DATA-ACQUISITION
+ *
+ * Supplements data_acquisition.h with the zero-copy consumer interface
+ * and the structure-of-arrays parameter block, reports cycle timing,
+ * receives configuration change notifications and carries source health
+ * over a warm start.
+ *
+ * The daq_ctx_ functions run the same validation, packing, CRC and
+ * publication on recorded data of any number of aircraft, each held in
+ * its own acquisition context. The daq_ functions operate on the onboard
+ * context, which alone is fed from the buses.
+ *
+ * Requirements Trace:
+ *   SRS-EHMS-110: System shall provide engine snapshot data to consumers
+ *   SRS-EHMS-111: System shall provide individual parameter values
+ */
+
+#ifndef DATA_ACQUISITION_EXT_H
+#define DATA_ACQUISITION_EXT_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* ============================================================================
+ * INCLUDES
+ * ============================================================================ */
+#include "ehms_types.h"
+#if defined(DAQ_TREND_ENGINE)
+#include "trend_engine.h"
+#endif
+
+/* ============================================================================
+ * CONSTANTS
+ * ============================================================================ */
+
+/** @brief Latency histogram bins; bin k counts durations of [2^(k-1), 2^k) ticks */
+#define DAQ_TIMING_HISTOGRAM_BINS           32U
+
+#if defined(DAQ_PARALLEL_ENGINES)
+/** @brief Cores sharing the acquisition cycle (DAQ_PARALLEL_ENGINES) */
+#ifndef DAQ_CORE_COUNT
+#define DAQ_CORE_COUNT                      2U
+#endif
+
+/** @brief Target cache line size; per-core and per-engine state is aligned to it */
+#ifndef DAQ_CACHE_LINE_BYTES
+#define DAQ_CACHE_LINE_BYTES                64U
+#endif
+#endif
+
+/* ============================================================================
+ * TYPES
+ * ============================================================================ */
+
+/**
+ * @brief Measured phases of the acquisition cycle
+ *
+ * Engine phases are summed over all engines of a cycle; with
+ * DAQ_PARALLEL_ENGINES the sums cover the engines of every core, so they
+ * may add up to more than the cycle. The bus phases cover only the bus
+ * reads. Processing of the data read is charged to DAQ_PHASE_VALIDATION:
+ * vibration order analysis (DAQ_VIBRATION_BURST), validation and anomaly
+ * scoring (DAQ_ANOMALY_DETECTION). The trend update (DAQ_TREND_ENGINE)
+ * is charged to DAQ_PHASE_INTEGRITY.
+ */
+typedef enum
+{
+    DAQ_PHASE_ARINC429      = 0U,   /**< ARINC 429 reads and failover */
+    DAQ_PHASE_MILSTD1553    = 1U,   /**< MIL-STD-1553B reads */
+    DAQ_PHASE_VALIDATION    = 2U,   /**< Vibration analysis, validation, anomaly scoring */
+    DAQ_PHASE_INTEGRITY     = 3U,   /**< Snapshot packing, CRC, publication and trend */
+    DAQ_PHASE_CYCLE         = 4U,   /**< Complete daq_execute_cycle */
+    DAQ_PHASE_COUNT         = 5U
+} daq_phase_t;
+
+/**
+ * @brief Execution-time statistics of one phase
+ */
+typedef struct
+{
+    uint32_t            samples;                /**< Cycles measured */
+    uint32_t            min_ns;                 /**< Shortest duration */
+    uint32_t            max_ns;                 /**< Longest duration */
+    uint32_t            mean_ns;                /**< Mean duration */
+    uint32_t            histogram[DAQ_TIMING_HISTOGRAM_BINS]; /**< log2(ticks) */
+} daq_phase_timing_t;
+
+/**
+ * @brief Acquisition cycle timing statistics
+ */
+typedef struct
+{
+    daq_phase_timing_t  phase[DAQ_PHASE_COUNT]; /**< Per-phase statistics */
+    uint32_t            timebase_hz;            /**< Histogram tick frequency */
+    uint32_t            deadline_ns;            /**< Cycle deadline */
+    uint32_t            overrun_count;          /**< Cycles exceeding deadline */
+    uint32_t            last_overrun_cycle;     /**< Cycle count of last overrun */
+} daq_timing_statistics_t;
+
+/**
+ * @brief Health of one ARINC 429 source
+ */
+typedef struct
+{
+    uint8_t             is_active;              /**< Source is active (0 or 1) */
+    uint8_t             reserved[3];            /**< Zero */
+    uint32_t            failure_count;          /**< Consecutive failure count */
+    uint32_t            total_samples;          /**< Total samples received */
+    uint32_t            error_samples;          /**< Total error samples */
+} daq_source_health_t;
+
+/**
+ * @brief Acquisition state carried over a warm start
+ */
+typedef struct
+{
+    daq_source_health_t source[EHMS_ARINC429_BUS_COUNT]; /**< By bus identifier */
+} daq_warm_state_t;
+
+/**
+ * @brief Acquisition context: the acquisition state of one aircraft
+ *
+ * Opaque; storage of daq_context_size() bytes is provided by the caller.
+ * Contexts share nothing but the parameter configuration and the limits
+ * generation, so different contexts may be used from different tasks
+ * concurrently; one context shall be used by one task at a time.
+ */
+typedef struct daq_context daq_context_t;
+
+/* ============================================================================
+ * FUNCTION PROTOTYPES
+ * ============================================================================ */
+
+/**
+ * @brief Borrow a read-only view of the published engine snapshot
+ *
+ * The view points directly into a published, CRC-stamped buffer that the
+ * acquisition task will not modify until it is released. Views shall be
+ * released within one acquisition cycle; while two views of the same
+ * engine are held the acquisition task cannot publish new data for it.
+ *
+ * @param[in]  engine_id  Engine identifier
+ * @param[out] view       Receives pointer to the published snapshot
+ * @return EHMS_OK on success, EHMS_ERROR_BUSY if too many views are held,
+ *         error code otherwise
+ *
+ * @trace SRS-EHMS-110
+ */
+ehms_result_t daq_acquire_snapshot_view(ehms_engine_id_t engine_id,
+                                         const ehms_engine_snapshot_t** view);
+
+/**
+ * @brief Return a view obtained from daq_acquire_snapshot_view
+ *
+ * Each view is released once. Releasing a buffer that no view holds, as
+ * a second release of its only view does, is refused and leaves the
+ * reader counts unchanged.
+ *
+ * @param[in] engine_id  Engine identifier the view was acquired for
+ * @param[in] view       View to release
+ * @return EHMS_OK on success, EHMS_ERROR_PARAM if view is not a view
+ *         currently held, error code otherwise
+ *
+ * @trace SRS-EHMS-110
+ */
+ehms_result_t daq_release_snapshot_view(ehms_engine_id_t engine_id,
+                                         const ehms_engine_snapshot_t* view);
+
+/**
+ * @brief Borrow a read-only view of the published engine parameter block
+ *
+ * Same publication and hold-time rules as daq_acquire_snapshot_view; the
+ * block and the snapshot of one acquisition cycle are published together.
+ *
+ * @param[in]  engine_id  Engine identifier
+ * @param[out] view       Receives pointer to the published parameter block
+ * @return EHMS_OK on success, EHMS_ERROR_BUSY if too many views are held,
+ *         error code otherwise
+ *
+ * @trace SRS-EHMS-110
+ */
+ehms_result_t daq_acquire_block_view(ehms_engine_id_t engine_id,
+                                      const ehms_engine_block_t** view);
+
+/**
+ * @brief Return a view obtained from daq_acquire_block_view
+ *
+ * Each view is released once. Releasing a buffer that no view holds, as
+ * a second release of its only view does, is refused and leaves the
+ * reader counts unchanged.
+ *
+ * @param[in] engine_id  Engine identifier the view was acquired for
+ * @param[in] view       View to release
+ * @return EHMS_OK on success, EHMS_ERROR_PARAM if view is not a view
+ *         currently held, error code otherwise
+ *
+ * @trace SRS-EHMS-110
+ */
+ehms_result_t daq_release_block_view(ehms_engine_id_t engine_id,
+                                      const ehms_engine_block_t* view);
+
+/**
+ * @brief Read engineering values and status of a list of parameters
+ *
+ * All values are taken from the same published snapshot.
+ *
+ * @param[in]  engine_id  Engine identifier
+ * @param[in]  param_ids  Parameter identifiers to read
+ * @param[in]  count      Number of identifiers
+ * @param[out] values     Receives eng_value of each parameter
+ * @param[out] status     Receives status of each parameter
+ * @return EHMS_OK on success, error code otherwise
+ *
+ * @trace SRS-EHMS-111
+ */
+ehms_result_t daq_get_parameter_values(ehms_engine_id_t engine_id,
+                                        const ehms_param_id_t* param_ids,
+                                        uint32_t count,
+                                        float* values,
+                                        ehms_param_status_t* status);
+
+/**
+ * @brief Notify the acquisition task that parameter limits have changed
+ *
+ * Called by the parameter database after a new OEM configuration has been
+ * loaded. Range validation uses a limits cache compiled at daq_init; the
+ * cache is recompiled at the start of the first acquisition cycle that
+ * follows the notification.
+ *
+ * @trace SRS-EHMS-101
+ */
+void daq_notify_limits_changed(void);
+
+/**
+ * @brief Set the flight phase of an engine
+ *
+ * Fed by the flight phase task from the FMS flight phase and the weight
+ * on wheels discrete. The acquisition task latches the latest phase into
+ * the engine's parameter block (flight_phase) once per cycle, before
+ * validation, so the anomaly baseline, the alert manager's threshold set
+ * and the trend phase periods of a cycle all use the same phase, and it
+ * is published in the snapshot. The phase is GROUND until first set.
+ *
+ * @param[in] engine_id  Engine identifier
+ * @param[in] phase      Flight phase
+ * @return EHMS_OK on success, EHMS_ERROR_RANGE for an invalid engine or
+ *         phase, EHMS_ERROR_NOT_INIT before daq_init
+ *
+ * @trace SRS-EHMS-202
+ */
+ehms_result_t daq_set_flight_phase(ehms_engine_id_t engine_id, ehms_flight_phase_t phase);
+
+#if defined(DAQ_PARALLEL_ENGINES)
+/**
+ * @brief Execute one acquisition cycle on one core of a multicore target
+ *
+ * Replaces daq_execute_cycle when the cycle is shared by DAQ_CORE_COUNT
+ * cores: the acquisition task of every core calls it once per cycle.
+ * Core 0 starts the cycle and reads the buses for all engines, keeping
+ * the bus interfaces and source selection on one core and in the serial
+ * order. After a barrier each core processes its statically assigned
+ * engines, engine e on core e % DAQ_CORE_COUNT: vibration analysis,
+ * validation, anomaly scoring, packing, CRC, publication and trend update.
+ * After a second barrier core 0 records the cycle timing. When core 0
+ * returns, the snapshots of all engines for the cycle are published for
+ * alert processing.
+ *
+ * @param[in] core  Core index, 0 .. DAQ_CORE_COUNT - 1
+ * @return EHMS_OK on success, EHMS_ERROR_PARAM for an invalid core,
+ *         EHMS_ERROR_NOT_INIT before daq_init
+ *
+ * @trace SRS-EHMS-100
+ * @trace SRS-EHMS-101
+ *
+ * @note daq_init shall complete before the cores' acquisition tasks start,
+ *       and every core shall call this function every cycle; a core that
+ *       does not arrive holds the others at the barrier.
+ */
+ehms_result_t daq_execute_cycle_core(uint32_t core);
+
+#endif
+/**
+ * @brief Get acquisition cycle timing statistics
+ *
+ * @param[out] stats  Pointer to receive timing statistics
+ * @return EHMS_OK on success, error code otherwise
+ *
+ * @trace SRS-EHMS-100
+ */
+ehms_result_t daq_get_timing_statistics(daq_timing_statistics_t* stats);
+
+/**
+ * @brief Clear acquisition cycle timing statistics
+ *
+ * @return EHMS_OK on success, error code otherwise
+ *
+ * @trace SRS-EHMS-100
+ */
+ehms_result_t daq_reset_timing_statistics(void);
+
+/**
+ * @brief Save the source health of the onboard context for a warm start
+ *
+ * @param[out] state  Receives the source health; every byte is written
+ * @return EHMS_OK on success, error code otherwise
+ *
+ * @trace SRS-EHMS-016
+ * @trace SRS-EHMS-103
+ */
+ehms_result_t daq_save_warm_state(daq_warm_state_t* state);
+
+/**
+ * @brief Restore source health saved by daq_save_warm_state
+ *
+ * Called after daq_init and before the first acquisition cycle, so that
+ * sources found failed before a power interruption are not used again
+ * until they fail for several more cycles. Nothing is restored unless
+ * every entry is valid.
+ *
+ * @param[in] state  Saved source health
+ * @return EHMS_OK on success, EHMS_ERROR_RANGE for an invalid entry,
+ *         error code otherwise
+ *
+ * @trace SRS-EHMS-016
+ * @trace SRS-EHMS-103
+ */
+ehms_result_t daq_restore_warm_state(const daq_warm_state_t* state);
+
+/**
+ * @brief Get the storage size of an acquisition context
+ *
+ * With DAQ_PARALLEL_ENGINES the storage shall be aligned to
+ * DAQ_CACHE_LINE_BYTES.
+ *
+ * @return Size in bytes
+ */
+uint32_t daq_context_size(void);
+
+/**
+ * @brief Initialize an acquisition context for recorded data
+ *
+ * Configures the context as daq_init configures the onboard context,
+ * without initializing any bus interface or the timebase.
+ *
+ * @param[out] ctx    Context storage of daq_context_size() bytes
+ * @param[in]  epoch  Calendar time at sample time zero
+ * @return EHMS_OK on success, error code otherwise
+ *
+ * @trace SRS-EHMS-105
+ */
+ehms_result_t daq_ctx_init(daq_context_t* ctx, const ehms_timestamp_t* epoch);
+
+#if defined(DAQ_TREND_ENGINE)
+/**
+ * @brief Attach a trend context to an acquisition context
+ *
+ * daq_ctx_process_sample folds every processed sample into the attached
+ * trend context, as the onboard cycle folds into the onboard trend
+ * statistics. An acquisition context has none attached after
+ * daq_ctx_init; NULL detaches it. The trend context is owned and
+ * initialized by the caller (trend_ctx_init) and shall outlive its use.
+ *
+ * @param[in,out] ctx    Acquisition context
+ * @param[in]     trend  Trend context, or NULL
+ * @return EHMS_OK on success, EHMS_ERROR_PARAM for a NULL ctx
+ *
+ * @trace SRS-EHMS-061
+ */
+ehms_result_t daq_ctx_set_trend_context(daq_context_t* ctx, trend_context_t* trend);
+
+#endif
+
+/**
+ * @brief Process one recorded sample of an engine
+ *
+ * The recorded values stand in for the bus reads of one acquisition cycle
+ * at the sample time. Samples recorded valid are range and staleness
+ * checked against the context's limits like received data; samples
+ * recorded with any other status keep it, unless out of range. The
+ * engine's snapshot is then packed, CRC-stamped and published as in
+ * flight. The recorded flight phase takes the place of
+ * daq_set_flight_phase, selecting the alert manager's threshold set as it
+ * did in flight. Raw values are the recorder's (rs_record_t): bus counts,
+ * or fixed-point units in EHMS_FIXED_POINT_PIPELINE builds.
+ *
+ * With DAQ_TREND_ENGINE the published samples are folded into the trend
+ * context attached by daq_ctx_set_trend_context, if any. The vibration
+ * order analysis and anomaly stages (DAQ_VIBRATION_BURST,
+ * DAQ_ANOMALY_DETECTION) are onboard only and are not run.
+ *
+ * @param[in,out] ctx           Acquisition context
+ * @param[in]     engine_id     Engine identifier
+ * @param[in]     time_ms       Sample time; not earlier than the previous sample
+ * @param[in]     flight_phase  Recorded ehms_flight_phase_t (rs_record_t)
+ * @param[in]     raw_value     Recorded raw values (EHMS_PARAM_COUNT)
+ * @param[in]     status        Recorded ehms_param_status_t values (EHMS_PARAM_COUNT)
+ * @return EHMS_OK on success, EHMS_ERROR_RANGE for an invalid engine or
+ *         flight phase, error code otherwise
+ *
+ * @trace SRS-EHMS-101
+ * @trace SRS-EHMS-102
+ */
+ehms_result_t daq_ctx_process_sample(daq_context_t* ctx,
+                                      ehms_engine_id_t engine_id,
+                                      uint32_t time_ms,
+                                      uint32_t flight_phase,
+                                      const int32_t* raw_value,
+                                      const uint8_t* status);
+
+/**
+ * @brief daq_get_engine_snapshot of an acquisition context
+ *
+ * @trace SRS-EHMS-110
+ */
+ehms_result_t daq_ctx_get_engine_snapshot(daq_context_t* ctx,
+                                          ehms_engine_id_t engine_id,
+                                          ehms_engine_snapshot_t* snapshot);
+
+/**
+ * @brief daq_get_parameter of an acquisition context
+ *
+ * @trace SRS-EHMS-111
+ */
+ehms_result_t daq_ctx_get_parameter(daq_context_t* ctx,
+                                    ehms_engine_id_t engine_id,
+                                    ehms_param_id_t param_id,
+                                    ehms_parameter_t* param);
+
+/**
+ * @brief daq_acquire_snapshot_view of an acquisition context
+ *
+ * @trace SRS-EHMS-110
+ */
+ehms_result_t daq_ctx_acquire_snapshot_view(daq_context_t* ctx,
+                                            ehms_engine_id_t engine_id,
+                                            const ehms_engine_snapshot_t** view);
+
+/**
+ * @brief daq_release_snapshot_view of an acquisition context
+ *
+ * @trace SRS-EHMS-110
+ */
+ehms_result_t daq_ctx_release_snapshot_view(daq_context_t* ctx,
+                                            ehms_engine_id_t engine_id,
+                                            const ehms_engine_snapshot_t* view);
+
+/**
+ * @brief daq_acquire_block_view of an acquisition context
+ *
+ * @trace SRS-EHMS-110
+ */
+ehms_result_t daq_ctx_acquire_block_view(daq_context_t* ctx,
+                                         ehms_engine_id_t engine_id,
+                                         const ehms_engine_block_t** view);
+
+/**
+ * @brief daq_release_block_view of an acquisition context
+ *
+ * @trace SRS-EHMS-110
+ */
+ehms_result_t daq_ctx_release_block_view(daq_context_t* ctx,
+                                         ehms_engine_id_t engine_id,
+                                         const ehms_engine_block_t* view);
+
+/**
+ * @brief daq_get_parameter_values of an acquisition context
+ *
+ * @trace SRS-EHMS-111
+ */
+ehms_result_t daq_ctx_get_parameter_values(daq_context_t* ctx,
+                                           ehms_engine_id_t engine_id,
+                                           const ehms_param_id_t* param_ids,
+                                           uint32_t count,
+                                           float* values,
+                                           ehms_param_status_t* status);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* DATA_ACQUISITION_EXT_H */
+
+/* END OF FILE */
@@ -0,0 +1,175 @@
+/**
+ * @file ehms_crc32.h
+ * @brief EHMS CRC-32 Integrity Engine
+ *
+ * @copyright Copyright (c) 2026 AeroTech Avionics Inc.
+ * @note This file is subject to DO-178C Level B certification requirements
+ *
+ * CSCI: EHMS-CORE
+ * CSC: CRC32-ENGINE
+ *
+ * Requirements Trace:
+ *   SRS-EHMS-108: System shall verify snapshot data integrity by CRC
+ *
+ * The engine computes the reflected CRC-32 (polynomial 0xEDB88320) used for
+ * all EHMS snapshot and record integrity fields. The backend is selected at
+ * build time through EHMS_CRC32_BACKEND; every backend produces results that
+ * are bit-identical to the reference bit-serial algorithm.
+ */
+
+#ifndef EHMS_CRC32_H
+#define EHMS_CRC32_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* ============================================================================
+ * INCLUDES
+ * ============================================================================ */
+#include <stdint.h>
+
+/* ============================================================================
+ * CONSTANTS
+ * ============================================================================ */
+
+/** @brief CRC-32 polynomial (reflected form) */
+#define EHMS_CRC32_POLYNOMIAL               0xEDB88320UL
+
+/** @brief CRC-32 register initial value */
+#define EHMS_CRC32_INITIAL                  0xFFFFFFFFUL
+
+/** @brief Backend: single 256-entry table, one byte per step */
+#define EHMS_CRC32_BACKEND_TABLE            1U
+
+/** @brief Backend: slicing-by-8, eight bytes per step */
+#define EHMS_CRC32_BACKEND_SLICING8         2U
+
+/** @brief Backend: ARMv8 CRC32 instructions (requires __ARM_FEATURE_CRC32) */
+#define EHMS_CRC32_BACKEND_ARMV8            3U
+
+/**
+ * @brief Build-time backend selection
+ *
+ * Defaults to the ARMv8 instructions when the compiler advertises them and
+ * to slicing-by-8 otherwise. Override with -DEHMS_CRC32_BACKEND=<backend>.
+ */
+#ifndef EHMS_CRC32_BACKEND
+#if defined(__ARM_FEATURE_CRC32)
+#define EHMS_CRC32_BACKEND                  EHMS_CRC32_BACKEND_ARMV8
+#else
+#define EHMS_CRC32_BACKEND                  EHMS_CRC32_BACKEND_SLICING8
+#endif
+#endif
+
+#if (EHMS_CRC32_BACKEND == EHMS_CRC32_BACKEND_ARMV8) && !defined(__ARM_FEATURE_CRC32)
+#error "EHMS_CRC32_BACKEND_ARMV8 selected but target lacks CRC32 instructions"
+#endif
+
+/* ============================================================================
+ * TYPES
+ * ============================================================================ */
+
+/**
+ * @brief Zero-extension operator
+ *
+ * GF(2) matrix that advances a CRC register over a fixed number of zero
+ * bytes. Used to place the CRC of one segment of a structure at its final
+ * position, so a structure CRC can be maintained from per-segment CRCs:
+ *   update(crc, A || B) = shift_apply(op(|B|), update(crc, A)) ^ update(0, B)
+ */
+typedef struct
+{
+    uint32_t            column[32];     /**< Image of each register bit */
+} ehms_crc32_shift_t;
+
+/* ============================================================================
+ * FUNCTION PROTOTYPES
+ * ============================================================================ */
+
+/**
+ * @brief Calculate CRC-32 of a buffer
+ *
+ * @param[in] data    Pointer to data
+ * @param[in] length  Data length in bytes
+ * @return CRC-32 (initial value and final inversion applied)
+ *
+ * @trace SRS-EHMS-108
+ */
+uint32_t ehms_crc32_calculate(const void* data, uint32_t length);
+
+/**
+ * @brief Advance a CRC-32 register over a buffer with the selected backend
+ *
+ * Operates on the raw register value: start from EHMS_CRC32_INITIAL and
+ * invert the final register to obtain the CRC. Allows a CRC to be computed
+ * over discontiguous buffers.
+ *
+ * @param[in] crc     Current register value
+ * @param[in] data    Pointer to data
+ * @param[in] length  Data length in bytes
+ * @return Updated register value
+ */
+uint32_t ehms_crc32_update(uint32_t crc, const void* data, uint32_t length);
+
+/**
+ * @brief Advance a CRC-32 register using the single-table backend
+ */
+uint32_t ehms_crc32_update_table(uint32_t crc, const void* data, uint32_t length);
+
+/**
+ * @brief Advance a CRC-32 register using the slicing-by-8 backend
+ */
+uint32_t ehms_crc32_update_slicing8(uint32_t crc, const void* data, uint32_t length);
+
+/**
+ * @brief Advance a CRC-32 register over zero bytes
+ *
+ * @param[in] crc     Current register value
+ * @param[in] length  Number of zero bytes
+ * @return Updated register value
+ */
+uint32_t ehms_crc32_zeros(uint32_t crc, uint32_t length);
+
+/**
+ * @brief Build the zero-extension operator for a byte count
+ *
+ * @param[out] op      Operator to initialize
+ * @param[in]  length  Number of zero bytes the operator advances over
+ */
+void ehms_crc32_shift_init(ehms_crc32_shift_t* op, uint32_t length);
+
+/**
+ * @brief Compose two zero-extension operators
+ *
+ * @param[out] result  Operator equivalent to applying first, then second
+ * @param[in]  first   Operator applied first
+ * @param[in]  second  Operator applied second
+ */
+void ehms_crc32_shift_compose(ehms_crc32_shift_t* result,
+                              const ehms_crc32_shift_t* first,
+                              const ehms_crc32_shift_t* second);
+
+/**
+ * @brief Apply a zero-extension operator to a CRC register
+ *
+ * @param[in] op   Operator
+ * @param[in] crc  Register value
+ * @return Register value after the operator's zero bytes
+ */
+uint32_t ehms_crc32_shift_apply(const ehms_crc32_shift_t* op, uint32_t crc);
+
+#if defined(__ARM_FEATURE_CRC32)
+/**
+ * @brief Advance a CRC-32 register using the ARMv8 CRC32 instructions
+ */
+uint32_t ehms_crc32_update_armv8(uint32_t crc, const void* data, uint32_t length);
+#endif
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* EHMS_CRC32_H */
+
+/* END OF FILE */
@@ -0,0 +1,168 @@
+/**
+ * @file ehms_fixed_point.h
+ * @brief EHMS Fixed-Point Parameter Representation
+ *
+ * @copyright Copyright (c) 2026 AeroTech Avionics Inc.
+ * @note This file is subject to DO-178C Level B certification requirements
+ *
+ * CSCI: EHMS-CORE
+ * CSC: FIXED-POINT
+ *
+ * Requirements Trace:
+ *   SRS-EHMS-101: System shall validate all incoming data
+ *   SRS-EHMS-200: System shall generate alerts within 100ms of threshold exceedance
+ *
+ * Builds with EHMS_FIXED_POINT_PIPELINE run acquisition, validation and
+ * alerting on raw_value only. raw_value then holds the engineering value
+ * multiplied by the EHMS_*_SCALE_FACTOR of the parameter's quantity, and
+ * engineering floats are produced only for snapshot consumers and display.
+ * Limits and thresholds are converted to these units once at init.
+ */
+
+#ifndef EHMS_FIXED_POINT_H
+#define EHMS_FIXED_POINT_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* ============================================================================
+ * INCLUDES
+ * ============================================================================ */
+#include "ehms_types.h"
+
+#include <math.h>
+
+/* ============================================================================
+ * CONSTANTS
+ * ============================================================================ */
+
+/** @brief Distance from a whole raw count treated as that count */
+#define EHMS_RAW_SNAP_TOLERANCE             1.0e-3
+
+/* ============================================================================
+ * FUNCTIONS
+ * ============================================================================ */
+
+/**
+ * @brief Fixed-point scale factor of a parameter
+ *
+ * @param[in] param_id  Parameter identifier
+ * @return Raw counts per engineering unit
+ */
+static inline uint32_t ehms_param_scale_factor(ehms_param_id_t param_id)
+{
+    uint32_t factor;
+    
+    switch (param_id)
+    {
+        case EHMS_PARAM_N1:
+        case EHMS_PARAM_N2:
+            factor = EHMS_RPM_SCALE_FACTOR;
+            break;
+        case EHMS_PARAM_EGT:
+        case EHMS_PARAM_OIL_TEMP:
+        case EHMS_PARAM_ITT:
+        case EHMS_PARAM_BLEED_TEMP:
+            factor = EHMS_TEMP_SCALE_FACTOR;
+            break;
+        case EHMS_PARAM_FF:
+            factor = EHMS_FUEL_FLOW_SCALE_FACTOR;
+            break;
+        case EHMS_PARAM_OIL_PRESS:
+        case EHMS_PARAM_BLEED_PRESS:
+            factor = EHMS_PRESSURE_SCALE_FACTOR;
+            break;
+        case EHMS_PARAM_OIL_QTY:
+            factor = EHMS_QUANTITY_SCALE_FACTOR;
+            break;
+        case EHMS_PARAM_VIB_FAN:
+        case EHMS_PARAM_VIB_CORE:
+        case EHMS_PARAM_VIB_FAN_N1:
+        case EHMS_PARAM_VIB_FAN_N2:
+        case EHMS_PARAM_VIB_CORE_N1:
+        case EHMS_PARAM_VIB_CORE_N2:
+            factor = EHMS_VIBRATION_SCALE_FACTOR;
+            break;
+        case EHMS_PARAM_EPR:
+        case EHMS_PARAM_ANOMALY_SCORE:
+            factor = EHMS_RATIO_SCALE_FACTOR;
+            break;
+        default:
+            factor = EHMS_UNIT_SCALE_FACTOR;
+            break;
+    }
+    
+    return factor;
+}
+
+/**
+ * @brief Scale an engineering value to raw units
+ *
+ * Results within EHMS_RAW_SNAP_TOLERANCE of a whole count are taken as that
+ * count, so decimal limits whose float representation falls just beside
+ * the raw resolution convert exactly.
+ */
+static inline double ehms_raw_scale(ehms_param_id_t param_id, float value)
+{
+    double raw = (double)value * (double)ehms_param_scale_factor(param_id);
+    double nearest = round(raw);
+    
+    return (fabs(raw - nearest) < EHMS_RAW_SNAP_TOLERANCE) ? nearest : raw;
+}
+
+/**
+ * @brief Smallest raw value at or above an engineering value
+ *
+ * Converts a limit that is exceeded when value >= limit (or fails when
+ * value < limit). Infinite limits saturate to the int32_t range.
+ *
+ * @param[in] param_id  Parameter identifier
+ * @param[in] value     Engineering value
+ * @return Raw value
+ */
+static inline int32_t ehms_raw_ceil(ehms_param_id_t param_id, float value)
+{
+    double raw = ceil(ehms_raw_scale(param_id, value));
+    
+    return (raw <= (double)INT32_MIN) ? INT32_MIN :
+           (raw >= (double)INT32_MAX) ? INT32_MAX : (int32_t)raw;
+}
+
+/**
+ * @brief Largest raw value at or below an engineering value
+ *
+ * Converts a limit that is exceeded when value <= limit (or fails when
+ * value > limit). Infinite limits saturate to the int32_t range.
+ *
+ * @param[in] param_id  Parameter identifier
+ * @param[in] value     Engineering value
+ * @return Raw value
+ */
+static inline int32_t ehms_raw_floor(ehms_param_id_t param_id, float value)
+{
+    double raw = floor(ehms_raw_scale(param_id, value));
+    
+    return (raw <= (double)INT32_MIN) ? INT32_MIN :
+           (raw >= (double)INT32_MAX) ? INT32_MAX : (int32_t)raw;
+}
+
+/**
+ * @brief Engineering value of a raw value
+ *
+ * @param[in] param_id  Parameter identifier
+ * @param[in] raw       Raw value
+ * @return Engineering value
+ */
+static inline float ehms_raw_to_eng(ehms_param_id_t param_id, int32_t raw)
+{
+    return (float)raw / (float)ehms_param_scale_factor(param_id);
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* EHMS_FIXED_POINT_H */
+
+/* END OF FILE */
@@ -0,0 +1,520 @@
+/**
+ * @file ehms_packed.c
+ * @brief EHMS Packed Snapshot and Alert Records
+ *
+ * @copyright Copyright (c) 2026 AeroTech Avionics Inc.
+ * @note DO-178C Level B - Safety Critical Software
+ *
+ * CSCI: EHMS-CORE
+ * CSC: PACKED-RECORDS
+ *
+ * Requirements Trace:
+ *   SRS-EHMS-040: System shall timestamp data in UTC
+ *   SRS-EHMS-050: System shall provide engine snapshots
+ *   SRS-EHMS-055: System shall report alerts
+ */
+
+/* ============================================================================
+ * INCLUDES
+ * ============================================================================ */
+#include "ehms_packed.h"
+
+#include <string.h>
+
+/* ============================================================================
+ * PRIVATE CONSTANTS
+ * ============================================================================ */
+
+/** @brief Milliseconds per day */
+#define EHMS_PACK_MS_PER_DAY            86400000L
+
+/** @brief First year of the timestamp range */
+#define EHMS_PACK_FIRST_YEAR            2000U
+
+/** @brief Last year of the timestamp range */
+#define EHMS_PACK_LAST_YEAR             2099U
+
+/** @brief Days from 2000-01-01 to 2100-01-01 (every fourth year is leap) */
+#define EHMS_PACK_DAY_COUNT             36525U
+
+/** @brief Days of a four-year cycle starting with a leap year */
+#define EHMS_PACK_CYCLE_DAYS            1461U
+
+/* ============================================================================
+ * PRIVATE TYPES
+ * ============================================================================ */
+
+/**
+ * @brief Calendar conversion state of one pack or unpack call
+ *
+ * The timestamps of a snapshot nearly all fall on one day, so the day of
+ * the previous conversion is kept and only the time of day is converted.
+ */
+typedef struct
+{
+    int64_t             epoch_ms;               /**< Epoch, ms from 2000-01-01 */
+    uint32_t            date_key;               /**< Date of date_ms (year, month, day) */
+    int64_t             date_ms;                /**< Midnight of that date, ms from 2000-01-01 */
+    uint32_t            day_number;             /**< Day of date, days from 2000-01-01 */
+    ehms_timestamp_t    date;                   /**< Date of day_number */
+} ehms_pack_clock_t;
+
+/* ============================================================================
+ * PRIVATE DATA
+ * ============================================================================ */
+
+/** @brief Days before each month of a common year */
+static const uint16_t s_days_before_month[12] =
+{
+    0U, 31U, 59U, 90U, 120U, 151U, 181U, 212U, 243U, 273U, 304U, 334U
+};
+
+/** @brief Days of each month of a common year */
+static const uint8_t s_month_days[12] =
+{
+    31U, 28U, 31U, 30U, 31U, 30U, 31U, 31U, 30U, 31U, 30U, 31U
+};
+
+/* ============================================================================
+ * PRIVATE FUNCTION PROTOTYPES
+ * ============================================================================ */
+
+static ehms_result_t ehms_pack_clock_init(ehms_pack_clock_t* clock, const ehms_timestamp_t* epoch);
+static bool ehms_pack_valid_time(const ehms_timestamp_t* time);
+static bool ehms_pack_unset_time(const ehms_timestamp_t* time);
+static uint32_t ehms_pack_day_number(const ehms_timestamp_t* time);
+static void ehms_pack_date(uint32_t day_number, ehms_timestamp_t* date);
+static int64_t ehms_pack_time_of_day_ms(const ehms_timestamp_t* time);
+static ehms_result_t ehms_pack_time(ehms_pack_clock_t* clock, const ehms_timestamp_t* time,
+                                    uint32_t* time_ms);
+static ehms_result_t ehms_unpack_time(ehms_pack_clock_t* clock, uint32_t time_ms,
+                                      ehms_timestamp_t* time);
+
+/* ============================================================================
+ * PUBLIC FUNCTIONS
+ * ============================================================================ */
+
+/**
+ * @brief Pack an engine snapshot
+ * @trace SRS-EHMS-050
+ */
+ehms_result_t ehms_pack_snapshot(const ehms_engine_snapshot_t* snapshot,
+                                 const ehms_timestamp_t* epoch,
+                                 ehms_packed_snapshot_t* packed)
+{
+    ehms_result_t result = EHMS_OK;
+    ehms_pack_clock_t clock;
+    
+    if ((snapshot == NULL) || (epoch == NULL) || (packed == NULL))
+    {
+        result = EHMS_ERROR_PARAM;
+    }
+    else if (((uint32_t)snapshot->engine_id >= (uint32_t)EHMS_ENGINE_COUNT) ||
+             (snapshot->flight_phase >= (uint32_t)EHMS_FLIGHT_PHASE_COUNT) ||
+             ((uint32_t)snapshot->health_status > (uint32_t)EHMS_HEALTH_CRITICAL))
+    {
+        result = EHMS_ERROR_RANGE;
+    }
+    else
+    {
+        result = ehms_pack_clock_init(&clock, epoch);
+    }
+    
+    if (result == EHMS_OK)
+    {
+        packed->crc32 = snapshot->crc32;
+        packed->engine_id = (uint8_t)snapshot->engine_id;
+        packed->flight_phase = (uint8_t)snapshot->flight_phase;
+        packed->health_status = (uint8_t)snapshot->health_status;
+        packed->reserved = 0U;
+        
+        result = ehms_pack_time(&clock, &snapshot->sample_time, &packed->time_ms);
+    }
+    
+    for (uint32_t p = 0U; (p < EHMS_PARAM_COUNT) && (result == EHMS_OK); p++)
+    {
+        const ehms_parameter_t* param = &snapshot->parameters[p];
+        ehms_packed_parameter_t* out = &packed->parameters[p];
+        
+        /* Identifiers are implied by position */
+        if (((uint32_t)param->param_id != p) ||
+            ((uint32_t)param->status > (uint32_t)EHMS_PARAM_TEST))
+        {
+            result = EHMS_ERROR_RANGE;
+        }
+        else
+        {
+            out->raw_value = param->raw_value;
+            out->eng_value = param->eng_value;
+            out->status = (uint8_t)param->status;
+            out->source_bus = param->source_bus;
+            out->reserved = 0U;
+            
+            result = ehms_pack_time(&clock, &param->timestamp, &out->time_ms);
+        }
+    }
+    
+    return result;
+}
+
+/**
+ * @brief Unpack an engine snapshot
+ * @trace SRS-EHMS-050
+ */
+ehms_result_t ehms_unpack_snapshot(const ehms_packed_snapshot_t* packed,
+                                   const ehms_timestamp_t* epoch,
+                                   ehms_engine_snapshot_t* snapshot)
+{
+    ehms_result_t result = EHMS_OK;
+    ehms_pack_clock_t clock;
+    
+    if ((packed == NULL) || (epoch == NULL) || (snapshot == NULL))
+    {
+        result = EHMS_ERROR_PARAM;
+    }
+    else
+    {
+        result = ehms_pack_clock_init(&clock, epoch);
+    }
+    
+    if (result == EHMS_OK)
+    {
+        /* Cleared padding keeps the snapshot byte-identical for its CRC */
+        (void)memset(snapshot, 0, sizeof(*snapshot));
+        
+        snapshot->engine_id = (ehms_engine_id_t)packed->engine_id;
+        snapshot->flight_phase = packed->flight_phase;
+        snapshot->health_status = (ehms_health_status_t)packed->health_status;
+        snapshot->crc32 = packed->crc32;
+        
+        result = ehms_unpack_time(&clock, packed->time_ms, &snapshot->sample_time);
+    }
+    
+    for (uint32_t p = 0U; (p < EHMS_PARAM_COUNT) && (result == EHMS_OK); p++)
+    {
+        const ehms_packed_parameter_t* in = &packed->parameters[p];
+        ehms_parameter_t* param = &snapshot->parameters[p];
+        
+        param->param_id = (ehms_param_id_t)p;
+        param->status = (ehms_param_status_t)in->status;
+        param->raw_value = in->raw_value;
+        param->eng_value = in->eng_value;
+        param->source_bus = in->source_bus;
+        
+        result = ehms_unpack_time(&clock, in->time_ms, &param->timestamp);
+    }
+    
+    return result;
+}
+
+/**
+ * @brief Pack an alert
+ * @trace SRS-EHMS-055
+ */
+ehms_result_t ehms_pack_alert(const ehms_alert_t* alert, const ehms_timestamp_t* epoch,
+                              ehms_packed_alert_t* packed)
+{
+    ehms_result_t result = EHMS_OK;
+    ehms_pack_clock_t clock;
+    
+    if ((alert == NULL) || (epoch == NULL) || (packed == NULL))
+    {
+        result = EHMS_ERROR_PARAM;
+    }
+    else if (((uint32_t)alert->level > (uint32_t)EHMS_ALERT_WARNING) ||
+             ((uint32_t)alert->engine_id >= (uint32_t)EHMS_ENGINE_COUNT) ||
+             ((uint32_t)alert->param_id > 0xFFU))
+    {
+        result = EHMS_ERROR_RANGE;
+    }
+    else
+    {
+        result = ehms_pack_clock_init(&clock, epoch);
+    }
+    
+    if (result == EHMS_OK)
+    {
+        packed->alert_id = alert->alert_id;
+        packed->ecam_code = alert->ecam_code;
+        packed->level = (uint8_t)alert->level;
+        packed->engine_id = (uint8_t)alert->engine_id;
+        packed->param_id = (uint8_t)alert->param_id;
+        packed->flags = (uint8_t)((alert->is_active ? EHMS_PACKED_ALERT_ACTIVE : 0U) |
+                                  (alert->is_latched ? EHMS_PACKED_ALERT_LATCHED : 0U) |
+                                  (alert->is_inhibited ? EHMS_PACKED_ALERT_INHIBITED : 0U));
+        packed->reserved = 0U;
+        
+        result = ehms_pack_time(&clock, &alert->onset_time, &packed->onset_ms);
+    }
+    
+    if (result == EHMS_OK)
+    {
+        result = ehms_pack_time(&clock, &alert->clear_time, &packed->clear_ms);
+    }
+    
+    return result;
+}
+
+/**
+ * @brief Unpack an alert
+ * @trace SRS-EHMS-055
+ */
+ehms_result_t ehms_unpack_alert(const ehms_packed_alert_t* packed, const ehms_timestamp_t* epoch,
+                                const char* message, ehms_alert_t* alert)
+{
+    ehms_result_t result = EHMS_OK;
+    ehms_pack_clock_t clock;
+    
+    if ((packed == NULL) || (epoch == NULL) || (alert == NULL))
+    {
+        result = EHMS_ERROR_PARAM;
+    }
+    else
+    {
+        result = ehms_pack_clock_init(&clock, epoch);
+    }
+    
+    if (result == EHMS_OK)
+    {
+        (void)memset(alert, 0, sizeof(*alert));
+        
+        alert->alert_id = packed->alert_id;
+        alert->level = (ehms_alert_level_t)packed->level;
+        alert->engine_id = (ehms_engine_id_t)packed->engine_id;
+        alert->param_id = (ehms_param_id_t)packed->param_id;
+        alert->is_active = ((packed->flags & EHMS_PACKED_ALERT_ACTIVE) != 0U);
+        alert->is_latched = ((packed->flags & EHMS_PACKED_ALERT_LATCHED) != 0U);
+        alert->is_inhibited = ((packed->flags & EHMS_PACKED_ALERT_INHIBITED) != 0U);
+        alert->ecam_code = packed->ecam_code;
+        
+        /* Bounded copy; the last byte stays the terminator */
+        for (uint32_t i = 0U; (message != NULL) && (i < (sizeof(alert->message) - 1U)) &&
+                              (message[i] != '\0'); i++)
+        {
+            alert->message[i] = message[i];
+        }
+        
+        result = ehms_unpack_time(&clock, packed->onset_ms, &alert->onset_time);
+    }
+    
+    if (result == EHMS_OK)
+    {
+        result = ehms_unpack_time(&clock, packed->clear_ms, &alert->clear_time);
+    }
+    
+    return result;
+}
+
+/* ============================================================================
+ * PRIVATE FUNCTIONS
+ * ============================================================================ */
+
+/**
+ * @brief Start a conversion against an epoch
+ */
+static ehms_result_t ehms_pack_clock_init(ehms_pack_clock_t* clock, const ehms_timestamp_t* epoch)
+{
+    ehms_result_t result = EHMS_OK;
+    
+    if (!ehms_pack_valid_time(epoch))
+    {
+        result = EHMS_ERROR_RANGE;
+    }
+    else
+    {
+        clock->epoch_ms = ((int64_t)ehms_pack_day_number(epoch) * EHMS_PACK_MS_PER_DAY) +
+                          ehms_pack_time_of_day_ms(epoch);
+        
+        /* No date has key 0 or day number EHMS_PACK_DAY_COUNT */
+        clock->date_key = 0U;
+        clock->date_ms = 0;
+        clock->day_number = EHMS_PACK_DAY_COUNT;
+        (void)memset(&clock->date, 0, sizeof(clock->date));
+    }
+    
+    return result;
+}
+
+/**
+ * @brief Check a timestamp is a calendar time from 2000 to 2099
+ */
+static bool ehms_pack_valid_time(const ehms_timestamp_t* time)
+{
+    bool valid = (time->year >= EHMS_PACK_FIRST_YEAR) && (time->year <= EHMS_PACK_LAST_YEAR) &&
+                 (time->month >= 1U) && (time->month <= 12U) &&
+                 (time->hour < 24U) && (time->minute < 60U) && (time->second < 60U) &&
+                 (time->millisecond < 1000U);
+    
+    if (valid)
+    {
+        uint32_t days = s_month_days[time->month - 1U];
+        
+        if ((time->month == 2U) && ((time->year % 4U) == 0U))
+        {
+            days++;
+        }
+        
+        valid = (time->day >= 1U) && (time->day <= days);
+    }
+    
+    return valid;
+}
+
+/**
+ * @brief Check a timestamp was never set (all fields zero)
+ */
+static bool ehms_pack_unset_time(const ehms_timestamp_t* time)
+{
+    return (time->year == 0U) && (time->month == 0U) && (time->day == 0U) &&
+           (time->hour == 0U) && (time->minute == 0U) && (time->second == 0U) &&
+           (time->millisecond == 0U);
+}
+
+/**
+ * @brief Days from 2000-01-01 to the date of a valid timestamp
+ */
+static uint32_t ehms_pack_day_number(const ehms_timestamp_t* time)
+{
+    uint32_t years = (uint32_t)time->year - EHMS_PACK_FIRST_YEAR;
+    
+    /* Leap days of the years before, 2000 being the first */
+    uint32_t days = (years * 365U) + ((years + 3U) / 4U) +
+                    s_days_before_month[time->month - 1U] + ((uint32_t)time->day - 1U);
+    
+    if (((years % 4U) == 0U) && (time->month > 2U))
+    {
+        days++;
+    }
+    
+    return days;
+}
+
+/**
+ * @brief Date of a day number below EHMS_PACK_DAY_COUNT
+ */
+static void ehms_pack_date(uint32_t day_number, ehms_timestamp_t* date)
+{
+    uint32_t year = EHMS_PACK_FIRST_YEAR + ((day_number / EHMS_PACK_CYCLE_DAYS) * 4U);
+    uint32_t rest = day_number % EHMS_PACK_CYCLE_DAYS;
+    bool leap = true;
+    uint32_t month = 0U;
+    
+    /* The leap year opens the cycle */
+    if (rest >= 366U)
+    {
+        rest -= 366U;
+        year += 1U + (rest / 365U);
+        rest %= 365U;
+        leap = false;
+    }
+    
+    while (month < 11U)
+    {
+        uint32_t days = (uint32_t)s_month_days[month] + (((month == 1U) && leap) ? 1U : 0U);
+        
+        if (rest < days)
+        {
+            break;
+        }
+        rest -= days;
+        month++;
+    }
+    
+    date->year = (uint16_t)year;
+    date->month = (uint8_t)(month + 1U);
+    date->day = (uint8_t)(rest + 1U);
+}
+
+/**
+ * @brief Milliseconds from midnight of a valid timestamp
+ */
+static int64_t ehms_pack_time_of_day_ms(const ehms_timestamp_t* time)
+{
+    return ((((((int64_t)time->hour * 60) + (int64_t)time->minute) * 60) +
+             (int64_t)time->second) * 1000) + (int64_t)time->millisecond;
+}
+
+/**
+ * @brief Convert a calendar timestamp to milliseconds from the epoch
+ */
+static ehms_result_t ehms_pack_time(ehms_pack_clock_t* clock, const ehms_timestamp_t* time,
+                                    uint32_t* time_ms)
+{
+    ehms_result_t result = EHMS_OK;
+    
+    if (ehms_pack_unset_time(time))
+    {
+        *time_ms = EHMS_PACKED_NO_TIME;
+    }
+    else if (!ehms_pack_valid_time(time))
+    {
+        result = EHMS_ERROR_RANGE;
+    }
+    else
+    {
+        uint32_t key = ((uint32_t)time->year << 16) | ((uint32_t)time->month << 8) |
+                       (uint32_t)time->day;
+        
+        if (key != clock->date_key)
+        {
+            clock->date_key = key;
+            clock->date_ms = (int64_t)ehms_pack_day_number(time) * EHMS_PACK_MS_PER_DAY;
+        }
+        
+        int64_t ms = (clock->date_ms + ehms_pack_time_of_day_ms(time)) - clock->epoch_ms;
+        
+        if ((ms < 0) || (ms >= (int64_t)EHMS_PACKED_NO_TIME))
+        {
+            result = EHMS_ERROR_RANGE;
+        }
+        else
+        {
+            *time_ms = (uint32_t)ms;
+        }
+    }
+    
+    return result;
+}
+
+/**
+ * @brief Convert milliseconds from the epoch to a calendar timestamp
+ */
+static ehms_result_t ehms_unpack_time(ehms_pack_clock_t* clock, uint32_t time_ms,
+                                      ehms_timestamp_t* time)
+{
+    ehms_result_t result = EHMS_OK;
+    
+    (void)memset(time, 0, sizeof(*time));
+    
+    if (time_ms != EHMS_PACKED_NO_TIME)
+    {
+        int64_t ms = clock->epoch_ms + (int64_t)time_ms;
+        uint32_t day_number = (uint32_t)(ms / EHMS_PACK_MS_PER_DAY);
+        uint32_t day_ms = (uint32_t)(ms % EHMS_PACK_MS_PER_DAY);
+        
+        if (day_number >= EHMS_PACK_DAY_COUNT)
+        {
+            result = EHMS_ERROR_RANGE;
+        }
+        else
+        {
+            if (day_number != clock->day_number)
+            {
+                clock->day_number = day_number;
+                ehms_pack_date(day_number, &clock->date);
+            }
+            
+            time->year = clock->date.year;
+            time->month = clock->date.month;
+            time->day = clock->date.day;
+            time->hour = (uint8_t)(day_ms / 3600000U);
+            time->minute = (uint8_t)((day_ms / 60000U) % 60U);
+            time->second = (uint8_t)((day_ms / 1000U) % 60U);
+            time->millisecond = (uint16_t)(day_ms % 1000U);
+        }
+    }
+    
+    return result;
+}
+
+/* END OF FILE */
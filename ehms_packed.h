@@ -0,0 +1,178 @@
+/**
+ * @file ehms_packed.h
+ * @brief EHMS Packed Snapshot and Alert Records
+ *
+ * @copyright Copyright (c) 2026 AeroTech Avionics Inc.
+ * @note This file is subject to DO-178C Level B certification requirements
+ *
+ * CSCI: EHMS-CORE
+ * CSC: PACKED-RECORDS
+ *
+ * Requirements Trace:
+ *   SRS-EHMS-040: System shall timestamp data in UTC
+ *   SRS-EHMS-050: System shall provide engine snapshots
+ *   SRS-EHMS-055: System shall report alerts
+ *
+ * Compact forms of ehms_engine_snapshot_t and ehms_alert_t for partitions
+ * with tight RAM budgets, the recorder and the ground link. Enumerations
+ * are held in one byte, parameter identifiers are implied by the array
+ * index, calendar timestamps become milliseconds from a caller-chosen
+ * epoch, and the alert message is replaced by its ECAM code, from which
+ * alert_get_message_text renders it again.
+ *
+ * Packing is lossless: an unpacked snapshot is identical to the one that
+ * was packed, so its crc32 still verifies. Timestamps shall lie within
+ * 2^32 - 1 ms (49.7 days) from the epoch onwards; a timestamp never set
+ * (year 0) is carried as EHMS_PACKED_NO_TIME.
+ */
+
+#ifndef EHMS_PACKED_H
+#define EHMS_PACKED_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* ============================================================================
+ * INCLUDES
+ * ============================================================================ */
+#include "ehms_types.h"
+
+/* ============================================================================
+ * CONSTANTS
+ * ============================================================================ */
+
+/** @brief Packed time of a timestamp that was never set */
+#define EHMS_PACKED_NO_TIME                 0xFFFFFFFFUL
+
+/** @brief Packed alert flags */
+#define EHMS_PACKED_ALERT_ACTIVE            0x01U
+#define EHMS_PACKED_ALERT_LATCHED           0x02U
+#define EHMS_PACKED_ALERT_INHIBITED         0x04U
+
+/* ============================================================================
+ * TYPES
+ * ============================================================================ */
+
+/**
+ * @brief Packed parameter; the parameter is its index in the snapshot
+ */
+typedef struct
+{
+    int32_t             raw_value;              /**< Raw scaled value */
+    float               eng_value;              /**< Engineering units value */
+    uint32_t            time_ms;                /**< Sample time, ms from the epoch */
+    uint8_t             status;                 /**< ehms_param_status_t */
+    uint8_t             source_bus;             /**< Source bus ID */
+    uint16_t            reserved;               /**< Zero */
+} ehms_packed_parameter_t;
+
+/**
+ * @brief Packed engine snapshot
+ */
+typedef struct
+{
+    uint32_t            time_ms;                /**< Snapshot time, ms from the epoch */
+    uint32_t            crc32;                  /**< Snapshot crc32, carried unchanged */
+    uint8_t             engine_id;              /**< ehms_engine_id_t */
+    uint8_t             flight_phase;           /**< ehms_flight_phase_t */
+    uint8_t             health_status;          /**< ehms_health_status_t */
+    uint8_t             reserved;               /**< Zero */
+    ehms_packed_parameter_t parameters[EHMS_PARAM_COUNT]; /**< By ehms_param_id_t */
+} ehms_packed_snapshot_t;
+
+/**
+ * @brief Packed alert; the message is rendered from ecam_code
+ */
+typedef struct
+{
+    uint32_t            alert_id;               /**< Unique alert identifier */
+    uint32_t            onset_ms;               /**< Onset time, ms from the epoch */
+    uint32_t            clear_ms;               /**< Clear time, or EHMS_PACKED_NO_TIME */
+    uint16_t            ecam_code;              /**< ECAM/EICAS message code */
+    uint8_t             level;                  /**< ehms_alert_level_t */
+    uint8_t             engine_id;              /**< ehms_engine_id_t */
+    uint8_t             param_id;               /**< ehms_param_id_t */
+    uint8_t             flags;                  /**< EHMS_PACKED_ALERT_* */
+    uint16_t            reserved;               /**< Zero */
+} ehms_packed_alert_t;
+
+_Static_assert(sizeof(ehms_packed_parameter_t) == 16U, "Packed parameter layout");
+_Static_assert(sizeof(ehms_packed_snapshot_t) == (12U + (16U * EHMS_PARAM_COUNT)),
+               "Packed snapshot layout");
+_Static_assert(sizeof(ehms_packed_alert_t) == 20U, "Packed alert layout");
+
+/* ============================================================================
+ * FUNCTION PROTOTYPES
+ * ============================================================================ */
+
+/**
+ * @brief Pack an engine snapshot
+ *
+ * @param[in]  snapshot  Snapshot; parameters[p].param_id shall be p
+ * @param[in]  epoch     Calendar time at packed time zero
+ * @param[out] packed    Receives the packed snapshot
+ * @return EHMS_OK on success, EHMS_ERROR_PARAM for a NULL pointer,
+ *         EHMS_ERROR_RANGE for a field or timestamp the packed form
+ *         cannot hold
+ *
+ * @trace SRS-EHMS-050
+ */
+ehms_result_t ehms_pack_snapshot(const ehms_engine_snapshot_t* snapshot,
+                                 const ehms_timestamp_t* epoch,
+                                 ehms_packed_snapshot_t* packed);
+
+/**
+ * @brief Unpack an engine snapshot
+ *
+ * @param[in]  packed    Packed snapshot
+ * @param[in]  epoch     Calendar time at packed time zero, as packed
+ * @param[out] snapshot  Receives the snapshot
+ * @return EHMS_OK on success, EHMS_ERROR_PARAM for a NULL pointer,
+ *         EHMS_ERROR_RANGE for an invalid epoch or a time beyond 2099
+ *
+ * @trace SRS-EHMS-050
+ */
+ehms_result_t ehms_unpack_snapshot(const ehms_packed_snapshot_t* packed,
+                                   const ehms_timestamp_t* epoch,
+                                   ehms_engine_snapshot_t* snapshot);
+
+/**
+ * @brief Pack an alert; the message text is not kept
+ *
+ * @param[in]  alert   Alert
+ * @param[in]  epoch   Calendar time at packed time zero
+ * @param[out] packed  Receives the packed alert
+ * @return EHMS_OK on success, EHMS_ERROR_PARAM for a NULL pointer,
+ *         EHMS_ERROR_RANGE for a field or timestamp the packed form
+ *         cannot hold
+ *
+ * @trace SRS-EHMS-055
+ */
+ehms_result_t ehms_pack_alert(const ehms_alert_t* alert, const ehms_timestamp_t* epoch,
+                              ehms_packed_alert_t* packed);
+
+/**
+ * @brief Unpack an alert
+ *
+ * @param[in]  packed   Packed alert
+ * @param[in]  epoch    Calendar time at packed time zero, as packed
+ * @param[in]  message  Message text, normally alert_get_message_text for
+ *                      the engine and ECAM code; NULL leaves it empty and
+ *                      longer text is truncated
+ * @param[out] alert    Receives the alert
+ * @return EHMS_OK on success, EHMS_ERROR_PARAM for a NULL pointer,
+ *         EHMS_ERROR_RANGE for an invalid epoch or a time beyond 2099
+ *
+ * @trace SRS-EHMS-055
+ */
+ehms_result_t ehms_unpack_alert(const ehms_packed_alert_t* packed, const ehms_timestamp_t* epoch,
+                                const char* message, ehms_alert_t* alert);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* EHMS_PACKED_H */
+
+/* END OF FILE */
@@ -0,0 +1,145 @@
+/**
+ * @file ehms_timebase.h
+ * @brief EHMS Free-Running Timebase Access
+ *
+ * @copyright Copyright (c) 2026 AeroTech Avionics Inc.
+ * @note This file is subject to DO-178C Level B certification requirements
+ *
+ * CSCI: EHMS-CORE
+ * CSC: TIMEBASE
+ *
+ * Requirements Trace:
+ *   SRS-EHMS-100: System shall acquire engine parameters at 100Hz
+ *
+ * Reads a free-running hardware counter for execution-time measurement.
+ * Readings are 32-bit tick counts; elapsed time is the unsigned difference
+ * of two readings and is valid for intervals shorter than one counter wrap.
+ *
+ *   PowerPC (MPC8548)  Time base lower word (mftb), EHMS_TIMEBASE_HZ
+ *   ARMv7-R (Cortex-R5) PMU cycle counter (PMCCNTR), EHMS_TIMEBASE_HZ
+ *   AArch64            Generic timer virtual count (CNTVCT_EL0), CNTFRQ_EL0
+ *   Other              ehms_timebase_read/ehms_timebase_hz from platform code
+ */
+
+#ifndef EHMS_TIMEBASE_H
+#define EHMS_TIMEBASE_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* ============================================================================
+ * INCLUDES
+ * ============================================================================ */
+#include <stdint.h>
+
+/* ============================================================================
+ * CONSTANTS
+ * ============================================================================ */
+
+#if defined(__powerpc__) || defined(__PPC__)
+/** @brief Time base frequency: CCB clock (533 MHz) / 8 */
+#ifndef EHMS_TIMEBASE_HZ
+#define EHMS_TIMEBASE_HZ                    66666667UL
+#endif
+#elif defined(__ARM_ARCH_7R__)
+/** @brief PMU cycle counter frequency: core clock */
+#ifndef EHMS_TIMEBASE_HZ
+#define EHMS_TIMEBASE_HZ                    600000000UL
+#endif
+#endif
+
+/* ============================================================================
+ * FUNCTIONS
+ * ============================================================================ */
+
+#if defined(__powerpc__) || defined(__PPC__)
+
+/** @brief Enable the timebase (time base runs from reset) */
+static inline void ehms_timebase_init(void)
+{
+}
+
+/** @brief Read the timebase */
+static inline uint32_t ehms_timebase_read(void)
+{
+    uint32_t ticks;
+    __asm__ volatile ("mftb %0" : "=r" (ticks));
+    return ticks;
+}
+
+/** @brief Timebase frequency in Hz */
+static inline uint32_t ehms_timebase_hz(void)
+{
+    return (uint32_t)EHMS_TIMEBASE_HZ;
+}
+
+#elif defined(__ARM_ARCH_7R__)
+
+/** @brief Enable and start the PMU cycle counter */
+static inline void ehms_timebase_init(void)
+{
+    uint32_t pmcr;
+    __asm__ volatile ("mrc p15, 0, %0, c9, c12, 0" : "=r" (pmcr));
+    pmcr |= 0x1UL;                                                  /* PMCR.E */
+    __asm__ volatile ("mcr p15, 0, %0, c9, c12, 0" : : "r" (pmcr));
+    __asm__ volatile ("mcr p15, 0, %0, c9, c12, 1" : : "r" (0x80000000UL)); /* PMCNTENSET.C */
+}
+
+/** @brief Read the PMU cycle counter */
+static inline uint32_t ehms_timebase_read(void)
+{
+    uint32_t ticks;
+    __asm__ volatile ("mrc p15, 0, %0, c9, c13, 0" : "=r" (ticks));
+    return ticks;
+}
+
+/** @brief Cycle counter frequency in Hz */
+static inline uint32_t ehms_timebase_hz(void)
+{
+    return (uint32_t)EHMS_TIMEBASE_HZ;
+}
+
+#elif defined(__aarch64__)
+
+/** @brief Enable the timebase (generic timer runs from reset) */
+static inline void ehms_timebase_init(void)
+{
+}
+
+/** @brief Read the generic timer virtual count */
+static inline uint32_t ehms_timebase_read(void)
+{
+    uint64_t ticks;
+    __asm__ volatile ("isb\n\tmrs %0, cntvct_el0" : "=r" (ticks) : : "memory");
+    return (uint32_t)ticks;
+}
+
+/** @brief Generic timer frequency in Hz */
+static inline uint32_t ehms_timebase_hz(void)
+{
+    uint64_t hz;
+    __asm__ volatile ("mrs %0, cntfrq_el0" : "=r" (hz));
+    return (uint32_t)hz;
+}
+
+#else
+
+/** @brief Enable the timebase (provided by platform code) */
+void ehms_timebase_init(void);
+
+/** @brief Read the timebase (provided by platform code) */
+uint32_t ehms_timebase_read(void);
+
+/** @brief Timebase frequency in Hz (provided by platform code) */
+uint32_t ehms_timebase_hz(void);
+
+#endif
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* EHMS_TIMEBASE_H */
+
+/* END OF FILE */
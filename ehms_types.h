@@ -78,6 +78,18 @@ extern "C" {
 /** @brief Fuel flow scaling (0.1 lb/hr resolution) */
 #define EHMS_FUEL_FLOW_SCALE_FACTOR         10U
 
+/** @brief Quantity scaling (0.1% resolution) */
+#define EHMS_QUANTITY_SCALE_FACTOR          10U
+
+/** @brief Vibration scaling (0.001 IPS resolution) */
+#define EHMS_VIBRATION_SCALE_FACTOR         1000U
+
+/** @brief Pressure ratio scaling (0.001 resolution) */
+#define EHMS_RATIO_SCALE_FACTOR             1000U
+
+/** @brief Scaling of parameters without a fixed-point resolution (1 unit) */
+#define EHMS_UNIT_SCALE_FACTOR              1U
+
 /* ============================================================================
  * ENUMERATED TYPES
  * ============================================================================ */
@@ -158,6 +170,11 @@ typedef enum
     EHMS_PARAM_BLEED_TEMP   = 13U,  /**< Bleed Air Temperature (°C) */
     EHMS_PARAM_START_VALVE  = 14U,  /**< Start Valve Position */
     EHMS_PARAM_FUEL_VALVE   = 15U,  /**< Fuel Shutoff Valve Position */
+    EHMS_PARAM_VIB_FAN_N1   = 16U,  /**< Fan sensor, N1 1/rev amplitude (IPS) */
+    EHMS_PARAM_VIB_FAN_N2   = 17U,  /**< Fan sensor, N2 1/rev amplitude (IPS) */
+    EHMS_PARAM_VIB_CORE_N1  = 18U,  /**< Core sensor, N1 1/rev amplitude (IPS) */
+    EHMS_PARAM_VIB_CORE_N2  = 19U,  /**< Core sensor, N2 1/rev amplitude (IPS) */
+    EHMS_PARAM_ANOMALY_SCORE = 20U, /**< Multivariate anomaly score (std devs) */
     /* ... additional parameters up to EHMS_MAX_PARAMETERS */
     EHMS_PARAM_COUNT        = 48U   /**< Total parameter count */
 } ehms_param_id_t;
@@ -175,6 +192,22 @@ typedef enum
     EHMS_HEALTH_CRITICAL    = 4U    /**< Immediate action required */
 } ehms_health_status_t;
 
+/**
+ * @brief Flight phase (engine snapshot and block flight_phase)
+ * @trace SRS-EHMS-202
+ */
+typedef enum
+{
+    EHMS_FLIGHT_PHASE_GROUND    = 0U,   /**< Engine start, taxi and shutdown */
+    EHMS_FLIGHT_PHASE_TAKEOFF   = 1U,   /**< Takeoff roll to acceleration altitude */
+    EHMS_FLIGHT_PHASE_CLIMB     = 2U,   /**< Climb */
+    EHMS_FLIGHT_PHASE_CRUISE    = 3U,   /**< Cruise */
+    EHMS_FLIGHT_PHASE_DESCENT   = 4U,   /**< Descent */
+    EHMS_FLIGHT_PHASE_APPROACH  = 5U,   /**< Approach */
+    EHMS_FLIGHT_PHASE_LANDING   = 6U,   /**< Touchdown and rollout */
+    EHMS_FLIGHT_PHASE_COUNT     = 7U
+} ehms_flight_phase_t;
+
 /* ============================================================================
  * DATA STRUCTURES
  * ============================================================================ */
@@ -216,12 +249,31 @@ typedef struct
 {
     ehms_engine_id_t    engine_id;                          /**< Engine ID */
     ehms_timestamp_t    sample_time;                        /**< Snapshot time */
-    uint32_t            flight_phase;                       /**< Current flight phase */
+    uint32_t            flight_phase;                       /**< Current ehms_flight_phase_t */
     ehms_parameter_t    parameters[EHMS_PARAM_COUNT];       /**< Parameter array */
     ehms_health_status_t health_status;                     /**< Overall health */
     uint32_t            crc32;                              /**< Data integrity CRC */
 } ehms_engine_snapshot_t;
 
+/**
+ * @brief Engine parameter block (structure-of-arrays form of a snapshot)
+ *
+ * Holds the per-parameter fields used by the validation, staleness and
+ * threshold loops as dense arrays indexed by ehms_param_id_t.
+ * @trace SRS-EHMS-050
+ */
+typedef struct
+{
+    ehms_engine_id_t    engine_id;                          /**< Engine ID */
+    ehms_timestamp_t    sample_time;                        /**< Block time */
+    uint32_t            flight_phase;                       /**< Current ehms_flight_phase_t */
+    float               eng_value[EHMS_PARAM_COUNT];        /**< Engineering units values */
+    int32_t             raw_value[EHMS_PARAM_COUNT];        /**< Raw scaled values */
+    uint32_t            timestamp_ms[EHMS_PARAM_COUNT];     /**< Sample times (ms) */
+    uint8_t             status[EHMS_PARAM_COUNT];           /**< ehms_param_status_t values */
+    uint8_t             source_bus[EHMS_PARAM_COUNT];       /**< Source bus IDs */
+} ehms_engine_block_t;
+
 /**
  * @brief Alert message structure
  * @trace SRS-EHMS-055
@@ -0,0 +1,753 @@
+/**
+ * @file fleet_batch.c
+ * @brief Host Fleet Recorder Log Reprocessing
+ *
+ * @copyright Copyright (c) 2026 AeroTech Avionics Inc.
+ *
+ * Host tool support; not part of the airborne load. Each worker thread
+ * owns one acquisition context, one alert context and, with
+ * DAQ_TREND_ENGINE, one trend context attached to the acquisition context,
+ * and reuses them for every log it processes; workers share only the
+ * read-only parameter limits and alert threshold tables.
+ */
+
+#define _POSIX_C_SOURCE 200809L
+
+/* ============================================================================
+ * INCLUDES
+ * ============================================================================ */
+#include "fleet_batch.h"
+#include "ehms_types.h"
+#include "data_acquisition.h"
+#include "data_acquisition_ext.h"
+#include "alert_manager.h"
+#include "alert_manager_ext.h"
+#include "ehms_crc32.h"
+#if defined(DAQ_TREND_ENGINE)
+#include "trend_engine.h"
+#endif
+
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/stat.h>
+
+/* ============================================================================
+ * PRIVATE CONSTANTS
+ * ============================================================================ */
+
+/**
+ * @brief Most samples a chunk can hold
+ *
+ * Every group spends at least one width byte per column after the
+ * reference values.
+ */
+#define FLEET_CHUNK_RECORDS                 (RS_GROUP_SAMPLES * \
+    ((RS_PAYLOAD_BYTES - (RS_COLUMN_COUNT * sizeof(uint32_t))) / RS_COLUMN_COUNT))
+
+/** @brief Alert events read per alert_ctx_read_events call */
+#define FLEET_EVENT_BATCH                   32U
+
+/* ============================================================================
+ * PRIVATE TYPES
+ * ============================================================================ */
+
+/**
+ * @brief Decode position in the chunks of one engine
+ */
+typedef struct
+{
+    rs_record_t*        record;             /**< Samples of the current chunk */
+    uint32_t            count;              /**< Samples decoded */
+    uint32_t            next;               /**< Next sample to process */
+    uint32_t            next_chunk;         /**< Log position to search from */
+} fleet_stream_t;
+
+/**
+ * @brief Reprocessing worker
+ */
+struct fleet_worker
+{
+    daq_context_t*      daq;                            /**< Acquisition context */
+    alert_context_t*    alert;                          /**< Alert context */
+#if defined(DAQ_TREND_ENGINE)
+    trend_context_t*    trend;                          /**< Trend context */
+#endif
+    fleet_stream_t      stream[EHMS_MAX_ENGINES];       /**< Decode position per engine */
+    ehms_alert_t        event[FLEET_EVENT_BATCH];       /**< Events being folded */
+};
+
+/**
+ * @brief Log queue of one worker thread
+ *
+ * Holds log indices [head, tail) of the pool's item array; the owner
+ * takes from head, thieves from tail.
+ */
+typedef struct
+{
+    pthread_mutex_t     lock;
+    uint32_t*           item;               /**< First slot of the queue */
+    uint32_t            head;               /**< Next log for the owner */
+    uint32_t            tail;               /**< One past the next log for a thief */
+} fleet_queue_t;
+
+/**
+ * @brief State shared by the threads of one fleet_run
+ */
+typedef struct
+{
+    const fleet_log_t*  logs;
+    fleet_log_result_t* results;
+    uint32_t            worker_count;
+    fleet_queue_t       queue[FLEET_MAX_WORKERS];
+    fleet_worker_t*     worker[FLEET_MAX_WORKERS];
+} fleet_pool_t;
+
+/**
+ * @brief One worker thread of a pool
+ */
+typedef struct
+{
+    fleet_pool_t*       pool;
+    uint32_t            id;
+    uint32_t            steals;
+} fleet_thread_t;
+
+/**
+ * @brief Log ordering key
+ */
+typedef struct
+{
+    uint64_t            size;
+    uint32_t            index;
+} fleet_order_t;
+
+/* ============================================================================
+ * PRIVATE FUNCTION PROTOTYPES
+ * ============================================================================ */
+
+static ehms_result_t fleet_read_log(const char* path, rs_chunk_t** chunks, uint32_t* count,
+                                    fleet_log_result_t* result);
+static void fleet_replay(fleet_worker_t* worker, const rs_chunk_t* chunks, uint32_t count,
+                         fleet_log_result_t* result);
+static void fleet_refill(fleet_worker_t* worker, uint32_t engine, const rs_chunk_t* chunks,
+                         uint32_t count, fleet_log_result_t* result);
+static void fleet_collect_events(fleet_worker_t* worker, uint32_t time_ms,
+                                 fleet_log_result_t* result);
+#if defined(DAQ_TREND_ENGINE)
+static uint32_t fleet_trend_digest(const trend_context_t* trend);
+#endif
+static bool fleet_header_valid(const rs_chunk_header_t* header);
+static uint64_t fleet_log_size(const fleet_log_t* log);
+static int fleet_compare_order(const void* a, const void* b);
+static bool fleet_take(fleet_thread_t* self, uint32_t* log);
+static void* fleet_thread_main(void* arg);
+
+/* ============================================================================
+ * PUBLIC FUNCTIONS
+ * ============================================================================ */
+
+/**
+ * @brief Allocate a worker
+ */
+fleet_worker_t* fleet_worker_create(void)
+{
+    fleet_worker_t* worker = calloc(1U, sizeof(*worker));
+    bool ok = (worker != NULL);
+    
+    if (ok)
+    {
+        worker->daq = malloc(daq_context_size());
+        worker->alert = malloc(alert_context_size());
+        ok = (worker->daq != NULL) && (worker->alert != NULL);
+    }
+
+#if defined(DAQ_TREND_ENGINE)
+    if (ok)
+    {
+        worker->trend = malloc(trend_context_size());
+        ok = (worker->trend != NULL);
+    }
+
+#endif
+    
+    for (uint32_t e = 0U; ok && (e < EHMS_MAX_ENGINES); e++)
+    {
+        worker->stream[e].record = malloc(FLEET_CHUNK_RECORDS * sizeof(rs_record_t));
+        ok = (worker->stream[e].record != NULL);
+    }
+    
+    /* Builds the shared threshold tables on first use */
+    if (ok)
+    {
+        ok = (alert_ctx_init(worker->alert) == EHMS_OK);
+    }
+    
+    if (!ok)
+    {
+        fleet_worker_destroy(worker);
+        worker = NULL;
+    }
+    
+    return worker;
+}
+
+/**
+ * @brief Free a worker
+ */
+void fleet_worker_destroy(fleet_worker_t* worker)
+{
+    if (worker != NULL)
+    {
+        for (uint32_t e = 0U; e < EHMS_MAX_ENGINES; e++)
+        {
+            free(worker->stream[e].record);
+        }
+        free(worker->daq);
+        free(worker->alert);
+#if defined(DAQ_TREND_ENGINE)
+        free(worker->trend);
+#endif
+        free(worker);
+    }
+}
+
+/**
+ * @brief Reprocess one log
+ */
+ehms_result_t fleet_process_log(fleet_worker_t* worker, const fleet_log_t* log,
+                                fleet_log_result_t* result)
+{
+    ehms_result_t status = EHMS_OK;
+    rs_chunk_t* buffer = NULL;
+    const rs_chunk_t* chunks = NULL;
+    uint32_t count = 0U;
+    
+    if ((worker == NULL) || (log == NULL) || (result == NULL))
+    {
+        status = EHMS_ERROR_PARAM;
+    }
+    else
+    {
+        (void)memset(result, 0, sizeof(*result));
+        
+        if (log->path != NULL)
+        {
+            status = fleet_read_log(log->path, &buffer, &count, result);
+            chunks = buffer;
+        }
+        else if ((log->chunks == NULL) && (log->chunk_count > 0U))
+        {
+            status = EHMS_ERROR_PARAM;
+        }
+        else
+        {
+            chunks = log->chunks;
+            count = log->chunk_count;
+        }
+        
+        if (status == EHMS_OK)
+        {
+            status = daq_ctx_init(worker->daq, &log->epoch);
+        }
+        
+        if (status == EHMS_OK)
+        {
+            status = alert_ctx_init(worker->alert);
+        }
+
+#if defined(DAQ_TREND_ENGINE)
+        if (status == EHMS_OK)
+        {
+            status = trend_ctx_init(worker->trend);
+        }
+        
+        if (status == EHMS_OK)
+        {
+            status = daq_ctx_set_trend_context(worker->daq, worker->trend);
+        }
+
+#endif
+        if (status == EHMS_OK)
+        {
+            result->result = EHMS_OK;
+            fleet_replay(worker, chunks, count, result);
+            status = result->result;
+        }
+        
+        result->result = status;
+    }
+    
+    free(buffer);
+    
+    return status;
+}
+
+/**
+ * @brief Reprocess a batch of logs on a pool of worker threads
+ */
+ehms_result_t fleet_run(const fleet_log_t* logs, uint32_t count, uint32_t workers,
+                        fleet_log_result_t* results, fleet_run_statistics_t* stats)
+{
+    ehms_result_t status = EHMS_OK;
+    fleet_pool_t* pool = NULL;
+    fleet_order_t* order = NULL;
+    uint32_t* items = NULL;
+    
+    if (((logs == NULL) || (results == NULL)) && (count > 0U))
+    {
+        status = EHMS_ERROR_PARAM;
+    }
+    else if ((workers == 0U) || (workers > FLEET_MAX_WORKERS))
+    {
+        status = EHMS_ERROR_RANGE;
+    }
+    else
+    {
+        pool = calloc(1U, sizeof(*pool));
+        order = calloc((count > 0U) ? count : 1U, sizeof(*order));
+        /* Each queue has a slot per log it can be dealt: ceil(count / workers) */
+        items = calloc(count + workers, sizeof(*items));
+        status = ((pool != NULL) && (order != NULL) && (items != NULL)) ? EHMS_OK :
+                 EHMS_ERROR_MEMORY;
+    }
+    
+    if (status == EHMS_OK)
+    {
+        uint32_t worker_count = (workers < count) ? workers : count;
+        uint32_t per_queue = (worker_count > 0U) ? ((count + worker_count - 1U) / worker_count) :
+                             0U;
+        
+        pool->logs = logs;
+        pool->results = results;
+        pool->worker_count = worker_count;
+        
+        for (uint32_t w = 0U; w < worker_count; w++)
+        {
+            (void)pthread_mutex_init(&pool->queue[w].lock, NULL);
+            pool->queue[w].item = &items[w * per_queue];
+        }
+        
+        /* Workers are created here so the threshold tables exist before any thread starts */
+        for (uint32_t w = 0U; (w < worker_count) && (status == EHMS_OK); w++)
+        {
+            pool->worker[w] = fleet_worker_create();
+            status = (pool->worker[w] != NULL) ? EHMS_OK : EHMS_ERROR_MEMORY;
+        }
+        
+        /* Largest first, dealt round-robin */
+        for (uint32_t i = 0U; i < count; i++)
+        {
+            order[i].size = fleet_log_size(&logs[i]);
+            order[i].index = i;
+        }
+        qsort(order, count, sizeof(*order), fleet_compare_order);
+        
+        for (uint32_t i = 0U; (i < count) && (status == EHMS_OK); i++)
+        {
+            fleet_queue_t* queue = &pool->queue[i % worker_count];
+            
+            queue->item[queue->tail] = order[i].index;
+            queue->tail++;
+        }
+        
+        if (status == EHMS_OK)
+        {
+            fleet_thread_t thread[FLEET_MAX_WORKERS];
+            pthread_t handle[FLEET_MAX_WORKERS];
+            bool started[FLEET_MAX_WORKERS];
+            
+            /* Worker 0 runs on the calling thread; a worker that fails to
+             * start leaves its queue to be stolen by the others */
+            for (uint32_t w = 0U; w < worker_count; w++)
+            {
+                thread[w].pool = pool;
+                thread[w].id = w;
+                thread[w].steals = 0U;
+                started[w] = (w > 0U) &&
+                             (pthread_create(&handle[w], NULL, fleet_thread_main, &thread[w]) == 0);
+            }
+            
+            if (worker_count > 0U)
+            {
+                (void)fleet_thread_main(&thread[0]);
+            }
+            
+            if (stats != NULL)
+            {
+                (void)memset(stats, 0, sizeof(*stats));
+                stats->workers = worker_count;
+            }
+            
+            for (uint32_t w = 0U; w < worker_count; w++)
+            {
+                if (started[w])
+                {
+                    (void)pthread_join(handle[w], NULL);
+                }
+                
+                if (stats != NULL)
+                {
+                    stats->steals += thread[w].steals;
+                }
+            }
+            
+            for (uint32_t i = 0U; (i < count) && (stats != NULL); i++)
+            {
+                stats->samples += results[i].samples;
+                stats->failed_logs += (results[i].result != EHMS_OK) ? 1U : 0U;
+            }
+        }
+        
+        for (uint32_t w = 0U; w < worker_count; w++)
+        {
+            fleet_worker_destroy(pool->worker[w]);
+            (void)pthread_mutex_destroy(&pool->queue[w].lock);
+        }
+    }
+    
+    free(items);
+    free(order);
+    free(pool);
+    
+    return status;
+}
+
+/* ============================================================================
+ * PRIVATE FUNCTIONS
+ * ============================================================================ */
+
+/**
+ * @brief Read a log file
+ *
+ * A trailing partial chunk is counted as corrupt.
+ */
+static ehms_result_t fleet_read_log(const char* path, rs_chunk_t** chunks, uint32_t* count,
+                                    fleet_log_result_t* result)
+{
+    ehms_result_t status = EHMS_OK;
+    FILE* file = fopen(path, "rb");
+    long size = -1L;
+    
+    if (file == NULL)
+    {
+        status = EHMS_ERROR_PARAM;
+    }
+    else if (fseek(file, 0L, SEEK_END) == 0)
+    {
+        size = ftell(file);
+        rewind(file);
+    }
+    
+    if ((status == EHMS_OK) && ((size < 0L) || ((uint64_t)size / RS_CHUNK_BYTES > UINT32_MAX)))
+    {
+        status = EHMS_ERROR_PARAM;
+    }
+    
+    if (status == EHMS_OK)
+    {
+        *count = (uint32_t)((uint64_t)size / RS_CHUNK_BYTES);
+        *chunks = malloc(((*count > 0U) ? *count : 1U) * sizeof(rs_chunk_t));
+        
+        if (*chunks == NULL)
+        {
+            status = EHMS_ERROR_MEMORY;
+        }
+        else if (fread(*chunks, sizeof(rs_chunk_t), *count, file) != *count)
+        {
+            status = EHMS_ERROR_PARAM;
+        }
+        
+        if (((uint64_t)size % RS_CHUNK_BYTES) != 0U)
+        {
+            result->chunks++;
+            result->corrupt_chunks++;
+        }
+    }
+    
+    if (file != NULL)
+    {
+        (void)fclose(file);
+    }
+    
+    return status;
+}
+
+/**
+ * @brief Run every sample of a log through the contexts, engines merged in time order
+ */
+static void fleet_replay(fleet_worker_t* worker, const rs_chunk_t* chunks, uint32_t count,
+                         fleet_log_result_t* result)
+{
+    result->chunks += count;
+    result->digest = EHMS_CRC32_INITIAL;
+    
+    /* Chunks no engine can claim are counted here, CRC failures as they are decoded */
+    for (uint32_t k = 0U; k < count; k++)
+    {
+        if (!fleet_header_valid(&chunks[k].header))
+        {
+            result->corrupt_chunks++;
+        }
+    }
+    
+    for (uint32_t e = 0U; e < EHMS_MAX_ENGINES; e++)
+    {
+        worker->stream[e].count = 0U;
+        worker->stream[e].next = 0U;
+        worker->stream[e].next_chunk = 0U;
+        fleet_refill(worker, e, chunks, count, result);
+    }
+    
+    while (result->result == EHMS_OK)
+    {
+        uint32_t engine = EHMS_MAX_ENGINES;
+        uint32_t time_ms = 0U;
+        
+        /* Earliest pending sample; times compared as differences across a counter wrap */
+        for (uint32_t e = 0U; e < EHMS_MAX_ENGINES; e++)
+        {
+            const fleet_stream_t* stream = &worker->stream[e];
+            
+            if ((stream->next < stream->count) &&
+                ((engine == EHMS_MAX_ENGINES) ||
+                 ((int32_t)(stream->record[stream->next].time_ms - time_ms) < 0)))
+            {
+                engine = e;
+                time_ms = stream->record[stream->next].time_ms;
+            }
+        }
+        
+        if (engine == EHMS_MAX_ENGINES)
+        {
+            break;
+        }
+        
+        fleet_stream_t* stream = &worker->stream[engine];
+        const rs_record_t* record = &stream->record[stream->next];
+        const ehms_engine_block_t* block = NULL;
+        
+        result->result = daq_ctx_process_sample(worker->daq, (ehms_engine_id_t)engine,
+                                                record->time_ms, record->flight_phase,
+                                                record->raw_value, record->status);
+        
+        if (result->result == EHMS_OK)
+        {
+            result->result = daq_ctx_acquire_block_view(worker->daq, (ehms_engine_id_t)engine,
+                                                        &block);
+        }
+        
+        if (result->result == EHMS_OK)
+        {
+            result->result = alert_ctx_process_block(worker->alert, block);
+            (void)daq_ctx_release_block_view(worker->daq, (ehms_engine_id_t)engine, block);
+        }
+        
+        if (result->result == EHMS_OK)
+        {
+            result->samples++;
+            fleet_collect_events(worker, record->time_ms, result);
+            
+            stream->next++;
+            if (stream->next == stream->count)
+            {
+                fleet_refill(worker, engine, chunks, count, result);
+            }
+        }
+    }
+    
+    result->digest ^= EHMS_CRC32_INITIAL;
+#if defined(DAQ_TREND_ENGINE)
+    result->trend_digest = fleet_trend_digest(worker->trend);
+#endif
+}
+
+/**
+ * @brief Decode the next intact chunk of an engine
+ *
+ * Leaves the stream empty when the log holds no further chunk of the engine.
+ */
+static void fleet_refill(fleet_worker_t* worker, uint32_t engine, const rs_chunk_t* chunks,
+                         uint32_t count, fleet_log_result_t* result)
+{
+    fleet_stream_t* stream = &worker->stream[engine];
+    
+    stream->count = 0U;
+    stream->next = 0U;
+    
+    while ((stream->count == 0U) && (stream->next_chunk < count))
+    {
+        const rs_chunk_t* chunk = &chunks[stream->next_chunk];
+        
+        stream->next_chunk++;
+        
+        if (fleet_header_valid(&chunk->header) && (chunk->header.engine_id == engine) &&
+            (rs_decode_chunk(chunk, stream->record, FLEET_CHUNK_RECORDS, &stream->count) !=
+             EHMS_OK))
+        {
+            stream->count = 0U;
+            result->corrupt_chunks++;
+        }
+    }
+}
+
+/**
+ * @brief Drain the alert context's events into the log result
+ */
+static void fleet_collect_events(fleet_worker_t* worker, uint32_t time_ms,
+                                 fleet_log_result_t* result)
+{
+    uint32_t read = FLEET_EVENT_BATCH;
+    
+    while (read == FLEET_EVENT_BATCH)
+    {
+        read = alert_ctx_read_events(worker->alert, worker->event, FLEET_EVENT_BATCH);
+        
+        for (uint32_t i = 0U; i < read; i++)
+        {
+            const ehms_alert_t* alert = &worker->event[i];
+            uint32_t fold[6] =
+            {
+                time_ms,
+                (uint32_t)alert->alert_id,
+                (uint32_t)alert->engine_id,
+                (uint32_t)alert->level,
+                (uint32_t)alert->ecam_code,
+                (alert->is_active ? 1U : 0U) | (alert->is_latched ? 2U : 0U) |
+                    (alert->is_inhibited ? 4U : 0U)
+            };
+            
+            result->digest = ehms_crc32_update(result->digest, fold, (uint32_t)sizeof(fold));
+            result->alert_events++;
+            
+            if (alert->is_active && ((uint32_t)alert->level < FLEET_ALERT_LEVELS))
+            {
+                result->onsets[alert->level]++;
+            }
+        }
+    }
+}
+
+#if defined(DAQ_TREND_ENGINE)
+/**
+ * @brief CRC-32 of the statistics of every engine and parameter of a trend context
+ */
+static uint32_t fleet_trend_digest(const trend_context_t* trend)
+{
+    uint32_t crc = EHMS_CRC32_INITIAL;
+    
+    for (uint32_t e = 0U; e < EHMS_ENGINE_COUNT; e++)
+    {
+        for (uint32_t p = 0U; p < EHMS_PARAM_COUNT; p++)
+        {
+            trend_statistics_t stats;
+            
+            (void)trend_ctx_get_statistics(trend, (ehms_engine_id_t)e, (ehms_param_id_t)p,
+                                           &stats);
+            crc = ehms_crc32_update(crc, &stats, (uint32_t)sizeof(stats));
+        }
+    }
+    
+    return crc ^ EHMS_CRC32_INITIAL;
+}
+#endif
+
+/**
+ * @brief Check the clear header fields that route a chunk to an engine
+ */
+static bool fleet_header_valid(const rs_chunk_header_t* header)
+{
+    return (header->magic == RS_CHUNK_MAGIC) && (header->engine_id < EHMS_MAX_ENGINES);
+}
+
+/**
+ * @brief Size of a log in bytes (0 if the file cannot be examined)
+ */
+static uint64_t fleet_log_size(const fleet_log_t* log)
+{
+    uint64_t size = (uint64_t)log->chunk_count * RS_CHUNK_BYTES;
+    
+    if (log->path != NULL)
+    {
+        struct stat info;
+        
+        size = (stat(log->path, &info) == 0) ? (uint64_t)info.st_size : 0U;
+    }
+    
+    return size;
+}
+
+/**
+ * @brief Order logs largest first, then by position in the batch
+ */
+static int fleet_compare_order(const void* a, const void* b)
+{
+    const fleet_order_t* x = a;
+    const fleet_order_t* y = b;
+    int order = 0;
+    
+    if (x->size != y->size)
+    {
+        order = (x->size > y->size) ? -1 : 1;
+    }
+    else if (x->index != y->index)
+    {
+        order = (x->index < y->index) ? -1 : 1;
+    }
+    
+    return order;
+}
+
+/**
+ * @brief Take the next log: own queue front first, then another queue's back
+ */
+static bool fleet_take(fleet_thread_t* self, uint32_t* log)
+{
+    fleet_pool_t* pool = self->pool;
+    bool taken = false;
+    
+    for (uint32_t k = 0U; (k < pool->worker_count) && !taken; k++)
+    {
+        fleet_queue_t* queue = &pool->queue[(self->id + k) % pool->worker_count];
+        
+        (void)pthread_mutex_lock(&queue->lock);
+        if (queue->head < queue->tail)
+        {
+            if (k == 0U)
+            {
+                *log = queue->item[queue->head];
+                queue->head++;
+            }
+            else
+            {
+                queue->tail--;
+                *log = queue->item[queue->tail];
+                self->steals++;
+            }
+            taken = true;
+        }
+        (void)pthread_mutex_unlock(&queue->lock);
+    }
+    
+    return taken;
+}
+
+/**
+ * @brief Worker thread: process logs until every queue is empty
+ */
+static void* fleet_thread_main(void* arg)
+{
+    fleet_thread_t* self = arg;
+    fleet_pool_t* pool = self->pool;
+    uint32_t log = 0U;
+    
+    while (fleet_take(self, &log))
+    {
+        (void)fleet_process_log(pool->worker[self->id], &pool->logs[log], &pool->results[log]);
+    }
+    
+    return NULL;
+}
+
+/* END OF FILE */
@@ -0,0 +1,158 @@
+/**
+ * @file fleet_batch.h
+ * @brief Host Fleet Recorder Log Reprocessing
+ *
+ * @copyright Copyright (c) 2026 AeroTech Avionics Inc.
+ *
+ * Host tool support; not part of the airborne load.
+ *
+ * Runs recorded engine data from many aircraft through the acquisition
+ * validation and alert evaluation of data_acquisition.c and
+ * alert_manager.c, one acquisition context and one alert context per log,
+ * and with DAQ_TREND_ENGINE through the trend statistics of trend_engine.c,
+ * one trend context per log.
+ * A log is the recorder stream of one aircraft: RS_CHUNK_BYTES chunks,
+ * payloads decrypted, chunk k at offset k * RS_CHUNK_BYTES, with the
+ * chunks of all engines in the order they were sealed. Samples of the
+ * engines are processed merged in time order.
+ *
+ * fleet_run spreads the logs of a batch over a pool of worker threads.
+ * Each worker owns a queue of logs, taking from its front and, when it
+ * runs dry, stealing from the back of another worker's queue. Logs are
+ * dealt largest first, so the long logs start early and the short ones
+ * fill the tail. Results are stored by log, so they do not depend on the
+ * number of workers or on which worker processed a log.
+ */
+
+#ifndef FLEET_BATCH_H
+#define FLEET_BATCH_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* ============================================================================
+ * INCLUDES
+ * ============================================================================ */
+#include "ehms_types.h"
+#include "recorder_stream.h"
+
+/* ============================================================================
+ * CONSTANTS
+ * ============================================================================ */
+
+/** @brief Worker threads of one fleet_run */
+#define FLEET_MAX_WORKERS                   64U
+
+/** @brief Alert levels counted in a log result (EHMS_ALERT_NONE .. WARNING) */
+#define FLEET_ALERT_LEVELS                  ((uint32_t)EHMS_ALERT_WARNING + 1U)
+
+/* ============================================================================
+ * TYPES
+ * ============================================================================ */
+
+/**
+ * @brief Recorder log of one aircraft
+ */
+typedef struct
+{
+    const char*         path;               /**< Log file, or NULL for chunks */
+    const rs_chunk_t*   chunks;             /**< Chunks in memory, if path is NULL */
+    uint32_t            chunk_count;        /**< Number of chunks in memory */
+    ehms_timestamp_t    epoch;              /**< Calendar time at sample time zero */
+} fleet_log_t;
+
+/**
+ * @brief Reprocessing result of one log
+ */
+typedef struct
+{
+    ehms_result_t       result;             /**< EHMS_OK, or why the log was not processed */
+    uint32_t            chunks;             /**< Chunks read */
+    uint32_t            corrupt_chunks;     /**< Chunks skipped, header or CRC invalid */
+    uint32_t            samples;            /**< Samples processed, all engines */
+    uint32_t            alert_events;       /**< Alert events (onsets, clears, reactivations) */
+    uint32_t            onsets[FLEET_ALERT_LEVELS]; /**< Events of active alerts per level */
+    uint32_t            digest;             /**< CRC-32 of the alert events */
+#if defined(DAQ_TREND_ENGINE)
+    uint32_t            trend_digest;       /**< CRC-32 of the final trend statistics */
+#endif
+} fleet_log_result_t;
+
+/**
+ * @brief Statistics of one fleet_run
+ */
+typedef struct
+{
+    uint32_t            workers;            /**< Worker threads run */
+    uint32_t            steals;             /**< Logs taken from another worker's queue */
+    uint32_t            failed_logs;        /**< Logs whose result is not EHMS_OK */
+    uint32_t            samples;            /**< Samples processed, all logs */
+} fleet_run_statistics_t;
+
+/**
+ * @brief Reprocessing worker: one acquisition, one alert and one trend context
+ */
+typedef struct fleet_worker fleet_worker_t;
+
+/* ============================================================================
+ * FUNCTION PROTOTYPES
+ * ============================================================================ */
+
+/**
+ * @brief Allocate a worker
+ *
+ * The first worker created builds the alert threshold tables; create a
+ * worker before starting threads that create further workers.
+ *
+ * @return Worker, or NULL if the contexts cannot be allocated or initialized
+ */
+fleet_worker_t* fleet_worker_create(void);
+
+/**
+ * @brief Free a worker
+ *
+ * @param[in] worker  Worker (NULL is ignored)
+ */
+void fleet_worker_destroy(fleet_worker_t* worker);
+
+/**
+ * @brief Reprocess one log
+ *
+ * The worker's contexts are reinitialized at the log's epoch. Corrupt
+ * chunks are counted and skipped; the remaining chunks of the engine still
+ * decode, as every chunk decodes on its own.
+ *
+ * @param[in,out] worker  Worker
+ * @param[in]     log     Log
+ * @param[out]    result  Receives the result; result->result is also returned
+ * @return EHMS_OK on success, EHMS_ERROR_PARAM for a NULL pointer or a log
+ *         file that cannot be read, EHMS_ERROR_MEMORY, or the error of the
+ *         first sample the pipeline rejected
+ */
+ehms_result_t fleet_process_log(fleet_worker_t* worker, const fleet_log_t* log,
+                                fleet_log_result_t* result);
+
+/**
+ * @brief Reprocess a batch of logs on a pool of worker threads
+ *
+ * @param[in]  logs     Logs
+ * @param[in]  count    Number of logs
+ * @param[in]  workers  Worker threads (1 .. FLEET_MAX_WORKERS; more than
+ *                      count are not started)
+ * @param[out] results  Receives one result per log, in log order
+ * @param[out] stats    Receives run statistics (may be NULL)
+ * @return EHMS_OK if the batch ran (individual logs may still have failed,
+ *         see stats->failed_logs), EHMS_ERROR_PARAM or EHMS_ERROR_RANGE for
+ *         invalid arguments, EHMS_ERROR_MEMORY otherwise
+ */
+ehms_result_t fleet_run(const fleet_log_t* logs, uint32_t count, uint32_t workers,
+                        fleet_log_result_t* results, fleet_run_statistics_t* stats);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* FLEET_BATCH_H */
+
+/* END OF FILE */
@@ -0,0 +1,323 @@
+/**
+ * @file fleet_reprocess.c
+ * @brief Host Fleet Recorder Log Reprocessing Tool
+ *
+ * @copyright Copyright (c) 2026 AeroTech Avionics Inc.
+ *
+ * Host tool support; not part of the airborne load.
+ *
+ * Reprocesses decrypted recorder logs through acquisition validation and
+ * alert evaluation on a pool of worker threads (fleet_batch.c) and prints
+ * one line per log: chunks read and skipped, samples, alert events, events
+ * of active alerts per level and the digest of the alert events. The
+ * output is the same for any number of workers.
+ *
+ * Logs are named on the command line or listed in a manifest, one per
+ * line with an optional calendar epoch (sample time zero, UTC; default
+ * 2000-01-01T00:00:00), '#' starting a comment:
+ *
+ *   <log file> [<yyyy-mm-dd>T<hh:mm:ss>]
+ *
+ * Usage: fleet_reprocess [-j workers] [-v] [-m manifest] [log ...]
+ */
+
+#define _POSIX_C_SOURCE 200809L
+
+#include "fleet_batch.h"
+#include "ehms_types.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+/* ============================================================================
+ * CONSTANTS
+ * ============================================================================ */
+
+#define FLEET_LINE_LENGTH           1024U
+#define FLEET_DEFAULT_YEAR          2000U
+
+/* ============================================================================
+ * TYPES
+ * ============================================================================ */
+
+/**
+ * @brief Logs of the batch, grown as the command line and manifest are read
+ */
+typedef struct
+{
+    fleet_log_t*    log;
+    uint32_t        count;
+    uint32_t        capacity;
+} fleet_batch_t;
+
+/* ============================================================================
+ * FUNCTIONS
+ * ============================================================================ */
+
+static double fleet_now_s(void)
+{
+    struct timespec ts;
+    (void)clock_gettime(CLOCK_MONOTONIC, &ts);
+    
+    return (double)ts.tv_sec + ((double)ts.tv_nsec / 1.0e9);
+}
+
+static void fleet_usage(void)
+{
+    (void)fprintf(stderr, "usage: fleet_reprocess [-j workers] [-v] [-m manifest] [log ...]\n");
+}
+
+/**
+ * @brief Append a log; the path is copied
+ */
+static int fleet_add_log(fleet_batch_t* batch, const char* path, const ehms_timestamp_t* epoch)
+{
+    int status = 0;
+    
+    if (batch->count == batch->capacity)
+    {
+        uint32_t capacity = (batch->capacity > 0U) ? (batch->capacity * 2U) : 64U;
+        fleet_log_t* grown = realloc(batch->log, capacity * sizeof(*grown));
+        
+        if (grown == NULL)
+        {
+            status = 1;
+        }
+        else
+        {
+            batch->log = grown;
+            batch->capacity = capacity;
+        }
+    }
+    
+    char* copy = (status == 0) ? strdup(path) : NULL;
+    
+    if (copy == NULL)
+    {
+        (void)fprintf(stderr, "out of memory\n");
+        status = 1;
+    }
+    else
+    {
+        fleet_log_t* log = &batch->log[batch->count];
+        
+        (void)memset(log, 0, sizeof(*log));
+        log->path = copy;
+        log->epoch = *epoch;
+        batch->count++;
+    }
+    
+    return status;
+}
+
+/**
+ * @brief Parse a <yyyy-mm-dd>T<hh:mm:ss> epoch
+ */
+static int fleet_parse_epoch(const char* text, ehms_timestamp_t* epoch)
+{
+    unsigned year;
+    unsigned month;
+    unsigned day;
+    unsigned hour;
+    unsigned minute;
+    unsigned second;
+    int status = 1;
+    
+    if ((sscanf(text, "%4u-%2u-%2uT%2u:%2u:%2u", &year, &month, &day, &hour, &minute,
+                &second) == 6) &&
+        (year >= 2000U) && (year <= 2099U) && (month >= 1U) && (month <= 12U) &&
+        (day >= 1U) && (day <= 31U) && (hour < 24U) && (minute < 60U) && (second < 60U))
+    {
+        (void)memset(epoch, 0, sizeof(*epoch));
+        epoch->year = (uint16_t)year;
+        epoch->month = (uint8_t)month;
+        epoch->day = (uint8_t)day;
+        epoch->hour = (uint8_t)hour;
+        epoch->minute = (uint8_t)minute;
+        epoch->second = (uint8_t)second;
+        status = 0;
+    }
+    
+    return status;
+}
+
+static int fleet_read_manifest(fleet_batch_t* batch, const char* path,
+                               const ehms_timestamp_t* default_epoch)
+{
+    FILE* file = fopen(path, "r");
+    char line[FLEET_LINE_LENGTH];
+    uint32_t line_number = 0U;
+    int status = 0;
+    
+    if (file == NULL)
+    {
+        (void)fprintf(stderr, "%s: cannot open manifest\n", path);
+        status = 1;
+    }
+    
+    while ((status == 0) && (fgets(line, (int)sizeof(line), file) != NULL))
+    {
+        char* comment = strchr(line, '#');
+        char* save = NULL;
+        
+        line_number++;
+        if (comment != NULL)
+        {
+            *comment = '\0';
+        }
+        
+        char* log_path = strtok_r(line, " \t\r\n", &save);
+        char* epoch_text = strtok_r(NULL, " \t\r\n", &save);
+        ehms_timestamp_t epoch = *default_epoch;
+        
+        if (log_path == NULL)
+        {
+            continue;
+        }
+        
+        if (((epoch_text != NULL) && (fleet_parse_epoch(epoch_text, &epoch) != 0)) ||
+            (strtok_r(NULL, " \t\r\n", &save) != NULL))
+        {
+            (void)fprintf(stderr, "%s:%u: expected <log file> [<yyyy-mm-dd>T<hh:mm:ss>]\n",
+                          path, (unsigned)line_number);
+            status = 1;
+        }
+        else
+        {
+            status = fleet_add_log(batch, log_path, &epoch);
+        }
+    }
+    
+    if (file != NULL)
+    {
+        (void)fclose(file);
+    }
+    
+    return status;
+}
+
+static void fleet_print_result(const char* path, const fleet_log_result_t* result)
+{
+    (void)printf("%-40s %6u %7u %9u %7u %5u %5u %5u %5u  %08X", path,
+                 (unsigned)result->chunks, (unsigned)result->corrupt_chunks,
+                 (unsigned)result->samples, (unsigned)result->alert_events,
+                 (unsigned)result->onsets[EHMS_ALERT_WARNING],
+                 (unsigned)result->onsets[EHMS_ALERT_CAUTION],
+                 (unsigned)result->onsets[EHMS_ALERT_ADVISORY],
+                 (unsigned)result->onsets[EHMS_ALERT_STATUS], (unsigned)result->digest);
+    
+    if (result->result != EHMS_OK)
+    {
+        (void)printf("  error %d", (int)result->result);
+    }
+    
+    (void)printf("\n");
+}
+
+int main(int argc, char* argv[])
+{
+    fleet_batch_t batch;
+    ehms_timestamp_t epoch;
+    long workers = sysconf(_SC_NPROCESSORS_ONLN);
+    bool verbose = false;
+    int status = 0;
+    int opt;
+    
+    (void)memset(&batch, 0, sizeof(batch));
+    (void)memset(&epoch, 0, sizeof(epoch));
+    epoch.year = (uint16_t)FLEET_DEFAULT_YEAR;
+    epoch.month = 1U;
+    epoch.day = 1U;
+    
+    while ((status == 0) && ((opt = getopt(argc, argv, "j:m:v")) != -1))
+    {
+        switch (opt)
+        {
+            case 'j':
+                workers = strtol(optarg, NULL, 10);
+                break;
+            case 'm':
+                status = fleet_read_manifest(&batch, optarg, &epoch);
+                break;
+            case 'v':
+                verbose = true;
+                break;
+            default:
+                fleet_usage();
+                status = 2;
+                break;
+        }
+    }
+    
+    for (int i = optind; (i < argc) && (status == 0); i++)
+    {
+        status = fleet_add_log(&batch, argv[i], &epoch);
+    }
+    
+    if ((status == 0) && (batch.count == 0U))
+    {
+        fleet_usage();
+        status = 2;
+    }
+    
+    if (workers < 1L)
+    {
+        workers = 1L;
+    }
+    else if (workers > (long)FLEET_MAX_WORKERS)
+    {
+        workers = (long)FLEET_MAX_WORKERS;
+    }
+    
+    if (status == 0)
+    {
+        fleet_log_result_t* results = calloc(batch.count, sizeof(*results));
+        fleet_run_statistics_t stats;
+        double start = fleet_now_s();
+        ehms_result_t ran = (results != NULL) ?
+                            fleet_run(batch.log, batch.count, (uint32_t)workers, results, &stats) :
+                            EHMS_ERROR_MEMORY;
+        double elapsed = fleet_now_s() - start;
+        
+        if (ran != EHMS_OK)
+        {
+            (void)fprintf(stderr, "fleet reprocessing failed (%d)\n", (int)ran);
+            status = 1;
+        }
+        else
+        {
+            (void)printf("%-40s %6s %7s %9s %7s %5s %5s %5s %5s  %s\n", "log", "chunks",
+                         "corrupt", "samples", "events", "warn", "caut", "adv", "stat", "digest");
+            
+            for (uint32_t i = 0U; i < batch.count; i++)
+            {
+                fleet_print_result(batch.log[i].path, &results[i]);
+            }
+            
+            if (verbose)
+            {
+                (void)fprintf(stderr, "%u logs, %u samples, %u workers, %u steals, %.3f s, "
+                              "%.0f samples/s\n", (unsigned)batch.count, (unsigned)stats.samples,
+                              (unsigned)stats.workers, (unsigned)stats.steals, elapsed,
+                              (elapsed > 0.0) ? ((double)stats.samples / elapsed) : 0.0);
+            }
+            
+            status = (stats.failed_logs > 0U) ? 1 : 0;
+        }
+        
+        free(results);
+    }
+    
+    for (uint32_t i = 0U; i < batch.count; i++)
+    {
+        free((void*)batch.log[i].path);
+    }
+    free(batch.log);
+    
+    return status;
+}
+
+/* END OF FILE */
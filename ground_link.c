@@ -0,0 +1,503 @@
+/**
+ * @file ground_link.c
+ * @brief EHMS Ground Link Change-Only Snapshot Encoding
+ *
+ * @copyright Copyright (c) 2026 AeroTech Avionics Inc.
+ * @note DO-178C Level B - Safety Critical Software
+ *
+ * CSCI: EHMS-CORE
+ * CSC: GROUND-LINK
+ *
+ * Requirements Trace:
+ *   SRS-EHMS-108: System shall verify snapshot data integrity by CRC
+ *   SRS-EHMS-310: System shall downlink engine data to the ground station
+ */
+
+/* ============================================================================
+ * INCLUDES
+ * ============================================================================ */
+#include "ground_link.h"
+#include "ehms_crc32.h"
+
+#include <string.h>
+
+/* ============================================================================
+ * PRIVATE CONSTANTS
+ * ============================================================================ */
+
+/** @brief Snapshot bytes covered by the CRC (everything before crc32) */
+#define GL_SNAPSHOT_CRC_LENGTH          (sizeof(ehms_engine_snapshot_t) - sizeof(uint32_t))
+
+/** @brief Serialized timestamp length */
+#define GL_TIMESTAMP_BYTES              9U
+
+/* ============================================================================
+ * PRIVATE TYPES
+ * ============================================================================ */
+
+/**
+ * @brief Encoder state of one engine
+ */
+typedef struct
+{
+    ehms_engine_snapshot_t  mirror;             /**< Ground reconstruction */
+    uint16_t                sequence;           /**< Sequence of next frame */
+    uint32_t                frames_to_key;      /**< Frames until next keyframe */
+    gl_statistics_t         stats;              /**< Encoder statistics */
+} gl_encoder_t;
+
+/**
+ * @brief Module state structure
+ */
+typedef struct
+{
+    bool                    is_initialized;
+    gl_config_t             config;
+    gl_encoder_t            encoder[EHMS_ENGINE_COUNT];
+} gl_state_t;
+
+/* ============================================================================
+ * PRIVATE DATA
+ * ============================================================================ */
+
+/** @brief Module state - static allocation for safety */
+static gl_state_t s_gl_state;
+
+/* ============================================================================
+ * PRIVATE FUNCTION PROTOTYPES
+ * ============================================================================ */
+
+static bool gl_slot_changed(const ehms_parameter_t* current,
+                            const ehms_parameter_t* sent,
+                            uint32_t deadband);
+static uint32_t gl_frame_length(const uint8_t* frame, uint32_t length);
+static void gl_apply_frame(ehms_engine_snapshot_t* image, const uint8_t* frame);
+static uint8_t* gl_put_entry(uint8_t* out, const ehms_parameter_t* param);
+static const uint8_t* gl_get_entry(const uint8_t* in, ehms_parameter_t* param);
+static uint8_t* gl_put_timestamp(uint8_t* out, const ehms_timestamp_t* timestamp);
+static const uint8_t* gl_get_timestamp(const uint8_t* in, ehms_timestamp_t* timestamp);
+static uint8_t* gl_put_u16(uint8_t* out, uint16_t value);
+static uint8_t* gl_put_u32(uint8_t* out, uint32_t value);
+static uint16_t gl_get_u16(const uint8_t* in);
+static uint32_t gl_get_u32(const uint8_t* in);
+
+/* ============================================================================
+ * PUBLIC FUNCTIONS
+ * ============================================================================ */
+
+/**
+ * @brief Initialize the ground link encoder of every engine
+ * @trace SRS-EHMS-310
+ */
+ehms_result_t gl_init(const gl_config_t* config)
+{
+    ehms_result_t result = EHMS_OK;
+    
+    if (config == NULL)
+    {
+        result = EHMS_ERROR_PARAM;
+    }
+    else if (config->keyframe_interval == 0U)
+    {
+        result = EHMS_ERROR_CONFIG;
+    }
+    else
+    {
+        (void)memset(&s_gl_state, 0, sizeof(s_gl_state));
+        s_gl_state.config = *config;
+        s_gl_state.is_initialized = true;
+    }
+    
+    return result;
+}
+
+/**
+ * @brief Encode a snapshot as the next frame of its engine's stream
+ * @trace SRS-EHMS-310
+ */
+ehms_result_t gl_encode(const ehms_engine_snapshot_t* snapshot,
+                        uint8_t* frame,
+                        uint32_t capacity,
+                        uint32_t* length)
+{
+    ehms_result_t result = EHMS_OK;
+    
+    if ((snapshot == NULL) || (frame == NULL) || (length == NULL))
+    {
+        result = EHMS_ERROR_PARAM;
+    }
+    else if (snapshot->engine_id >= EHMS_ENGINE_COUNT)
+    {
+        result = EHMS_ERROR_RANGE;
+    }
+    else if (!s_gl_state.is_initialized)
+    {
+        result = EHMS_ERROR_NOT_INIT;
+    }
+    else if (ehms_crc32_calculate(snapshot, GL_SNAPSHOT_CRC_LENGTH) != snapshot->crc32)
+    {
+        /* Never downlink data that fails its own integrity check */
+        result = EHMS_ERROR_CRC;
+    }
+    else
+    {
+        gl_encoder_t* enc = &s_gl_state.encoder[snapshot->engine_id];
+        bool key = (enc->frames_to_key == 0U);
+        uint8_t bitmap[GL_BITMAP_BYTES] = { 0U };
+        uint32_t slots = 0U;
+        
+        for (uint32_t p = 0U; p < EHMS_PARAM_COUNT; p++)
+        {
+            if (key || gl_slot_changed(&snapshot->parameters[p], &enc->mirror.parameters[p],
+                                       s_gl_state.config.deadband[p]))
+            {
+                bitmap[p / 8U] |= (uint8_t)(1U << (p % 8U));
+                slots++;
+            }
+        }
+        
+        uint32_t needed = GL_HEADER_BYTES + GL_BITMAP_BYTES +
+                          (slots * GL_ENTRY_BYTES) + GL_CRC_BYTES;
+        
+        if (needed > capacity)
+        {
+            result = EHMS_ERROR_RANGE;
+        }
+        else
+        {
+            uint8_t* out = frame;
+            
+            *out++ = key ? (uint8_t)GL_FRAME_KEY : (uint8_t)GL_FRAME_DELTA;
+            *out++ = (uint8_t)snapshot->engine_id;
+            out = gl_put_u16(out, enc->sequence);
+            out = gl_put_timestamp(out, &snapshot->sample_time);
+            out = gl_put_u32(out, snapshot->flight_phase);
+            *out++ = (uint8_t)snapshot->health_status;
+            (void)memcpy(out, bitmap, GL_BITMAP_BYTES);
+            out += GL_BITMAP_BYTES;
+            
+            for (uint32_t p = 0U; p < EHMS_PARAM_COUNT; p++)
+            {
+                if ((bitmap[p / 8U] & (1U << (p % 8U))) != 0U)
+                {
+                    out = gl_put_entry(out, &snapshot->parameters[p]);
+                }
+            }
+            
+            /* Reconstruct exactly as the ground will, then stamp the frame */
+            gl_apply_frame(&enc->mirror, frame);
+            enc->mirror.crc32 = ehms_crc32_calculate(&enc->mirror, GL_SNAPSHOT_CRC_LENGTH);
+            (void)gl_put_u32(out, enc->mirror.crc32);
+            
+            *length = needed;
+            enc->sequence++;
+            enc->frames_to_key = key ? (s_gl_state.config.keyframe_interval - 1U) :
+                                       (enc->frames_to_key - 1U);
+            enc->stats.frames++;
+            enc->stats.keyframes += key ? 1U : 0U;
+            enc->stats.slots_sent += slots;
+            enc->stats.frame_bytes += needed;
+        }
+    }
+    
+    return result;
+}
+
+/**
+ * @brief Make the next frame of an engine a keyframe
+ * @trace SRS-EHMS-310
+ */
+ehms_result_t gl_request_keyframe(ehms_engine_id_t engine_id)
+{
+    ehms_result_t result = EHMS_OK;
+    
+    if (engine_id >= EHMS_ENGINE_COUNT)
+    {
+        result = EHMS_ERROR_RANGE;
+    }
+    else if (!s_gl_state.is_initialized)
+    {
+        result = EHMS_ERROR_NOT_INIT;
+    }
+    else
+    {
+        s_gl_state.encoder[engine_id].frames_to_key = 0U;
+    }
+    
+    return result;
+}
+
+/**
+ * @brief Get encoder statistics of an engine
+ * @trace SRS-EHMS-310
+ */
+ehms_result_t gl_get_statistics(ehms_engine_id_t engine_id, gl_statistics_t* stats)
+{
+    ehms_result_t result = EHMS_OK;
+    
+    if (stats == NULL)
+    {
+        result = EHMS_ERROR_PARAM;
+    }
+    else if (engine_id >= EHMS_ENGINE_COUNT)
+    {
+        result = EHMS_ERROR_RANGE;
+    }
+    else if (!s_gl_state.is_initialized)
+    {
+        result = EHMS_ERROR_NOT_INIT;
+    }
+    else
+    {
+        *stats = s_gl_state.encoder[engine_id].stats;
+    }
+    
+    return result;
+}
+
+/**
+ * @brief Reset a ground decoder; it waits for a keyframe
+ * @trace SRS-EHMS-310
+ */
+void gl_decoder_init(gl_decoder_t* decoder)
+{
+    if (decoder != NULL)
+    {
+        (void)memset(decoder, 0, sizeof(gl_decoder_t));
+    }
+}
+
+/**
+ * @brief Apply a received frame and verify the reconstruction
+ *
+ * The frame is applied to a copy of the image, which replaces the image
+ * only if its CRC matches. Any rejected frame desynchronizes the decoder
+ * until the next keyframe.
+ *
+ * @trace SRS-EHMS-108
+ */
+ehms_result_t gl_decode(gl_decoder_t* decoder,
+                        const uint8_t* frame,
+                        uint32_t length,
+                        ehms_engine_snapshot_t* snapshot)
+{
+    ehms_result_t result = EHMS_OK;
+    
+    if ((decoder == NULL) || (frame == NULL) || (snapshot == NULL))
+    {
+        result = EHMS_ERROR_PARAM;
+    }
+    else if ((gl_frame_length(frame, length) != length) ||
+             (frame[1] >= (uint8_t)EHMS_ENGINE_COUNT))
+    {
+        result = EHMS_ERROR_CRC;
+    }
+    else if ((frame[0] == GL_FRAME_DELTA) &&
+             (!decoder->synchronized ||
+              (gl_get_u16(&frame[2]) != (uint16_t)(decoder->sequence + 1U))))
+    {
+        result = EHMS_ERROR;
+    }
+    else
+    {
+        ehms_engine_snapshot_t image = decoder->image;
+        
+        gl_apply_frame(&image, frame);
+        image.crc32 = ehms_crc32_calculate(&image, GL_SNAPSHOT_CRC_LENGTH);
+        
+        if (image.crc32 != gl_get_u32(&frame[length - GL_CRC_BYTES]))
+        {
+            result = EHMS_ERROR_CRC;
+        }
+        else
+        {
+            decoder->image = image;
+            decoder->sequence = gl_get_u16(&frame[2]);
+            *snapshot = image;
+        }
+    }
+    
+    if (decoder != NULL)
+    {
+        decoder->synchronized = (result == EHMS_OK);
+    }
+    
+    return result;
+}
+
+/* ============================================================================
+ * PRIVATE FUNCTIONS
+ * ============================================================================ */
+
+/**
+ * @brief Whether a slot differs from the ground copy beyond its deadband
+ */
+static bool gl_slot_changed(const ehms_parameter_t* current,
+                            const ehms_parameter_t* sent,
+                            uint32_t deadband)
+{
+    uint32_t difference = (current->raw_value >= sent->raw_value) ?
+                          ((uint32_t)current->raw_value - (uint32_t)sent->raw_value) :
+                          ((uint32_t)sent->raw_value - (uint32_t)current->raw_value);
+    
+    return (current->status != sent->status) || (difference > deadband);
+}
+
+/**
+ * @brief Length a well-formed frame with this header and bitmap would have
+ *
+ * @return Expected length, or 0 if the frame is too short or of unknown type
+ */
+static uint32_t gl_frame_length(const uint8_t* frame, uint32_t length)
+{
+    uint32_t expected = 0U;
+    
+    if ((length >= (GL_HEADER_BYTES + GL_BITMAP_BYTES + GL_CRC_BYTES)) &&
+        ((frame[0] == GL_FRAME_KEY) || (frame[0] == GL_FRAME_DELTA)))
+    {
+        const uint8_t* bitmap = &frame[GL_HEADER_BYTES];
+        uint32_t slots = 0U;
+        
+        for (uint32_t p = 0U; p < EHMS_PARAM_COUNT; p++)
+        {
+            slots += (bitmap[p / 8U] >> (p % 8U)) & 1U;
+        }
+        
+        /* A keyframe carries every slot */
+        if ((frame[0] == GL_FRAME_DELTA) || (slots == EHMS_PARAM_COUNT))
+        {
+            expected = GL_HEADER_BYTES + GL_BITMAP_BYTES + (slots * GL_ENTRY_BYTES) + GL_CRC_BYTES;
+        }
+    }
+    
+    return expected;
+}
+
+/**
+ * @brief Apply a well-formed frame to a reconstructed snapshot
+ *
+ * Shared by the encoder mirror and the ground decoder so both build their
+ * image with identical stores; a keyframe starts from a cleared image so
+ * the padding bytes covered by the CRC are zero, as in DAQ snapshots.
+ */
+static void gl_apply_frame(ehms_engine_snapshot_t* image, const uint8_t* frame)
+{
+    const uint8_t* in = &frame[4];
+    const uint8_t* bitmap = &frame[GL_HEADER_BYTES];
+    
+    if (frame[0] == GL_FRAME_KEY)
+    {
+        (void)memset(image, 0, sizeof(ehms_engine_snapshot_t));
+    }
+    
+    image->engine_id = (ehms_engine_id_t)frame[1];
+    in = gl_get_timestamp(in, &image->sample_time);
+    image->flight_phase = gl_get_u32(in);
+    in += 4U;
+    image->health_status = (ehms_health_status_t)*in;
+    in = &frame[GL_HEADER_BYTES + GL_BITMAP_BYTES];
+    
+    for (uint32_t p = 0U; p < EHMS_PARAM_COUNT; p++)
+    {
+        if ((bitmap[p / 8U] & (1U << (p % 8U))) != 0U)
+        {
+            image->parameters[p].param_id = (ehms_param_id_t)p;
+            in = gl_get_entry(in, &image->parameters[p]);
+        }
+    }
+}
+
+/**
+ * @brief Serialize a slot entry
+ */
+static uint8_t* gl_put_entry(uint8_t* out, const ehms_parameter_t* param)
+{
+    uint32_t eng_bits;
+    
+    (void)memcpy(&eng_bits, &param->eng_value, sizeof(eng_bits));
+    
+    *out++ = (uint8_t)param->status;
+    *out++ = param->source_bus;
+    out = gl_put_u32(out, (uint32_t)param->raw_value);
+    out = gl_put_u32(out, eng_bits);
+    
+    return gl_put_timestamp(out, &param->timestamp);
+}
+
+/**
+ * @brief Deserialize a slot entry (param_id is set by the caller)
+ */
+static const uint8_t* gl_get_entry(const uint8_t* in, ehms_parameter_t* param)
+{
+    uint32_t eng_bits;
+    
+    param->status = (ehms_param_status_t)in[0];
+    param->source_bus = in[1];
+    param->raw_value = (int32_t)gl_get_u32(&in[2]);
+    eng_bits = gl_get_u32(&in[6]);
+    (void)memcpy(&param->eng_value, &eng_bits, sizeof(eng_bits));
+    
+    return gl_get_timestamp(&in[10], &param->timestamp);
+}
+
+/**
+ * @brief Serialize a timestamp (year, month, day, hour, minute, second, ms)
+ */
+static uint8_t* gl_put_timestamp(uint8_t* out, const ehms_timestamp_t* timestamp)
+{
+    out = gl_put_u16(out, timestamp->year);
+    *out++ = timestamp->month;
+    *out++ = timestamp->day;
+    *out++ = timestamp->hour;
+    *out++ = timestamp->minute;
+    *out++ = timestamp->second;
+    
+    return gl_put_u16(out, timestamp->millisecond);
+}
+
+/**
+ * @brief Deserialize a timestamp
+ */
+static const uint8_t* gl_get_timestamp(const uint8_t* in, ehms_timestamp_t* timestamp)
+{
+    timestamp->year = gl_get_u16(&in[0]);
+    timestamp->month = in[2];
+    timestamp->day = in[3];
+    timestamp->hour = in[4];
+    timestamp->minute = in[5];
+    timestamp->second = in[6];
+    timestamp->millisecond = gl_get_u16(&in[7]);
+    
+    return &in[GL_TIMESTAMP_BYTES];
+}
+
+static uint8_t* gl_put_u16(uint8_t* out, uint16_t value)
+{
+    out[0] = (uint8_t)value;
+    out[1] = (uint8_t)(value >> 8);
+    
+    return &out[2];
+}
+
+static uint8_t* gl_put_u32(uint8_t* out, uint32_t value)
+{
+    out[0] = (uint8_t)value;
+    out[1] = (uint8_t)(value >> 8);
+    out[2] = (uint8_t)(value >> 16);
+    out[3] = (uint8_t)(value >> 24);
+    
+    return &out[4];
+}
+
+static uint16_t gl_get_u16(const uint8_t* in)
+{
+    return (uint16_t)((uint32_t)in[0] | ((uint32_t)in[1] << 8));
+}
+
+static uint32_t gl_get_u32(const uint8_t* in)
+{
+    return (uint32_t)in[0] | ((uint32_t)in[1] << 8) |
+           ((uint32_t)in[2] << 16) | ((uint32_t)in[3] << 24);
+}
+
+/* END OF FILE */
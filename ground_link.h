@@ -0,0 +1,194 @@
+/**
+ * @file ground_link.h
+ * @brief EHMS Ground Link Change-Only Snapshot Encoding
+ *
+ * @copyright Copyright (c) 2026 AeroTech Avionics Inc.
+ * @note This file is subject to DO-178C Level B certification requirements
+ *
+ * CSCI: EHMS-CORE
+ * CSC: GROUND-LINK
+ *
+ * Requirements Trace:
+ *   SRS-EHMS-108: System shall verify snapshot data integrity by CRC
+ *   SRS-EHMS-310: System shall downlink engine data to the ground station
+ *
+ * Engine snapshots are sent over ACARS/SATCOM as byte-serialized frames.
+ * A keyframe carries every parameter; a delta frame carries the snapshot
+ * header, a bitmap of changed parameter slots and the entries of those
+ * slots only. A slot is sent when its status differs from, or its
+ * raw_value is further than the slot's deadband from, the value the ground
+ * last received, so the ground copy never deviates from the aircraft by
+ * more than the deadband.
+ *
+ * The encoder keeps a mirror of the ground's reconstruction, built by the
+ * same code the ground decoder runs. Every frame ends with the CRC-32 of
+ * the reconstructed snapshot, computed as for the snapshot crc32 field;
+ * for a keyframe it therefore equals the crc32 of the source snapshot.
+ * Multi-byte fields are little-endian.
+ */
+
+#ifndef GROUND_LINK_H
+#define GROUND_LINK_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* ============================================================================
+ * INCLUDES
+ * ============================================================================ */
+#include "ehms_types.h"
+
+/* ============================================================================
+ * CONSTANTS
+ * ============================================================================ */
+
+/** @brief Frame type: every slot present, ground copy replaced */
+#define GL_FRAME_KEY                        0x01U
+
+/** @brief Frame type: changed slots only */
+#define GL_FRAME_DELTA                      0x02U
+
+/** @brief Frame header: type, engine, sequence, sample time, phase, health */
+#define GL_HEADER_BYTES                     18U
+
+/** @brief Changed slot bitmap */
+#define GL_BITMAP_BYTES                     ((EHMS_PARAM_COUNT + 7U) / 8U)
+
+/** @brief Slot entry: status, source bus, raw, engineering value, timestamp */
+#define GL_ENTRY_BYTES                      19U
+
+/** @brief Reconstruction CRC */
+#define GL_CRC_BYTES                        4U
+
+/** @brief Largest frame (keyframe) */
+#define GL_FRAME_MAX_BYTES                  (GL_HEADER_BYTES + GL_BITMAP_BYTES + \
+                                             (EHMS_PARAM_COUNT * GL_ENTRY_BYTES) + GL_CRC_BYTES)
+
+/** @brief Default frames between keyframes */
+#define GL_DEFAULT_KEYFRAME_INTERVAL        60U
+
+/* ============================================================================
+ * TYPES
+ * ============================================================================ */
+
+/**
+ * @brief Encoder configuration
+ */
+typedef struct
+{
+    uint32_t            keyframe_interval;      /**< Frames per keyframe (1: keyframes only) */
+    uint32_t            deadband[EHMS_PARAM_COUNT]; /**< raw_value change not sent (counts) */
+} gl_config_t;
+
+/**
+ * @brief Ground decoder state of one engine stream
+ */
+typedef struct
+{
+    bool                    synchronized;       /**< A keyframe has been applied */
+    uint16_t                sequence;           /**< Sequence of last frame applied */
+    ehms_engine_snapshot_t  image;              /**< Reconstructed snapshot */
+} gl_decoder_t;
+
+/**
+ * @brief Encoder statistics of one engine
+ */
+typedef struct
+{
+    uint32_t            frames;                 /**< Frames encoded */
+    uint32_t            keyframes;              /**< Of which keyframes */
+    uint32_t            slots_sent;             /**< Slot entries sent */
+    uint32_t            frame_bytes;            /**< Bytes encoded */
+} gl_statistics_t;
+
+/* ============================================================================
+ * FUNCTION PROTOTYPES
+ * ============================================================================ */
+
+/**
+ * @brief Initialize the ground link encoder of every engine
+ *
+ * The first frame of each engine is a keyframe.
+ *
+ * @param[in] config  Encoder configuration
+ * @return EHMS_OK on success, error code otherwise
+ *
+ * @trace SRS-EHMS-310
+ */
+ehms_result_t gl_init(const gl_config_t* config);
+
+/**
+ * @brief Encode a snapshot as the next frame of its engine's stream
+ *
+ * @param[in]  snapshot  Snapshot with valid crc32
+ * @param[out] frame     Frame buffer
+ * @param[in]  capacity  Frame buffer size (GL_FRAME_MAX_BYTES always suffices)
+ * @param[out] length    Receives frame length
+ * @return EHMS_OK on success, EHMS_ERROR_CRC if the snapshot fails its CRC,
+ *         error code otherwise
+ *
+ * @trace SRS-EHMS-310
+ */
+ehms_result_t gl_encode(const ehms_engine_snapshot_t* snapshot,
+                        uint8_t* frame,
+                        uint32_t capacity,
+                        uint32_t* length);
+
+/**
+ * @brief Make the next frame of an engine a keyframe
+ *
+ * Used when the ground reports a lost or rejected frame.
+ *
+ * @param[in] engine_id  Engine identifier
+ * @return EHMS_OK on success, error code otherwise
+ *
+ * @trace SRS-EHMS-310
+ */
+ehms_result_t gl_request_keyframe(ehms_engine_id_t engine_id);
+
+/**
+ * @brief Get encoder statistics of an engine
+ *
+ * @param[in]  engine_id  Engine identifier
+ * @param[out] stats      Receives statistics
+ * @return EHMS_OK on success, error code otherwise
+ *
+ * @trace SRS-EHMS-310
+ */
+ehms_result_t gl_get_statistics(ehms_engine_id_t engine_id, gl_statistics_t* stats);
+
+/**
+ * @brief Reset a ground decoder; it waits for a keyframe
+ *
+ * @param[out] decoder  Decoder state
+ *
+ * @trace SRS-EHMS-310
+ */
+void gl_decoder_init(gl_decoder_t* decoder);
+
+/**
+ * @brief Apply a received frame and verify the reconstruction
+ *
+ * @param[in,out] decoder   Decoder state
+ * @param[in]     frame     Received frame
+ * @param[in]     length    Frame length
+ * @param[out]    snapshot  Receives the reconstructed snapshot
+ * @return EHMS_OK on success, EHMS_ERROR if a keyframe is needed (no
+ *         keyframe yet or a frame was lost), EHMS_ERROR_CRC if the frame is
+ *         malformed or the reconstruction fails its CRC
+ *
+ * @trace SRS-EHMS-108
+ */
+ehms_result_t gl_decode(gl_decoder_t* decoder,
+                        const uint8_t* frame,
+                        uint32_t length,
+                        ehms_engine_snapshot_t* snapshot);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* GROUND_LINK_H */
+
+/* END OF FILE */
@@ -0,0 +1,216 @@
+/**
+ * @file param_validation.c
+ * @brief EHMS Batch Parameter Validation Kernel
+ *
+ * @copyright Copyright (c) 2026 AeroTech Avionics Inc.
+ * @note DO-178C Level B - Safety Critical Software
+ *
+ * CSCI: EHMS-CORE
+ * CSC: PARAMETER-VALIDATION
+ *
+ * Requirements Trace:
+ *   SRS-EHMS-101: System shall validate all incoming data
+ *   SRS-EHMS-102: System shall detect stale data within 100ms
+ */
+
+/* ============================================================================
+ * INCLUDES
+ * ============================================================================ */
+#include "param_validation.h"
+
+#include <string.h>
+
+#if defined(__ARM_NEON) && !defined(__ARM_BIG_ENDIAN)
+#include <arm_neon.h>
+#define PARAM_VALIDATION_NEON   1
+#endif
+
+/* ============================================================================
+ * PRIVATE FUNCTION PROTOTYPES
+ * ============================================================================ */
+
+static uint32_t param_validate_one(uint32_t status,
+                                   uint32_t failed,
+                                   uint32_t timestamp_ms,
+                                   uint32_t now_ms,
+                                   uint32_t stale_timeout_ms);
+#if defined(PARAM_VALIDATION_NEON)
+static uint64_t param_store_status_neon(uint8_t* status, uint32_t index, uint32x4_t fail,
+                                        uint32x4_t age, uint32x4_t timeout);
+#endif
+
+/* ============================================================================
+ * PUBLIC FUNCTIONS
+ * ============================================================================ */
+
+/**
+ * @brief Range-validate and stale-check a parameter vector in one pass
+ * @trace SRS-EHMS-101, SRS-EHMS-102
+ */
+uint64_t param_validate_batch(uint8_t* status,
+                              const float* value,
+                              const uint32_t* timestamp_ms,
+                              const float* min_value,
+                              const float* max_value,
+                              uint32_t now_ms,
+                              const uint32_t* stale_timeout_ms,
+                              uint32_t count)
+{
+    uint64_t changed = 0ULL;
+    uint32_t i = 0U;
+
+#if defined(PARAM_VALIDATION_NEON)
+    const uint32x4_t v_now = vdupq_n_u32(now_ms);
+    
+    for (; (i + 4U) <= count; i += 4U)
+    {
+        /* Range check: FAILED takes precedence */
+        float32x4_t v = vld1q_f32(&value[i]);
+        uint32x4_t fail = vorrq_u32(vcltq_f32(v, vld1q_f32(&min_value[i])),
+                                    vcgtq_f32(v, vld1q_f32(&max_value[i])));
+        uint32x4_t age = vsubq_u32(v_now, vld1q_u32(&timestamp_ms[i]));
+        
+        changed |= param_store_status_neon(status, i, fail, age, 
+                                           vld1q_u32(&stale_timeout_ms[i]));
+    }
+#endif
+    
+    /* Scalar path and vector tail */
+    for (; i < count; i++)
+    {
+        uint32_t old_status = status[i];
+        uint32_t failed = (uint32_t)(value[i] < min_value[i]) | 
+                          (uint32_t)(value[i] > max_value[i]);
+        uint32_t new_status = param_validate_one(old_status, failed, timestamp_ms[i],
+                                                 now_ms, stale_timeout_ms[i]);
+        
+        status[i] = (uint8_t)new_status;
+        changed |= (uint64_t)(new_status != old_status) << i;
+    }
+    
+    return changed;
+}
+
+/**
+ * @brief Range-validate and stale-check a fixed-point parameter vector
+ * @trace SRS-EHMS-101, SRS-EHMS-102
+ */
+uint64_t param_validate_batch_fixed(uint8_t* status,
+                                    const int32_t* raw_value,
+                                    const uint32_t* timestamp_ms,
+                                    const int32_t* min_raw,
+                                    const int32_t* max_raw,
+                                    uint32_t now_ms,
+                                    const uint32_t* stale_timeout_ms,
+                                    uint32_t count)
+{
+    uint64_t changed = 0ULL;
+    uint32_t i = 0U;
+
+#if defined(PARAM_VALIDATION_NEON)
+    const uint32x4_t v_now = vdupq_n_u32(now_ms);
+    
+    for (; (i + 4U) <= count; i += 4U)
+    {
+        int32x4_t v = vld1q_s32(&raw_value[i]);
+        uint32x4_t fail = vorrq_u32(vcltq_s32(v, vld1q_s32(&min_raw[i])),
+                                    vcgtq_s32(v, vld1q_s32(&max_raw[i])));
+        uint32x4_t age = vsubq_u32(v_now, vld1q_u32(&timestamp_ms[i]));
+        
+        changed |= param_store_status_neon(status, i, fail, age, 
+                                           vld1q_u32(&stale_timeout_ms[i]));
+    }
+#endif
+    
+    /* Scalar path and vector tail */
+    for (; i < count; i++)
+    {
+        uint32_t old_status = status[i];
+        uint32_t failed = (uint32_t)(raw_value[i] < min_raw[i]) | 
+                          (uint32_t)(raw_value[i] > max_raw[i]);
+        uint32_t new_status = param_validate_one(old_status, failed, timestamp_ms[i],
+                                                 now_ms, stale_timeout_ms[i]);
+        
+        status[i] = (uint8_t)new_status;
+        changed |= (uint64_t)(new_status != old_status) << i;
+    }
+    
+    return changed;
+}
+
+/* ============================================================================
+ * PRIVATE FUNCTIONS
+ * ============================================================================ */
+
+/**
+ * @brief Branch-free status update for one parameter
+ *
+ * Written with mask selects rather than conditionals so the compiler can
+ * vectorize the scalar loop on targets without a hand-written path.
+ */
+static uint32_t param_validate_one(uint32_t status,
+                                   uint32_t failed,
+                                   uint32_t timestamp_ms,
+                                   uint32_t now_ms,
+                                   uint32_t stale_timeout_ms)
+{
+    uint32_t fail_mask = 0U - failed;
+    uint32_t result = (status & ~fail_mask) | ((uint32_t)EHMS_PARAM_FAILED & fail_mask);
+    
+    uint32_t stale = (uint32_t)((now_ms - timestamp_ms) > stale_timeout_ms) &
+                     (uint32_t)(result == (uint32_t)EHMS_PARAM_VALID);
+    uint32_t stale_mask = 0U - stale;
+    
+    return (result & ~stale_mask) | ((uint32_t)EHMS_PARAM_STALE & stale_mask);
+}
+
+#if defined(PARAM_VALIDATION_NEON)
+/**
+ * @brief Apply range and staleness results to four status bytes
+ *
+ * @param[in,out] status   Status vector
+ * @param[in]     index    First of the four parameters
+ * @param[in]     fail     Lanes failing the range check
+ * @param[in]     age      Sample age of each lane (ms)
+ * @param[in]     timeout  Staleness timeout of each lane (ms)
+ * @return Bit mask of parameters whose status changed
+ */
+static uint64_t param_store_status_neon(uint8_t* status, uint32_t index, uint32x4_t fail,
+                                        uint32x4_t age, uint32x4_t timeout)
+{
+    const uint32x4_t v_valid = vdupq_n_u32((uint32_t)EHMS_PARAM_VALID);
+    const uint32x4_t v_stale = vdupq_n_u32((uint32_t)EHMS_PARAM_STALE);
+    const uint32x4_t v_failed = vdupq_n_u32((uint32_t)EHMS_PARAM_FAILED);
+    uint64_t changed = 0ULL;
+    uint32_t packed_in;
+    uint32_t packed_out;
+    
+    /* Widen four status bytes to 32-bit lanes */
+    (void)memcpy(&packed_in, &status[index], sizeof(packed_in));
+    uint32x4_t st = vmovl_u16(vget_low_u16(vmovl_u8(vcreate_u8((uint64_t)packed_in))));
+    
+    /* FAILED takes precedence */
+    st = vbslq_u32(fail, v_failed, st);
+    
+    /* Staleness applies only to VALID data */
+    uint32x4_t stale = vandq_u32(vcgtq_u32(age, timeout), vceqq_u32(st, v_valid));
+    st = vbslq_u32(stale, v_stale, st);
+    
+    /* Narrow back to four status bytes */
+    uint16x4_t st16 = vmovn_u32(st);
+    packed_out = vget_lane_u32(vreinterpret_u32_u8(vmovn_u16(vcombine_u16(st16, st16))), 0);
+    (void)memcpy(&status[index], &packed_out, sizeof(packed_out));
+    
+    for (uint32_t lane = 0U; lane < 4U; lane++)
+    {
+        if ((((packed_in ^ packed_out) >> (lane * 8U)) & 0xFFU) != 0U)
+        {
+            changed |= 1ULL << (index + lane);
+        }
+    }
+    
+    return changed;
+}
+#endif
+
+/* END OF FILE */
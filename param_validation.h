@@ -0,0 +1,100 @@
+/**
+ * @file param_validation.h
+ * @brief EHMS Batch Parameter Validation Kernel
+ *
+ * @copyright Copyright (c) 2026 AeroTech Avionics Inc.
+ * @note This file is subject to DO-178C Level B certification requirements
+ *
+ * CSCI: EHMS-CORE
+ * CSC: PARAMETER-VALIDATION
+ *
+ * Requirements Trace:
+ *   SRS-EHMS-101: System shall validate all incoming data
+ *   SRS-EHMS-102: System shall detect stale data within 100ms
+ */
+
+#ifndef PARAM_VALIDATION_H
+#define PARAM_VALIDATION_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* ============================================================================
+ * INCLUDES
+ * ============================================================================ */
+#include "ehms_types.h"
+
+/* ============================================================================
+ * FUNCTION PROTOTYPES
+ * ============================================================================ */
+
+/**
+ * @brief Range-validate and stale-check a parameter vector in one pass
+ *
+ * For each parameter i:
+ *   - FAILED if value[i] < min_value[i] or value[i] > max_value[i]
+ *     (a NaN value or an unbounded +/-infinity limit never fails)
+ *   - then STALE if (now_ms - timestamp_ms[i]) > stale_timeout_ms[i] and the
+ *     status is VALID
+ *   - otherwise the status is left unchanged
+ *
+ * The NEON path is used on little-endian ARM targets with Advanced SIMD;
+ * all other targets use the branch-free scalar path. Both are bit-exact.
+ *
+ * @param[in,out] status            Status vector (ehms_param_status_t values)
+ * @param[in]     value             Engineering values
+ * @param[in]     timestamp_ms      Sample times (ms)
+ * @param[in]     min_value         Lower limits
+ * @param[in]     max_value         Upper limits
+ * @param[in]     now_ms            Current time (ms)
+ * @param[in]     stale_timeout_ms  Staleness timeouts (ms)
+ * @param[in]     count             Number of parameters (at most 64)
+ * @return Bit mask of parameters whose status changed
+ *
+ * @trace SRS-EHMS-101, SRS-EHMS-102
+ */
+uint64_t param_validate_batch(uint8_t* status,
+                              const float* value,
+                              const uint32_t* timestamp_ms,
+                              const float* min_value,
+                              const float* max_value,
+                              uint32_t now_ms,
+                              const uint32_t* stale_timeout_ms,
+                              uint32_t count);
+
+/**
+ * @brief Range-validate and stale-check a fixed-point parameter vector
+ *
+ * Integer form of param_validate_batch for EHMS_FIXED_POINT_PIPELINE
+ * builds: raw_value[i] is compared against limits already converted to raw
+ * units (see ehms_fixed_point.h), with identical status semantics.
+ *
+ * @param[in,out] status            Status vector (ehms_param_status_t values)
+ * @param[in]     raw_value         Fixed-point values
+ * @param[in]     timestamp_ms      Sample times (ms)
+ * @param[in]     min_raw           Lower limits (raw units)
+ * @param[in]     max_raw           Upper limits (raw units)
+ * @param[in]     now_ms            Current time (ms)
+ * @param[in]     stale_timeout_ms  Staleness timeouts (ms)
+ * @param[in]     count             Number of parameters (at most 64)
+ * @return Bit mask of parameters whose status changed
+ *
+ * @trace SRS-EHMS-101, SRS-EHMS-102
+ */
+uint64_t param_validate_batch_fixed(uint8_t* status,
+                                    const int32_t* raw_value,
+                                    const uint32_t* timestamp_ms,
+                                    const int32_t* min_raw,
+                                    const int32_t* max_raw,
+                                    uint32_t now_ms,
+                                    const uint32_t* stale_timeout_ms,
+                                    uint32_t count);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* PARAM_VALIDATION_H */
+
+/* END OF FILE */
@@ -0,0 +1,693 @@
+/**
+ * @file recorder_stream.c
+ * @brief EHMS Columnar Flight Recorder Stream Format
+ *
+ * @copyright Copyright (c) 2026 AeroTech Avionics Inc.
+ * @note DO-178C Level B - Safety Critical Software
+ *
+ * CSCI: EHMS-CORE
+ * CSC: RECORDER-STREAM
+ *
+ * Requirements Trace:
+ *   SRS-EHMS-108: System shall verify snapshot data integrity by CRC
+ *   SRS-EHMS-300: System shall retain EHMS_DATA_RETENTION_HOURS of engine data
+ */
+
+/* ============================================================================
+ * INCLUDES
+ * ============================================================================ */
+#include "recorder_stream.h"
+#include "ehms_crc32.h"
+
+#include <stddef.h>
+#include <string.h>
+
+/* ============================================================================
+ * PRIVATE CONSTANTS
+ * ============================================================================ */
+
+/** @brief Payload bytes of the reference values opening a chunk */
+#define RS_REFERENCE_BYTES              (RS_COLUMN_COUNT * sizeof(uint32_t))
+
+/** @brief Largest encoded group: every column at 32 bits */
+#define RS_GROUP_MAX_BYTES              (RS_COLUMN_COUNT * (1U + (RS_GROUP_SAMPLES * 4U)))
+
+/** @brief Header bytes covered by the chunk CRC */
+#define RS_HEADER_CRC_LENGTH            (offsetof(rs_chunk_header_t, crc32))
+
+_Static_assert((RS_REFERENCE_BYTES + RS_GROUP_MAX_BYTES) <= RS_PAYLOAD_BYTES,
+               "A chunk shall hold at least one group of any content");
+_Static_assert(RS_GROUP_SAMPLES <= 0xFFFFU, "Sample counts are 16-bit");
+
+/* ============================================================================
+ * PRIVATE TYPES
+ * ============================================================================ */
+
+/**
+ * @brief Encoder state of one engine's stream
+ *
+ * Column values are handled as uint32_t so deltas wrap modulo 2^32 and
+ * decode exactly for any raw_value.
+ */
+typedef struct
+{
+    uint32_t            last_value[RS_COLUMN_COUNT];    /**< Latest sample */
+    uint32_t            group_base[RS_COLUMN_COUNT];    /**< Sample preceding the group */
+    uint32_t            delta[RS_GROUP_SAMPLES][RS_COLUMN_COUNT]; /**< Zigzag deltas */
+    uint32_t            column_bits[RS_COLUMN_COUNT];   /**< OR of each column's deltas */
+    uint32_t            group_count;                    /**< Samples in the group */
+    uint32_t            group_first_time_ms;            /**< Time of group's first sample */
+    bool                has_previous;                   /**< A sample has been appended */
+    bool                chunk_open;                     /**< chunk holds at least one group */
+    uint32_t            chunk_used;                     /**< Payload bytes written */
+    uint32_t            sequence;                       /**< Number of the next chunk */
+    rs_chunk_t          chunk;                          /**< Chunk being filled */
+    rs_chunk_t          sealed[RS_SEALED_CHUNKS];       /**< Chunks awaiting the recorder */
+    uint32_t            sealed_head;                    /**< Chunks queued */
+    uint32_t            sealed_tail;                    /**< Chunks taken */
+    rs_statistics_t     stats;                          /**< Stream statistics */
+} rs_stream_t;
+
+/**
+ * @brief Module state structure
+ */
+typedef struct
+{
+    bool                is_initialized;
+    rs_stream_t         stream[EHMS_ENGINE_COUNT];
+} rs_state_t;
+
+/* ============================================================================
+ * PRIVATE DATA
+ * ============================================================================ */
+
+/** @brief Module state - static allocation for safety */
+static rs_state_t s_rs_state;
+
+/* ============================================================================
+ * PRIVATE FUNCTION PROTOTYPES
+ * ============================================================================ */
+
+static void rs_emit_group(rs_stream_t* stream, uint8_t engine_id);
+static void rs_open_chunk(rs_stream_t* stream, uint8_t engine_id);
+static void rs_seal_chunk(rs_stream_t* stream);
+static uint32_t rs_chunk_crc(const rs_chunk_t* chunk);
+static bool rs_chunk_intact(const rs_chunk_t* chunk);
+static uint32_t rs_read_reference(const uint8_t* payload, uint32_t* value);
+static uint32_t rs_bit_width(uint32_t value);
+static uint32_t rs_read_bits(const uint8_t* data, uint32_t bit_offset, uint32_t width);
+
+/* ============================================================================
+ * PUBLIC FUNCTIONS
+ * ============================================================================ */
+
+/**
+ * @brief Initialize the recorder stream of every engine
+ * @trace SRS-EHMS-300
+ */
+ehms_result_t rs_init(void)
+{
+    (void)memset(&s_rs_state, 0, sizeof(s_rs_state));
+    s_rs_state.is_initialized = true;
+    
+    return EHMS_OK;
+}
+
+/**
+ * @brief Append one parameter block to an engine's stream
+ * @trace SRS-EHMS-300
+ */
+ehms_result_t rs_append(const ehms_engine_block_t* block, uint32_t time_ms)
+{
+    ehms_result_t result = EHMS_OK;
+    
+    if (block == NULL)
+    {
+        result = EHMS_ERROR_PARAM;
+    }
+    else if (block->engine_id >= EHMS_ENGINE_COUNT)
+    {
+        result = EHMS_ERROR_RANGE;
+    }
+    else if (!s_rs_state.is_initialized)
+    {
+        result = EHMS_ERROR_NOT_INIT;
+    }
+    else
+    {
+        rs_stream_t* stream = &s_rs_state.stream[block->engine_id];
+        uint32_t value[RS_COLUMN_COUNT];
+        
+        value[RS_COLUMN_TIME] = time_ms;
+        value[RS_COLUMN_PHASE] = block->flight_phase;
+        
+        for (uint32_t p = 0U; p < EHMS_PARAM_COUNT; p++)
+        {
+            value[RS_COLUMN_RAW(p)] = (uint32_t)block->raw_value[p];
+            value[RS_COLUMN_STATUS(p)] = block->status[p];
+        }
+        
+        /* The first sample ever recorded is its own reference */
+        if (stream->group_count == 0U)
+        {
+            (void)memcpy(stream->group_base,
+                         stream->has_previous ? stream->last_value : value,
+                         sizeof(stream->group_base));
+            (void)memset(stream->column_bits, 0, sizeof(stream->column_bits));
+            stream->group_first_time_ms = time_ms;
+        }
+        
+        const uint32_t* previous = (stream->group_count == 0U) ?
+                                   stream->group_base : stream->last_value;
+        uint32_t* delta = stream->delta[stream->group_count];
+        
+        for (uint32_t c = 0U; c < RS_COLUMN_COUNT; c++)
+        {
+            uint32_t d = value[c] - previous[c];
+            uint32_t z = (d << 1) ^ (0U - (d >> 31));
+            
+            delta[c] = z;
+            stream->column_bits[c] |= z;
+        }
+        
+        (void)memcpy(stream->last_value, value, sizeof(stream->last_value));
+        stream->has_previous = true;
+        stream->group_count++;
+        stream->stats.samples++;
+        
+        if (stream->group_count == RS_GROUP_SAMPLES)
+        {
+            rs_emit_group(stream, (uint8_t)block->engine_id);
+        }
+    }
+    
+    return result;
+}
+
+/**
+ * @brief Encode pending samples and seal the open chunk
+ * @trace SRS-EHMS-300
+ */
+ehms_result_t rs_flush(ehms_engine_id_t engine_id)
+{
+    ehms_result_t result = EHMS_OK;
+    
+    if (engine_id >= EHMS_ENGINE_COUNT)
+    {
+        result = EHMS_ERROR_RANGE;
+    }
+    else if (!s_rs_state.is_initialized)
+    {
+        result = EHMS_ERROR_NOT_INIT;
+    }
+    else
+    {
+        rs_stream_t* stream = &s_rs_state.stream[engine_id];
+        
+        if (stream->group_count != 0U)
+        {
+            rs_emit_group(stream, (uint8_t)engine_id);
+        }
+        
+        if (stream->chunk_open)
+        {
+            rs_seal_chunk(stream);
+        }
+    }
+    
+    return result;
+}
+
+/**
+ * @brief Take the oldest sealed chunk of an engine
+ * @trace SRS-EHMS-300
+ */
+ehms_result_t rs_take_chunk(ehms_engine_id_t engine_id, rs_chunk_t* chunk, bool* available)
+{
+    ehms_result_t result = EHMS_OK;
+    
+    if ((chunk == NULL) || (available == NULL))
+    {
+        result = EHMS_ERROR_PARAM;
+    }
+    else if (engine_id >= EHMS_ENGINE_COUNT)
+    {
+        result = EHMS_ERROR_RANGE;
+    }
+    else if (!s_rs_state.is_initialized)
+    {
+        result = EHMS_ERROR_NOT_INIT;
+    }
+    else
+    {
+        rs_stream_t* stream = &s_rs_state.stream[engine_id];
+        
+        *available = (stream->sealed_head != stream->sealed_tail);
+        
+        if (*available)
+        {
+            (void)memcpy(chunk, &stream->sealed[stream->sealed_tail % RS_SEALED_CHUNKS],
+                         sizeof(rs_chunk_t));
+            stream->sealed_tail++;
+        }
+    }
+    
+    return result;
+}
+
+/**
+ * @brief Decode one sample of a chunk
+ * @trace SRS-EHMS-108
+ */
+ehms_result_t rs_decode_sample(const rs_chunk_t* chunk, uint32_t sample, rs_record_t* record)
+{
+    ehms_result_t result = EHMS_OK;
+    
+    if ((chunk == NULL) || (record == NULL))
+    {
+        result = EHMS_ERROR_PARAM;
+    }
+    else if (!rs_chunk_intact(chunk))
+    {
+        result = EHMS_ERROR_CRC;
+    }
+    else if (sample >= chunk->header.sample_count)
+    {
+        result = EHMS_ERROR_RANGE;
+    }
+    else
+    {
+        const uint8_t* payload = chunk->payload;
+        uint32_t length = chunk->header.payload_length;
+        uint32_t value[RS_COLUMN_COUNT];
+        uint32_t pos = rs_read_reference(payload, value);
+        
+        /* Apply deltas of each group up to and including the sample */
+        for (uint32_t first = 0U; (first <= sample) && (result == EHMS_OK); first += RS_GROUP_SAMPLES)
+        {
+            uint32_t remaining = chunk->header.sample_count - first;
+            uint32_t n = (remaining < RS_GROUP_SAMPLES) ? remaining : RS_GROUP_SAMPLES;
+            uint32_t take = ((sample - first) < n) ? ((sample - first) + 1U) : n;
+            
+            for (uint32_t c = 0U; c < RS_COLUMN_COUNT; c++)
+            {
+                uint32_t width = (pos < length) ? payload[pos] : 0xFFU;
+                uint32_t bytes = ((n * width) + 7U) / 8U;
+                
+                if ((width > 32U) || ((pos + 1U + bytes) > length))
+                {
+                    result = EHMS_ERROR_CRC;
+                    break;
+                }
+                
+                pos++;
+                
+                for (uint32_t i = 0U; i < take; i++)
+                {
+                    uint32_t z = rs_read_bits(&payload[pos], i * width, width);
+                    
+                    value[c] += (z >> 1) ^ (0U - (z & 1U));
+                }
+                
+                pos += bytes;
+            }
+        }
+        
+        if (result == EHMS_OK)
+        {
+            record->time_ms = value[RS_COLUMN_TIME];
+            record->flight_phase = value[RS_COLUMN_PHASE];
+            
+            for (uint32_t p = 0U; p < EHMS_PARAM_COUNT; p++)
+            {
+                record->raw_value[p] = (int32_t)value[RS_COLUMN_RAW(p)];
+                record->status[p] = (uint8_t)value[RS_COLUMN_STATUS(p)];
+            }
+        }
+    }
+    
+    return result;
+}
+
+/**
+ * @brief Decode every sample of a chunk
+ *
+ * One pass over the payload: each group's columns are located once and
+ * the deltas applied sample by sample.
+ *
+ * @trace SRS-EHMS-108
+ */
+ehms_result_t rs_decode_chunk(const rs_chunk_t* chunk, rs_record_t* records, uint32_t capacity,
+                              uint32_t* count)
+{
+    ehms_result_t result = EHMS_OK;
+    
+    if ((chunk == NULL) || (records == NULL) || (count == NULL))
+    {
+        result = EHMS_ERROR_PARAM;
+    }
+    else if (!rs_chunk_intact(chunk))
+    {
+        result = EHMS_ERROR_CRC;
+    }
+    else if (chunk->header.sample_count > capacity)
+    {
+        result = EHMS_ERROR_RANGE;
+    }
+    else
+    {
+        const uint8_t* payload = chunk->payload;
+        uint32_t length = chunk->header.payload_length;
+        uint32_t samples = chunk->header.sample_count;
+        uint32_t value[RS_COLUMN_COUNT];
+        uint32_t width[RS_COLUMN_COUNT];
+        uint32_t column[RS_COLUMN_COUNT];
+        uint32_t pos = rs_read_reference(payload, value);
+        
+        for (uint32_t first = 0U; (first < samples) && (result == EHMS_OK);
+             first += RS_GROUP_SAMPLES)
+        {
+            uint32_t remaining = samples - first;
+            uint32_t n = (remaining < RS_GROUP_SAMPLES) ? remaining : RS_GROUP_SAMPLES;
+            
+            /* Locate the group's columns */
+            for (uint32_t c = 0U; c < RS_COLUMN_COUNT; c++)
+            {
+                width[c] = (pos < length) ? payload[pos] : 0xFFU;
+                
+                uint32_t bytes = ((n * width[c]) + 7U) / 8U;
+                
+                if ((width[c] > 32U) || ((pos + 1U + bytes) > length))
+                {
+                    result = EHMS_ERROR_CRC;
+                    break;
+                }
+                
+                column[c] = pos + 1U;
+                pos += 1U + bytes;
+            }
+            
+            for (uint32_t i = 0U; (i < n) && (result == EHMS_OK); i++)
+            {
+                rs_record_t* record = &records[first + i];
+                
+                for (uint32_t c = 0U; c < RS_COLUMN_COUNT; c++)
+                {
+                    uint32_t z = rs_read_bits(&payload[column[c]], i * width[c], width[c]);
+                    
+                    value[c] += (z >> 1) ^ (0U - (z & 1U));
+                }
+                
+                record->time_ms = value[RS_COLUMN_TIME];
+                record->flight_phase = value[RS_COLUMN_PHASE];
+                
+                for (uint32_t p = 0U; p < EHMS_PARAM_COUNT; p++)
+                {
+                    record->raw_value[p] = (int32_t)value[RS_COLUMN_RAW(p)];
+                    record->status[p] = (uint8_t)value[RS_COLUMN_STATUS(p)];
+                }
+            }
+        }
+        
+        *count = (result == EHMS_OK) ? samples : 0U;
+    }
+    
+    return result;
+}
+
+/**
+ * @brief Find the chunk holding a time in a log's chunk headers
+ *
+ * Times are compared as offsets from the first chunk, so the search is
+ * unaffected by the millisecond counter wrapping within the log.
+ *
+ * @trace SRS-EHMS-300
+ */
+uint32_t rs_locate_chunk(const rs_chunk_header_t* index, uint32_t count, uint32_t time_ms)
+{
+    uint32_t found = 0U;
+    
+    if ((index != NULL) && (count > 0U))
+    {
+        uint32_t base = index[0].first_time_ms;
+        uint32_t target = time_ms - base;
+        
+        /* Times before the log are reported as its first chunk */
+        if ((target & 0x80000000UL) == 0U)
+        {
+            uint32_t lo = 0U;
+            uint32_t hi = count;
+            
+            /* Invariant: chunks [0, lo) start at or before target, [hi, count) after */
+            while ((hi - lo) > 1U)
+            {
+                uint32_t mid = lo + ((hi - lo) / 2U);
+                
+                if ((index[mid].first_time_ms - base) <= target)
+                {
+                    lo = mid;
+                }
+                else
+                {
+                    hi = mid;
+                }
+            }
+            
+            found = lo;
+        }
+    }
+    
+    return found;
+}
+
+/**
+ * @brief Get stream statistics of an engine
+ * @trace SRS-EHMS-300
+ */
+ehms_result_t rs_get_statistics(ehms_engine_id_t engine_id, rs_statistics_t* stats)
+{
+    ehms_result_t result = EHMS_OK;
+    
+    if (stats == NULL)
+    {
+        result = EHMS_ERROR_PARAM;
+    }
+    else if (engine_id >= EHMS_ENGINE_COUNT)
+    {
+        result = EHMS_ERROR_RANGE;
+    }
+    else if (!s_rs_state.is_initialized)
+    {
+        result = EHMS_ERROR_NOT_INIT;
+    }
+    else
+    {
+        *stats = s_rs_state.stream[engine_id].stats;
+    }
+    
+    return result;
+}
+
+/* ============================================================================
+ * PRIVATE FUNCTIONS
+ * ============================================================================ */
+
+/**
+ * @brief Bit-pack the pending group into the open chunk
+ *
+ * Each column is written as its bit width followed by the group's deltas,
+ * least significant bit first, padded to a whole byte. A group that does
+ * not fit in the open chunk seals it and starts the next one.
+ */
+static void rs_emit_group(rs_stream_t* stream, uint8_t engine_id)
+{
+    uint32_t n = stream->group_count;
+    uint32_t width[RS_COLUMN_COUNT];
+    uint32_t size = 0U;
+    
+    for (uint32_t c = 0U; c < RS_COLUMN_COUNT; c++)
+    {
+        width[c] = rs_bit_width(stream->column_bits[c]);
+        size += 1U + (((n * width[c]) + 7U) / 8U);
+    }
+    
+    if (stream->chunk_open && ((stream->chunk_used + size) > RS_PAYLOAD_BYTES))
+    {
+        rs_seal_chunk(stream);
+    }
+    
+    if (!stream->chunk_open)
+    {
+        rs_open_chunk(stream, engine_id);
+    }
+    
+    uint8_t* out = &stream->chunk.payload[stream->chunk_used];
+    
+    for (uint32_t c = 0U; c < RS_COLUMN_COUNT; c++)
+    {
+        uint64_t bits = 0ULL;
+        uint32_t bit_count = 0U;
+        
+        *out++ = (uint8_t)width[c];
+        
+        for (uint32_t i = 0U; i < n; i++)
+        {
+            bits |= (uint64_t)stream->delta[i][c] << bit_count;
+            bit_count += width[c];
+            
+            while (bit_count >= 8U)
+            {
+                *out++ = (uint8_t)bits;
+                bits >>= 8;
+                bit_count -= 8U;
+            }
+        }
+        
+        if (bit_count > 0U)
+        {
+            *out++ = (uint8_t)bits;
+        }
+    }
+    
+    stream->chunk_used += size;
+    stream->chunk.header.sample_count = (uint16_t)(stream->chunk.header.sample_count + n);
+    stream->chunk.header.last_time_ms = stream->last_value[RS_COLUMN_TIME];
+    stream->group_count = 0U;
+}
+
+/**
+ * @brief Start a chunk at the pending group
+ */
+static void rs_open_chunk(rs_stream_t* stream, uint8_t engine_id)
+{
+    rs_chunk_t* chunk = &stream->chunk;
+    uint8_t* out = chunk->payload;
+    
+    (void)memset(chunk, 0, sizeof(rs_chunk_t));
+    chunk->header.magic = RS_CHUNK_MAGIC;
+    chunk->header.version = RS_FORMAT_VERSION;
+    chunk->header.engine_id = engine_id;
+    chunk->header.sequence = stream->sequence;
+    chunk->header.first_time_ms = stream->group_first_time_ms;
+    
+    /* Values preceding the first sample, so the chunk decodes on its own */
+    for (uint32_t c = 0U; c < RS_COLUMN_COUNT; c++)
+    {
+        uint32_t v = stream->group_base[c];
+        
+        out[0] = (uint8_t)v;
+        out[1] = (uint8_t)(v >> 8);
+        out[2] = (uint8_t)(v >> 16);
+        out[3] = (uint8_t)(v >> 24);
+        out += 4U;
+    }
+    
+    stream->chunk_used = RS_REFERENCE_BYTES;
+    stream->chunk_open = true;
+}
+
+/**
+ * @brief Stamp the open chunk and queue it for the recorder
+ *
+ * A chunk sealed while the queue is full is dropped; the recorder is
+ * expected to take chunks far faster than they fill.
+ */
+static void rs_seal_chunk(rs_stream_t* stream)
+{
+    stream->chunk.header.payload_length = (uint16_t)stream->chunk_used;
+    stream->chunk.header.crc32 = rs_chunk_crc(&stream->chunk);
+    
+    if ((stream->sealed_head - stream->sealed_tail) < RS_SEALED_CHUNKS)
+    {
+        (void)memcpy(&stream->sealed[stream->sealed_head % RS_SEALED_CHUNKS],
+                     &stream->chunk, sizeof(rs_chunk_t));
+        stream->sealed_head++;
+    }
+    else
+    {
+        stream->stats.chunks_dropped++;
+    }
+    
+    stream->stats.chunks_sealed++;
+    stream->stats.payload_bytes += stream->chunk_used;
+    stream->chunk_open = false;
+    stream->sequence++;
+}
+
+/**
+ * @brief CRC of a chunk's header fields and used payload
+ */
+static uint32_t rs_chunk_crc(const rs_chunk_t* chunk)
+{
+    uint32_t crc = ehms_crc32_update(EHMS_CRC32_INITIAL, &chunk->header, RS_HEADER_CRC_LENGTH);
+    
+    crc = ehms_crc32_update(crc, chunk->payload, chunk->header.payload_length);
+    
+    return crc ^ EHMS_CRC32_INITIAL;
+}
+
+/**
+ * @brief Check a chunk's header fields and CRC before decoding
+ */
+static bool rs_chunk_intact(const rs_chunk_t* chunk)
+{
+    return (chunk->header.magic == RS_CHUNK_MAGIC) &&
+           (chunk->header.version == RS_FORMAT_VERSION) &&
+           (chunk->header.payload_length <= RS_PAYLOAD_BYTES) &&
+           (chunk->header.payload_length >= RS_REFERENCE_BYTES) &&
+           (rs_chunk_crc(chunk) == chunk->header.crc32);
+}
+
+/**
+ * @brief Read the reference values opening a chunk payload (little-endian)
+ *
+ * @param[in]  payload  Chunk payload
+ * @param[out] value    Receives one value per column
+ * @return Payload offset of the first group
+ */
+static uint32_t rs_read_reference(const uint8_t* payload, uint32_t* value)
+{
+    uint32_t pos = 0U;
+    
+    for (uint32_t c = 0U; c < RS_COLUMN_COUNT; c++)
+    {
+        value[c] = (uint32_t)payload[pos] | ((uint32_t)payload[pos + 1U] << 8) |
+                   ((uint32_t)payload[pos + 2U] << 16) | ((uint32_t)payload[pos + 3U] << 24);
+        pos += 4U;
+    }
+    
+    return pos;
+}
+
+/**
+ * @brief Bits needed to represent a value (0 for 0)
+ */
+static uint32_t rs_bit_width(uint32_t value)
+{
+    return (value == 0U) ? 0U : (32U - (uint32_t)__builtin_clz(value));
+}
+
+/**
+ * @brief Read a little-endian bit field
+ *
+ * @param[in] data        Start of the bit-packed column
+ * @param[in] bit_offset  Offset of the field in bits
+ * @param[in] width       Field width (0 to 32)
+ * @return Field value
+ */
+static uint32_t rs_read_bits(const uint8_t* data, uint32_t bit_offset, uint32_t width)
+{
+    uint32_t first = bit_offset / 8U;
+    uint32_t shift = bit_offset % 8U;
+    uint32_t bytes = (shift + width + 7U) / 8U;
+    uint64_t bits = 0ULL;
+    
+    for (uint32_t k = 0U; k < bytes; k++)
+    {
+        bits |= (uint64_t)data[first + k] << (8U * k);
+    }
+    
+    return (uint32_t)((bits >> shift) & ((1ULL << width) - 1ULL));
+}
+
+/* END OF FILE */
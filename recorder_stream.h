@@ -0,0 +1,245 @@
+/**
+ * @file recorder_stream.h
+ * @brief EHMS Columnar Flight Recorder Stream Format
+ *
+ * @copyright Copyright (c) 2026 AeroTech Avionics Inc.
+ * @note This file is subject to DO-178C Level B certification requirements
+ *
+ * CSCI: EHMS-CORE
+ * CSC: RECORDER-STREAM
+ *
+ * Requirements Trace:
+ *   SRS-EHMS-108: System shall verify snapshot data integrity by CRC
+ *   SRS-EHMS-300: System shall retain EHMS_DATA_RETENTION_HOURS of engine data
+ *
+ * Engine parameter blocks are recorded as a stream of fixed-size chunks.
+ * Within a chunk the data is columnar: a sample time column, one raw_value
+ * column and one status column per parameter, and a flight phase column.
+ * Samples are encoded in groups of RS_GROUP_SAMPLES; each column of a
+ * group holds the zigzag deltas from the previous sample, bit-packed at
+ * the narrowest width that holds all of them. A chunk opens with the values preceding its first
+ * sample, so every chunk decodes on its own.
+ *
+ * Chunks are RS_CHUNK_BYTES long. Chunk k of a log is stored at offset
+ * k * RS_CHUNK_BYTES and its header records the time span it covers, so
+ * the headers form an index that is searched by time without decoding any
+ * payload (rs_locate_chunk). The header CRC covers the header and the
+ * plaintext payload; the recorder encrypts each sealed payload as one block
+ * before storage and leaves the header in clear.
+ */
+
+#ifndef RECORDER_STREAM_H
+#define RECORDER_STREAM_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* ============================================================================
+ * INCLUDES
+ * ============================================================================ */
+#include "ehms_types.h"
+
+/* ============================================================================
+ * CONSTANTS
+ * ============================================================================ */
+
+/** @brief Chunk size, header included */
+#define RS_CHUNK_BYTES                      8192U
+
+/** @brief Chunk header magic ("EHRS") */
+#define RS_CHUNK_MAGIC                      0x53524845UL
+
+/** @brief Chunk format version (2: flight phase column) */
+#define RS_FORMAT_VERSION                   2U
+
+/** @brief Samples per encoding group */
+#define RS_GROUP_SAMPLES                    16U
+
+/** @brief Sealed chunks held per engine until taken by the recorder */
+#define RS_SEALED_CHUNKS                    2U
+
+/** @brief Columns: sample time, raw_value and status of each parameter, flight phase */
+#define RS_COLUMN_COUNT                     (2U + (2U * EHMS_PARAM_COUNT))
+
+/** @brief Column of the sample time */
+#define RS_COLUMN_TIME                      0U
+
+/** @brief Column of a parameter's raw_value */
+#define RS_COLUMN_RAW(p)                    (1U + (p))
+
+/** @brief Column of a parameter's status */
+#define RS_COLUMN_STATUS(p)                 (1U + EHMS_PARAM_COUNT + (p))
+
+/** @brief Column of the flight phase */
+#define RS_COLUMN_PHASE                     (1U + (2U * EHMS_PARAM_COUNT))
+
+/* ============================================================================
+ * TYPES
+ * ============================================================================ */
+
+/**
+ * @brief Chunk header (stored in clear)
+ */
+typedef struct
+{
+    uint32_t            magic;                  /**< RS_CHUNK_MAGIC */
+    uint16_t            version;                /**< RS_FORMAT_VERSION */
+    uint8_t             engine_id;              /**< Engine recorded */
+    uint8_t             reserved;               /**< Zero */
+    uint32_t            sequence;               /**< Chunk number in the engine's stream */
+    uint32_t            first_time_ms;          /**< Time of first sample */
+    uint32_t            last_time_ms;           /**< Time of last sample */
+    uint16_t            sample_count;           /**< Samples in chunk */
+    uint16_t            payload_length;         /**< Payload bytes used */
+    uint32_t            crc32;                  /**< CRC of header fields above and payload */
+} rs_chunk_header_t;
+
+/** @brief Payload capacity of a chunk */
+#define RS_PAYLOAD_BYTES                    (RS_CHUNK_BYTES - sizeof(rs_chunk_header_t))
+
+/**
+ * @brief Recorder chunk
+ */
+typedef struct
+{
+    rs_chunk_header_t   header;                 /**< Chunk header */
+    uint8_t             payload[RS_PAYLOAD_BYTES]; /**< Reference values, then groups */
+} rs_chunk_t;
+
+_Static_assert(sizeof(rs_chunk_header_t) == 28U, "Chunk header layout is part of the format");
+_Static_assert(sizeof(rs_chunk_t) == RS_CHUNK_BYTES, "Chunks shall be RS_CHUNK_BYTES long");
+
+/**
+ * @brief One decoded sample
+ */
+typedef struct
+{
+    uint32_t            time_ms;                /**< Sample time */
+    uint32_t            flight_phase;           /**< ehms_flight_phase_t */
+    int32_t             raw_value[EHMS_PARAM_COUNT]; /**< Raw values */
+    uint8_t             status[EHMS_PARAM_COUNT];    /**< ehms_param_status_t values */
+} rs_record_t;
+
+/**
+ * @brief Stream statistics of one engine
+ */
+typedef struct
+{
+    uint32_t            samples;                /**< Samples appended */
+    uint32_t            chunks_sealed;          /**< Chunks completed */
+    uint32_t            chunks_dropped;         /**< Chunks lost, sealed queue full */
+    uint32_t            payload_bytes;          /**< Payload bytes of sealed chunks */
+} rs_statistics_t;
+
+/* ============================================================================
+ * FUNCTION PROTOTYPES
+ * ============================================================================ */
+
+/**
+ * @brief Initialize the recorder stream of every engine
+ *
+ * @return EHMS_OK on success, error code otherwise
+ *
+ * @trace SRS-EHMS-300
+ */
+ehms_result_t rs_init(void);
+
+/**
+ * @brief Append one parameter block to an engine's stream
+ *
+ * @param[in] block    Parameter block; engine taken from block->engine_id
+ * @param[in] time_ms  Sample time of the block
+ * @return EHMS_OK on success, error code otherwise
+ *
+ * @trace SRS-EHMS-300
+ */
+ehms_result_t rs_append(const ehms_engine_block_t* block, uint32_t time_ms);
+
+/**
+ * @brief Encode pending samples and seal the open chunk
+ *
+ * @param[in] engine_id  Engine identifier
+ * @return EHMS_OK on success, error code otherwise
+ *
+ * @trace SRS-EHMS-300
+ */
+ehms_result_t rs_flush(ehms_engine_id_t engine_id);
+
+/**
+ * @brief Take the oldest sealed chunk of an engine
+ *
+ * @param[in]  engine_id  Engine identifier
+ * @param[out] chunk      Receives the chunk
+ * @param[out] available  Receives true if a chunk was taken
+ * @return EHMS_OK on success, error code otherwise
+ *
+ * @trace SRS-EHMS-300
+ */
+ehms_result_t rs_take_chunk(ehms_engine_id_t engine_id, rs_chunk_t* chunk, bool* available);
+
+/**
+ * @brief Decode one sample of a chunk
+ *
+ * The chunk CRC is verified before decoding.
+ *
+ * @param[in]  chunk   Chunk, payload decrypted
+ * @param[in]  sample  Sample index within the chunk
+ * @param[out] record  Receives the sample
+ * @return EHMS_OK on success, EHMS_ERROR_CRC if the chunk is corrupt,
+ *         error code otherwise
+ *
+ * @trace SRS-EHMS-108
+ */
+ehms_result_t rs_decode_sample(const rs_chunk_t* chunk, uint32_t sample, rs_record_t* record);
+
+/**
+ * @brief Decode every sample of a chunk
+ *
+ * Equivalent to rs_decode_sample for each sample in turn, with the chunk
+ * CRC verified once and the payload decoded in a single pass.
+ *
+ * @param[in]  chunk     Chunk, payload decrypted
+ * @param[out] records   Receives the samples in order
+ * @param[in]  capacity  Capacity of records
+ * @param[out] count     Receives the number of samples decoded
+ * @return EHMS_OK on success, EHMS_ERROR_CRC if the chunk is corrupt,
+ *         EHMS_ERROR_RANGE if the chunk holds more than capacity samples,
+ *         error code otherwise
+ *
+ * @trace SRS-EHMS-108
+ */
+ehms_result_t rs_decode_chunk(const rs_chunk_t* chunk, rs_record_t* records, uint32_t capacity,
+                              uint32_t* count);
+
+/**
+ * @brief Find the chunk holding a time in a log's chunk headers
+ *
+ * @param[in] index    Headers of the log's chunks, in stream order
+ * @param[in] count    Number of headers
+ * @param[in] time_ms  Time searched for
+ * @return Position of the last chunk starting at or before time_ms
+ *         (0 if time_ms precedes the log)
+ *
+ * @trace SRS-EHMS-300
+ */
+uint32_t rs_locate_chunk(const rs_chunk_header_t* index, uint32_t count, uint32_t time_ms);
+
+/**
+ * @brief Get stream statistics of an engine
+ *
+ * @param[in]  engine_id  Engine identifier
+ * @param[out] stats      Receives statistics
+ * @return EHMS_OK on success, error code otherwise
+ *
+ * @trace SRS-EHMS-300
+ */
+ehms_result_t rs_get_statistics(ehms_engine_id_t engine_id, rs_statistics_t* stats);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* RECORDER_STREAM_H */
+
+/* END OF FILE */
@@ -0,0 +1,928 @@
+/**
+ * @file replay_engine.c
+ * @brief Host Deterministic Bus Traffic Replay Engine
+ *
+ * @copyright Copyright (c) 2026 AeroTech Avionics Inc.
+ *
+ * Host tool support; not part of the airborne load. Provides the driver,
+ * system service and consumer entry points the acquisition and alert
+ * modules link against, fed from a trace or a synthetic profile.
+ */
+
+#define _POSIX_C_SOURCE 200809L
+
+/* ============================================================================
+ * INCLUDES
+ * ============================================================================ */
+#include "replay_engine.h"
+#include "ehms_types.h"
+#include "ehms_config.h"
+#include "arinc429_driver.h"
+#include "milstd1553_driver.h"
+#include "parameter_database.h"
+#include "error_handler.h"
+#include "eicas_interface.h"
+#include "flight_recorder.h"
+#include "ehms_crc32.h"
+#include "ehms_timebase.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+/* ============================================================================
+ * PRIVATE CONSTANTS
+ * ============================================================================ */
+
+/** @brief Trace line length */
+#define REPLAY_LINE_LENGTH                  512U
+
+/** @brief Labels transmitted as unrouted traffic (001-177 octal) */
+#define REPLAY_UNROUTED_LABEL_FIRST         0o001U
+#define REPLAY_UNROUTED_LABEL_LAST          0o177U
+
+/** @brief SSM of a negative BCD value */
+#define REPLAY_SSM_BCD_MINUS                3U
+
+/** @brief Range limits returned for every parameter */
+#define REPLAY_LIMIT_MIN                    (-1.0e6f)
+#define REPLAY_LIMIT_MAX                    1.0e6f
+
+/** @brief Alert consumer tags folded into the digest */
+#define REPLAY_SINK_EICAS                   1U
+#define REPLAY_SINK_RECORDER                2U
+
+/** @brief Timebase provided here rather than by ehms_timebase.h */
+#if !defined(__powerpc__) && !defined(__PPC__) && !defined(__ARM_ARCH_7R__) && \
+    !defined(__aarch64__)
+#define REPLAY_HOST_TIMEBASE                1
+#else
+#define REPLAY_HOST_TIMEBASE                0
+#endif
+
+/** @brief Calendar date of replay time zero */
+#define REPLAY_EPOCH_YEAR                   2026U
+#define REPLAY_EPOCH_MONTH                  1U
+#define REPLAY_EPOCH_DAY                    1U
+
+/* ============================================================================
+ * PRIVATE TYPES
+ * ============================================================================ */
+
+/**
+ * @brief Recorded word or message
+ */
+typedef struct
+{
+    uint32_t            time_ms;                        /**< Reception time */
+    uint8_t             bus;                            /**< replay_bus_t */
+    uint8_t             channel;                        /**< Bus or subaddress */
+    uint8_t             ssm;                            /**< ARINC 429 SSM */
+    uint8_t             word_count;                     /**< 1553 data words */
+    uint32_t            label;                          /**< ARINC 429 label */
+    int32_t             data;                           /**< ARINC 429 data field */
+    uint16_t            words[REPLAY_MESSAGE_WORDS];    /**< 1553 data words */
+} replay_record_t;
+
+/**
+ * @brief Latest word of one label
+ */
+typedef struct
+{
+    arinc429_word_t     word;
+    uint32_t            time_ms;
+    bool                held;
+} replay_label_t;
+
+/**
+ * @brief ARINC 429 receive FIFO of one bus
+ */
+typedef struct
+{
+    arinc429_word_t     word[REPLAY_FIFO_WORDS];
+    uint32_t            head;                   /**< Oldest word */
+    uint32_t            count;                  /**< Words buffered */
+    uint32_t            drain_ms;               /**< Time of the last read */
+    bool                drained;                /**< Read at least once */
+} replay_fifo_t;
+
+/**
+ * @brief Latest message of one subaddress
+ */
+typedef struct
+{
+    milstd1553_message_t message;
+    uint32_t            time_ms;
+    bool                held;
+} replay_subaddress_t;
+
+/**
+ * @brief Module state structure
+ */
+typedef struct
+{
+    const replay_profile_t* profile;            /**< Synthetic profile, NULL for a trace */
+    uint32_t            record_count;           /**< Trace records loaded */
+    uint32_t            next_record;            /**< Next trace record to latch */
+    uint32_t            engine_count;           /**< Engines configured */
+    uint32_t            now_ms;                 /**< Simulated clock */
+    uint32_t            noise_state;            /**< Noise generator state */
+    bool                virtual_time;           /**< Timebase follows the simulated clock */
+    replay_label_t      label[EHMS_ARINC429_BUS_COUNT][REPLAY_LABEL_COUNT];
+    replay_fifo_t       fifo[EHMS_ARINC429_BUS_COUNT];
+    replay_subaddress_t subaddress[REPLAY_SUBADDRESS_COUNT];
+    replay_statistics_t stats;
+} replay_state_t;
+
+/* ============================================================================
+ * PRIVATE DATA
+ * ============================================================================ */
+
+/** @brief Module state - static allocation */
+static replay_state_t s_replay_state;
+
+/** @brief Loaded trace */
+static replay_record_t s_replay_trace[REPLAY_MAX_RECORDS];
+
+/* ============================================================================
+ * PRIVATE FUNCTION PROTOTYPES
+ * ============================================================================ */
+
+static void replay_reset(void);
+static ehms_result_t replay_parse_line(char* line, replay_record_t* record);
+static void replay_latch_record(const replay_record_t* record);
+static void replay_generate_cycle(void);
+static int32_t replay_source_value(const replay_source_t* source, bool excursion);
+static void replay_fold_word(const arinc429_word_t* word);
+static void replay_fold_alert(uint32_t sink, const ehms_alert_t* alert);
+
+/* ============================================================================
+ * PUBLIC FUNCTIONS
+ * ============================================================================ */
+
+/**
+ * @brief Replay a synthetic traffic profile
+ */
+ehms_result_t replay_start_profile(const replay_profile_t* profile)
+{
+    ehms_result_t result = EHMS_OK;
+    
+    if ((profile == NULL) || (profile->sources == NULL))
+    {
+        result = EHMS_ERROR_PARAM;
+    }
+    else if ((profile->engine_count == 0U) || (profile->engine_count > EHMS_MAX_ENGINES) ||
+             (profile->repeat == 0U) ||
+             (profile->unrouted_labels > (REPLAY_UNROUTED_LABEL_LAST -
+                                          REPLAY_UNROUTED_LABEL_FIRST + 1U)))
+    {
+        result = EHMS_ERROR_CONFIG;
+    }
+    else
+    {
+        for (uint32_t s = 0U; s < profile->source_count; s++)
+        {
+            const replay_source_t* source = &profile->sources[s];
+            bool arinc = (source->bus == REPLAY_BUS_ARINC429);
+            
+            if ((arinc && ((source->channel >= EHMS_ARINC429_BUS_COUNT) ||
+                           (source->label >= REPLAY_LABEL_COUNT) ||
+                           ((profile->unrouted_labels != 0U) &&
+                            (source->label <= REPLAY_UNROUTED_LABEL_LAST)))) ||
+                (!arinc && ((source->channel >= REPLAY_SUBADDRESS_COUNT) ||
+                            (source->label >= REPLAY_MESSAGE_WORDS))))
+            {
+                result = EHMS_ERROR_CONFIG;
+                break;
+            }
+        }
+    }
+    
+    if (result == EHMS_OK)
+    {
+        s_replay_state.profile = profile;
+        s_replay_state.record_count = 0U;
+        s_replay_state.engine_count = profile->engine_count;
+        replay_reset();
+    }
+    
+    return result;
+}
+
+/**
+ * @brief Load a recorded trace and replay it
+ */
+ehms_result_t replay_load_trace(const char* path, uint32_t engine_count)
+{
+    ehms_result_t result = EHMS_OK;
+    FILE* file = NULL;
+    
+    if ((path == NULL) || (engine_count == 0U) || (engine_count > EHMS_MAX_ENGINES))
+    {
+        result = EHMS_ERROR_PARAM;
+    }
+    else
+    {
+        file = fopen(path, "r");
+        result = (file != NULL) ? EHMS_OK : EHMS_ERROR_PARAM;
+    }
+    
+    if (result == EHMS_OK)
+    {
+        char line[REPLAY_LINE_LENGTH];
+        uint32_t line_number = 0U;
+        uint32_t count = 0U;
+        
+        while ((result == EHMS_OK) && (fgets(line, (int)sizeof(line), file) != NULL))
+        {
+            char* comment = strchr(line, '#');
+            
+            line_number++;
+            if (comment != NULL)
+            {
+                *comment = '\0';
+            }
+            
+            if (strspn(line, " \t\r\n") == strlen(line))
+            {
+                continue;
+            }
+            
+            if (count >= REPLAY_MAX_RECORDS)
+            {
+                (void)fprintf(stderr, "%s:%u: more than %u records\n", path,
+                              (unsigned)line_number, (unsigned)REPLAY_MAX_RECORDS);
+                result = EHMS_ERROR_CONFIG;
+            }
+            else
+            {
+                result = replay_parse_line(line, &s_replay_trace[count]);
+                
+                if ((result == EHMS_OK) && (count > 0U) &&
+                    (s_replay_trace[count].time_ms < s_replay_trace[count - 1U].time_ms))
+                {
+                    result = EHMS_ERROR_CONFIG;
+                }
+                
+                if (result != EHMS_OK)
+                {
+                    (void)fprintf(stderr, "%s:%u: malformed or out of order record\n", path,
+                                  (unsigned)line_number);
+                }
+                count++;
+            }
+        }
+        
+        (void)fclose(file);
+        
+        if (result == EHMS_OK)
+        {
+            s_replay_state.profile = NULL;
+            s_replay_state.record_count = count;
+            s_replay_state.engine_count = engine_count;
+            replay_reset();
+        }
+    }
+    
+    return result;
+}
+
+/**
+ * @brief Restart the current trace or profile from time zero
+ */
+void replay_rewind(void)
+{
+    replay_reset();
+}
+
+/**
+ * @brief Advance one acquisition cycle and latch the traffic received in it
+ */
+bool replay_step(void)
+{
+    bool more = (s_replay_state.profile != NULL) ||
+                (s_replay_state.next_record < s_replay_state.record_count);
+    
+    if (more)
+    {
+        s_replay_state.now_ms += REPLAY_CYCLE_MS;
+        s_replay_state.stats.cycles++;
+        
+        if (s_replay_state.profile != NULL)
+        {
+            replay_generate_cycle();
+        }
+        else
+        {
+            while ((s_replay_state.next_record < s_replay_state.record_count) &&
+                   (s_replay_trace[s_replay_state.next_record].time_ms <=
+                    s_replay_state.now_ms))
+            {
+                replay_latch_record(&s_replay_trace[s_replay_state.next_record]);
+                s_replay_state.next_record++;
+            }
+        }
+    }
+    
+    return more;
+}
+
+/**
+ * @brief Select the timebase seen by the pipeline
+ */
+ehms_result_t replay_set_virtual_time(bool virtual_time)
+{
+    ehms_result_t result = EHMS_OK;
+
+#if REPLAY_HOST_TIMEBASE
+    s_replay_state.virtual_time = virtual_time;
+#else
+    /* The pipeline reads the hardware timebase directly */
+    result = virtual_time ? EHMS_ERROR_CONFIG : EHMS_OK;
+#endif
+    
+    return result;
+}
+
+/**
+ * @brief Fold caller data into the replay digest
+ */
+void replay_digest_update(const void* data, uint32_t length)
+{
+    s_replay_state.stats.digest = ehms_crc32_update(s_replay_state.stats.digest, data, length);
+}
+
+/**
+ * @brief Get replay statistics
+ */
+ehms_result_t replay_get_statistics(replay_statistics_t* stats)
+{
+    ehms_result_t result = EHMS_OK;
+    
+    if (stats == NULL)
+    {
+        result = EHMS_ERROR_PARAM;
+    }
+    else
+    {
+        *stats = s_replay_state.stats;
+        stats->digest = ~s_replay_state.stats.digest;
+    }
+    
+    return result;
+}
+
+/**
+ * @brief Encode counts as an ARINC 429 BNR data field (saturating)
+ */
+int32_t replay_encode_bnr(int32_t counts, uint32_t bits)
+{
+    int32_t limit = (int32_t)(1UL << bits);
+    int32_t value = counts;
+    
+    if (value >= limit)
+    {
+        value = limit - 1;
+    }
+    else if (value < -limit)
+    {
+        value = -limit;
+    }
+    
+    /* Two's complement in the top bits + 1 of the 19-bit field */
+    return (int32_t)(((uint32_t)value << (18U - bits)) & 0x7FFFFUL);
+}
+
+/**
+ * @brief Encode counts as an ARINC 429 BCD data field (saturating)
+ */
+int32_t replay_encode_bcd(int32_t counts, uint32_t digits, uint32_t* ssm)
+{
+    uint32_t scale = 1U;
+    uint32_t value = (counts < 0) ? (uint32_t)(-(int64_t)counts) : (uint32_t)counts;
+    uint32_t field = 0U;
+    uint32_t shift = 16U;
+    
+    for (uint32_t d = 1U; d < digits; d++)
+    {
+        scale *= 10U;
+    }
+    
+    /* Leading digit is 3 bits wide */
+    if (value > ((8U * scale) - 1U))
+    {
+        value = (8U * scale) - 1U;
+    }
+    
+    for (uint32_t d = 0U; d < digits; d++)
+    {
+        field |= ((value / scale) % 10U) << shift;
+        scale /= 10U;
+        shift -= 4U;
+    }
+    
+    *ssm = (counts < 0) ? REPLAY_SSM_BCD_MINUS : 0U;
+    
+    return (int32_t)field;
+}
+
+/* ============================================================================
+ * DRIVER AND SERVICE ENTRY POINTS
+ * ============================================================================ */
+
+ehms_result_t arinc429_init(uint8_t bus_id, arinc429_config_t config)
+{
+    (void)config;
+    
+    return (bus_id < EHMS_ARINC429_BUS_COUNT) ? EHMS_OK : EHMS_ERROR_RANGE;
+}
+
+ehms_result_t arinc429_read(uint8_t bus_id, uint32_t label, arinc429_word_t* word)
+{
+    ehms_result_t result = EHMS_OK;
+    
+    if (word == NULL)
+    {
+        result = EHMS_ERROR_PARAM;
+    }
+    else if ((bus_id >= EHMS_ARINC429_BUS_COUNT) || (label >= REPLAY_LABEL_COUNT))
+    {
+        result = EHMS_ERROR_RANGE;
+    }
+    else
+    {
+        const replay_label_t* held = &s_replay_state.label[bus_id][label];
+        
+        if (held->held && ((s_replay_state.now_ms - held->time_ms) <= REPLAY_HOLD_MS))
+        {
+            *word = held->word;
+            replay_fold_word(word);
+        }
+        else
+        {
+            s_replay_state.stats.read_timeouts++;
+            result = EHMS_ERROR_TIMEOUT;
+        }
+    }
+    
+    return result;
+}
+
+ehms_result_t arinc429_read_fifo(uint8_t bus_id, arinc429_word_t* words, uint32_t max_words,
+                                 uint32_t* word_count)
+{
+    ehms_result_t result = EHMS_OK;
+    
+    if ((words == NULL) || (word_count == NULL))
+    {
+        result = EHMS_ERROR_PARAM;
+    }
+    else if (bus_id >= EHMS_ARINC429_BUS_COUNT)
+    {
+        result = EHMS_ERROR_RANGE;
+    }
+    else
+    {
+        replay_fifo_t* fifo = &s_replay_state.fifo[bus_id];
+        uint32_t count = 0U;
+        
+        fifo->drain_ms = s_replay_state.now_ms;
+        fifo->drained = true;
+        
+        /* Words beyond max_words stay buffered for the next drain */
+        while ((count < max_words) && (fifo->count > 0U))
+        {
+            words[count] = fifo->word[fifo->head];
+            replay_fold_word(&words[count]);
+            fifo->head = (fifo->head + 1U) % REPLAY_FIFO_WORDS;
+            fifo->count--;
+            count++;
+        }
+        
+        *word_count = count;
+    }
+    
+    return result;
+}
+
+ehms_result_t milstd1553_init(uint8_t rt_address)
+{
+    (void)rt_address;
+    
+    return EHMS_OK;
+}
+
+ehms_result_t milstd1553_read_subaddress(uint8_t subaddress, milstd1553_message_t* message)
+{
+    ehms_result_t result = EHMS_OK;
+    
+    if (message == NULL)
+    {
+        result = EHMS_ERROR_PARAM;
+    }
+    else if (subaddress >= REPLAY_SUBADDRESS_COUNT)
+    {
+        result = EHMS_ERROR_RANGE;
+    }
+    else
+    {
+        const replay_subaddress_t* held = &s_replay_state.subaddress[subaddress];
+        
+        if (held->held && ((s_replay_state.now_ms - held->time_ms) <= REPLAY_HOLD_MS))
+        {
+            *message = held->message;
+            replay_digest_update(message->data,
+                                 (uint32_t)message->word_count * (uint32_t)sizeof(uint16_t));
+        }
+        else
+        {
+            s_replay_state.stats.read_timeouts++;
+            result = EHMS_ERROR_TIMEOUT;
+        }
+    }
+    
+    return result;
+}
+
+uint32_t system_get_time_ms(void)
+{
+    return s_replay_state.now_ms;
+}
+
+ehms_timestamp_t system_get_timestamp(void)
+{
+    ehms_timestamp_t timestamp;
+    uint32_t now_ms = s_replay_state.now_ms;
+    
+    (void)memset(&timestamp, 0, sizeof(timestamp));
+    timestamp.year = (uint16_t)REPLAY_EPOCH_YEAR;
+    timestamp.month = (uint8_t)REPLAY_EPOCH_MONTH;
+    timestamp.day = (uint8_t)(REPLAY_EPOCH_DAY + (now_ms / 86400000UL));
+    timestamp.hour = (uint8_t)((now_ms / 3600000UL) % 24U);
+    timestamp.minute = (uint8_t)((now_ms / 60000UL) % 60U);
+    timestamp.second = (uint8_t)((now_ms / 1000U) % 60U);
+    timestamp.millisecond = (uint16_t)(now_ms % 1000U);
+    
+    return timestamp;
+}
+
+uint32_t timestamp_to_ms(const ehms_timestamp_t* timestamp)
+{
+    return (((((((uint32_t)timestamp->day - REPLAY_EPOCH_DAY) * 24U) + timestamp->hour) * 60U +
+              timestamp->minute) * 60U + timestamp->second) * 1000U) + timestamp->millisecond;
+}
+
+uint32_t config_get_engine_count(void)
+{
+    return s_replay_state.engine_count;
+}
+
+ehms_result_t param_db_get_limits(ehms_param_id_t param_id, param_limits_t* limits)
+{
+    ehms_result_t result = EHMS_OK;
+    
+    if (limits == NULL)
+    {
+        result = EHMS_ERROR_PARAM;
+    }
+    else if (param_id >= EHMS_PARAM_COUNT)
+    {
+        result = EHMS_ERROR_RANGE;
+    }
+    else
+    {
+        limits->min_value = REPLAY_LIMIT_MIN;
+        limits->max_value = REPLAY_LIMIT_MAX;
+    }
+    
+    return result;
+}
+
+void error_report(uint32_t module, uint32_t severity, uint32_t code, uint32_t data)
+{
+    uint32_t report[4] = { module, severity, code, data };
+    
+    s_replay_state.stats.error_reports++;
+    replay_digest_update(report, (uint32_t)sizeof(report));
+}
+
+ehms_result_t eicas_post_message(const ehms_alert_t* alert)
+{
+    s_replay_state.stats.eicas_events++;
+    replay_fold_alert(REPLAY_SINK_EICAS, alert);
+    
+    return EHMS_OK;
+}
+
+ehms_result_t recorder_log_alert(const ehms_alert_t* alert)
+{
+    s_replay_state.stats.recorder_events++;
+    replay_fold_alert(REPLAY_SINK_RECORDER, alert);
+    
+    return EHMS_OK;
+}
+
+#if REPLAY_HOST_TIMEBASE
+/* Timebase in nanoseconds: host monotonic clock or the simulated clock */
+
+void ehms_timebase_init(void)
+{
+}
+
+uint32_t ehms_timebase_read(void)
+{
+    uint64_t ns = (uint64_t)s_replay_state.now_ms * 1000000ULL;
+    
+    if (!s_replay_state.virtual_time)
+    {
+        struct timespec ts;
+        
+        (void)clock_gettime(CLOCK_MONOTONIC, &ts);
+        ns = ((uint64_t)ts.tv_sec * 1000000000ULL) + (uint64_t)ts.tv_nsec;
+    }
+    
+    return (uint32_t)ns;
+}
+
+uint32_t ehms_timebase_hz(void)
+{
+    return 1000000000UL;
+}
+#endif
+
+/* ============================================================================
+ * PRIVATE FUNCTIONS
+ * ============================================================================ */
+
+/**
+ * @brief Return the clock, bus state and statistics to time zero
+ */
+static void replay_reset(void)
+{
+    s_replay_state.next_record = 0U;
+    s_replay_state.now_ms = 0U;
+    s_replay_state.noise_state = (s_replay_state.profile != NULL) ?
+                                 s_replay_state.profile->seed : 0U;
+    (void)memset(s_replay_state.label, 0, sizeof(s_replay_state.label));
+    (void)memset(s_replay_state.fifo, 0, sizeof(s_replay_state.fifo));
+    (void)memset(s_replay_state.subaddress, 0, sizeof(s_replay_state.subaddress));
+    (void)memset(&s_replay_state.stats, 0, sizeof(s_replay_state.stats));
+    s_replay_state.stats.digest = EHMS_CRC32_INITIAL;
+}
+
+/**
+ * @brief Parse one trace line
+ */
+static ehms_result_t replay_parse_line(char* line, replay_record_t* record)
+{
+    ehms_result_t result = EHMS_ERROR_CONFIG;
+    char* cursor = line;
+    char* end = NULL;
+    
+    (void)memset(record, 0, sizeof(*record));
+    record->time_ms = (uint32_t)strtoul(cursor, &end, 10);
+    
+    if (end != cursor)
+    {
+        cursor = end + strspn(end, " \t");
+        
+        if (strncmp(cursor, "A429", 4U) == 0)
+        {
+            unsigned bus = 0U;
+            unsigned label = 0U;
+            long data = 0L;
+            unsigned ssm = 0U;
+            int fields = sscanf(cursor + 4, "%u %o %ld %u", &bus, &label, &data, &ssm);
+            
+            if ((fields >= 3) && (bus < EHMS_ARINC429_BUS_COUNT) &&
+                (label < REPLAY_LABEL_COUNT) && (ssm <= 3U))
+            {
+                record->bus = (uint8_t)REPLAY_BUS_ARINC429;
+                record->channel = (uint8_t)bus;
+                record->label = label;
+                record->data = (int32_t)data;
+                record->ssm = (uint8_t)ssm;
+                result = EHMS_OK;
+            }
+        }
+        else if (strncmp(cursor, "1553", 4U) == 0)
+        {
+            unsigned long subaddress = strtoul(cursor + 4, &end, 10);
+            
+            if ((end != (cursor + 4)) && (subaddress < REPLAY_SUBADDRESS_COUNT))
+            {
+                record->bus = (uint8_t)REPLAY_BUS_MILSTD1553;
+                record->channel = (uint8_t)subaddress;
+                cursor = end;
+                
+                while (record->word_count < REPLAY_MESSAGE_WORDS)
+                {
+                    unsigned long value = strtoul(cursor, &end, 16);
+                    
+                    if ((end == cursor) || (value > 0xFFFFUL))
+                    {
+                        break;
+                    }
+                    record->words[record->word_count] = (uint16_t)value;
+                    record->word_count++;
+                    cursor = end;
+                }
+                
+                result = ((record->word_count > 0U) &&
+                          (strspn(cursor, " \t\r\n") == strlen(cursor))) ?
+                         EHMS_OK : EHMS_ERROR_CONFIG;
+            }
+        }
+    }
+    
+    return result;
+}
+
+/**
+ * @brief Deliver a received word or message to the simulated receivers
+ */
+static void replay_latch_record(const replay_record_t* record)
+{
+    if (record->bus == (uint8_t)REPLAY_BUS_ARINC429)
+    {
+        replay_label_t* held = &s_replay_state.label[record->channel][record->label];
+        replay_fifo_t* fifo = &s_replay_state.fifo[record->channel];
+        
+        held->word.label = record->label;
+        held->word.data = record->data;
+        held->word.ssm = record->ssm;
+        held->time_ms = record->time_ms;
+        held->held = true;
+        s_replay_state.stats.arinc429_words++;
+        
+        /* A full FIFO discards the word; only losses on a bus being read count */
+        if (fifo->count < REPLAY_FIFO_WORDS)
+        {
+            fifo->word[(fifo->head + fifo->count) % REPLAY_FIFO_WORDS] = held->word;
+            fifo->count++;
+        }
+        else if (fifo->drained && ((record->time_ms - fifo->drain_ms) <= REPLAY_CYCLE_MS))
+        {
+            s_replay_state.stats.fifo_overruns++;
+        }
+    }
+    else
+    {
+        replay_subaddress_t* held = &s_replay_state.subaddress[record->channel];
+        
+        (void)memset(&held->message, 0, sizeof(held->message));
+        (void)memcpy(held->message.data, record->words,
+                     (size_t)record->word_count * sizeof(uint16_t));
+        held->message.word_count = record->word_count;
+        held->time_ms = record->time_ms;
+        held->held = true;
+        s_replay_state.stats.milstd1553_messages++;
+    }
+}
+
+/**
+ * @brief Generate and deliver one cycle of profile traffic
+ *
+ * Each repetition transmits every source once, at evenly spaced times
+ * within the cycle, followed by the profile's unrouted labels on every
+ * ARINC 429 bus. Sources sharing a subaddress form one message.
+ */
+static void replay_generate_cycle(void)
+{
+    const replay_profile_t* profile = s_replay_state.profile;
+    uint32_t cycle = s_replay_state.stats.cycles;
+    uint32_t cycle_start = s_replay_state.now_ms - REPLAY_CYCLE_MS;
+    bool excursion = (profile->excursion_period != 0U) &&
+                     ((cycle % profile->excursion_period) < profile->excursion_cycles);
+    replay_record_t record;
+    replay_record_t messages[REPLAY_SUBADDRESS_COUNT];
+    
+    for (uint32_t r = 0U; r < profile->repeat; r++)
+    {
+        uint32_t time_ms = cycle_start + ((r * REPLAY_CYCLE_MS) / profile->repeat);
+        uint32_t pending = 0U;
+        
+        for (uint32_t s = 0U; s < profile->source_count; s++)
+        {
+            const replay_source_t* source = &profile->sources[s];
+            int32_t value = replay_source_value(source, excursion);
+            
+            if (source->bus == REPLAY_BUS_ARINC429)
+            {
+                uint32_t ssm = 0U;
+                
+                (void)memset(&record, 0, sizeof(record));
+                record.time_ms = time_ms;
+                record.bus = (uint8_t)REPLAY_BUS_ARINC429;
+                record.channel = source->channel;
+                record.label = source->label;
+                record.data = (source->encoding == REPLAY_ENCODING_BCD) ?
+                              replay_encode_bcd(value, source->width, &ssm) :
+                              replay_encode_bnr(value, source->width);
+                record.ssm = (uint8_t)ssm;
+                replay_latch_record(&record);
+            }
+            else
+            {
+                replay_record_t* message = &messages[source->channel];
+                
+                if ((pending & (1UL << source->channel)) == 0U)
+                {
+                    (void)memset(message, 0, sizeof(*message));
+                    message->time_ms = time_ms;
+                    message->bus = (uint8_t)REPLAY_BUS_MILSTD1553;
+                    message->channel = source->channel;
+                    pending |= 1UL << source->channel;
+                }
+                
+                message->words[source->label] = (uint16_t)((value < 0) ? 0 :
+                                                           ((value > 0xFFFF) ? 0xFFFF : value));
+                if (message->word_count <= source->label)
+                {
+                    message->word_count = (uint8_t)(source->label + 1U);
+                }
+            }
+        }
+        
+        while (pending != 0U)
+        {
+            uint32_t sa = (uint32_t)__builtin_ctz(pending);
+            
+            pending &= pending - 1U;
+            replay_latch_record(&messages[sa]);
+        }
+        
+        for (uint32_t u = 0U; u < profile->unrouted_labels; u++)
+        {
+            for (uint8_t bus = 0U; bus < EHMS_ARINC429_BUS_COUNT; bus++)
+            {
+                (void)memset(&record, 0, sizeof(record));
+                record.time_ms = time_ms;
+                record.bus = (uint8_t)REPLAY_BUS_ARINC429;
+                record.channel = bus;
+                record.label = REPLAY_UNROUTED_LABEL_FIRST + u;
+                record.data = (int32_t)(s_replay_state.noise_state & 0x7FFFFUL);
+                replay_latch_record(&record);
+            }
+        }
+    }
+}
+
+/**
+ * @brief Next value of a source: nominal, uniform noise and excursion
+ */
+static int32_t replay_source_value(const replay_source_t* source, bool excursion)
+{
+    int32_t value = source->nominal;
+    
+    /* Numerical Recipes LCG: deterministic on every host */
+    s_replay_state.noise_state = (s_replay_state.noise_state * 1664525UL) + 1013904223UL;
+    
+    if (source->noise > 0)
+    {
+        uint32_t span = ((uint32_t)source->noise * 2U) + 1U;
+        
+        value += (int32_t)((s_replay_state.noise_state >> 8U) % span) - source->noise;
+    }
+    
+    if (excursion)
+    {
+        value += source->excursion;
+    }
+    
+    return value;
+}
+
+/**
+ * @brief Fold a delivered ARINC 429 word into the digest
+ */
+static void replay_fold_word(const arinc429_word_t* word)
+{
+    uint32_t fields[3] = { (uint32_t)word->label, (uint32_t)word->data, (uint32_t)word->ssm };
+    
+    replay_digest_update(fields, (uint32_t)sizeof(fields));
+}
+
+/**
+ * @brief Fold an alert event received by a consumer into the digest
+ */
+static void replay_fold_alert(uint32_t sink, const ehms_alert_t* alert)
+{
+    uint32_t fields[9] =
+    {
+        sink,
+        alert->alert_id,
+        (uint32_t)alert->level,
+        (uint32_t)alert->engine_id,
+        (uint32_t)alert->param_id,
+        (uint32_t)alert->is_active,
+        (uint32_t)alert->is_inhibited,
+        (uint32_t)alert->ecam_code,
+        timestamp_to_ms(&alert->onset_time)
+    };
+    
+    replay_digest_update(fields, (uint32_t)sizeof(fields));
+}
+
+/* END OF FILE */
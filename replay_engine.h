@@ -0,0 +1,232 @@
+/**
+ * @file replay_engine.h
+ * @brief Host Deterministic Bus Traffic Replay Engine
+ *
+ * @copyright Copyright (c) 2026 AeroTech Avionics Inc.
+ *
+ * Host tool support; not part of the airborne load.
+ *
+ * Stands in for the ARINC 429 and MIL-STD-1553B drivers, system services
+ * and alert consumers so that data_acquisition.c and alert_manager.c run
+ * unmodified on a workstation. Bus traffic is either a recorded trace or
+ * a seeded synthetic profile; either way it is latched one acquisition
+ * cycle at a time on a simulated clock, so a replay runs as fast as the
+ * host allows and repeats bit for bit.
+ *
+ * Trace files are text, one received word or message per line, in time
+ * order ('#' starts a comment):
+ *
+ *   <time_ms> A429 <bus> <label, octal> <data field> [<ssm>]
+ *   <time_ms> 1553 <subaddress> <word, hex> [<word, hex> ...]
+ *
+ * Every word delivered to the pipeline and every alert event received by
+ * the EICAS and recorder sinks is folded into a CRC-32 digest; with the
+ * virtual timebase two replays of the same traffic through the same build
+ * produce the same digest.
+ */
+
+#ifndef REPLAY_ENGINE_H
+#define REPLAY_ENGINE_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* ============================================================================
+ * INCLUDES
+ * ============================================================================ */
+#include "ehms_types.h"
+
+/* ============================================================================
+ * CONSTANTS
+ * ============================================================================ */
+
+/** @brief Simulated acquisition cycle (100 Hz) */
+#define REPLAY_CYCLE_MS                     10U
+
+/** @brief Trace records held by replay_load_trace */
+#ifndef REPLAY_MAX_RECORDS
+#define REPLAY_MAX_RECORDS                  65536U
+#endif
+
+/** @brief Words buffered per ARINC 429 receive FIFO */
+#define REPLAY_FIFO_WORDS                   512U
+
+/** @brief Age at which a label or subaddress is no longer returned */
+#define REPLAY_HOLD_MS                      1000U
+
+/** @brief ARINC 429 labels per bus */
+#define REPLAY_LABEL_COUNT                  256U
+
+/** @brief MIL-STD-1553B subaddresses and data words per message */
+#define REPLAY_SUBADDRESS_COUNT             32U
+#define REPLAY_MESSAGE_WORDS                32U
+
+/* ============================================================================
+ * TYPES
+ * ============================================================================ */
+
+/**
+ * @brief Bus a traffic source transmits on
+ */
+typedef enum
+{
+    REPLAY_BUS_ARINC429     = 0U,   /**< ARINC 429 word, channel = bus */
+    REPLAY_BUS_MILSTD1553   = 1U    /**< 1553 data word, channel = subaddress */
+} replay_bus_t;
+
+/**
+ * @brief Data encoding of a synthetic source
+ */
+typedef enum
+{
+    REPLAY_ENCODING_BNR     = 0U,   /**< ARINC 429 BNR, width = significant bits */
+    REPLAY_ENCODING_BCD     = 1U,   /**< ARINC 429 BCD, width = digits */
+    REPLAY_ENCODING_WORD    = 2U    /**< Unsigned 16-bit 1553 data word */
+} replay_encoding_t;
+
+/**
+ * @brief Synthetic traffic source (one label or one 1553 data word)
+ *
+ * Values are in counts of the receiver's resolution.
+ */
+typedef struct
+{
+    replay_bus_t        bus;            /**< Bus type */
+    uint8_t             channel;        /**< ARINC 429 bus or 1553 subaddress */
+    uint32_t            label;          /**< ARINC 429 label or 1553 word index */
+    replay_encoding_t   encoding;       /**< Data encoding */
+    uint32_t            width;          /**< Significant bits or digits */
+    int32_t             nominal;        /**< Steady-state value */
+    int32_t             noise;          /**< Peak uniform noise */
+    int32_t             excursion;      /**< Offset during an excursion */
+} replay_source_t;
+
+/**
+ * @brief Synthetic traffic profile
+ */
+typedef struct
+{
+    const replay_source_t*  sources;            /**< Traffic sources */
+    uint32_t                source_count;       /**< Number of sources */
+    uint32_t                engine_count;       /**< Engines configured */
+    uint32_t                repeat;             /**< Transmissions per source per cycle */
+    uint32_t                unrouted_labels;    /**< Extra labels per ARINC bus per cycle */
+    uint32_t                excursion_period;   /**< Cycles between excursions (0: none) */
+    uint32_t                excursion_cycles;   /**< Cycles an excursion lasts */
+    uint32_t                seed;               /**< Noise generator seed */
+} replay_profile_t;
+
+/**
+ * @brief Replay statistics
+ */
+typedef struct
+{
+    uint32_t            cycles;             /**< Cycles stepped */
+    uint32_t            arinc429_words;     /**< ARINC 429 words received */
+    uint32_t            milstd1553_messages;/**< 1553 messages received */
+    uint32_t            fifo_overruns;      /**< Words lost to a full FIFO being read */
+    uint32_t            read_timeouts;      /**< Reads of labels not held */
+    uint32_t            eicas_events;       /**< Alert events posted to EICAS */
+    uint32_t            recorder_events;    /**< Alert events logged to the recorder */
+    uint32_t            error_reports;      /**< error_report calls */
+    uint32_t            digest;             /**< CRC-32 of delivered traffic and events */
+} replay_statistics_t;
+
+/* ============================================================================
+ * FUNCTION PROTOTYPES
+ * ============================================================================ */
+
+/**
+ * @brief Replay a synthetic traffic profile
+ *
+ * Resets the clock, bus state and statistics. The profile is referenced,
+ * not copied, and shall remain valid while it is replayed.
+ *
+ * @param[in] profile  Traffic profile
+ * @return EHMS_OK on success, EHMS_ERROR_PARAM or EHMS_ERROR_CONFIG otherwise
+ */
+ehms_result_t replay_start_profile(const replay_profile_t* profile);
+
+/**
+ * @brief Load a recorded trace and replay it
+ *
+ * Resets the clock, bus state and statistics.
+ *
+ * @param[in] path          Trace file
+ * @param[in] engine_count  Engines configured
+ * @return EHMS_OK on success, EHMS_ERROR_PARAM if the file cannot be read,
+ *         EHMS_ERROR_CONFIG with the line number on stderr if it is malformed
+ */
+ehms_result_t replay_load_trace(const char* path, uint32_t engine_count);
+
+/**
+ * @brief Restart the current trace or profile from time zero
+ */
+void replay_rewind(void);
+
+/**
+ * @brief Advance one acquisition cycle and latch the traffic received in it
+ *
+ * @return true while traffic remains (always for a profile), false once a
+ *         trace is exhausted
+ */
+bool replay_step(void);
+
+/**
+ * @brief Select the timebase seen by the pipeline
+ *
+ * With the host timebase phase timings are real, but sample times carry
+ * the host time elapsed within each cycle, so output varies with host
+ * scheduling. The virtual timebase follows the simulated clock: no time
+ * elapses within a cycle and output depends on the traffic alone. Survives
+ * replay_rewind.
+ *
+ * @param[in] virtual_time  true for the virtual timebase (default false)
+ * @return EHMS_OK on success, EHMS_ERROR_CONFIG if the build reads a
+ *         hardware timebase (ehms_timebase.h)
+ */
+ehms_result_t replay_set_virtual_time(bool virtual_time);
+
+/**
+ * @brief Fold caller data into the replay digest
+ *
+ * @param[in] data    Data to fold
+ * @param[in] length  Length in bytes
+ */
+void replay_digest_update(const void* data, uint32_t length);
+
+/**
+ * @brief Get replay statistics
+ *
+ * @param[out] stats  Pointer to receive statistics
+ * @return EHMS_OK on success, EHMS_ERROR_PARAM if stats is NULL
+ */
+ehms_result_t replay_get_statistics(replay_statistics_t* stats);
+
+/**
+ * @brief Encode counts as an ARINC 429 BNR data field (saturating)
+ *
+ * @param[in] counts  Value
+ * @param[in] bits    Significant bits (1 .. 18)
+ * @return Data field
+ */
+int32_t replay_encode_bnr(int32_t counts, uint32_t bits);
+
+/**
+ * @brief Encode counts as an ARINC 429 BCD data field (saturating)
+ *
+ * @param[in]  counts  Value
+ * @param[in]  digits  Digits (1 .. 5)
+ * @param[out] ssm     Receives the sign/status matrix
+ * @return Data field
+ */
+int32_t replay_encode_bcd(int32_t counts, uint32_t digits, uint32_t* ssm);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* REPLAY_ENGINE_H */
+
+/* END OF FILE */
@@ -0,0 +1,811 @@
+/**
+ * @file test_alert_manager.c
+ * @brief Unit Tests for Alert Management Module
+ * 
+ * @copyright Copyright (c) 2026 AeroTech Avionics Inc.
+ * 
+ * Test Framework: Unity Test Framework
+ * Coverage Target: 100% MC/DC
+ * 
+ * Requirements Verified:
+ *   SRS-EHMS-200, SRS-EHMS-201, SRS-EHMS-202, SRS-EHMS-203
+ */
+
+#include "unity.h"
+#include "alert_manager.h"
+#include "alert_manager_ext.h"
+#include "ehms_types.h"
+#include "mock_eicas_interface.h"
+#include "mock_flight_recorder.h"
+#if defined(EHMS_FIXED_POINT_PIPELINE)
+#include "ehms_fixed_point.h"
+#endif
+
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+/* ============================================================================
+ * TEST FIXTURES
+ * ============================================================================ */
+
+/** @brief Evaluations needed for onset and clear (ALERT_DEBOUNCE_CYCLES) */
+#define TEST_DEBOUNCE_CYCLES    3U
+
+/** @brief Events per priority class of a consumer queue (ALERT_MAX_QUEUE_SIZE) */
+#define TEST_QUEUE_SIZE         64U
+
+/** @brief Dispatch batch size large enough to empty every queue */
+#define TEST_DISPATCH_ALL       1024U
+
+static ehms_engine_block_t test_block;
+
+static void set_value(ehms_engine_block_t* block, ehms_param_id_t param, float value)
+{
+    block->eng_value[param] = value;
+#if defined(EHMS_FIXED_POINT_PIPELINE)
+    if (!isnan(value))
+    {
+        block->raw_value[param] = ehms_raw_floor(param, value);
+    }
+#endif
+}
+
+void setUp(void)
+{
+    mock_eicas_interface_Init();
+    mock_flight_recorder_Init();
+    
+    /* Nominal, valid engine data below every threshold */
+    (void)memset(&test_block, 0, sizeof(test_block));
+    test_block.engine_id = EHMS_ENGINE_1;
+    set_value(&test_block, EHMS_PARAM_N1, 85.0f);
+    set_value(&test_block, EHMS_PARAM_N2, 90.0f);
+    set_value(&test_block, EHMS_PARAM_EGT, 700.0f);
+    set_value(&test_block, EHMS_PARAM_OIL_TEMP, 90.0f);
+    set_value(&test_block, EHMS_PARAM_OIL_PRESS, 50.0f);
+    set_value(&test_block, EHMS_PARAM_VIB_FAN, 1.0f);
+    set_value(&test_block, EHMS_PARAM_VIB_CORE, 1.0f);
+    
+    (void)alert_init();
+}
+
+void tearDown(void)
+{
+    mock_eicas_interface_Verify();
+    mock_flight_recorder_Verify();
+    
+    mock_eicas_interface_Destroy();
+    mock_flight_recorder_Destroy();
+}
+
+static void expect_alert_posts(uint32_t count)
+{
+    for (uint32_t i = 0U; i < count; i++)
+    {
+        eicas_post_message_ExpectAnyArgsAndReturn(EHMS_OK);
+        recorder_log_alert_ExpectAnyArgsAndReturn(EHMS_OK);
+    }
+}
+
+static void process_queued(void)
+{
+    for (uint32_t i = 0U; i < TEST_DEBOUNCE_CYCLES; i++)
+    {
+        (void)alert_process_block(&test_block);
+    }
+}
+
+static void process_debounced(void)
+{
+    process_queued();
+    
+    (void)alert_dispatch_eicas(TEST_DISPATCH_ALL);
+    (void)alert_dispatch_recorder(TEST_DISPATCH_ALL);
+}
+
+/* ============================================================================
+ * INPUT VALIDATION TESTS
+ * ============================================================================ */
+
+/**
+ * @test Test block processing with NULL pointer and invalid engine
+ * @trace SRS-EHMS-200
+ */
+void test_alert_process_block_invalid(void)
+{
+    TEST_ASSERT_EQUAL(EHMS_ERROR_PARAM, alert_process_block(NULL));
+    
+    test_block.engine_id = (ehms_engine_id_t)EHMS_MAX_ENGINES;
+    TEST_ASSERT_EQUAL(EHMS_ERROR_RANGE, alert_process_block(&test_block));
+}
+
+/* ============================================================================
+ * THRESHOLD EVALUATION TESTS
+ * ============================================================================ */
+
+/**
+ * @test Test nominal data raises no alert
+ * @trace SRS-EHMS-200
+ */
+void test_alert_nominal_no_alert(void)
+{
+    TEST_ASSERT_EQUAL(EHMS_OK, alert_process_block(&test_block));
+    
+    TEST_ASSERT_EQUAL(0U, alert_get_active_count());
+    TEST_ASSERT_EQUAL(EHMS_ALERT_NONE, alert_get_highest_level());
+}
+
+/**
+ * @test Test high limit is inclusive and raises every exceeded band
+ * @trace SRS-EHMS-200, SRS-EHMS-201
+ */
+void test_alert_high_limit_bands(void)
+{
+    /* EGT 950 caution only */
+    set_value(&test_block, EHMS_PARAM_EGT, 950.0f);
+    expect_alert_posts(1U);
+    process_debounced();
+    
+    TEST_ASSERT_EQUAL(1U, alert_get_active_count());
+    TEST_ASSERT_EQUAL(EHMS_ALERT_CAUTION, alert_get_highest_level());
+    TEST_ASSERT_TRUE(alert_is_master_caution());
+    
+    /* EGT 1000: warning added, caution not raised again */
+    set_value(&test_block, EHMS_PARAM_EGT, 1000.0f);
+    expect_alert_posts(1U);
+    process_debounced();
+    
+    TEST_ASSERT_EQUAL(2U, alert_get_active_count());
+    TEST_ASSERT_EQUAL(EHMS_ALERT_WARNING, alert_get_highest_level());
+    TEST_ASSERT_TRUE(alert_is_master_warning());
+}
+
+/**
+ * @test Test low limit raises caution and warning together
+ * @trace SRS-EHMS-200, SRS-EHMS-201
+ */
+void test_alert_low_limit_bands(void)
+{
+    set_value(&test_block, EHMS_PARAM_OIL_PRESS, 10.0f);
+    expect_alert_posts(2U);
+    process_debounced();
+    
+    TEST_ASSERT_EQUAL(2U, alert_get_active_count());
+    TEST_ASSERT_EQUAL(EHMS_ALERT_WARNING, alert_get_highest_level());
+}
+
+/**
+ * @test Test an anomaly score at the advisory limit raises an advisory only
+ * @trace SRS-EHMS-200
+ */
+void test_alert_anomaly_advisory(void)
+{
+    set_value(&test_block, EHMS_PARAM_ANOMALY_SCORE, 4.0f);
+    expect_alert_posts(1U);
+    process_debounced();
+    
+    TEST_ASSERT_EQUAL(1U, alert_get_active_count());
+    TEST_ASSERT_EQUAL(EHMS_ALERT_ADVISORY, alert_get_highest_level());
+    TEST_ASSERT_FALSE(alert_is_master_caution());
+}
+
+/**
+ * @test Test active alerts are tracked per engine
+ * @trace SRS-EHMS-200
+ */
+void test_alert_active_per_engine(void)
+{
+    set_value(&test_block, EHMS_PARAM_N1, 105.0f);
+    expect_alert_posts(2U);
+    process_debounced();
+    process_debounced();
+    
+    test_block.engine_id = EHMS_ENGINE_2;
+    process_debounced();
+    
+    TEST_ASSERT_EQUAL(2U, alert_get_active_count());
+}
+
+/**
+ * @test Test invalid and NaN parameters raise no alert
+ * @trace SRS-EHMS-200
+ */
+void test_alert_invalid_data_ignored(void)
+{
+    set_value(&test_block, EHMS_PARAM_EGT, 1200.0f);
+    test_block.status[EHMS_PARAM_EGT] = (uint8_t)EHMS_PARAM_STALE;
+    set_value(&test_block, EHMS_PARAM_N1, NAN);
+    process_debounced();
+    
+    TEST_ASSERT_EQUAL(0U, alert_get_active_count());
+}
+
+/* ============================================================================
+ * DEBOUNCE AND CLEARING TESTS
+ * ============================================================================ */
+
+/**
+ * @test Test onset requires consecutive exceedances
+ * @trace SRS-EHMS-200
+ */
+void test_alert_onset_debounce(void)
+{
+    set_value(&test_block, EHMS_PARAM_EGT, 960.0f);
+    
+    for (uint32_t i = 0U; i < (TEST_DEBOUNCE_CYCLES - 1U); i++)
+    {
+        (void)alert_process_block(&test_block);
+    }
+    
+    /* An in-range sample restarts the debounce */
+    set_value(&test_block, EHMS_PARAM_EGT, 700.0f);
+    (void)alert_process_block(&test_block);
+    set_value(&test_block, EHMS_PARAM_EGT, 960.0f);
+    (void)alert_process_block(&test_block);
+    
+    TEST_ASSERT_EQUAL(0U, alert_get_active_count());
+    
+    expect_alert_posts(1U);
+    process_debounced();
+    
+    TEST_ASSERT_EQUAL(1U, alert_get_active_count());
+}
+
+/**
+ * @test Test clearing requires the hysteresis margin
+ * @trace SRS-EHMS-200, SRS-EHMS-203
+ */
+void test_alert_clear_hysteresis(void)
+{
+    set_value(&test_block, EHMS_PARAM_EGT, 960.0f);
+    expect_alert_posts(1U);
+    process_debounced();
+    
+    /* Below threshold but inside the 2% hysteresis band: stays active */
+    set_value(&test_block, EHMS_PARAM_EGT, 940.0f);
+    process_debounced();
+    TEST_ASSERT_EQUAL(1U, alert_get_active_count());
+    
+    /* Below 931 (950 less 2%): clear posted and logged, slot released */
+    set_value(&test_block, EHMS_PARAM_EGT, 930.0f);
+    expect_alert_posts(1U);
+    process_debounced();
+    
+    TEST_ASSERT_EQUAL(0U, alert_get_active_count());
+    TEST_ASSERT_EQUAL(EHMS_ALERT_NONE, alert_get_highest_level());
+}
+
+/**
+ * @test Test latched warning stays until acknowledged after clearing
+ * @trace SRS-EHMS-201, SRS-EHMS-202
+ */
+void test_alert_latched_clear_acknowledge(void)
+{
+    set_value(&test_block, EHMS_PARAM_N1, 105.0f);
+    expect_alert_posts(1U);
+    process_debounced();
+    
+    set_value(&test_block, EHMS_PARAM_N1, 85.0f);
+    expect_alert_posts(1U);
+    process_debounced();
+    
+    TEST_ASSERT_EQUAL(1U, alert_get_active_count());
+    TEST_ASSERT_EQUAL(EHMS_ALERT_WARNING, alert_get_highest_level());
+    
+    (void)alert_acknowledge(EHMS_ALERT_WARNING);
+    
+    TEST_ASSERT_EQUAL(0U, alert_get_active_count());
+    TEST_ASSERT_FALSE(alert_is_master_warning());
+    TEST_ASSERT_EQUAL(EHMS_ALERT_NONE, alert_get_highest_level());
+}
+
+/**
+ * @test Test cleared slots are reused beyond EHMS_MAX_ACTIVE_ALERTS onsets
+ * @trace SRS-EHMS-200
+ */
+void test_alert_slot_reuse(void)
+{
+    for (uint32_t i = 0U; i < (2U * EHMS_MAX_ACTIVE_ALERTS); i++)
+    {
+        set_value(&test_block, EHMS_PARAM_EGT, 960.0f);
+        expect_alert_posts(1U);
+        process_debounced();
+        
+        set_value(&test_block, EHMS_PARAM_EGT, 700.0f);
+        expect_alert_posts(1U);
+        process_debounced();
+    }
+    
+    set_value(&test_block, EHMS_PARAM_EGT, 960.0f);
+    expect_alert_posts(1U);
+    process_debounced();
+    
+    TEST_ASSERT_EQUAL(1U, alert_get_active_count());
+}
+
+/**
+ * @test Test message text is rendered per engine at init
+ * @trace SRS-EHMS-200
+ */
+void test_alert_message_text(void)
+{
+    TEST_ASSERT_EQUAL_STRING("ENG 1 EGT HIGH", alert_get_message_text(0U, 0x1001U));
+    TEST_ASSERT_EQUAL_STRING("ENG 2 EGT OVERLIMIT", alert_get_message_text(1U, 0x1002U));
+    TEST_ASSERT_NULL(alert_get_message_text(0U, 0xFFFFU));
+    TEST_ASSERT_NULL(alert_get_message_text(EHMS_MAX_ENGINES, 0x1001U));
+}
+
+/* ============================================================================
+ * WARM START TESTS
+ * ============================================================================ */
+
+/**
+ * @test Test latched alerts survive a warm start and unlatched ones re-raise
+ * @trace SRS-EHMS-016, SRS-EHMS-201
+ */
+void test_alert_warm_state_round_trip(void)
+{
+    alert_warm_state_t state;
+    ehms_timestamp_t epoch = { 2026U, 10U, 14U, 9U, 0U, 0U, 0U };
+    
+    test_block.sample_time = (ehms_timestamp_t){ 2026U, 10U, 14U, 9U, 30U, 0U, 250U };
+    
+    /* A cleared warning awaiting acknowledgement and an active caution */
+    set_value(&test_block, EHMS_PARAM_N1, 105.0f);
+    expect_alert_posts(1U);
+    process_debounced();
+    set_value(&test_block, EHMS_PARAM_N1, 85.0f);
+    set_value(&test_block, EHMS_PARAM_EGT, 960.0f);
+    expect_alert_posts(2U);
+    process_debounced();
+    
+    TEST_ASSERT_EQUAL(EHMS_OK, alert_save_warm_state(&epoch, &state));
+    TEST_ASSERT_EQUAL(1U, state.alert_count);
+    TEST_ASSERT_EQUAL(EHMS_ERROR_BUSY, alert_restore_warm_state(&epoch, &state));
+    
+    /* Power interruption: the warning is restored and sent to the display only */
+    (void)alert_init();
+    TEST_ASSERT_EQUAL(EHMS_OK, alert_restore_warm_state(&epoch, &state));
+    TEST_ASSERT_EQUAL(1U, alert_get_active_count());
+    TEST_ASSERT_TRUE(alert_is_master_warning());
+    TEST_ASSERT_EQUAL(EHMS_ALERT_WARNING, alert_get_highest_level());
+    
+    /* The caution is raised again from the data, after its debounce */
+    eicas_post_message_ExpectAnyArgsAndReturn(EHMS_OK);
+    expect_alert_posts(1U);
+    process_debounced();
+    TEST_ASSERT_EQUAL(2U, alert_get_active_count());
+    
+    (void)alert_acknowledge(EHMS_ALERT_WARNING);
+    TEST_ASSERT_EQUAL(1U, alert_get_active_count());
+    TEST_ASSERT_EQUAL(EHMS_ALERT_CAUTION, alert_get_highest_level());
+}
+
+/* ============================================================================
+ * FLIGHT PHASE TESTS
+ * ============================================================================ */
+
+/**
+ * @test Test a phase change switches to the phase's threshold set
+ * @trace SRS-EHMS-200, SRS-EHMS-202
+ */
+void test_alert_phase_threshold_set(void)
+{
+    /* Takeoff: EGT caution limit is 980 */
+    test_block.flight_phase = (uint32_t)EHMS_FLIGHT_PHASE_TAKEOFF;
+    set_value(&test_block, EHMS_PARAM_EGT, 960.0f);
+    process_debounced();
+    TEST_ASSERT_EQUAL(0U, alert_get_active_count());
+    
+    set_value(&test_block, EHMS_PARAM_EGT, 990.0f);
+    expect_alert_posts(1U);
+    process_debounced();
+    TEST_ASSERT_EQUAL(1U, alert_get_active_count());
+    
+    /* Climb: takeoff caution cleared, 950 caution raised after debounce */
+    test_block.flight_phase = (uint32_t)EHMS_FLIGHT_PHASE_CLIMB;
+    expect_alert_posts(2U);
+    process_debounced();
+    
+    TEST_ASSERT_EQUAL(1U, alert_get_active_count());
+    TEST_ASSERT_EQUAL(EHMS_ALERT_CAUTION, alert_get_highest_level());
+}
+
+/**
+ * @test Test an inhibited alert is logged only until its inhibit ends
+ * @trace SRS-EHMS-202, SRS-EHMS-203
+ */
+void test_alert_phase_inhibit(void)
+{
+    /* Fan vibration caution is inhibited during takeoff */
+    test_block.flight_phase = (uint32_t)EHMS_FLIGHT_PHASE_TAKEOFF;
+    set_value(&test_block, EHMS_PARAM_VIB_FAN, 3.5f);
+    recorder_log_alert_ExpectAnyArgsAndReturn(EHMS_OK);
+    process_debounced();
+    
+    TEST_ASSERT_EQUAL(1U, alert_get_active_count());
+    TEST_ASSERT_FALSE(alert_is_master_caution());
+    
+    /* Climb: posted to EICAS once, not logged again */
+    test_block.flight_phase = (uint32_t)EHMS_FLIGHT_PHASE_CLIMB;
+    eicas_post_message_ExpectAnyArgsAndReturn(EHMS_OK);
+    (void)alert_process_block(&test_block);
+    (void)alert_dispatch_eicas(TEST_DISPATCH_ALL);
+    (void)alert_dispatch_recorder(TEST_DISPATCH_ALL);
+    
+    TEST_ASSERT_EQUAL(1U, alert_get_active_count());
+    TEST_ASSERT_TRUE(alert_is_master_caution());
+}
+
+/**
+ * @test Test clearing uses the hysteresis of the band
+ * @trace SRS-EHMS-200, SRS-EHMS-203
+ */
+void test_alert_band_hysteresis(void)
+{
+    set_value(&test_block, EHMS_PARAM_ANOMALY_SCORE, 4.2f);
+    expect_alert_posts(1U);
+    process_debounced();
+    
+    /* Anomaly advisory hysteresis is 0.5: active down to 3.5 */
+    set_value(&test_block, EHMS_PARAM_ANOMALY_SCORE, 3.6f);
+    process_debounced();
+    TEST_ASSERT_EQUAL(1U, alert_get_active_count());
+    
+    set_value(&test_block, EHMS_PARAM_ANOMALY_SCORE, 3.4f);
+    expect_alert_posts(1U);
+    process_debounced();
+    TEST_ASSERT_EQUAL(0U, alert_get_active_count());
+}
+
+/**
+ * @test Test an unknown flight phase evaluates every band uninhibited
+ * @trace SRS-EHMS-200, SRS-EHMS-202
+ */
+void test_alert_unknown_phase(void)
+{
+    test_block.flight_phase = (uint32_t)EHMS_FLIGHT_PHASE_COUNT + 2U;
+    set_value(&test_block, EHMS_PARAM_EGT, 960.0f);
+    set_value(&test_block, EHMS_PARAM_VIB_FAN, 3.5f);
+    expect_alert_posts(2U);
+    process_debounced();
+    
+    TEST_ASSERT_EQUAL(2U, alert_get_active_count());
+    TEST_ASSERT_TRUE(alert_is_master_caution());
+}
+
+/* ============================================================================
+ * BATCH EVALUATION TESTS
+ * ============================================================================ */
+
+/**
+ * @test Test batch processing with invalid arguments
+ * @trace SRS-EHMS-200
+ */
+void test_alert_process_blocks_invalid(void)
+{
+    ehms_engine_block_t blocks[2];
+    
+    blocks[0] = test_block;
+    blocks[1] = test_block;
+    
+    TEST_ASSERT_EQUAL(EHMS_ERROR_PARAM, alert_process_blocks(NULL, 1U));
+    TEST_ASSERT_EQUAL(EHMS_ERROR_PARAM, alert_process_snapshots(NULL, 1U));
+    TEST_ASSERT_EQUAL(EHMS_ERROR_RANGE, alert_process_blocks(blocks, EHMS_MAX_ENGINES + 1U));
+    TEST_ASSERT_EQUAL(EHMS_OK, alert_process_blocks(blocks, 0U));
+    
+    /* Repeated engine */
+    TEST_ASSERT_EQUAL(EHMS_ERROR_PARAM, alert_process_blocks(blocks, 2U));
+    
+    blocks[1].engine_id = (ehms_engine_id_t)EHMS_MAX_ENGINES;
+    TEST_ASSERT_EQUAL(EHMS_ERROR_RANGE, alert_process_blocks(blocks, 2U));
+}
+
+/**
+ * @test Test batch raises the same alerts as per-engine processing
+ * @trace SRS-EHMS-200, SRS-EHMS-201
+ */
+void test_alert_process_blocks_per_engine(void)
+{
+    ehms_engine_block_t blocks[2];
+    
+    blocks[0] = test_block;
+    blocks[1] = test_block;
+    blocks[1].engine_id = EHMS_ENGINE_2;
+    
+    /* Engine 1 EGT caution and warning, engine 2 oil pressure caution */
+    set_value(&blocks[0], EHMS_PARAM_EGT, 1010.0f);
+    set_value(&blocks[1], EHMS_PARAM_OIL_PRESS, 20.0f);
+    
+    for (uint32_t i = 0U; i < TEST_DEBOUNCE_CYCLES; i++)
+    {
+        TEST_ASSERT_EQUAL(EHMS_OK, alert_process_blocks(blocks, 2U));
+    }
+    
+    TEST_ASSERT_EQUAL(3U, alert_get_active_count());
+    TEST_ASSERT_EQUAL(EHMS_ALERT_WARNING, alert_get_highest_level());
+    TEST_ASSERT_TRUE(alert_is_master_warning());
+    TEST_ASSERT_TRUE(alert_is_master_caution());
+    
+    expect_alert_posts(3U);
+    TEST_ASSERT_EQUAL(3U, alert_dispatch_eicas(TEST_DISPATCH_ALL));
+    TEST_ASSERT_EQUAL(3U, alert_dispatch_recorder(TEST_DISPATCH_ALL));
+}
+
+/**
+ * @test Test batch engines in different flight phases use their own sets
+ * @trace SRS-EHMS-200, SRS-EHMS-202
+ */
+void test_alert_process_blocks_mixed_phases(void)
+{
+    ehms_engine_block_t blocks[2];
+    
+    blocks[0] = test_block;
+    blocks[1] = test_block;
+    blocks[1].engine_id = EHMS_ENGINE_2;
+    
+    /* EGT 960: below the takeoff caution limit only */
+    blocks[0].flight_phase = (uint32_t)EHMS_FLIGHT_PHASE_TAKEOFF;
+    blocks[1].flight_phase = (uint32_t)EHMS_FLIGHT_PHASE_CRUISE;
+    set_value(&blocks[0], EHMS_PARAM_EGT, 960.0f);
+    set_value(&blocks[1], EHMS_PARAM_EGT, 960.0f);
+    
+    for (uint32_t i = 0U; i < TEST_DEBOUNCE_CYCLES; i++)
+    {
+        TEST_ASSERT_EQUAL(EHMS_OK, alert_process_blocks(blocks, 2U));
+    }
+    
+    TEST_ASSERT_EQUAL(1U, alert_get_active_count());
+    
+    expect_alert_posts(1U);
+    TEST_ASSERT_EQUAL(1U, alert_dispatch_eicas(TEST_DISPATCH_ALL));
+    TEST_ASSERT_EQUAL(1U, alert_dispatch_recorder(TEST_DISPATCH_ALL));
+}
+
+/* ============================================================================
+ * EVENT QUEUE TESTS
+ * ============================================================================ */
+
+/**
+ * @test Test alert events are delivered only when each consumer dispatches
+ * @trace SRS-EHMS-200, SRS-EHMS-201
+ */
+void test_alert_events_queued_until_dispatch(void)
+{
+    alert_queue_statistics_t stats;
+    
+    set_value(&test_block, EHMS_PARAM_EGT, 960.0f);
+    process_queued();
+    
+    TEST_ASSERT_EQUAL(1U, alert_get_active_count());
+    TEST_ASSERT_EQUAL(EHMS_OK, alert_get_queue_statistics(&stats));
+    TEST_ASSERT_EQUAL(1U, stats.eicas.pending);
+    TEST_ASSERT_EQUAL(1U, stats.recorder.pending);
+    
+    eicas_post_message_ExpectAnyArgsAndReturn(EHMS_OK);
+    TEST_ASSERT_EQUAL(1U, alert_dispatch_eicas(TEST_DISPATCH_ALL));
+    TEST_ASSERT_EQUAL(0U, alert_dispatch_eicas(TEST_DISPATCH_ALL));
+    
+    TEST_ASSERT_EQUAL(EHMS_OK, alert_get_queue_statistics(&stats));
+    TEST_ASSERT_EQUAL(0U, stats.eicas.pending);
+    TEST_ASSERT_EQUAL(1U, stats.eicas.delivered);
+    TEST_ASSERT_EQUAL(1U, stats.recorder.pending);
+    
+    recorder_log_alert_ExpectAnyArgsAndReturn(EHMS_OK);
+    TEST_ASSERT_EQUAL(1U, alert_dispatch_recorder(TEST_DISPATCH_ALL));
+}
+
+/**
+ * @test Test dispatch delivers at most the requested batch
+ * @trace SRS-EHMS-201
+ */
+void test_alert_dispatch_batch_limit(void)
+{
+    alert_queue_statistics_t stats;
+    
+    set_value(&test_block, EHMS_PARAM_OIL_PRESS, 10.0f);
+    process_queued();
+    
+    eicas_post_message_ExpectAnyArgsAndReturn(EHMS_OK);
+    TEST_ASSERT_EQUAL(1U, alert_dispatch_eicas(1U));
+    
+    TEST_ASSERT_EQUAL(EHMS_OK, alert_get_queue_statistics(&stats));
+    TEST_ASSERT_EQUAL(1U, stats.eicas.pending);
+    /* Caution and warning are held in separate priority rings */
+    TEST_ASSERT_EQUAL(1U, stats.eicas.high_water);
+    
+    expect_alert_posts(1U);
+    recorder_log_alert_ExpectAnyArgsAndReturn(EHMS_OK);
+    TEST_ASSERT_EQUAL(1U, alert_dispatch_eicas(TEST_DISPATCH_ALL));
+    TEST_ASSERT_EQUAL(2U, alert_dispatch_recorder(TEST_DISPATCH_ALL));
+}
+
+/**
+ * @test Test a full queue drops and counts new events
+ * @trace SRS-EHMS-201
+ */
+void test_alert_queue_overflow(void)
+{
+    alert_queue_statistics_t stats;
+    
+    /* Onset and clear of one caution per iteration, never dispatched */
+    for (uint32_t i = 0U; i < ((TEST_QUEUE_SIZE / 2U) + 1U); i++)
+    {
+        set_value(&test_block, EHMS_PARAM_EGT, 960.0f);
+        process_queued();
+        set_value(&test_block, EHMS_PARAM_EGT, 700.0f);
+        process_queued();
+    }
+    
+    TEST_ASSERT_EQUAL(EHMS_OK, alert_get_queue_statistics(&stats));
+    TEST_ASSERT_EQUAL(TEST_QUEUE_SIZE, stats.eicas.pending);
+    TEST_ASSERT_EQUAL(2U, stats.eicas.overflow_count);
+    TEST_ASSERT_EQUAL(2U, stats.recorder.overflow_count);
+    TEST_ASSERT_EQUAL(TEST_QUEUE_SIZE, stats.recorder.high_water);
+    
+    expect_alert_posts(TEST_QUEUE_SIZE);
+    TEST_ASSERT_EQUAL(TEST_QUEUE_SIZE, alert_dispatch_eicas(TEST_DISPATCH_ALL));
+    TEST_ASSERT_EQUAL(TEST_QUEUE_SIZE, alert_dispatch_recorder(TEST_DISPATCH_ALL));
+}
+
+/**
+ * @test Test queue statistics with NULL pointer
+ * @trace SRS-EHMS-201
+ */
+void test_alert_queue_statistics_null(void)
+{
+    TEST_ASSERT_EQUAL(EHMS_ERROR_PARAM, alert_get_queue_statistics(NULL));
+}
+
+/* ============================================================================
+ * RECORDED DATA CONTEXT TESTS
+ * ============================================================================ */
+
+/**
+ * @test Test alert context functions with NULL pointers
+ * @trace SRS-EHMS-200
+ */
+void test_alert_ctx_invalid(void)
+{
+    alert_queue_statistics_t stats;
+    ehms_alert_t event;
+    
+    TEST_ASSERT_EQUAL(EHMS_ERROR_PARAM, alert_ctx_init(NULL));
+    TEST_ASSERT_EQUAL(EHMS_ERROR_PARAM, alert_ctx_process_block(NULL, &test_block));
+    TEST_ASSERT_EQUAL(EHMS_ERROR_PARAM, alert_ctx_process_blocks(NULL, &test_block, 1U));
+    TEST_ASSERT_EQUAL(EHMS_ERROR_PARAM, alert_ctx_get_queue_statistics(NULL, &stats));
+    TEST_ASSERT_EQUAL(0U, alert_ctx_read_events(NULL, &event, 1U));
+    TEST_ASSERT_EQUAL(0U, alert_ctx_get_active_count(NULL));
+    TEST_ASSERT_EQUAL(EHMS_ALERT_NONE, alert_ctx_get_highest_level(NULL));
+    TEST_ASSERT_FALSE(alert_ctx_is_master_warning(NULL));
+}
+
+/**
+ * @test Test context events are read back, not posted, highest level first
+ * @trace SRS-EHMS-200, SRS-EHMS-201
+ */
+void test_alert_ctx_read_events(void)
+{
+    alert_context_t* ctx = malloc(alert_context_size());
+    alert_queue_statistics_t stats;
+    ehms_alert_t events[4];
+    
+    TEST_ASSERT_NOT_NULL(ctx);
+    TEST_ASSERT_EQUAL(EHMS_OK, alert_ctx_init(ctx));
+    
+    /* EGT 1000: caution and warning, neither posted to EICAS or the recorder */
+    set_value(&test_block, EHMS_PARAM_EGT, 1000.0f);
+    for (uint32_t i = 0U; i < TEST_DEBOUNCE_CYCLES; i++)
+    {
+        TEST_ASSERT_EQUAL(EHMS_OK, alert_ctx_process_block(ctx, &test_block));
+    }
+    
+    TEST_ASSERT_EQUAL(2U, alert_ctx_get_active_count(ctx));
+    TEST_ASSERT_EQUAL(EHMS_ALERT_WARNING, alert_ctx_get_highest_level(ctx));
+    TEST_ASSERT_TRUE(alert_ctx_is_master_warning(ctx));
+    
+    TEST_ASSERT_EQUAL(2U, alert_ctx_read_events(ctx, events, 4U));
+    TEST_ASSERT_EQUAL(EHMS_ALERT_WARNING, events[0].level);
+    TEST_ASSERT_EQUAL(EHMS_ALERT_CAUTION, events[1].level);
+    TEST_ASSERT_TRUE(events[0].is_active);
+    TEST_ASSERT_EQUAL(0U, alert_ctx_read_events(ctx, events, 4U));
+    
+    TEST_ASSERT_EQUAL(EHMS_OK, alert_ctx_get_queue_statistics(ctx, &stats));
+    TEST_ASSERT_EQUAL(0U, stats.eicas.delivered);
+    TEST_ASSERT_EQUAL(2U, stats.recorder.delivered);
+    
+    /* Onboard state untouched */
+    TEST_ASSERT_EQUAL(0U, alert_get_active_count());
+    
+    free(ctx);
+}
+
+/**
+ * @test Test alert contexts do not share state
+ * @trace SRS-EHMS-200
+ */
+void test_alert_ctx_independent(void)
+{
+    alert_context_t* high = malloc(alert_context_size());
+    alert_context_t* nominal = malloc(alert_context_size());
+    ehms_engine_block_t nominal_block = test_block;
+    
+    TEST_ASSERT_NOT_NULL(high);
+    TEST_ASSERT_NOT_NULL(nominal);
+    TEST_ASSERT_EQUAL(EHMS_OK, alert_ctx_init(high));
+    TEST_ASSERT_EQUAL(EHMS_OK, alert_ctx_init(nominal));
+    
+    set_value(&test_block, EHMS_PARAM_EGT, 950.0f);
+    for (uint32_t i = 0U; i < TEST_DEBOUNCE_CYCLES; i++)
+    {
+        (void)alert_ctx_process_block(high, &test_block);
+        (void)alert_ctx_process_block(nominal, &nominal_block);
+    }
+    
+    TEST_ASSERT_EQUAL(1U, alert_ctx_get_active_count(high));
+    TEST_ASSERT_TRUE(alert_ctx_is_master_caution(high));
+    TEST_ASSERT_EQUAL(0U, alert_ctx_get_active_count(nominal));
+    TEST_ASSERT_FALSE(alert_ctx_is_master_caution(nominal));
+    
+    free(high);
+    free(nominal);
+}
+
+/* ============================================================================
+ * TEST RUNNER
+ * ============================================================================ */
+
+int main(void)
+{
+    UNITY_BEGIN();
+    
+    /* Input validation tests */
+    RUN_TEST(test_alert_process_block_invalid);
+    
+    /* Threshold evaluation tests */
+    RUN_TEST(test_alert_nominal_no_alert);
+    RUN_TEST(test_alert_high_limit_bands);
+    RUN_TEST(test_alert_low_limit_bands);
+    RUN_TEST(test_alert_anomaly_advisory);
+    RUN_TEST(test_alert_active_per_engine);
+    RUN_TEST(test_alert_invalid_data_ignored);
+    
+    /* Debounce and clearing tests */
+    RUN_TEST(test_alert_onset_debounce);
+    RUN_TEST(test_alert_clear_hysteresis);
+    RUN_TEST(test_alert_latched_clear_acknowledge);
+    RUN_TEST(test_alert_slot_reuse);
+    
+    /* Message text tests */
+    RUN_TEST(test_alert_message_text);
+    
+    /* Warm start tests */
+    RUN_TEST(test_alert_warm_state_round_trip);
+    
+    /* Flight phase tests */
+    RUN_TEST(test_alert_phase_threshold_set);
+    RUN_TEST(test_alert_phase_inhibit);
+    RUN_TEST(test_alert_band_hysteresis);
+    RUN_TEST(test_alert_unknown_phase);
+    
+    /* Batch evaluation tests */
+    RUN_TEST(test_alert_process_blocks_invalid);
+    RUN_TEST(test_alert_process_blocks_per_engine);
+    RUN_TEST(test_alert_process_blocks_mixed_phases);
+    
+    /* Event queue tests */
+    RUN_TEST(test_alert_events_queued_until_dispatch);
+    RUN_TEST(test_alert_dispatch_batch_limit);
+    RUN_TEST(test_alert_queue_overflow);
+    RUN_TEST(test_alert_queue_statistics_null);
+    
+    /* Recorded data context tests */
+    RUN_TEST(test_alert_ctx_invalid);
+    RUN_TEST(test_alert_ctx_read_events);
+    RUN_TEST(test_alert_ctx_independent);
+    
+    return UNITY_END();
+}
+
+/* END OF FILE */
@@ -0,0 +1,245 @@
+/**
+ * @file test_anomaly_detection.c
+ * @brief Unit Tests for Multivariate Engine Anomaly Detection
+ *
+ * @copyright Copyright (c) 2026 AeroTech Avionics Inc.
+ *
+ * Test Framework: Unity Test Framework
+ * Coverage Target: 100% MC/DC
+ *
+ * Requirements Verified:
+ *   SRS-EHMS-035, SRS-EHMS-062
+ */
+
+#include "unity.h"
+#include "anomaly_detection.h"
+#include "ehms_types.h"
+
+#include <math.h>
+#include <string.h>
+
+/* ============================================================================
+ * TEST FIXTURES
+ * ============================================================================ */
+
+#define TEST_PHASE              3U
+#define TEST_SMOOTHING          0.25f
+
+/** @brief Baseline standard deviations of N1, N2, EGT and FF */
+static const float test_sigma[ANOMALY_FEATURE_COUNT] = { 0.5f, 0.4f, 8.0f, 40.0f };
+
+static const float test_mean[ANOMALY_FEATURE_COUNT] = { 85.0f, 92.0f, 640.0f, 2400.0f };
+
+static anomaly_model_t test_model;
+static float test_features[ANOMALY_FEATURE_COUNT];
+static anomaly_result_t test_result;
+
+/**
+ * @brief Offset a feature by a number of standard deviations from the mean
+ */
+static void set_deviation(anomaly_feature_t feature, float sigmas)
+{
+    test_features[feature] = test_mean[feature] + (sigmas * test_sigma[feature]);
+}
+
+static ehms_result_t evaluate(void)
+{
+    return anomaly_evaluate(EHMS_ENGINE_2, TEST_PHASE, test_features, true, &test_result);
+}
+
+void setUp(void)
+{
+    anomaly_baseline_t* baseline = &test_model.phase[TEST_PHASE];
+    
+    /* One phase baseline, uncorrelated features */
+    (void)memset(&test_model, 0, sizeof(test_model));
+    test_model.smoothing = TEST_SMOOTHING;
+    baseline->defined = true;
+    
+    for (uint32_t f = 0U; f < ANOMALY_FEATURE_COUNT; f++)
+    {
+        baseline->mean[f] = test_mean[f];
+        baseline->whiten[ANOMALY_WHITEN_INDEX(f, f)] = 1.0f / test_sigma[f];
+        test_features[f] = test_mean[f];
+    }
+    
+    (void)anomaly_init(&test_model);
+}
+
+void tearDown(void)
+{
+}
+
+/* ============================================================================
+ * SCORING TESTS
+ * ============================================================================ */
+
+/**
+ * @test Test an engine on its baseline scores zero with normal health
+ * @trace SRS-EHMS-062
+ */
+void test_anomaly_baseline_scores_zero(void)
+{
+    TEST_ASSERT_EQUAL(EHMS_OK, evaluate());
+    
+    TEST_ASSERT_EQUAL(EHMS_PARAM_VALID, test_result.status);
+    TEST_ASSERT_FLOAT_WITHIN(1.0e-4f, 0.0f, test_result.score);
+    TEST_ASSERT_EQUAL(EHMS_HEALTH_NORMAL, test_result.health);
+}
+
+/**
+ * @test Test correlation in the baseline weighs deviations by direction
+ * @trace SRS-EHMS-062
+ */
+void test_anomaly_correlated_distance(void)
+{
+    anomaly_baseline_t* baseline = &test_model.phase[TEST_PHASE];
+    
+    /* N1 and N2 unit variance with correlation 0.8: L^T L = inverse covariance */
+    baseline->whiten[ANOMALY_WHITEN_INDEX(0U, 0U)] = 1.0f;
+    baseline->whiten[ANOMALY_WHITEN_INDEX(1U, 0U)] = -4.0f / 3.0f;
+    baseline->whiten[ANOMALY_WHITEN_INDEX(1U, 1U)] = 5.0f / 3.0f;
+    TEST_ASSERT_EQUAL(EHMS_OK, anomaly_init(&test_model));
+    
+    /* Along the correlation: d^2 = 0.4 / 0.36 */
+    test_features[ANOMALY_FEATURE_N1] = test_mean[ANOMALY_FEATURE_N1] + 1.0f;
+    test_features[ANOMALY_FEATURE_N2] = test_mean[ANOMALY_FEATURE_N2] + 1.0f;
+    TEST_ASSERT_EQUAL(EHMS_OK, evaluate());
+    TEST_ASSERT_FLOAT_WITHIN(1.0e-4f, sqrtf(0.4f / 0.36f), test_result.distance);
+    
+    /* Against it: d^2 = 3.6 / 0.36 */
+    test_features[ANOMALY_FEATURE_N2] = test_mean[ANOMALY_FEATURE_N2] - 1.0f;
+    TEST_ASSERT_EQUAL(EHMS_OK, evaluate());
+    TEST_ASSERT_FLOAT_WITHIN(1.0e-4f, sqrtf(10.0f), test_result.distance);
+}
+
+/**
+ * @test Test the smoothed score rises through the health limits
+ * @trace SRS-EHMS-035
+ */
+void test_anomaly_smoothed_health(void)
+{
+    TEST_ASSERT_EQUAL(EHMS_OK, evaluate());
+    
+    /* EGT 5 sigma high: a single cycle does not reach the advisory score */
+    set_deviation(ANOMALY_FEATURE_EGT, 5.0f);
+    TEST_ASSERT_EQUAL(EHMS_OK, evaluate());
+    TEST_ASSERT_FLOAT_WITHIN(1.0e-3f, 5.0f, test_result.distance);
+    TEST_ASSERT_FLOAT_WITHIN(1.0e-3f, sqrtf(TEST_SMOOTHING * 25.0f), test_result.score);
+    TEST_ASSERT_EQUAL(EHMS_HEALTH_NORMAL, test_result.health);
+    
+    TEST_ASSERT_EQUAL(EHMS_OK, evaluate());
+    TEST_ASSERT_EQUAL(EHMS_HEALTH_MONITOR, test_result.health);
+    
+    for (uint32_t i = 0U; i < 10U; i++)
+    {
+        TEST_ASSERT_EQUAL(EHMS_OK, evaluate());
+    }
+    
+    TEST_ASSERT_TRUE(test_result.score >= ANOMALY_ADVISORY_SCORE);
+    TEST_ASSERT_EQUAL(EHMS_HEALTH_CAUTION, test_result.health);
+}
+
+/**
+ * @test Test unassessable cycles are NCD and restart the filter
+ * @trace SRS-EHMS-062
+ */
+void test_anomaly_not_assessed(void)
+{
+    set_deviation(ANOMALY_FEATURE_FF, 5.0f);
+    TEST_ASSERT_EQUAL(EHMS_OK, evaluate());
+    
+    TEST_ASSERT_EQUAL(EHMS_OK, anomaly_evaluate(EHMS_ENGINE_2, TEST_PHASE, test_features,
+                                                false, &test_result));
+    TEST_ASSERT_EQUAL(EHMS_PARAM_NCD, test_result.status);
+    TEST_ASSERT_EQUAL(EHMS_HEALTH_NORMAL, test_result.health);
+    
+    /* Phase without a baseline, and a phase beyond the table */
+    TEST_ASSERT_EQUAL(EHMS_OK, anomaly_evaluate(EHMS_ENGINE_2, TEST_PHASE + 1U, test_features,
+                                                true, &test_result));
+    TEST_ASSERT_EQUAL(EHMS_PARAM_NCD, test_result.status);
+    TEST_ASSERT_EQUAL(EHMS_OK, anomaly_evaluate(EHMS_ENGINE_2, ANOMALY_PHASE_COUNT,
+                                                test_features, true, &test_result));
+    TEST_ASSERT_EQUAL(EHMS_PARAM_NCD, test_result.status);
+    
+    /* Restarted filter starts from the current cycle */
+    set_deviation(ANOMALY_FEATURE_FF, 1.0f);
+    TEST_ASSERT_EQUAL(EHMS_OK, evaluate());
+    TEST_ASSERT_FLOAT_WITHIN(1.0e-3f, 1.0f, test_result.score);
+}
+
+/**
+ * @test Test snapshots are scored from their parameters and validity
+ * @trace SRS-EHMS-062
+ */
+void test_anomaly_evaluate_snapshot(void)
+{
+    ehms_engine_snapshot_t snapshot;
+    
+    (void)memset(&snapshot, 0, sizeof(snapshot));
+    snapshot.engine_id = EHMS_ENGINE_2;
+    snapshot.flight_phase = TEST_PHASE;
+    set_deviation(ANOMALY_FEATURE_N2, 2.0f);
+    
+    for (uint32_t f = 0U; f < ANOMALY_FEATURE_COUNT; f++)
+    {
+        snapshot.parameters[f].eng_value = test_features[f];
+    }
+    
+    TEST_ASSERT_EQUAL(EHMS_OK, anomaly_evaluate_snapshot(&snapshot, &test_result));
+    TEST_ASSERT_EQUAL(EHMS_PARAM_VALID, test_result.status);
+    TEST_ASSERT_FLOAT_WITHIN(1.0e-3f, 2.0f, test_result.distance);
+    
+    snapshot.parameters[EHMS_PARAM_EGT].status = EHMS_PARAM_STALE;
+    TEST_ASSERT_EQUAL(EHMS_OK, anomaly_evaluate_snapshot(&snapshot, &test_result));
+    TEST_ASSERT_EQUAL(EHMS_PARAM_NCD, test_result.status);
+}
+
+/* ============================================================================
+ * CONFIGURATION TESTS
+ * ============================================================================ */
+
+/**
+ * @test Test invalid models and arguments are rejected
+ * @trace SRS-EHMS-062
+ */
+void test_anomaly_invalid_arguments(void)
+{
+    TEST_ASSERT_EQUAL(EHMS_ERROR_PARAM, anomaly_init(NULL));
+    
+    test_model.phase[TEST_PHASE].whiten[ANOMALY_WHITEN_INDEX(2U, 2U)] = 0.0f;
+    TEST_ASSERT_EQUAL(EHMS_ERROR_CONFIG, anomaly_init(&test_model));
+    
+    test_model.phase[TEST_PHASE].defined = false;
+    test_model.smoothing = 0.0f;
+    TEST_ASSERT_EQUAL(EHMS_ERROR_CONFIG, anomaly_init(&test_model));
+    
+    TEST_ASSERT_EQUAL(EHMS_ERROR_PARAM, anomaly_evaluate(EHMS_ENGINE_1, TEST_PHASE, NULL,
+                                                         true, &test_result));
+    TEST_ASSERT_EQUAL(EHMS_ERROR_RANGE, anomaly_evaluate(EHMS_ENGINE_COUNT, TEST_PHASE,
+                                                         test_features, true, &test_result));
+    TEST_ASSERT_EQUAL(EHMS_ERROR_PARAM, anomaly_evaluate_snapshot(NULL, &test_result));
+}
+
+/* ============================================================================
+ * TEST RUNNER
+ * ============================================================================ */
+
+int main(void)
+{
+    UNITY_BEGIN();
+    
+    /* Scoring tests */
+    RUN_TEST(test_anomaly_baseline_scores_zero);
+    RUN_TEST(test_anomaly_correlated_distance);
+    RUN_TEST(test_anomaly_smoothed_health);
+    RUN_TEST(test_anomaly_not_assessed);
+    RUN_TEST(test_anomaly_evaluate_snapshot);
+    
+    /* Configuration tests */
+    RUN_TEST(test_anomaly_invalid_arguments);
+    
+    return UNITY_END();
+}
+
+/* END OF FILE */
@@ -0,0 +1,134 @@
+/**
+ * @file test_arinc429_decode.c
+ * @brief Unit Tests for ARINC 429 BNR and BCD Data Field Decoding
+ *
+ * @copyright Copyright (c) 2026 AeroTech Avionics Inc.
+ *
+ * Test Framework: Unity Test Framework
+ * Coverage Target: 100% MC/DC
+ *
+ * Requirements Verified:
+ *   SRS-EHMS-100, SRS-EHMS-101
+ */
+
+#include "unity.h"
+#include "arinc429_decode.h"
+#include "ehms_types.h"
+
+/* ============================================================================
+ * TEST FIXTURES
+ * ============================================================================ */
+
+/** @brief Data field sign bit (word bit 29) */
+#define TEST_BNR_SIGN           (1L << 18)
+
+/** @brief SSM of a positive BCD value */
+#define TEST_SSM_BCD_PLUS       0U
+
+void setUp(void)
+{
+}
+
+void tearDown(void)
+{
+}
+
+/* ============================================================================
+ * BNR TESTS
+ * ============================================================================ */
+
+/**
+ * @test Test a full-width BNR field decodes as a signed 19-bit value
+ * @trace SRS-EHMS-100
+ */
+void test_bnr_full_width(void)
+{
+    TEST_ASSERT_EQUAL_INT32(850, arinc429_decode_bnr(850, 18U));
+    TEST_ASSERT_EQUAL_INT32(-5, arinc429_decode_bnr((int32_t)(TEST_BNR_SIGN * 2L) - 5, 18U));
+    TEST_ASSERT_EQUAL_INT32(-(1L << 18), arinc429_decode_bnr((int32_t)TEST_BNR_SIGN, 18U));
+    
+    /* Data sign-extended by the driver decodes the same */
+    TEST_ASSERT_EQUAL_INT32(-5, arinc429_decode_bnr(-5, 18U));
+}
+
+/**
+ * @test Test a BNR field with fewer significant bits ignores the pad bits
+ * @trace SRS-EHMS-100
+ */
+void test_bnr_reduced_width(void)
+{
+    /* 8 significant bits in data bits 10-17, pad in bits 0-9 */
+    TEST_ASSERT_EQUAL_INT32(100, arinc429_decode_bnr((100L << 10) | 0x3FFL, 8U));
+    TEST_ASSERT_EQUAL_INT32(-1, arinc429_decode_bnr((int32_t)(TEST_BNR_SIGN | (0xFFL << 10)), 8U));
+    TEST_ASSERT_EQUAL_INT32(-256, arinc429_decode_bnr((int32_t)TEST_BNR_SIGN, 8U));
+}
+
+/* ============================================================================
+ * BCD TESTS
+ * ============================================================================ */
+
+/**
+ * @test Test five BCD digits decode with the sign from the SSM
+ * @trace SRS-EHMS-100
+ */
+void test_bcd_five_digits(void)
+{
+    int32_t counts = 0;
+    
+    TEST_ASSERT_TRUE(arinc429_decode_bcd(0x24000, TEST_SSM_BCD_PLUS, 5U, &counts));
+    TEST_ASSERT_EQUAL_INT32(24000, counts);
+    
+    TEST_ASSERT_TRUE(arinc429_decode_bcd(0x79999, ARINC429_SSM_BCD_MINUS, 5U, &counts));
+    TEST_ASSERT_EQUAL_INT32(-79999, counts);
+}
+
+/**
+ * @test Test fewer BCD digits ignore the pad bits below them
+ * @trace SRS-EHMS-100
+ */
+void test_bcd_reduced_digits(void)
+{
+    int32_t counts = 0;
+    
+    /* Three digits in data bits 8-18, pad in bits 0-7 */
+    TEST_ASSERT_TRUE(arinc429_decode_bcd(0x125FF, TEST_SSM_BCD_PLUS, 3U, &counts));
+    TEST_ASSERT_EQUAL_INT32(125, counts);
+}
+
+/**
+ * @test Test a non-decimal BCD digit is rejected
+ * @trace SRS-EHMS-101
+ */
+void test_bcd_invalid_digit(void)
+{
+    int32_t counts = 42;
+    
+    TEST_ASSERT_FALSE(arinc429_decode_bcd(0x12A45, TEST_SSM_BCD_PLUS, 5U, &counts));
+    TEST_ASSERT_EQUAL_INT32(42, counts);
+    
+    /* A pad nibble is not a digit */
+    TEST_ASSERT_TRUE(arinc429_decode_bcd(0x1234F, TEST_SSM_BCD_PLUS, 4U, &counts));
+    TEST_ASSERT_EQUAL_INT32(1234, counts);
+}
+
+/* ============================================================================
+ * TEST RUNNER
+ * ============================================================================ */
+
+int main(void)
+{
+    UNITY_BEGIN();
+    
+    /* BNR tests */
+    RUN_TEST(test_bnr_full_width);
+    RUN_TEST(test_bnr_reduced_width);
+    
+    /* BCD tests */
+    RUN_TEST(test_bcd_five_digits);
+    RUN_TEST(test_bcd_reduced_digits);
+    RUN_TEST(test_bcd_invalid_digit);
+    
+    return UNITY_END();
+}
+
+/* END OF FILE */
@@ -14,17 +14,124 @@
 
 #include "unity.h"
 #include "data_acquisition.h"
+#include "data_acquisition_ext.h"
 #include "ehms_types.h"
 #include "mock_arinc429_driver.h"
 #include "mock_milstd1553_driver.h"
 #include "mock_system_services.h"
+#include "mock_ehms_timebase.h"
+#include "ehms_crc32.h"
+#if defined(DAQ_ANOMALY_DETECTION)
+#include "anomaly_detection.h"
+#endif
+
+#include <stdlib.h>
+#include <string.h>
 
 /* ============================================================================
  * TEST FIXTURES
  * ============================================================================ */
 
+/** @brief Failing cycles that mark a source inactive (DAQ_MAX_CONSECUTIVE_FAILURES reads) */
+#define TEST_SOURCE_FAIL_CYCLES     5U
+
 static daq_config_t test_config;
 
+/**
+ * @brief Run one acquisition cycle with every ARINC 429 read timing out
+ */
+static void run_quiet_cycle(uint32_t time_ms)
+{
+    system_get_time_ms_ExpectAndReturn(time_ms);
+    arinc429_read_IgnoreAndReturn(EHMS_ERROR_TIMEOUT);
+    (void)daq_execute_cycle();
+}
+
+/** @brief Result of every read on each bus, for fake_arinc429_read */
+static ehms_result_t fake_bus_result[EHMS_ARINC429_BUS_COUNT];
+
+/** @brief Label that fails on each bus whatever its result (0: none) */
+static uint32_t fake_bus_failed_label[EHMS_ARINC429_BUS_COUNT];
+
+/** @brief SSM of every word fake_arinc429_read returns */
+static uint32_t fake_word_ssm;
+
+/** @brief Data field of every word fake_arinc429_read returns */
+static int32_t fake_word_data;
+
+/** @brief Reads made on each bus since the last run_fake_bus_cycle */
+static uint32_t fake_bus_reads[EHMS_ARINC429_BUS_COUNT];
+
+/**
+ * @brief ARINC 429 read callback answering each bus from fake_bus_result
+ */
+static ehms_result_t fake_arinc429_read(uint8_t bus, uint32_t label,
+                                        arinc429_word_t* word, int num_calls)
+{
+    ehms_result_t result = fake_bus_result[bus];
+    
+    (void)num_calls;
+    fake_bus_reads[bus]++;
+    
+    if (label == fake_bus_failed_label[bus])
+    {
+        result = EHMS_ERROR_HARDWARE;
+    }
+    
+    if (result == EHMS_OK)
+    {
+        word->label = label;
+        word->data = fake_word_data;
+        word->ssm = fake_word_ssm;
+    }
+    
+    return result;
+}
+
+/**
+ * @brief Run one acquisition cycle against fake_arinc429_read
+ */
+static void run_fake_bus_cycle(uint32_t time_ms)
+{
+    (void)memset(fake_bus_reads, 0, sizeof(fake_bus_reads));
+    system_get_time_ms_ExpectAndReturn(time_ms);
+    (void)daq_execute_cycle();
+}
+
+/**
+ * @brief Initialize the module with every bus answering, one bus failed
+ *
+ * Every read on the failed bus fails for cycles 1 .. TEST_SOURCE_FAIL_CYCLES
+ * (time 1010 ms on, 10 ms apart), marking it inactive; the bus then
+ * answers again. EHMS_ARINC429_BUS_COUNT leaves every bus active and runs
+ * no cycle.
+ */
+static void init_with_failed_source(uint8_t failed_bus)
+{
+    for (uint8_t i = 0; i < EHMS_ARINC429_BUS_COUNT; i++)
+    {
+        arinc429_init_ExpectAndReturn(i, test_config.arinc_config[i], EHMS_OK);
+        fake_bus_result[i] = EHMS_OK;
+        fake_bus_failed_label[i] = 0U;
+    }
+    fake_word_ssm = SSM_NORMAL;
+    fake_word_data = 850;
+    milstd1553_init_ExpectAndReturn(EHMS_1553_RT_ADDRESS, EHMS_OK);
+    (void)daq_init(&test_config);
+    
+    arinc429_read_StubWithCallback(fake_arinc429_read);
+    
+    if (failed_bus < EHMS_ARINC429_BUS_COUNT)
+    {
+        fake_bus_result[failed_bus] = EHMS_ERROR_HARDWARE;
+        for (uint32_t cycle = 1U; cycle <= TEST_SOURCE_FAIL_CYCLES; cycle++)
+        {
+            run_fake_bus_cycle(1000U + (cycle * 10U));
+        }
+        fake_bus_result[failed_bus] = EHMS_OK;
+    }
+}
+
 void setUp(void)
 {
     /* Initialize test configuration */
@@ -41,6 +148,12 @@ void setUp(void)
     mock_arinc429_driver_Init();
     mock_milstd1553_driver_Init();
     mock_system_services_Init();
+    mock_ehms_timebase_Init();
+    
+    /* Timebase: free-running 1 GHz counter, not under test */
+    ehms_timebase_init_Ignore();
+    ehms_timebase_read_IgnoreAndReturn(0U);
+    ehms_timebase_hz_IgnoreAndReturn(1000000000UL);
 }
 
 void tearDown(void)
@@ -49,11 +162,13 @@ void tearDown(void)
     mock_arinc429_driver_Verify();
     mock_milstd1553_driver_Verify();
     mock_system_services_Verify();
+    mock_ehms_timebase_Verify();
     
     /* Destroy mocks */
     mock_arinc429_driver_Destroy();
     mock_milstd1553_driver_Destroy();
     mock_system_services_Destroy();
+    mock_ehms_timebase_Destroy();
 }
 
 /* ============================================================================
@@ -181,6 +296,125 @@ void test_daq_execute_cycle_success(void)
     TEST_ASSERT_EQUAL(EHMS_OK, result);
 }
 
+/**
+ * @test Test the flight phase input is latched per engine at the next cycle
+ * @trace SRS-EHMS-202
+ */
+void test_daq_flight_phase_latched_per_cycle(void)
+{
+    ehms_engine_snapshot_t snapshot;
+    
+    for (uint8_t i = 0; i < EHMS_ARINC429_BUS_COUNT; i++)
+    {
+        arinc429_init_ExpectAndReturn(i, test_config.arinc_config[i], EHMS_OK);
+    }
+    milstd1553_init_ExpectAndReturn(EHMS_1553_RT_ADDRESS, EHMS_OK);
+    (void)daq_init(&test_config);
+    
+    TEST_ASSERT_EQUAL(EHMS_ERROR_RANGE, 
+                      daq_set_flight_phase(EHMS_ENGINE_COUNT, EHMS_FLIGHT_PHASE_CRUISE));
+    TEST_ASSERT_EQUAL(EHMS_ERROR_RANGE, 
+                      daq_set_flight_phase(EHMS_ENGINE_1, EHMS_FLIGHT_PHASE_COUNT));
+    
+    /* GROUND until first set */
+    run_quiet_cycle(1000U);
+    TEST_ASSERT_EQUAL(EHMS_OK, daq_get_engine_snapshot(EHMS_ENGINE_2, &snapshot));
+    TEST_ASSERT_EQUAL(EHMS_FLIGHT_PHASE_GROUND, snapshot.flight_phase);
+    
+    /* Published by the next cycle, not before */
+    TEST_ASSERT_EQUAL(EHMS_OK, daq_set_flight_phase(EHMS_ENGINE_2, EHMS_FLIGHT_PHASE_TAKEOFF));
+    TEST_ASSERT_EQUAL(EHMS_OK, daq_get_engine_snapshot(EHMS_ENGINE_2, &snapshot));
+    TEST_ASSERT_EQUAL(EHMS_FLIGHT_PHASE_GROUND, snapshot.flight_phase);
+    
+    run_quiet_cycle(1010U);
+    TEST_ASSERT_EQUAL(EHMS_OK, daq_get_engine_snapshot(EHMS_ENGINE_2, &snapshot));
+    TEST_ASSERT_EQUAL(EHMS_FLIGHT_PHASE_TAKEOFF, snapshot.flight_phase);
+    TEST_ASSERT_EQUAL_HEX32(
+        ehms_crc32_calculate(&snapshot, sizeof(snapshot) - sizeof(uint32_t)),
+        snapshot.crc32);
+    
+    /* Each engine has its own phase */
+    TEST_ASSERT_EQUAL(EHMS_OK, daq_get_engine_snapshot(EHMS_ENGINE_1, &snapshot));
+    TEST_ASSERT_EQUAL(EHMS_FLIGHT_PHASE_GROUND, snapshot.flight_phase);
+    
+    /* daq_init starts again from GROUND */
+    for (uint8_t i = 0; i < EHMS_ARINC429_BUS_COUNT; i++)
+    {
+        arinc429_init_ExpectAndReturn(i, test_config.arinc_config[i], EHMS_OK);
+    }
+    milstd1553_init_ExpectAndReturn(EHMS_1553_RT_ADDRESS, EHMS_OK);
+    (void)daq_init(&test_config);
+    
+    run_quiet_cycle(1020U);
+    TEST_ASSERT_EQUAL(EHMS_OK, daq_get_engine_snapshot(EHMS_ENGINE_2, &snapshot));
+    TEST_ASSERT_EQUAL(EHMS_FLIGHT_PHASE_GROUND, snapshot.flight_phase);
+}
+
+#if defined(DAQ_ANOMALY_DETECTION)
+/**
+ * @test Test the anomaly score uses the baseline of the latched flight phase
+ * @trace SRS-EHMS-062, SRS-EHMS-202
+ */
+void test_daq_anomaly_scored_in_flight_phase(void)
+{
+    static anomaly_model_t model;
+    ehms_parameter_t param;
+    
+    /* Only cruise has a baseline */
+    (void)memset(&model, 0, sizeof(model));
+    model.smoothing = 1.0f;
+    model.phase[EHMS_FLIGHT_PHASE_CRUISE].defined = true;
+    for (uint32_t f = 0U; f < ANOMALY_FEATURE_COUNT; f++)
+    {
+        model.phase[EHMS_FLIGHT_PHASE_CRUISE].whiten[ANOMALY_WHITEN_INDEX(f, f)] = 1.0f;
+    }
+    TEST_ASSERT_EQUAL(EHMS_OK, anomaly_init(&model));
+    
+    init_with_failed_source(EHMS_ARINC429_BUS_COUNT);
+    fake_word_ssm = 0U;                 /* Positive BCD fuel flow */
+    
+    /* Every scored parameter received; no baseline on the ground */
+    run_fake_bus_cycle(1000U);
+    run_fake_bus_cycle(1010U);
+    (void)daq_get_parameter(EHMS_ENGINE_1, EHMS_PARAM_ANOMALY_SCORE, &param);
+    TEST_ASSERT_EQUAL(EHMS_PARAM_NCD, param.status);
+    
+    TEST_ASSERT_EQUAL(EHMS_OK, daq_set_flight_phase(EHMS_ENGINE_1, EHMS_FLIGHT_PHASE_CRUISE));
+    run_fake_bus_cycle(1020U);
+    (void)daq_get_parameter(EHMS_ENGINE_1, EHMS_PARAM_ANOMALY_SCORE, &param);
+    TEST_ASSERT_EQUAL(EHMS_PARAM_VALID, param.status);
+    
+    /* The other engine is still on the ground */
+    (void)daq_get_parameter(EHMS_ENGINE_2, EHMS_PARAM_ANOMALY_SCORE, &param);
+    TEST_ASSERT_EQUAL(EHMS_PARAM_NCD, param.status);
+    
+    TEST_ASSERT_EQUAL(EHMS_OK, daq_set_flight_phase(EHMS_ENGINE_1, EHMS_FLIGHT_PHASE_DESCENT));
+    run_fake_bus_cycle(1030U);
+    (void)daq_get_parameter(EHMS_ENGINE_1, EHMS_PARAM_ANOMALY_SCORE, &param);
+    TEST_ASSERT_EQUAL(EHMS_PARAM_NCD, param.status);
+}
+
+#endif
+#if defined(DAQ_PARALLEL_ENGINES)
+/**
+ * @test Test per-core cycle rejects a core outside the acquisition cores
+ * @trace SRS-EHMS-100
+ */
+void test_daq_execute_cycle_core_invalid(void)
+{
+    for (uint8_t i = 0; i < EHMS_ARINC429_BUS_COUNT; i++)
+    {
+        arinc429_init_ExpectAndReturn(i, test_config.arinc_config[i], EHMS_OK);
+    }
+    milstd1553_init_ExpectAndReturn(EHMS_1553_RT_ADDRESS, EHMS_OK);
+    (void)daq_init(&test_config);
+    
+    /* Rejected before any core reaches the barrier or touches the buses */
+    TEST_ASSERT_EQUAL(EHMS_ERROR_PARAM, daq_execute_cycle_core(DAQ_CORE_COUNT));
+    TEST_ASSERT_EQUAL(EHMS_ERROR_PARAM, daq_execute_cycle_core(0xFFFFFFFFU));
+}
+
+#endif
 /* ============================================================================
  * DATA RETRIEVAL TESTS
  * ============================================================================ */
@@ -238,6 +472,264 @@ void test_daq_get_parameter_invalid_ids(void)
     TEST_ASSERT_EQUAL(EHMS_ERROR_RANGE, result);
 }
 
+/**
+ * @test Test snapshot view with invalid arguments
+ * @trace SRS-EHMS-110
+ */
+void test_daq_snapshot_view_invalid(void)
+{
+    const ehms_engine_snapshot_t* view;
+    ehms_result_t result;
+    
+    result = daq_acquire_snapshot_view(EHMS_ENGINE_1, NULL);
+    TEST_ASSERT_EQUAL(EHMS_ERROR_PARAM, result);
+    
+    result = daq_acquire_snapshot_view(EHMS_ENGINE_COUNT, &view);
+    TEST_ASSERT_EQUAL(EHMS_ERROR_RANGE, result);
+    TEST_ASSERT_NULL(view);
+}
+
+/**
+ * @test Test snapshot view matches copied snapshot and releases cleanly
+ * @trace SRS-EHMS-110
+ */
+void test_daq_snapshot_view_round_trip(void)
+{
+    const ehms_engine_snapshot_t* view;
+    ehms_engine_snapshot_t snapshot;
+    ehms_engine_snapshot_t foreign;
+    
+    for (uint8_t i = 0; i < EHMS_ARINC429_BUS_COUNT; i++)
+    {
+        arinc429_init_ExpectAndReturn(i, test_config.arinc_config[i], EHMS_OK);
+    }
+    milstd1553_init_ExpectAndReturn(EHMS_1553_RT_ADDRESS, EHMS_OK);
+    (void)daq_init(&test_config);
+    
+    TEST_ASSERT_EQUAL(EHMS_OK, daq_acquire_snapshot_view(EHMS_ENGINE_2, &view));
+    TEST_ASSERT_NOT_NULL(view);
+    TEST_ASSERT_EQUAL(EHMS_OK, daq_get_engine_snapshot(EHMS_ENGINE_2, &snapshot));
+    TEST_ASSERT_EQUAL_MEMORY(&snapshot, view, sizeof(snapshot));
+    
+    /* Pointers not handed out by the module are rejected */
+    TEST_ASSERT_EQUAL(EHMS_ERROR_PARAM, daq_release_snapshot_view(EHMS_ENGINE_2, &foreign));
+    TEST_ASSERT_EQUAL(EHMS_ERROR_PARAM, daq_release_snapshot_view(EHMS_ENGINE_1, view));
+    TEST_ASSERT_EQUAL(EHMS_OK, daq_release_snapshot_view(EHMS_ENGINE_2, view));
+}
+
+/**
+ * @test Test a second release of a view is refused and leaves the counts intact
+ * @trace SRS-EHMS-110
+ */
+void test_daq_view_double_release(void)
+{
+    const ehms_engine_snapshot_t* view;
+    const ehms_engine_block_t* block;
+    
+    for (uint8_t i = 0; i < EHMS_ARINC429_BUS_COUNT; i++)
+    {
+        arinc429_init_ExpectAndReturn(i, test_config.arinc_config[i], EHMS_OK);
+    }
+    milstd1553_init_ExpectAndReturn(EHMS_1553_RT_ADDRESS, EHMS_OK);
+    (void)daq_init(&test_config);
+    
+    TEST_ASSERT_EQUAL(EHMS_OK, daq_acquire_snapshot_view(EHMS_ENGINE_1, &view));
+    TEST_ASSERT_EQUAL(EHMS_OK, daq_release_snapshot_view(EHMS_ENGINE_1, view));
+    TEST_ASSERT_EQUAL(EHMS_ERROR_PARAM, daq_release_snapshot_view(EHMS_ENGINE_1, view));
+    
+    TEST_ASSERT_EQUAL(EHMS_OK, daq_acquire_block_view(EHMS_ENGINE_1, &block));
+    TEST_ASSERT_EQUAL(EHMS_OK, daq_release_block_view(EHMS_ENGINE_1, block));
+    TEST_ASSERT_EQUAL(EHMS_ERROR_PARAM, daq_release_block_view(EHMS_ENGINE_1, block));
+    
+    /* A count that had underflowed would read as saturated */
+    for (uint32_t i = 0U; i < 4U; i++)
+    {
+        TEST_ASSERT_EQUAL(EHMS_OK, daq_acquire_snapshot_view(EHMS_ENGINE_1, &view));
+        TEST_ASSERT_EQUAL(EHMS_OK, daq_release_snapshot_view(EHMS_ENGINE_1, view));
+    }
+}
+
+/**
+ * @test Test parameter block view mirrors the published snapshot
+ * @trace SRS-EHMS-110
+ */
+void test_daq_block_view_matches_snapshot(void)
+{
+    const ehms_engine_block_t* block;
+    const ehms_engine_snapshot_t* snapshot;
+    
+    for (uint8_t i = 0; i < EHMS_ARINC429_BUS_COUNT; i++)
+    {
+        arinc429_init_ExpectAndReturn(i, test_config.arinc_config[i], EHMS_OK);
+    }
+    milstd1553_init_ExpectAndReturn(EHMS_1553_RT_ADDRESS, EHMS_OK);
+    (void)daq_init(&test_config);
+    
+    TEST_ASSERT_EQUAL(EHMS_OK, daq_acquire_block_view(EHMS_ENGINE_1, &block));
+    TEST_ASSERT_EQUAL(EHMS_OK, daq_acquire_snapshot_view(EHMS_ENGINE_1, &snapshot));
+    
+    TEST_ASSERT_EQUAL(snapshot->engine_id, block->engine_id);
+    for (uint32_t p = 0U; p < EHMS_PARAM_COUNT; p++)
+    {
+        TEST_ASSERT_EQUAL(snapshot->parameters[p].status, block->status[p]);
+        TEST_ASSERT_EQUAL_INT32(snapshot->parameters[p].raw_value, block->raw_value[p]);
+        TEST_ASSERT_EQUAL_FLOAT(snapshot->parameters[p].eng_value, block->eng_value[p]);
+    }
+    
+    TEST_ASSERT_EQUAL(EHMS_OK, daq_release_snapshot_view(EHMS_ENGINE_1, snapshot));
+    TEST_ASSERT_EQUAL(EHMS_OK, daq_release_block_view(EHMS_ENGINE_1, block));
+}
+
+/**
+ * @test Test bulk parameter accessor argument checking
+ * @trace SRS-EHMS-111
+ */
+void test_daq_get_parameter_values_invalid(void)
+{
+    const ehms_param_id_t ids[2] = { EHMS_PARAM_N1, EHMS_PARAM_COUNT };
+    float values[2];
+    ehms_param_status_t status[2];
+    ehms_result_t result;
+    
+    result = daq_get_parameter_values(EHMS_ENGINE_1, ids, 2U, NULL, status);
+    TEST_ASSERT_EQUAL(EHMS_ERROR_PARAM, result);
+    
+    result = daq_get_parameter_values(EHMS_ENGINE_1, ids, 2U, values, status);
+    TEST_ASSERT_EQUAL(EHMS_ERROR_RANGE, result);
+}
+
+/* ============================================================================
+ * SNAPSHOT PUBLICATION TESTS
+ * ============================================================================ */
+
+/**
+ * @test Test each cycle publishes into a back buffer no reader holds
+ * @trace SRS-EHMS-110
+ */
+void test_daq_publish_skips_pinned_buffers(void)
+{
+    const ehms_engine_snapshot_t* first;
+    const ehms_engine_snapshot_t* second;
+    const ehms_engine_snapshot_t* third;
+    const ehms_engine_snapshot_t* view;
+    
+    for (uint8_t i = 0; i < EHMS_ARINC429_BUS_COUNT; i++)
+    {
+        arinc429_init_ExpectAndReturn(i, test_config.arinc_config[i], EHMS_OK);
+    }
+    milstd1553_init_ExpectAndReturn(EHMS_1553_RT_ADDRESS, EHMS_OK);
+    (void)daq_init(&test_config);
+    
+    /* Pinned buffer stays out of use; the cycle publishes another */
+    TEST_ASSERT_EQUAL(EHMS_OK, daq_acquire_snapshot_view(EHMS_ENGINE_1, &first));
+    run_quiet_cycle(1000U);
+    TEST_ASSERT_EQUAL(EHMS_OK, daq_acquire_snapshot_view(EHMS_ENGINE_1, &second));
+    TEST_ASSERT_TRUE(second != first);
+    TEST_ASSERT_EQUAL(EHMS_OK, daq_release_snapshot_view(EHMS_ENGINE_1, second));
+    
+    /* Next cycle: neither the published buffer nor the pinned one is used */
+    run_quiet_cycle(1010U);
+    TEST_ASSERT_EQUAL(EHMS_OK, daq_acquire_snapshot_view(EHMS_ENGINE_1, &third));
+    TEST_ASSERT_TRUE((third != first) && (third != second));
+    TEST_ASSERT_EQUAL(EHMS_OK, daq_release_snapshot_view(EHMS_ENGINE_1, third));
+    
+    /* Once released, the first buffer is the free back buffer again */
+    TEST_ASSERT_EQUAL(EHMS_OK, daq_release_snapshot_view(EHMS_ENGINE_1, first));
+    run_quiet_cycle(1020U);
+    TEST_ASSERT_EQUAL(EHMS_OK, daq_acquire_snapshot_view(EHMS_ENGINE_1, &view));
+    TEST_ASSERT_TRUE(view == first);
+    TEST_ASSERT_EQUAL(EHMS_OK, daq_release_snapshot_view(EHMS_ENGINE_1, view));
+}
+
+/**
+ * @test Test the previous snapshot stays published while both back buffers are held
+ * @trace SRS-EHMS-110
+ */
+void test_daq_publish_skipped_all_pinned(void)
+{
+    const ehms_engine_snapshot_t* held[3];
+    const ehms_engine_snapshot_t* view;
+    ehms_engine_snapshot_t published;
+    ehms_engine_snapshot_t snapshot;
+    
+    for (uint8_t i = 0; i < EHMS_ARINC429_BUS_COUNT; i++)
+    {
+        arinc429_init_ExpectAndReturn(i, test_config.arinc_config[i], EHMS_OK);
+    }
+    milstd1553_init_ExpectAndReturn(EHMS_1553_RT_ADDRESS, EHMS_OK);
+    (void)daq_init(&test_config);
+    
+    /* Pin each buffer in turn as it is published */
+    for (uint32_t b = 0U; b < 3U; b++)
+    {
+        if (b > 0U)
+        {
+            run_quiet_cycle(1000U + (b * 10U));
+        }
+        TEST_ASSERT_EQUAL(EHMS_OK, daq_acquire_snapshot_view(EHMS_ENGINE_1, &held[b]));
+    }
+    TEST_ASSERT_TRUE((held[0] != held[1]) && (held[1] != held[2]) && (held[0] != held[2]));
+    published = *held[2];
+    
+    /* No free back buffer: the cycle is not published and no held view is written */
+    run_quiet_cycle(1030U);
+    TEST_ASSERT_EQUAL(EHMS_OK, daq_acquire_snapshot_view(EHMS_ENGINE_1, &view));
+    TEST_ASSERT_TRUE(view == held[2]);
+    TEST_ASSERT_EQUAL_MEMORY(&published, view, sizeof(published));
+    TEST_ASSERT_EQUAL(EHMS_OK, daq_release_snapshot_view(EHMS_ENGINE_1, view));
+    
+    /* A released buffer takes the next cycle */
+    TEST_ASSERT_EQUAL(EHMS_OK, daq_release_snapshot_view(EHMS_ENGINE_1, held[0]));
+    run_quiet_cycle(1040U);
+    TEST_ASSERT_EQUAL(EHMS_OK, daq_acquire_snapshot_view(EHMS_ENGINE_1, &view));
+    TEST_ASSERT_TRUE(view == held[0]);
+    TEST_ASSERT_EQUAL(EHMS_OK, daq_get_engine_snapshot(EHMS_ENGINE_1, &snapshot));
+    TEST_ASSERT_EQUAL_MEMORY(&snapshot, view, sizeof(snapshot));
+    
+    TEST_ASSERT_EQUAL(EHMS_OK, daq_release_snapshot_view(EHMS_ENGINE_1, view));
+    TEST_ASSERT_EQUAL(EHMS_OK, daq_release_snapshot_view(EHMS_ENGINE_1, held[1]));
+    TEST_ASSERT_EQUAL(EHMS_OK, daq_release_snapshot_view(EHMS_ENGINE_1, held[2]));
+}
+
+/**
+ * @test Test views are refused once a buffer's reader count is saturated
+ * @trace SRS-EHMS-110
+ */
+void test_daq_view_reader_count_saturated(void)
+{
+    static const ehms_engine_snapshot_t* held[255];
+    const ehms_engine_snapshot_t* view;
+    ehms_engine_snapshot_t snapshot;
+    
+    for (uint8_t i = 0; i < EHMS_ARINC429_BUS_COUNT; i++)
+    {
+        arinc429_init_ExpectAndReturn(i, test_config.arinc_config[i], EHMS_OK);
+    }
+    milstd1553_init_ExpectAndReturn(EHMS_1553_RT_ADDRESS, EHMS_OK);
+    (void)daq_init(&test_config);
+    
+    /* 8-bit reader count per buffer */
+    for (uint32_t i = 0U; i < 255U; i++)
+    {
+        TEST_ASSERT_EQUAL(EHMS_OK, daq_acquire_snapshot_view(EHMS_ENGINE_2, &held[i]));
+    }
+    
+    TEST_ASSERT_EQUAL(EHMS_ERROR_BUSY, daq_acquire_snapshot_view(EHMS_ENGINE_2, &view));
+    TEST_ASSERT_NULL(view);
+    TEST_ASSERT_EQUAL(EHMS_ERROR_BUSY, daq_get_engine_snapshot(EHMS_ENGINE_2, &snapshot));
+    
+    /* Other engines publish independently */
+    TEST_ASSERT_EQUAL(EHMS_OK, daq_acquire_snapshot_view(EHMS_ENGINE_1, &view));
+    TEST_ASSERT_EQUAL(EHMS_OK, daq_release_snapshot_view(EHMS_ENGINE_1, view));
+    
+    for (uint32_t i = 0U; i < 255U; i++)
+    {
+        TEST_ASSERT_EQUAL(EHMS_OK, daq_release_snapshot_view(EHMS_ENGINE_2, held[i]));
+    }
+    TEST_ASSERT_EQUAL(EHMS_OK, daq_acquire_snapshot_view(EHMS_ENGINE_2, &view));
+    TEST_ASSERT_EQUAL(EHMS_OK, daq_release_snapshot_view(EHMS_ENGINE_2, view));
+}
+
 /* ============================================================================
  * STALE DATA DETECTION TESTS
  * ============================================================================ */
@@ -276,6 +768,46 @@ void test_daq_stale_detection(void)
     TEST_ASSERT_EQUAL(EHMS_PARAM_STALE, param.status);
 }
 
+/**
+ * @test Test sample timestamps are derived from the cycle calendar time
+ * @trace SRS-EHMS-102
+ */
+void test_daq_parameter_timestamp(void)
+{
+    /* Initialize module */
+    for (uint8_t i = 0; i < EHMS_ARINC429_BUS_COUNT; i++)
+    {
+        arinc429_init_ExpectAndReturn(i, test_config.arinc_config[i], EHMS_OK);
+    }
+    milstd1553_init_ExpectAndReturn(EHMS_1553_RT_ADDRESS, EHMS_OK);
+    (void)daq_init(&test_config);
+    
+    ehms_timestamp_t cycle_time = { 2026U, 3U, 14U, 10U, 20U, 30U, 400U };
+    arinc429_word_t mock_word;
+    mock_word.label = 0o310;
+    mock_word.data = 850;
+    mock_word.ssm = SSM_NORMAL;
+    
+    /* One calendar read per cycle; samples are taken with the timebase */
+    system_get_time_ms_ExpectAndReturn(1000U);
+    system_get_timestamp_ExpectAndReturn(cycle_time);
+    arinc429_read_ExpectAndReturn(0, 0o310, NULL, EHMS_OK);
+    arinc429_read_IgnoreArg_word();
+    arinc429_read_ReturnThruPtr_word(&mock_word);
+    
+    (void)daq_execute_cycle();
+    
+    ehms_parameter_t param;
+    (void)daq_get_parameter(EHMS_ENGINE_1, EHMS_PARAM_N1, &param);
+    
+    TEST_ASSERT_EQUAL(EHMS_PARAM_VALID, param.status);
+    TEST_ASSERT_EQUAL(cycle_time.year, param.timestamp.year);
+    TEST_ASSERT_EQUAL(cycle_time.day, param.timestamp.day);
+    TEST_ASSERT_EQUAL(cycle_time.hour, param.timestamp.hour);
+    TEST_ASSERT_EQUAL(cycle_time.second, param.timestamp.second);
+    TEST_ASSERT_EQUAL(cycle_time.millisecond, param.timestamp.millisecond);
+}
+
 /* ============================================================================
  * SOURCE REDUNDANCY TESTS
  * ============================================================================ */
@@ -321,6 +853,170 @@ void test_daq_source_switchover(void)
     TEST_ASSERT_EQUAL(1U, param.source_bus); /* Bus 1 = backup */
 }
 
+/**
+ * @test Test an inactive primary is probed every DAQ_SOURCE_PROBE_CYCLES
+ * @trace SRS-EHMS-103
+ */
+void test_daq_source_probe_inactive_primary(void)
+{
+    ehms_parameter_t param;
+    
+    init_with_failed_source(0U);
+    fake_bus_result[0] = EHMS_ERROR_HARDWARE;
+    
+    /* Up to cycle 99 the backup only is read */
+    for (uint32_t cycle = TEST_SOURCE_FAIL_CYCLES + 1U; cycle < 100U; cycle++)
+    {
+        run_fake_bus_cycle(1000U + (cycle * 10U));
+        TEST_ASSERT_EQUAL_UINT32(0U, fake_bus_reads[0]);
+        TEST_ASSERT_TRUE(fake_bus_reads[1] > 0U);
+    }
+    
+    /* Cycle 100 probes the primary; the failed probe fails over in the same cycle */
+    run_fake_bus_cycle(2000U);
+    TEST_ASSERT_TRUE(fake_bus_reads[0] > 0U);
+    TEST_ASSERT_TRUE(fake_bus_reads[1] > 0U);
+    
+    (void)daq_get_parameter(EHMS_ENGINE_1, EHMS_PARAM_N1, &param);
+    TEST_ASSERT_EQUAL(EHMS_PARAM_VALID, param.status);
+    TEST_ASSERT_EQUAL(1U, param.source_bus);
+    
+    /* The primary is still inactive and left alone until the next probe */
+    run_fake_bus_cycle(2010U);
+    TEST_ASSERT_EQUAL_UINT32(0U, fake_bus_reads[0]);
+}
+
+/**
+ * @test Test a probed primary that answers is reactivated and used again
+ * @trace SRS-EHMS-103
+ */
+void test_daq_source_reactivated_after_success(void)
+{
+    ehms_parameter_t param;
+    
+    init_with_failed_source(0U);
+    
+    /* The primary has recovered but is not read before the probe */
+    for (uint32_t cycle = TEST_SOURCE_FAIL_CYCLES + 1U; cycle < 100U; cycle++)
+    {
+        run_fake_bus_cycle(1000U + (cycle * 10U));
+        TEST_ASSERT_EQUAL_UINT32(0U, fake_bus_reads[0]);
+    }
+    
+    (void)daq_get_parameter(EHMS_ENGINE_1, EHMS_PARAM_N1, &param);
+    TEST_ASSERT_EQUAL(1U, param.source_bus);
+    
+    /* Probe succeeds */
+    run_fake_bus_cycle(2000U);
+    
+    (void)daq_get_parameter(EHMS_ENGINE_1, EHMS_PARAM_N1, &param);
+    TEST_ASSERT_EQUAL(EHMS_PARAM_VALID, param.status);
+    TEST_ASSERT_EQUAL(0U, param.source_bus);
+    
+    /* The primary is active again: later cycles read it only */
+    run_fake_bus_cycle(2010U);
+    TEST_ASSERT_TRUE(fake_bus_reads[0] > 0U);
+    TEST_ASSERT_EQUAL_UINT32(0U, fake_bus_reads[1]);
+}
+
+/**
+ * @test Test parameters on buses 2 and 3 fail over between those buses
+ * @trace SRS-EHMS-103
+ */
+void test_daq_source_switchover_vibration_buses(void)
+{
+    ehms_parameter_t param;
+    
+    init_with_failed_source(EHMS_ARINC429_BUS_COUNT);
+    fake_bus_result[2] = EHMS_ERROR_HARDWARE;
+    
+    run_fake_bus_cycle(1000U);
+    TEST_ASSERT_TRUE(fake_bus_reads[2] > 0U);
+    TEST_ASSERT_TRUE(fake_bus_reads[3] > 0U);
+    
+    (void)daq_get_parameter(EHMS_ENGINE_1, EHMS_PARAM_VIB_FAN, &param);
+    TEST_ASSERT_EQUAL(EHMS_PARAM_VALID, param.status);
+    TEST_ASSERT_EQUAL(3U, param.source_bus);
+    
+    (void)daq_get_parameter(EHMS_ENGINE_1, EHMS_PARAM_VIB_CORE, &param);
+    TEST_ASSERT_EQUAL(EHMS_PARAM_VALID, param.status);
+    TEST_ASSERT_EQUAL(3U, param.source_bus);
+    
+    /* Buses 0 and 1 are unaffected */
+    (void)daq_get_parameter(EHMS_ENGINE_1, EHMS_PARAM_N1, &param);
+    TEST_ASSERT_EQUAL(0U, param.source_bus);
+}
+
+/**
+ * @test Test a failed read on the failed-over backup does not retry the primary
+ * @trace SRS-EHMS-103
+ */
+void test_daq_source_backup_failure_no_primary_retry(void)
+{
+    ehms_parameter_t param;
+    int32_t n1_before;
+    
+    init_with_failed_source(0U);
+    (void)daq_get_parameter(EHMS_ENGINE_1, EHMS_PARAM_N1, &param);
+    n1_before = param.raw_value;
+    
+    /* The backup now sends a new value, except for the N1 label */
+    fake_bus_failed_label[1] = 0o310;
+    fake_word_data = 900;
+    run_fake_bus_cycle(1000U + ((TEST_SOURCE_FAIL_CYCLES + 1U) * 10U));
+    
+    /* The N1 label failed on the backup; the inactive primary was not read */
+    TEST_ASSERT_EQUAL_UINT32(0U, fake_bus_reads[0]);
+    TEST_ASSERT_TRUE(fake_bus_reads[1] > 0U);
+    
+    (void)daq_get_parameter(EHMS_ENGINE_1, EHMS_PARAM_N1, &param);
+    TEST_ASSERT_EQUAL(n1_before, param.raw_value);
+    
+    (void)daq_get_parameter(EHMS_ENGINE_1, EHMS_PARAM_N2, &param);
+    TEST_ASSERT_EQUAL(EHMS_PARAM_VALID, param.status);
+    TEST_ASSERT_EQUAL(1U, param.source_bus);
+    TEST_ASSERT_TRUE(param.raw_value != n1_before);
+}
+
+/**
+ * @test Test source health is carried over a warm start and checked first
+ * @trace SRS-EHMS-016, SRS-EHMS-103
+ */
+void test_daq_warm_state_round_trip(void)
+{
+    daq_warm_state_t state;
+    daq_warm_state_t restored;
+    
+    TEST_ASSERT_EQUAL(EHMS_ERROR_PARAM, daq_save_warm_state(NULL));
+    TEST_ASSERT_EQUAL(EHMS_ERROR_PARAM, daq_restore_warm_state(NULL));
+    
+    /* Initialize module */
+    for (uint8_t i = 0; i < EHMS_ARINC429_BUS_COUNT; i++)
+    {
+        arinc429_init_ExpectAndReturn(i, test_config.arinc_config[i], EHMS_OK);
+    }
+    milstd1553_init_ExpectAndReturn(EHMS_1553_RT_ADDRESS, EHMS_OK);
+    (void)daq_init(&test_config);
+    
+    TEST_ASSERT_EQUAL(EHMS_OK, daq_save_warm_state(&state));
+    
+    /* Primary source found failed before the interruption (5 consecutive failures) */
+    state.source[0].is_active = 0U;
+    state.source[0].failure_count = 5U;
+    state.source[0].total_samples = 1200U;
+    state.source[0].error_samples = 40U;
+    TEST_ASSERT_EQUAL(EHMS_OK, daq_restore_warm_state(&state));
+    TEST_ASSERT_EQUAL(EHMS_OK, daq_save_warm_state(&restored));
+    TEST_ASSERT_EQUAL_MEMORY(&state, &restored, sizeof(state));
+    
+    /* An inactive source that never reached the failure limit is rejected */
+    state.source[1].is_active = 0U;
+    state.source[1].failure_count = 1U;
+    TEST_ASSERT_EQUAL(EHMS_ERROR_RANGE, daq_restore_warm_state(&state));
+    TEST_ASSERT_EQUAL(EHMS_OK, daq_save_warm_state(&state));
+    TEST_ASSERT_EQUAL_MEMORY(&restored, &state, sizeof(state));
+}
+
 /* ============================================================================
  * CRC VALIDATION TESTS
  * ============================================================================ */
@@ -337,6 +1033,240 @@ void test_daq_crc_validation(void)
     TEST_IGNORE_MESSAGE("CRC corruption test requires internal access");
 }
 
+/**
+ * @test Test incrementally maintained snapshot CRC equals full-snapshot CRC
+ * @trace SRS-EHMS-108
+ */
+void test_daq_incremental_crc_matches_full(void)
+{
+    ehms_engine_snapshot_t snapshot;
+    
+    for (uint8_t i = 0; i < EHMS_ARINC429_BUS_COUNT; i++)
+    {
+        arinc429_init_ExpectAndReturn(i, test_config.arinc_config[i], EHMS_OK);
+    }
+    milstd1553_init_ExpectAndReturn(EHMS_1553_RT_ADDRESS, EHMS_OK);
+    (void)daq_init(&test_config);
+    
+    for (uint8_t eng = 0U; eng < EHMS_MAX_ENGINES; eng++)
+    {
+        ehms_result_t result = daq_get_engine_snapshot((ehms_engine_id_t)eng, &snapshot);
+        
+        TEST_ASSERT_EQUAL(EHMS_OK, result);
+        TEST_ASSERT_EQUAL((ehms_engine_id_t)eng, snapshot.engine_id);
+        TEST_ASSERT_EQUAL_HEX32(
+            ehms_crc32_calculate(&snapshot, sizeof(snapshot) - sizeof(uint32_t)),
+            snapshot.crc32);
+    }
+}
+
+/* ============================================================================
+ * TIMING STATISTICS TESTS
+ * ============================================================================ */
+
+/**
+ * @test Test timing statistics with NULL pointer
+ * @trace SRS-EHMS-100
+ */
+void test_daq_timing_statistics_null(void)
+{
+    ehms_result_t result = daq_get_timing_statistics(NULL);
+    
+    TEST_ASSERT_EQUAL(EHMS_ERROR_PARAM, result);
+}
+
+/**
+ * @test Test timing statistics are cleared at init and count each cycle
+ * @trace SRS-EHMS-100
+ */
+void test_daq_timing_statistics_cycle(void)
+{
+    daq_timing_statistics_t stats;
+    
+    for (uint8_t i = 0; i < EHMS_ARINC429_BUS_COUNT; i++)
+    {
+        arinc429_init_ExpectAndReturn(i, test_config.arinc_config[i], EHMS_OK);
+    }
+    milstd1553_init_ExpectAndReturn(EHMS_1553_RT_ADDRESS, EHMS_OK);
+    (void)daq_init(&test_config);
+    
+    TEST_ASSERT_EQUAL(EHMS_OK, daq_get_timing_statistics(&stats));
+    TEST_ASSERT_EQUAL(0U, stats.phase[DAQ_PHASE_CYCLE].samples);
+    TEST_ASSERT_EQUAL(10000000U, stats.deadline_ns);
+    TEST_ASSERT_EQUAL(0U, stats.overrun_count);
+    
+    system_get_time_ms_ExpectAndReturn(1000U);
+    arinc429_read_IgnoreAndReturn(EHMS_ERROR_TIMEOUT);
+    (void)daq_execute_cycle();
+    
+    TEST_ASSERT_EQUAL(EHMS_OK, daq_get_timing_statistics(&stats));
+    for (uint32_t phase = 0U; phase < DAQ_PHASE_COUNT; phase++)
+    {
+        TEST_ASSERT_EQUAL(1U, stats.phase[phase].samples);
+        TEST_ASSERT_EQUAL(1U, stats.phase[phase].histogram[0]);
+    }
+    TEST_ASSERT_EQUAL(0U, stats.overrun_count);
+    
+    TEST_ASSERT_EQUAL(EHMS_OK, daq_reset_timing_statistics());
+    TEST_ASSERT_EQUAL(EHMS_OK, daq_get_timing_statistics(&stats));
+    TEST_ASSERT_EQUAL(0U, stats.phase[DAQ_PHASE_CYCLE].samples);
+}
+
+/* ============================================================================
+ * RECORDED DATA CONTEXT TESTS
+ * ============================================================================ */
+
+/**
+ * @test Test context initialization and sample processing argument checks
+ * @trace SRS-EHMS-105
+ */
+void test_daq_ctx_invalid(void)
+{
+    const ehms_timestamp_t epoch = { 2026U, 3U, 14U, 9U, 30U, 0U, 0U };
+    int32_t raw[EHMS_PARAM_COUNT] = { 0 };
+    uint8_t status[EHMS_PARAM_COUNT] = { 0U };
+    daq_context_t* ctx = (daq_context_t*)calloc(1U, daq_context_size());
+    
+    TEST_ASSERT_NOT_NULL(ctx);
+    TEST_ASSERT_EQUAL(EHMS_ERROR_PARAM, daq_ctx_init(NULL, &epoch));
+    TEST_ASSERT_EQUAL(EHMS_ERROR_PARAM, daq_ctx_init(ctx, NULL));
+    
+    /* Zeroed storage is an uninitialized context */
+    TEST_ASSERT_EQUAL(EHMS_ERROR_NOT_INIT, 
+                      daq_ctx_process_sample(ctx, EHMS_ENGINE_1, 0U, 0U, raw, status));
+    
+    TEST_ASSERT_EQUAL(EHMS_OK, daq_ctx_init(ctx, &epoch));
+    TEST_ASSERT_EQUAL(EHMS_ERROR_PARAM, 
+                      daq_ctx_process_sample(NULL, EHMS_ENGINE_1, 0U, 0U, raw, status));
+    TEST_ASSERT_EQUAL(EHMS_ERROR_PARAM, 
+                      daq_ctx_process_sample(ctx, EHMS_ENGINE_1, 0U, 0U, NULL, status));
+    TEST_ASSERT_EQUAL(EHMS_ERROR_RANGE, 
+                      daq_ctx_process_sample(ctx, EHMS_ENGINE_COUNT, 0U, 0U, raw, status));
+    TEST_ASSERT_EQUAL(EHMS_ERROR_RANGE, 
+                      daq_ctx_process_sample(ctx, EHMS_ENGINE_1, 0U, 
+                                             (uint32_t)EHMS_FLIGHT_PHASE_COUNT, raw, status));
+    
+    free(ctx);
+}
+
+/**
+ * @test Test recorded samples are published with their calendar time and flight phase
+ * @trace SRS-EHMS-101, SRS-EHMS-108
+ */
+void test_daq_ctx_process_sample(void)
+{
+    const ehms_timestamp_t epoch = { 2026U, 3U, 14U, 23U, 59U, 59U, 0U };
+    int32_t raw[EHMS_PARAM_COUNT] = { 0 };
+    uint8_t status[EHMS_PARAM_COUNT] = { 0U };
+    ehms_engine_snapshot_t snapshot;
+    const ehms_engine_block_t* view = NULL;
+    daq_context_t* ctx = (daq_context_t*)calloc(1U, daq_context_size());
+    
+    TEST_ASSERT_NOT_NULL(ctx);
+    TEST_ASSERT_EQUAL(EHMS_OK, daq_ctx_init(ctx, &epoch));
+    
+    raw[EHMS_PARAM_N1] = 850;
+    status[EHMS_PARAM_OIL_QTY] = (uint8_t)EHMS_PARAM_STALE;
+    TEST_ASSERT_EQUAL(EHMS_OK, daq_ctx_process_sample(ctx, EHMS_ENGINE_2, 1500U,
+                                                      (uint32_t)EHMS_FLIGHT_PHASE_CRUISE,
+                                                      raw, status));
+    
+    TEST_ASSERT_EQUAL(EHMS_OK, daq_ctx_acquire_block_view(ctx, EHMS_ENGINE_2, &view));
+    TEST_ASSERT_EQUAL(850, view->raw_value[EHMS_PARAM_N1]);
+    TEST_ASSERT_EQUAL(EHMS_PARAM_VALID, view->status[EHMS_PARAM_N1]);
+    TEST_ASSERT_EQUAL(1500U, view->timestamp_ms[EHMS_PARAM_N1]);
+    TEST_ASSERT_EQUAL(EHMS_PARAM_STALE, view->status[EHMS_PARAM_OIL_QTY]);
+    TEST_ASSERT_EQUAL(EHMS_FLIGHT_PHASE_CRUISE, view->flight_phase);
+    TEST_ASSERT_EQUAL(EHMS_OK, daq_ctx_release_block_view(ctx, EHMS_ENGINE_2, view));
+    
+    /* Sample time crosses midnight from the epoch */
+    TEST_ASSERT_EQUAL(EHMS_OK, daq_ctx_get_engine_snapshot(ctx, EHMS_ENGINE_2, &snapshot));
+    TEST_ASSERT_EQUAL(15U, snapshot.sample_time.day);
+    TEST_ASSERT_EQUAL(0U, snapshot.sample_time.hour);
+    TEST_ASSERT_EQUAL(0U, snapshot.sample_time.second);
+    TEST_ASSERT_EQUAL(500U, snapshot.sample_time.millisecond);
+    TEST_ASSERT_EQUAL(EHMS_FLIGHT_PHASE_CRUISE, snapshot.flight_phase);
+    TEST_ASSERT_EQUAL_HEX32(
+        ehms_crc32_calculate(&snapshot, sizeof(snapshot) - sizeof(uint32_t)),
+        snapshot.crc32);
+    
+    free(ctx);
+}
+
+/**
+ * @test Test contexts are independent of each other and of the onboard context
+ * @trace SRS-EHMS-110
+ */
+void test_daq_ctx_independent(void)
+{
+    const ehms_timestamp_t epoch = { 2026U, 3U, 14U, 9U, 30U, 0U, 0U };
+    int32_t raw[EHMS_PARAM_COUNT] = { 0 };
+    uint8_t status[EHMS_PARAM_COUNT] = { 0U };
+    ehms_parameter_t param;
+    daq_context_t* ctx_a = (daq_context_t*)calloc(1U, daq_context_size());
+    daq_context_t* ctx_b = (daq_context_t*)calloc(1U, daq_context_size());
+    
+    TEST_ASSERT_NOT_NULL(ctx_a);
+    TEST_ASSERT_NOT_NULL(ctx_b);
+    TEST_ASSERT_EQUAL(EHMS_OK, daq_ctx_init(ctx_a, &epoch));
+    TEST_ASSERT_EQUAL(EHMS_OK, daq_ctx_init(ctx_b, &epoch));
+    
+    raw[EHMS_PARAM_EGT] = 600;
+    TEST_ASSERT_EQUAL(EHMS_OK, daq_ctx_process_sample(ctx_a, EHMS_ENGINE_1, 10U, 0U, raw, status));
+    raw[EHMS_PARAM_EGT] = 700;
+    TEST_ASSERT_EQUAL(EHMS_OK, daq_ctx_process_sample(ctx_b, EHMS_ENGINE_1, 10U, 0U, raw, status));
+    
+    TEST_ASSERT_EQUAL(EHMS_OK, daq_ctx_get_parameter(ctx_a, EHMS_ENGINE_1, EHMS_PARAM_EGT, &param));
+    TEST_ASSERT_EQUAL(600, param.raw_value);
+    TEST_ASSERT_EQUAL(EHMS_OK, daq_ctx_get_parameter(ctx_b, EHMS_ENGINE_1, EHMS_PARAM_EGT, &param));
+    TEST_ASSERT_EQUAL(700, param.raw_value);
+    
+    free(ctx_a);
+    free(ctx_b);
+}
+
+#if defined(DAQ_TREND_ENGINE)
+/**
+ * @test Test recorded samples are folded into the attached trend context
+ * @trace SRS-EHMS-061
+ */
+void test_daq_ctx_trend_context(void)
+{
+    const ehms_timestamp_t epoch = { 2026U, 3U, 14U, 9U, 30U, 0U, 0U };
+    int32_t raw[EHMS_PARAM_COUNT] = { 0 };
+    uint8_t status[EHMS_PARAM_COUNT] = { 0U };
+    trend_statistics_t stats;
+    ehms_parameter_t param;
+    daq_context_t* ctx = (daq_context_t*)calloc(1U, daq_context_size());
+    trend_context_t* trend = (trend_context_t*)calloc(1U, trend_context_size());
+    
+    TEST_ASSERT_NOT_NULL(ctx);
+    TEST_ASSERT_NOT_NULL(trend);
+    TEST_ASSERT_EQUAL(EHMS_OK, daq_ctx_init(ctx, &epoch));
+    TEST_ASSERT_EQUAL(EHMS_OK, trend_ctx_init(trend));
+    TEST_ASSERT_EQUAL(EHMS_ERROR_PARAM, daq_ctx_set_trend_context(NULL, trend));
+    
+    /* No trend context attached after initialization */
+    raw[EHMS_PARAM_EGT] = 600;
+    TEST_ASSERT_EQUAL(EHMS_OK, daq_ctx_process_sample(ctx, EHMS_ENGINE_2, 10U, 0U, raw, status));
+    
+    TEST_ASSERT_EQUAL(EHMS_OK, daq_ctx_set_trend_context(ctx, trend));
+    TEST_ASSERT_EQUAL(EHMS_OK, daq_ctx_process_sample(ctx, EHMS_ENGINE_2, 20U, 0U, raw, status));
+    raw[EHMS_PARAM_EGT] = 700;
+    TEST_ASSERT_EQUAL(EHMS_OK, daq_ctx_process_sample(ctx, EHMS_ENGINE_2, 30U, 0U, raw, status));
+    
+    TEST_ASSERT_EQUAL(EHMS_OK, daq_ctx_get_parameter(ctx, EHMS_ENGINE_2, EHMS_PARAM_EGT, &param));
+    TEST_ASSERT_EQUAL(EHMS_OK, trend_ctx_get_statistics(trend, EHMS_ENGINE_2, EHMS_PARAM_EGT,
+                                                        &stats));
+    TEST_ASSERT_EQUAL_UINT32(2U, stats.count);
+    TEST_ASSERT_EQUAL_FLOAT(param.eng_value, stats.last);
+    
+    free(ctx);
+    free(trend);
+}
+
+#endif
+
 /* ============================================================================
  * TEST RUNNER
  * ============================================================================ */
@@ -355,21 +1285,57 @@ int main(void)
     /* Acquisition tests */
     RUN_TEST(test_daq_execute_not_initialized);
     RUN_TEST(test_daq_execute_cycle_success);
+    RUN_TEST(test_daq_flight_phase_latched_per_cycle);
+#if defined(DAQ_ANOMALY_DETECTION)
+    RUN_TEST(test_daq_anomaly_scored_in_flight_phase);
+#endif
+#if defined(DAQ_PARALLEL_ENGINES)
+    RUN_TEST(test_daq_execute_cycle_core_invalid);
+#endif
     
     /* Data retrieval tests */
     RUN_TEST(test_daq_get_snapshot_null);
     RUN_TEST(test_daq_get_snapshot_invalid_engine);
     RUN_TEST(test_daq_get_parameter_null);
     RUN_TEST(test_daq_get_parameter_invalid_ids);
+    RUN_TEST(test_daq_snapshot_view_invalid);
+    RUN_TEST(test_daq_snapshot_view_round_trip);
+    RUN_TEST(test_daq_view_double_release);
+    RUN_TEST(test_daq_block_view_matches_snapshot);
+    RUN_TEST(test_daq_get_parameter_values_invalid);
+    
+    /* Snapshot publication tests */
+    RUN_TEST(test_daq_publish_skips_pinned_buffers);
+    RUN_TEST(test_daq_publish_skipped_all_pinned);
+    RUN_TEST(test_daq_view_reader_count_saturated);
     
     /* Stale detection tests */
     RUN_TEST(test_daq_stale_detection);
+    RUN_TEST(test_daq_parameter_timestamp);
     
     /* Redundancy tests */
     RUN_TEST(test_daq_source_switchover);
+    RUN_TEST(test_daq_source_probe_inactive_primary);
+    RUN_TEST(test_daq_source_reactivated_after_success);
+    RUN_TEST(test_daq_source_switchover_vibration_buses);
+    RUN_TEST(test_daq_source_backup_failure_no_primary_retry);
+    RUN_TEST(test_daq_warm_state_round_trip);
     
     /* CRC tests */
     RUN_TEST(test_daq_crc_validation);
+    RUN_TEST(test_daq_incremental_crc_matches_full);
+    
+    /* Timing statistics tests */
+    RUN_TEST(test_daq_timing_statistics_null);
+    RUN_TEST(test_daq_timing_statistics_cycle);
+    
+    /* Recorded data context tests */
+    RUN_TEST(test_daq_ctx_invalid);
+    RUN_TEST(test_daq_ctx_process_sample);
+    RUN_TEST(test_daq_ctx_independent);
+#if defined(DAQ_TREND_ENGINE)
+    RUN_TEST(test_daq_ctx_trend_context);
+#endif
     
     return UNITY_END();
 }
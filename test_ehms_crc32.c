@@ -0,0 +1,196 @@
+/**
+ * @file test_ehms_crc32.c
+ * @brief Unit Tests for CRC-32 Integrity Engine
+ *
+ * @copyright Copyright (c) 2026 AeroTech Avionics Inc.
+ *
+ * Test Framework: Unity Test Framework
+ * Coverage Target: 100% MC/DC
+ *
+ * Requirements Verified:
+ *   SRS-EHMS-108
+ */
+
+#include "unity.h"
+#include "ehms_crc32.h"
+#include "ehms_types.h"
+
+#include <string.h>
+
+/* ============================================================================
+ * TEST FIXTURES
+ * ============================================================================ */
+
+#define TEST_BUFFER_SIZE    (sizeof(ehms_engine_snapshot_t) + 16U)
+
+static uint8_t test_buffer[TEST_BUFFER_SIZE];
+
+/**
+ * @brief Reference bit-serial CRC-32 (original daq_calculate_crc32)
+ */
+static uint32_t reference_crc32(const void* data, uint32_t length)
+{
+    const uint8_t* bytes = (const uint8_t*)data;
+    uint32_t crc = 0xFFFFFFFFUL;
+    
+    for (uint32_t i = 0U; i < length; i++)
+    {
+        crc ^= bytes[i];
+        for (uint8_t bit = 0U; bit < 8U; bit++)
+        {
+            if ((crc & 1U) != 0U)
+            {
+                crc = (crc >> 1U) ^ EHMS_CRC32_POLYNOMIAL;
+            }
+            else
+            {
+                crc >>= 1U;
+            }
+        }
+    }
+    
+    return ~crc;
+}
+
+void setUp(void)
+{
+    /* Deterministic pseudo-random fill */
+    uint32_t seed = 0x12345678UL;
+    
+    for (uint32_t i = 0U; i < TEST_BUFFER_SIZE; i++)
+    {
+        seed = (seed * 1103515245UL) + 12345UL;
+        test_buffer[i] = (uint8_t)(seed >> 16U);
+    }
+}
+
+void tearDown(void)
+{
+}
+
+/* ============================================================================
+ * KNOWN ANSWER TESTS
+ * ============================================================================ */
+
+/**
+ * @test Test standard CRC-32 check value
+ * @trace SRS-EHMS-108
+ */
+void test_crc32_check_value(void)
+{
+    const char* check = "123456789";
+    
+    TEST_ASSERT_EQUAL_HEX32(0xCBF43926UL,
+                            ehms_crc32_calculate(check, (uint32_t)strlen(check)));
+}
+
+/**
+ * @test Test CRC-32 of empty buffer
+ * @trace SRS-EHMS-108
+ */
+void test_crc32_empty_buffer(void)
+{
+    TEST_ASSERT_EQUAL_HEX32(0x00000000UL, ehms_crc32_calculate(test_buffer, 0U));
+}
+
+/* ============================================================================
+ * BACKEND EQUIVALENCE TESTS
+ * ============================================================================ */
+
+/**
+ * @test Test every backend is bit-identical to the reference for all
+ *       lengths and alignments up to one snapshot
+ * @trace SRS-EHMS-108
+ */
+void test_crc32_backends_match_reference(void)
+{
+    for (uint32_t offset = 0U; offset < 8U; offset++)
+    {
+        for (uint32_t length = 0U;
+             length <= (uint32_t)sizeof(ehms_engine_snapshot_t);
+             length++)
+        {
+            const uint8_t* data = &test_buffer[offset];
+            uint32_t expected = reference_crc32(data, length);
+            
+            TEST_ASSERT_EQUAL_HEX32(expected,
+                ~ehms_crc32_update_table(EHMS_CRC32_INITIAL, data, length));
+            TEST_ASSERT_EQUAL_HEX32(expected,
+                ~ehms_crc32_update_slicing8(EHMS_CRC32_INITIAL, data, length));
+#if defined(__ARM_FEATURE_CRC32)
+            TEST_ASSERT_EQUAL_HEX32(expected,
+                ~ehms_crc32_update_armv8(EHMS_CRC32_INITIAL, data, length));
+#endif
+            TEST_ASSERT_EQUAL_HEX32(expected, ehms_crc32_calculate(data, length));
+        }
+    }
+}
+
+/**
+ * @test Test CRC over split buffers equals CRC over whole buffer
+ * @trace SRS-EHMS-108
+ */
+void test_crc32_split_update(void)
+{
+    uint32_t length = (uint32_t)sizeof(ehms_engine_snapshot_t);
+    uint32_t expected = ehms_crc32_calculate(test_buffer, length);
+    
+    for (uint32_t split = 0U; split <= length; split += 7U)
+    {
+        uint32_t crc = ehms_crc32_update(EHMS_CRC32_INITIAL, test_buffer, split);
+        crc = ehms_crc32_update(crc, &test_buffer[split], length - split);
+        
+        TEST_ASSERT_EQUAL_HEX32(expected, ~crc);
+    }
+}
+
+/**
+ * @test Test zero-extension operator places a segment CRC at its position
+ * @trace SRS-EHMS-108
+ */
+void test_crc32_shift_combines_segments(void)
+{
+    ehms_crc32_shift_t op_a;
+    ehms_crc32_shift_t op_b;
+    ehms_crc32_shift_t op_ab;
+    uint32_t length = (uint32_t)sizeof(ehms_engine_snapshot_t);
+    uint32_t expected = ehms_crc32_update(EHMS_CRC32_INITIAL, test_buffer, length);
+    
+    for (uint32_t split = 0U; split <= length; split += 13U)
+    {
+        uint32_t head = ehms_crc32_update(EHMS_CRC32_INITIAL, test_buffer, split);
+        uint32_t tail = ehms_crc32_update(0U, &test_buffer[split], length - split);
+        
+        ehms_crc32_shift_init(&op_a, length - split);
+        TEST_ASSERT_EQUAL_HEX32(expected, ehms_crc32_shift_apply(&op_a, head) ^ tail);
+    }
+    
+    /* Composition equals a single operator over the summed length */
+    ehms_crc32_shift_init(&op_a, 28U);
+    ehms_crc32_shift_init(&op_b, 1340U);
+    ehms_crc32_shift_compose(&op_ab, &op_a, &op_b);
+    TEST_ASSERT_EQUAL_HEX32(ehms_crc32_zeros(0xDEADBEEFUL, 1368U),
+                            ehms_crc32_shift_apply(&op_ab, 0xDEADBEEFUL));
+}
+
+/* ============================================================================
+ * TEST RUNNER
+ * ============================================================================ */
+
+int main(void)
+{
+    UNITY_BEGIN();
+    
+    /* Known answer tests */
+    RUN_TEST(test_crc32_check_value);
+    RUN_TEST(test_crc32_empty_buffer);
+    
+    /* Backend equivalence tests */
+    RUN_TEST(test_crc32_backends_match_reference);
+    RUN_TEST(test_crc32_split_update);
+    RUN_TEST(test_crc32_shift_combines_segments);
+    
+    return UNITY_END();
+}
+
+/* END OF FILE */
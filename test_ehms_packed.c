@@ -0,0 +1,304 @@
+/**
+ * @file test_ehms_packed.c
+ * @brief Unit Tests for Packed Snapshot and Alert Records
+ *
+ * @copyright Copyright (c) 2026 AeroTech Avionics Inc.
+ *
+ * Test Framework: Unity Test Framework
+ * Coverage Target: 100% MC/DC
+ *
+ * Requirements Verified:
+ *   SRS-EHMS-040, SRS-EHMS-050, SRS-EHMS-055
+ */
+
+#include "unity.h"
+#include "ehms_packed.h"
+#include "ehms_types.h"
+#include "ehms_crc32.h"
+
+#include <string.h>
+
+/* ============================================================================
+ * TEST FIXTURES
+ * ============================================================================ */
+
+/** @brief Snapshot bytes covered by the CRC (everything before crc32) */
+#define TEST_SNAPSHOT_CRC_LENGTH    (sizeof(ehms_engine_snapshot_t) - sizeof(uint32_t))
+
+static const ehms_timestamp_t test_epoch = { 2028U, 2U, 28U, 23U, 59U, 59U, 500U };
+
+static ehms_engine_snapshot_t test_snapshot;
+static ehms_engine_snapshot_t test_unpacked;
+static ehms_packed_snapshot_t test_packed;
+
+/**
+ * @brief Calendar timestamp from its fields
+ */
+static ehms_timestamp_t make_time(uint16_t year, uint8_t month, uint8_t day, uint8_t hour,
+                                  uint8_t minute, uint8_t second, uint16_t millisecond)
+{
+    ehms_timestamp_t time;
+    
+    (void)memset(&time, 0, sizeof(time));
+    time.year = year;
+    time.month = month;
+    time.day = day;
+    time.hour = hour;
+    time.minute = minute;
+    time.second = second;
+    time.millisecond = millisecond;
+    
+    return time;
+}
+
+/**
+ * @brief Build a snapshot as acquisition does, crc32 included
+ *
+ * Parameters are sampled around midnight into the leap day; parameters
+ * from EHMS_PARAM_VIB_FAN_N1 on were never sampled.
+ */
+static void make_snapshot(void)
+{
+    (void)memset(&test_snapshot, 0, sizeof(test_snapshot));
+    test_snapshot.engine_id = EHMS_ENGINE_2;
+    test_snapshot.sample_time = make_time(2028U, 2U, 29U, 0U, 0U, 0U, 250U);
+    test_snapshot.flight_phase = (uint32_t)EHMS_FLIGHT_PHASE_CLIMB;
+    test_snapshot.health_status = EHMS_HEALTH_MONITOR;
+    
+    for (uint32_t p = 0U; p < EHMS_PARAM_COUNT; p++)
+    {
+        ehms_parameter_t* param = &test_snapshot.parameters[p];
+        
+        param->param_id = (ehms_param_id_t)p;
+        
+        if (p < (uint32_t)EHMS_PARAM_VIB_FAN_N1)
+        {
+            param->status = (p == (uint32_t)EHMS_PARAM_OIL_QTY) ? EHMS_PARAM_STALE :
+                                                                  EHMS_PARAM_VALID;
+            param->raw_value = (p == (uint32_t)EHMS_PARAM_FF) ? INT32_MIN : (int32_t)(p * 1000U);
+            param->eng_value = (float)p * 12.5f;
+            param->source_bus = (uint8_t)(p % EHMS_ARINC429_BUS_COUNT);
+            param->timestamp = (p < 8U) ? make_time(2028U, 2U, 28U, 23U, 59U, 59U, 990U) :
+                                          make_time(2028U, 2U, 29U, 0U, 0U, 0U, 240U);
+        }
+        else
+        {
+            param->status = EHMS_PARAM_NCD;
+        }
+    }
+    
+    test_snapshot.crc32 = ehms_crc32_calculate(&test_snapshot, TEST_SNAPSHOT_CRC_LENGTH);
+}
+
+void setUp(void)
+{
+    make_snapshot();
+    (void)memset(&test_unpacked, 0xA5, sizeof(test_unpacked));
+    (void)memset(&test_packed, 0, sizeof(test_packed));
+}
+
+void tearDown(void)
+{
+}
+
+/* ============================================================================
+ * SNAPSHOT TESTS
+ * ============================================================================ */
+
+/**
+ * @test Test an unpacked snapshot is identical to the packed one
+ * @trace SRS-EHMS-050
+ */
+void test_pack_snapshot_round_trip(void)
+{
+    TEST_ASSERT_EQUAL(EHMS_OK, ehms_pack_snapshot(&test_snapshot, &test_epoch, &test_packed));
+    
+    TEST_ASSERT_EQUAL_UINT32(750U, test_packed.time_ms);
+    TEST_ASSERT_EQUAL_UINT32(490U, test_packed.parameters[EHMS_PARAM_N1].time_ms);
+    TEST_ASSERT_EQUAL_UINT32(EHMS_PACKED_NO_TIME,
+                             test_packed.parameters[EHMS_PARAM_VIB_FAN_N1].time_ms);
+    TEST_ASSERT_EQUAL_UINT32((uint32_t)EHMS_PARAM_STALE,
+                             test_packed.parameters[EHMS_PARAM_OIL_QTY].status);
+    
+    TEST_ASSERT_EQUAL(EHMS_OK, ehms_unpack_snapshot(&test_packed, &test_epoch, &test_unpacked));
+    
+    TEST_ASSERT_EQUAL_MEMORY(&test_snapshot, &test_unpacked, sizeof(test_snapshot));
+    TEST_ASSERT_EQUAL_UINT32(ehms_crc32_calculate(&test_unpacked, TEST_SNAPSHOT_CRC_LENGTH),
+                             test_unpacked.crc32);
+}
+
+/**
+ * @test Test the packed snapshot is at most 60% of the snapshot
+ * @trace SRS-EHMS-050
+ */
+void test_pack_snapshot_footprint(void)
+{
+    TEST_ASSERT_LESS_OR_EQUAL((sizeof(ehms_engine_snapshot_t) * 6U) / 10U,
+                              sizeof(ehms_packed_snapshot_t));
+    TEST_ASSERT_LESS_OR_EQUAL(sizeof(ehms_alert_t) / 4U, sizeof(ehms_packed_alert_t));
+}
+
+/**
+ * @test Test times convert across day, month and year ends
+ * @trace SRS-EHMS-040
+ */
+void test_pack_calendar_boundaries(void)
+{
+    static const ehms_timestamp_t epoch = { 2099U, 12U, 1U, 0U, 0U, 0U, 0U };
+    const ehms_timestamp_t times[3] =
+    {
+        make_time(2099U, 12U, 1U, 0U, 0U, 0U, 0U),
+        make_time(2099U, 12U, 31U, 23U, 59U, 59U, 999U),
+        make_time(2099U, 12U, 2U, 12U, 0U, 0U, 1U),
+    };
+    const uint32_t expected_ms[3] = { 0U, 2678399999U, 129600001U };
+    
+    for (uint32_t i = 0U; i < 3U; i++)
+    {
+        test_snapshot.sample_time = times[i];
+        for (uint32_t p = 0U; p < EHMS_PARAM_COUNT; p++)
+        {
+            test_snapshot.parameters[p].timestamp = times[i];
+        }
+        TEST_ASSERT_EQUAL(EHMS_OK, ehms_pack_snapshot(&test_snapshot, &epoch, &test_packed));
+        TEST_ASSERT_EQUAL_UINT32(expected_ms[i], test_packed.time_ms);
+        TEST_ASSERT_EQUAL(EHMS_OK, ehms_unpack_snapshot(&test_packed, &epoch, &test_unpacked));
+        TEST_ASSERT_EQUAL_MEMORY(&times[i], &test_unpacked.sample_time, sizeof(times[i]));
+    }
+    
+    /* One millisecond into 2100 is beyond the calendar */
+    test_packed.time_ms = 2678400000U;
+    TEST_ASSERT_EQUAL(EHMS_ERROR_RANGE, ehms_unpack_snapshot(&test_packed, &epoch, &test_unpacked));
+}
+
+/**
+ * @test Test fields and times the packed form cannot hold are rejected
+ * @trace SRS-EHMS-050
+ */
+void test_pack_snapshot_range(void)
+{
+    static const ehms_timestamp_t bad_epoch = { 2027U, 2U, 29U, 0U, 0U, 0U, 0U };
+    
+    /* Before the epoch */
+    test_snapshot.parameters[EHMS_PARAM_EGT].timestamp = make_time(2028U, 2U, 28U, 23U, 59U,
+                                                                   59U, 499U);
+    TEST_ASSERT_EQUAL(EHMS_ERROR_RANGE,
+                      ehms_pack_snapshot(&test_snapshot, &test_epoch, &test_packed));
+    
+    /* 2^32 - 1 ms after the epoch is reserved */
+    test_snapshot.parameters[EHMS_PARAM_EGT].timestamp = make_time(2028U, 4U, 18U, 17U, 2U,
+                                                                   46U, 795U);
+    TEST_ASSERT_EQUAL(EHMS_ERROR_RANGE,
+                      ehms_pack_snapshot(&test_snapshot, &test_epoch, &test_packed));
+    test_snapshot.parameters[EHMS_PARAM_EGT].timestamp.millisecond = 794U;
+    TEST_ASSERT_EQUAL(EHMS_OK, ehms_pack_snapshot(&test_snapshot, &test_epoch, &test_packed));
+    TEST_ASSERT_EQUAL_UINT32(0xFFFFFFFEUL, test_packed.parameters[EHMS_PARAM_EGT].time_ms);
+    
+    /* Not a calendar date */
+    test_snapshot.parameters[EHMS_PARAM_EGT].timestamp = make_time(2028U, 2U, 30U, 0U, 0U,
+                                                                   0U, 0U);
+    TEST_ASSERT_EQUAL(EHMS_ERROR_RANGE,
+                      ehms_pack_snapshot(&test_snapshot, &test_epoch, &test_packed));
+    TEST_ASSERT_EQUAL(EHMS_ERROR_RANGE,
+                      ehms_pack_snapshot(&test_snapshot, &bad_epoch, &test_packed));
+    
+    /* Identifiers are implied by position */
+    make_snapshot();
+    test_snapshot.parameters[EHMS_PARAM_N2].param_id = EHMS_PARAM_N1;
+    TEST_ASSERT_EQUAL(EHMS_ERROR_RANGE,
+                      ehms_pack_snapshot(&test_snapshot, &test_epoch, &test_packed));
+    
+    make_snapshot();
+    test_snapshot.engine_id = EHMS_ENGINE_COUNT;
+    TEST_ASSERT_EQUAL(EHMS_ERROR_RANGE,
+                      ehms_pack_snapshot(&test_snapshot, &test_epoch, &test_packed));
+}
+
+/* ============================================================================
+ * ALERT TESTS
+ * ============================================================================ */
+
+/**
+ * @test Test an alert unpacks with its flags, times and message
+ * @trace SRS-EHMS-055
+ */
+void test_pack_alert_round_trip(void)
+{
+    ehms_alert_t alert;
+    ehms_alert_t unpacked;
+    ehms_packed_alert_t packed;
+    
+    (void)memset(&alert, 0, sizeof(alert));
+    alert.alert_id = 77U;
+    alert.level = EHMS_ALERT_CAUTION;
+    alert.engine_id = EHMS_ENGINE_1;
+    alert.param_id = EHMS_PARAM_OIL_PRESS;
+    alert.onset_time = make_time(2028U, 3U, 1U, 0U, 0U, 1U, 0U);
+    alert.is_active = true;
+    alert.is_latched = true;
+    alert.ecam_code = 0x0105U;
+    (void)strcpy(alert.message, "ENG 1 OIL PRESS LO");
+    
+    TEST_ASSERT_EQUAL(EHMS_OK, ehms_pack_alert(&alert, &test_epoch, &packed));
+    TEST_ASSERT_EQUAL_UINT32(86401500U, packed.onset_ms);
+    TEST_ASSERT_EQUAL_UINT32(EHMS_PACKED_NO_TIME, packed.clear_ms);
+    TEST_ASSERT_EQUAL_UINT32(EHMS_PACKED_ALERT_ACTIVE | EHMS_PACKED_ALERT_LATCHED, packed.flags);
+    
+    /* The message is rendered again from the ECAM code */
+    TEST_ASSERT_EQUAL(EHMS_OK, ehms_unpack_alert(&packed, &test_epoch, "ENG 1 OIL PRESS LO",
+                                                 &unpacked));
+    TEST_ASSERT_EQUAL_MEMORY(&alert, &unpacked, sizeof(alert));
+    
+    TEST_ASSERT_EQUAL(EHMS_OK, ehms_unpack_alert(&packed, &test_epoch, NULL, &unpacked));
+    TEST_ASSERT_EQUAL_UINT32(0U, strlen(unpacked.message));
+    
+    alert.level = (ehms_alert_level_t)(EHMS_ALERT_WARNING + 1U);
+    TEST_ASSERT_EQUAL(EHMS_ERROR_RANGE, ehms_pack_alert(&alert, &test_epoch, &packed));
+}
+
+/**
+ * @test Test NULL arguments are rejected
+ * @trace SRS-EHMS-050, SRS-EHMS-055
+ */
+void test_pack_invalid_arguments(void)
+{
+    ehms_alert_t alert;
+    ehms_packed_alert_t packed;
+    
+    (void)memset(&alert, 0, sizeof(alert));
+    (void)memset(&packed, 0, sizeof(packed));
+    
+    TEST_ASSERT_EQUAL(EHMS_ERROR_PARAM, ehms_pack_snapshot(NULL, &test_epoch, &test_packed));
+    TEST_ASSERT_EQUAL(EHMS_ERROR_PARAM, ehms_pack_snapshot(&test_snapshot, NULL, &test_packed));
+    TEST_ASSERT_EQUAL(EHMS_ERROR_PARAM, ehms_pack_snapshot(&test_snapshot, &test_epoch, NULL));
+    TEST_ASSERT_EQUAL(EHMS_ERROR_PARAM, ehms_unpack_snapshot(NULL, &test_epoch, &test_unpacked));
+    TEST_ASSERT_EQUAL(EHMS_ERROR_PARAM, ehms_unpack_snapshot(&test_packed, NULL, &test_unpacked));
+    TEST_ASSERT_EQUAL(EHMS_ERROR_PARAM, ehms_unpack_snapshot(&test_packed, &test_epoch, NULL));
+    TEST_ASSERT_EQUAL(EHMS_ERROR_PARAM, ehms_pack_alert(NULL, &test_epoch, &packed));
+    TEST_ASSERT_EQUAL(EHMS_ERROR_PARAM, ehms_pack_alert(&alert, &test_epoch, NULL));
+    TEST_ASSERT_EQUAL(EHMS_ERROR_PARAM, ehms_unpack_alert(NULL, &test_epoch, NULL, &alert));
+    TEST_ASSERT_EQUAL(EHMS_ERROR_PARAM, ehms_unpack_alert(&packed, &test_epoch, NULL, NULL));
+}
+
+/* ============================================================================
+ * TEST RUNNER
+ * ============================================================================ */
+
+int main(void)
+{
+    UNITY_BEGIN();
+    
+    /* Snapshot tests */
+    RUN_TEST(test_pack_snapshot_round_trip);
+    RUN_TEST(test_pack_snapshot_footprint);
+    RUN_TEST(test_pack_calendar_boundaries);
+    RUN_TEST(test_pack_snapshot_range);
+    
+    /* Alert tests */
+    RUN_TEST(test_pack_alert_round_trip);
+    RUN_TEST(test_pack_invalid_arguments);
+    
+    return UNITY_END();
+}
+
+/* END OF FILE */
@@ -0,0 +1,283 @@
+/**
+ * @file test_ground_link.c
+ * @brief Unit Tests for Ground Link Change-Only Snapshot Encoding
+ *
+ * @copyright Copyright (c) 2026 AeroTech Avionics Inc.
+ *
+ * Test Framework: Unity Test Framework
+ * Coverage Target: 100% MC/DC
+ *
+ * Requirements Verified:
+ *   SRS-EHMS-108, SRS-EHMS-310
+ */
+
+#include "unity.h"
+#include "ground_link.h"
+#include "ehms_crc32.h"
+#include "ehms_types.h"
+
+#include <string.h>
+
+/* ============================================================================
+ * TEST FIXTURES
+ * ============================================================================ */
+
+#define TEST_KEYFRAME_INTERVAL  4U
+#define TEST_DEADBAND           5U
+
+static gl_config_t test_config;
+static gl_decoder_t test_decoder;
+static ehms_engine_snapshot_t test_snapshot;
+static ehms_engine_snapshot_t test_received;
+static uint8_t test_frame[GL_FRAME_MAX_BYTES];
+static uint32_t test_length;
+
+/**
+ * @brief Stamp the snapshot CRC as the acquisition module does
+ */
+static void stamp_snapshot(void)
+{
+    test_snapshot.crc32 = ehms_crc32_calculate(&test_snapshot,
+                                               sizeof(test_snapshot) - sizeof(uint32_t));
+}
+
+/**
+ * @brief Advance every parameter timestamp and the snapshot time
+ */
+static void advance_time(void)
+{
+    uint32_t ms = (test_snapshot.sample_time.millisecond + 10U) % 1000U;
+    
+    test_snapshot.sample_time.millisecond = (uint16_t)ms;
+    
+    for (uint32_t p = 0U; p < EHMS_PARAM_COUNT; p++)
+    {
+        test_snapshot.parameters[p].timestamp = test_snapshot.sample_time;
+    }
+}
+
+/**
+ * @brief Encode the snapshot and decode it on the ground
+ */
+static ehms_result_t downlink(void)
+{
+    ehms_result_t result;
+    
+    stamp_snapshot();
+    result = gl_encode(&test_snapshot, test_frame, sizeof(test_frame), &test_length);
+    
+    if (result == EHMS_OK)
+    {
+        result = gl_decode(&test_decoder, test_frame, test_length, &test_received);
+    }
+    
+    return result;
+}
+
+void setUp(void)
+{
+    (void)memset(&test_config, 0, sizeof(test_config));
+    test_config.keyframe_interval = TEST_KEYFRAME_INTERVAL;
+    
+    for (uint32_t p = 0U; p < EHMS_PARAM_COUNT; p++)
+    {
+        test_config.deadband[p] = TEST_DEADBAND;
+    }
+    
+    (void)gl_init(&test_config);
+    gl_decoder_init(&test_decoder);
+    
+    (void)memset(&test_snapshot, 0, sizeof(test_snapshot));
+    test_snapshot.engine_id = EHMS_ENGINE_2;
+    test_snapshot.sample_time.year = 2026U;
+    test_snapshot.sample_time.month = 10U;
+    test_snapshot.sample_time.day = 14U;
+    test_snapshot.flight_phase = 3U;
+    
+    for (uint32_t p = 0U; p < EHMS_PARAM_COUNT; p++)
+    {
+        test_snapshot.parameters[p].param_id = (ehms_param_id_t)p;
+        test_snapshot.parameters[p].raw_value = (int32_t)(p * 100U) - 1000;
+        test_snapshot.parameters[p].eng_value = (float)p * 0.5f;
+        test_snapshot.parameters[p].source_bus = (uint8_t)(p % 4U);
+    }
+    
+    advance_time();
+}
+
+void tearDown(void)
+{
+}
+
+/* ============================================================================
+ * ENCODING TESTS
+ * ============================================================================ */
+
+/**
+ * @test Test a keyframe reconstructs the snapshot with its own crc32
+ * @trace SRS-EHMS-108
+ */
+void test_gl_keyframe_reconstructs_snapshot(void)
+{
+    TEST_ASSERT_EQUAL(EHMS_OK, downlink());
+    
+    TEST_ASSERT_EQUAL_UINT8(GL_FRAME_KEY, test_frame[0]);
+    TEST_ASSERT_EQUAL_UINT32(GL_FRAME_MAX_BYTES, test_length);
+    TEST_ASSERT_EQUAL_HEX32(test_snapshot.crc32, test_received.crc32);
+    TEST_ASSERT_EQUAL_MEMORY(&test_snapshot, &test_received, sizeof(test_snapshot));
+}
+
+/**
+ * @test Test delta frames carry only slots changed beyond the deadband
+ * @trace SRS-EHMS-310
+ */
+void test_gl_delta_deadband(void)
+{
+    gl_statistics_t stats;
+    
+    TEST_ASSERT_EQUAL(EHMS_OK, downlink());
+    
+    /* Within deadband: not sent, ground keeps the keyframe value */
+    advance_time();
+    test_snapshot.parameters[EHMS_PARAM_N1].raw_value += (int32_t)TEST_DEADBAND;
+    TEST_ASSERT_EQUAL(EHMS_OK, downlink());
+    TEST_ASSERT_EQUAL_UINT8(GL_FRAME_DELTA, test_frame[0]);
+    TEST_ASSERT_EQUAL_UINT32(GL_HEADER_BYTES + GL_BITMAP_BYTES + GL_CRC_BYTES, test_length);
+    TEST_ASSERT_EQUAL_INT32(test_snapshot.parameters[EHMS_PARAM_N1].raw_value -
+                            (int32_t)TEST_DEADBAND,
+                            test_received.parameters[EHMS_PARAM_N1].raw_value);
+    TEST_ASSERT_EQUAL_UINT16(test_snapshot.sample_time.millisecond,
+                             test_received.sample_time.millisecond);
+    
+    /* Beyond deadband of the value last sent, and a status change */
+    advance_time();
+    test_snapshot.parameters[EHMS_PARAM_N1].raw_value += 1;
+    test_snapshot.parameters[EHMS_PARAM_EGT].status = EHMS_PARAM_STALE;
+    TEST_ASSERT_EQUAL(EHMS_OK, downlink());
+    TEST_ASSERT_EQUAL_UINT32(GL_HEADER_BYTES + GL_BITMAP_BYTES + (2U * GL_ENTRY_BYTES) +
+                             GL_CRC_BYTES, test_length);
+    TEST_ASSERT_EQUAL_MEMORY(&test_snapshot.parameters[EHMS_PARAM_N1],
+                             &test_received.parameters[EHMS_PARAM_N1],
+                             sizeof(ehms_parameter_t));
+    TEST_ASSERT_EQUAL(EHMS_PARAM_STALE, test_received.parameters[EHMS_PARAM_EGT].status);
+    
+    TEST_ASSERT_EQUAL(EHMS_OK, gl_get_statistics(EHMS_ENGINE_2, &stats));
+    TEST_ASSERT_EQUAL_UINT32(3U, stats.frames);
+    TEST_ASSERT_EQUAL_UINT32(1U, stats.keyframes);
+    TEST_ASSERT_EQUAL_UINT32(EHMS_PARAM_COUNT + 2U, stats.slots_sent);
+}
+
+/**
+ * @test Test keyframes are sent periodically and on request
+ * @trace SRS-EHMS-310
+ */
+void test_gl_periodic_keyframes(void)
+{
+    for (uint32_t f = 0U; f < (2U * TEST_KEYFRAME_INTERVAL); f++)
+    {
+        advance_time();
+        TEST_ASSERT_EQUAL(EHMS_OK, downlink());
+        TEST_ASSERT_EQUAL_UINT8(((f % TEST_KEYFRAME_INTERVAL) == 0U) ? GL_FRAME_KEY :
+                                                                       GL_FRAME_DELTA,
+                                test_frame[0]);
+    }
+    
+    TEST_ASSERT_EQUAL(EHMS_OK, gl_request_keyframe(EHMS_ENGINE_2));
+    TEST_ASSERT_EQUAL(EHMS_OK, downlink());
+    TEST_ASSERT_EQUAL_UINT8(GL_FRAME_KEY, test_frame[0]);
+}
+
+/* ============================================================================
+ * GROUND DECODER TESTS
+ * ============================================================================ */
+
+/**
+ * @test Test a lost frame stops reconstruction until the next keyframe
+ * @trace SRS-EHMS-310
+ */
+void test_gl_lost_frame_needs_keyframe(void)
+{
+    TEST_ASSERT_EQUAL(EHMS_OK, downlink());
+    
+    /* Frame lost on the link */
+    test_snapshot.parameters[EHMS_PARAM_FF].raw_value += 100;
+    stamp_snapshot();
+    TEST_ASSERT_EQUAL(EHMS_OK, gl_encode(&test_snapshot, test_frame, sizeof(test_frame),
+                                         &test_length));
+    
+    test_snapshot.parameters[EHMS_PARAM_FF].raw_value += 100;
+    TEST_ASSERT_EQUAL(EHMS_ERROR, downlink());
+    
+    TEST_ASSERT_EQUAL(EHMS_OK, gl_request_keyframe(EHMS_ENGINE_2));
+    TEST_ASSERT_EQUAL(EHMS_OK, downlink());
+    TEST_ASSERT_EQUAL_MEMORY(&test_snapshot, &test_received, sizeof(test_snapshot));
+}
+
+/**
+ * @test Test corrupted frames and snapshots are rejected
+ * @trace SRS-EHMS-108
+ */
+void test_gl_corruption_rejected(void)
+{
+    TEST_ASSERT_EQUAL(EHMS_OK, downlink());
+    
+    test_snapshot.parameters[EHMS_PARAM_OIL_PRESS].raw_value += 100;
+    stamp_snapshot();
+    TEST_ASSERT_EQUAL(EHMS_OK, gl_encode(&test_snapshot, test_frame, sizeof(test_frame),
+                                         &test_length));
+    test_frame[GL_HEADER_BYTES + GL_BITMAP_BYTES + 3U] ^= 0x10U;
+    TEST_ASSERT_EQUAL(EHMS_ERROR_CRC, gl_decode(&test_decoder, test_frame, test_length,
+                                                &test_received));
+    TEST_ASSERT_EQUAL(EHMS_ERROR_CRC, gl_decode(&test_decoder, test_frame, test_length - 1U,
+                                                &test_received));
+    
+    /* A snapshot failing its own CRC is never encoded */
+    test_snapshot.crc32 ^= 1U;
+    TEST_ASSERT_EQUAL(EHMS_ERROR_CRC, gl_encode(&test_snapshot, test_frame, sizeof(test_frame),
+                                                &test_length));
+}
+
+/**
+ * @test Test invalid arguments are rejected
+ * @trace SRS-EHMS-310
+ */
+void test_gl_invalid_arguments(void)
+{
+    gl_statistics_t stats;
+    
+    test_config.keyframe_interval = 0U;
+    TEST_ASSERT_EQUAL(EHMS_ERROR_CONFIG, gl_init(&test_config));
+    TEST_ASSERT_EQUAL(EHMS_ERROR_PARAM, gl_init(NULL));
+    TEST_ASSERT_EQUAL(EHMS_ERROR_PARAM, gl_encode(NULL, test_frame, sizeof(test_frame),
+                                                  &test_length));
+    stamp_snapshot();
+    TEST_ASSERT_EQUAL(EHMS_ERROR_RANGE, gl_encode(&test_snapshot, test_frame,
+                                                  GL_FRAME_MAX_BYTES - 1U, &test_length));
+    TEST_ASSERT_EQUAL(EHMS_ERROR_RANGE, gl_request_keyframe(EHMS_ENGINE_COUNT));
+    TEST_ASSERT_EQUAL(EHMS_ERROR_PARAM, gl_get_statistics(EHMS_ENGINE_1, NULL));
+    TEST_ASSERT_EQUAL(EHMS_ERROR_RANGE, gl_get_statistics(EHMS_ENGINE_COUNT, &stats));
+    TEST_ASSERT_EQUAL(EHMS_ERROR_PARAM, gl_decode(NULL, test_frame, 1U, &test_received));
+}
+
+/* ============================================================================
+ * TEST RUNNER
+ * ============================================================================ */
+
+int main(void)
+{
+    UNITY_BEGIN();
+    
+    /* Encoding tests */
+    RUN_TEST(test_gl_keyframe_reconstructs_snapshot);
+    RUN_TEST(test_gl_delta_deadband);
+    RUN_TEST(test_gl_periodic_keyframes);
+    
+    /* Ground decoder tests */
+    RUN_TEST(test_gl_lost_frame_needs_keyframe);
+    RUN_TEST(test_gl_corruption_rejected);
+    RUN_TEST(test_gl_invalid_arguments);
+    
+    return UNITY_END();
+}
+
+/* END OF FILE */
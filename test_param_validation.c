@@ -0,0 +1,282 @@
+/**
+ * @file test_param_validation.c
+ * @brief Unit Tests for Batch Parameter Validation Kernel
+ *
+ * @copyright Copyright (c) 2026 AeroTech Avionics Inc.
+ *
+ * Test Framework: Unity Test Framework
+ * Coverage Target: 100% MC/DC
+ *
+ * Requirements Verified:
+ *   SRS-EHMS-101, SRS-EHMS-102
+ */
+
+#include "unity.h"
+#include "param_validation.h"
+#include "ehms_types.h"
+
+#include <math.h>
+
+/* ============================================================================
+ * TEST FIXTURES
+ * ============================================================================ */
+
+#define TEST_COUNT          EHMS_PARAM_COUNT
+#define TEST_TIMEOUT_MS     100U
+
+static uint8_t  test_status[TEST_COUNT];
+static float    test_value[TEST_COUNT];
+static uint32_t test_timestamp[TEST_COUNT];
+static float    test_min[TEST_COUNT];
+static float    test_max[TEST_COUNT];
+static uint32_t test_timeout[TEST_COUNT];
+
+/**
+ * @brief Reference: the per-parameter range check followed by the
+ *        staleness check that the kernel replaces
+ */
+static uint8_t reference_status(uint8_t status, float value, uint32_t timestamp,
+                                float min_value, float max_value, uint32_t now)
+{
+    if ((value < min_value) || (value > max_value))
+    {
+        status = (uint8_t)EHMS_PARAM_FAILED;
+    }
+    
+    if ((now - timestamp) > TEST_TIMEOUT_MS)
+    {
+        if (status == (uint8_t)EHMS_PARAM_VALID)
+        {
+            status = (uint8_t)EHMS_PARAM_STALE;
+        }
+    }
+    
+    return status;
+}
+
+void setUp(void)
+{
+    for (uint32_t i = 0U; i < TEST_COUNT; i++)
+    {
+        test_status[i] = (uint8_t)EHMS_PARAM_VALID;
+        test_value[i] = 50.0f;
+        test_timestamp[i] = 1000U;
+        test_min[i] = 0.0f;
+        test_max[i] = 100.0f;
+        test_timeout[i] = TEST_TIMEOUT_MS;
+    }
+}
+
+void tearDown(void)
+{
+}
+
+/* ============================================================================
+ * STATUS SEMANTICS TESTS
+ * ============================================================================ */
+
+/**
+ * @test Test in-range, fresh parameters are unchanged
+ * @trace SRS-EHMS-101
+ */
+void test_validate_all_valid(void)
+{
+    uint64_t changed = param_validate_batch(test_status, test_value, test_timestamp,
+                                            test_min, test_max, 1050U,
+                                            test_timeout, TEST_COUNT);
+    
+    TEST_ASSERT_EQUAL_HEX64(0ULL, changed);
+    for (uint32_t i = 0U; i < TEST_COUNT; i++)
+    {
+        TEST_ASSERT_EQUAL(EHMS_PARAM_VALID, test_status[i]);
+    }
+}
+
+/**
+ * @test Test FAILED takes precedence over STALE and limits are inclusive
+ * @trace SRS-EHMS-101, SRS-EHMS-102
+ */
+void test_validate_failed_precedence(void)
+{
+    test_value[0] = 100.5f;         /* Above max, stale */
+    test_value[1] = -0.5f;          /* Below max, fresh */
+    test_value[2] = 100.0f;         /* On limit: valid */
+    test_value[3] = 0.0f;           /* On limit: valid */
+    test_timestamp[0] = 0U;
+    
+    uint64_t changed = param_validate_batch(test_status, test_value, test_timestamp,
+                                            test_min, test_max, 1050U,
+                                            test_timeout, TEST_COUNT);
+    
+    TEST_ASSERT_EQUAL(EHMS_PARAM_FAILED, test_status[0]);
+    TEST_ASSERT_EQUAL(EHMS_PARAM_FAILED, test_status[1]);
+    TEST_ASSERT_EQUAL(EHMS_PARAM_VALID, test_status[2]);
+    TEST_ASSERT_EQUAL(EHMS_PARAM_VALID, test_status[3]);
+    TEST_ASSERT_EQUAL_HEX64(0x3ULL, changed);
+}
+
+/**
+ * @test Test STALE applies only to VALID data and survives time wrap
+ * @trace SRS-EHMS-102
+ */
+void test_validate_stale_only_when_valid(void)
+{
+    test_timestamp[0] = 0xFFFFFFF0UL;   /* 0x60 ms old across wrap: fresh */
+    test_timestamp[1] = 0xFFFFFF00UL;   /* 0x150 ms old across wrap: stale */
+    test_timestamp[2] = 0U;
+    test_status[2] = (uint8_t)EHMS_PARAM_NCD;
+    test_timestamp[3] = 0U;
+    test_status[3] = (uint8_t)EHMS_PARAM_TEST;
+    
+    (void)param_validate_batch(test_status, test_value, test_timestamp,
+                               test_min, test_max, 0x50U,
+                               test_timeout, TEST_COUNT);
+    
+    TEST_ASSERT_EQUAL(EHMS_PARAM_VALID, test_status[0]);
+    TEST_ASSERT_EQUAL(EHMS_PARAM_STALE, test_status[1]);
+    TEST_ASSERT_EQUAL(EHMS_PARAM_NCD, test_status[2]);
+    TEST_ASSERT_EQUAL(EHMS_PARAM_TEST, test_status[3]);
+}
+
+/**
+ * @test Test each parameter is aged against its own timeout
+ * @trace SRS-EHMS-102
+ */
+void test_validate_per_parameter_timeout(void)
+{
+    for (uint32_t i = 0U; i < 8U; i++)
+    {
+        test_timestamp[i] = 1000U;
+        test_timeout[i] = ((i % 2U) == 0U) ? TEST_TIMEOUT_MS : (10U * TEST_TIMEOUT_MS);
+    }
+    
+    uint64_t changed = param_validate_batch(test_status, test_value, test_timestamp,
+                                            test_min, test_max, 1000U + (2U * TEST_TIMEOUT_MS),
+                                            test_timeout, 8U);
+    
+    TEST_ASSERT_EQUAL_HEX64(0x55ULL, changed);
+    TEST_ASSERT_EQUAL(EHMS_PARAM_STALE, test_status[6]);
+    TEST_ASSERT_EQUAL(EHMS_PARAM_VALID, test_status[7]);
+}
+
+/**
+ * @test Test NaN values and unbounded limits never fail
+ * @trace SRS-EHMS-101
+ */
+void test_validate_nan_and_unbounded(void)
+{
+    test_value[0] = NAN;
+    test_value[1] = 1.0e30f;
+    test_min[1] = -INFINITY;
+    test_max[1] = INFINITY;
+    
+    (void)param_validate_batch(test_status, test_value, test_timestamp,
+                               test_min, test_max, 1000U,
+                               test_timeout, TEST_COUNT);
+    
+    TEST_ASSERT_EQUAL(EHMS_PARAM_VALID, test_status[0]);
+    TEST_ASSERT_EQUAL(EHMS_PARAM_VALID, test_status[1]);
+}
+
+/**
+ * @test Test kernel is bit-exact with the reference for every status,
+ *       range and age combination and for vector tail lengths
+ * @trace SRS-EHMS-101, SRS-EHMS-102
+ */
+void test_validate_matches_reference(void)
+{
+    static const float values[4] = { -1.0f, 0.0f, 50.0f, 101.0f };
+    static const uint32_t ages[3] = { 0U, TEST_TIMEOUT_MS, TEST_TIMEOUT_MS + 1U };
+    uint8_t expected[TEST_COUNT];
+    uint32_t now = 5000U;
+    
+    for (uint32_t count = 1U; count <= TEST_COUNT; count++)
+    {
+        uint64_t expected_changed = 0ULL;
+        
+        for (uint32_t i = 0U; i < count; i++)
+        {
+            test_status[i] = (uint8_t)((i + count) % 5U);
+            test_value[i] = values[(i / 5U) % 4U];
+            test_timestamp[i] = now - ages[(i + (count / 3U)) % 3U];
+            expected[i] = reference_status(test_status[i], test_value[i], test_timestamp[i],
+                                           test_min[i], test_max[i], now);
+            if (expected[i] != test_status[i])
+            {
+                expected_changed |= 1ULL << i;
+            }
+        }
+        
+        uint64_t changed = param_validate_batch(test_status, test_value, test_timestamp,
+                                                test_min, test_max, now,
+                                                test_timeout, count);
+        
+        TEST_ASSERT_EQUAL_HEX64(expected_changed, changed);
+        TEST_ASSERT_EQUAL_MEMORY(expected, test_status, count);
+    }
+}
+
+/**
+ * @test Test fixed-point kernel matches the floating-point kernel on
+ *       values and limits in raw units
+ * @trace SRS-EHMS-101, SRS-EHMS-102
+ */
+void test_validate_fixed_matches_float(void)
+{
+    static const int32_t raw_values[5] = { INT32_MIN, -1, 0, 1000, 1001 };
+    static const uint32_t ages[3] = { 0U, TEST_TIMEOUT_MS, TEST_TIMEOUT_MS + 1U };
+    int32_t raw[TEST_COUNT];
+    int32_t min_raw[TEST_COUNT];
+    int32_t max_raw[TEST_COUNT];
+    uint8_t fixed_status[TEST_COUNT];
+    uint32_t now = 5000U;
+    
+    for (uint32_t count = 1U; count <= TEST_COUNT; count++)
+    {
+        for (uint32_t i = 0U; i < count; i++)
+        {
+            raw[i] = raw_values[(i / 3U) % 5U];
+            min_raw[i] = ((i % 7U) == 0U) ? INT32_MIN : 0;
+            max_raw[i] = ((i % 11U) == 0U) ? INT32_MAX : 1000;
+            test_value[i] = (float)raw[i];
+            test_min[i] = (min_raw[i] == INT32_MIN) ? -INFINITY : (float)min_raw[i];
+            test_max[i] = (max_raw[i] == INT32_MAX) ? INFINITY : (float)max_raw[i];
+            test_status[i] = (uint8_t)((i + count) % 5U);
+            fixed_status[i] = test_status[i];
+            test_timestamp[i] = now - ages[(i + (count / 3U)) % 3U];
+        }
+        
+        uint64_t expected_changed = param_validate_batch(test_status, test_value,
+                                                         test_timestamp, test_min,
+                                                         test_max, now,
+                                                         test_timeout, count);
+        uint64_t changed = param_validate_batch_fixed(fixed_status, raw, test_timestamp,
+                                                      min_raw, max_raw, now,
+                                                      test_timeout, count);
+        
+        TEST_ASSERT_EQUAL_HEX64(expected_changed, changed);
+        TEST_ASSERT_EQUAL_MEMORY(test_status, fixed_status, count);
+    }
+}
+
+/* ============================================================================
+ * TEST RUNNER
+ * ============================================================================ */
+
+int main(void)
+{
+    UNITY_BEGIN();
+    
+    /* Status semantics tests */
+    RUN_TEST(test_validate_all_valid);
+    RUN_TEST(test_validate_failed_precedence);
+    RUN_TEST(test_validate_stale_only_when_valid);
+    RUN_TEST(test_validate_per_parameter_timeout);
+    RUN_TEST(test_validate_nan_and_unbounded);
+    RUN_TEST(test_validate_matches_reference);
+    RUN_TEST(test_validate_fixed_matches_float);
+    
+    return UNITY_END();
+}
+
+/* END OF FILE */
@@ -0,0 +1,338 @@
+/**
+ * @file test_recorder_stream.c
+ * @brief Unit Tests for Columnar Flight Recorder Stream Format
+ *
+ * @copyright Copyright (c) 2026 AeroTech Avionics Inc.
+ *
+ * Test Framework: Unity Test Framework
+ * Coverage Target: 100% MC/DC
+ *
+ * Requirements Verified:
+ *   SRS-EHMS-108, SRS-EHMS-300
+ */
+
+#include "unity.h"
+#include "recorder_stream.h"
+#include "ehms_types.h"
+
+#include <string.h>
+
+/* ============================================================================
+ * TEST FIXTURES
+ * ============================================================================ */
+
+#define TEST_START_MS       1000U
+#define TEST_PERIOD_MS      10U
+
+static ehms_engine_block_t test_block;
+static rs_chunk_t test_chunk;
+static rs_record_t test_record;
+static uint32_t test_lcg;
+
+/**
+ * @brief Pseudo-random 32-bit value (full-width deltas)
+ */
+static uint32_t next_random(void)
+{
+    test_lcg = (test_lcg * 1664525UL) + 1013904223UL;
+    return test_lcg;
+}
+
+/**
+ * @brief Set block contents for sample n of a slowly varying signal
+ */
+static void make_slow_sample(uint32_t n)
+{
+    for (uint32_t p = 0U; p < EHMS_PARAM_COUNT; p++)
+    {
+        test_block.raw_value[p] = (int32_t)(1000U + (p * 10U) + ((n / (p + 1U)) % 3U));
+        test_block.status[p] = (uint8_t)EHMS_PARAM_VALID;
+    }
+}
+
+/**
+ * @brief Check a decoded record against the block it was recorded from
+ */
+static void assert_record_matches(uint32_t time_ms)
+{
+    TEST_ASSERT_EQUAL_UINT32(time_ms, test_record.time_ms);
+    TEST_ASSERT_EQUAL_UINT32(test_block.flight_phase, test_record.flight_phase);
+    TEST_ASSERT_EQUAL_MEMORY(test_block.raw_value, test_record.raw_value,
+                             sizeof(test_record.raw_value));
+    TEST_ASSERT_EQUAL_MEMORY(test_block.status, test_record.status,
+                             sizeof(test_record.status));
+}
+
+void setUp(void)
+{
+    (void)memset(&test_block, 0, sizeof(test_block));
+    test_block.engine_id = EHMS_ENGINE_1;
+    test_lcg = 12345U;
+    (void)rs_init();
+}
+
+void tearDown(void)
+{
+}
+
+/* ============================================================================
+ * ENCODING TESTS
+ * ============================================================================ */
+
+/**
+ * @test Test every sample of a chunk decodes to the recorded block
+ * @trace SRS-EHMS-300
+ */
+void test_rs_round_trip(void)
+{
+    static ehms_engine_block_t recorded[40];
+    bool available = false;
+    
+    for (uint32_t n = 0U; n < 40U; n++)
+    {
+        make_slow_sample(n);
+        test_block.raw_value[EHMS_PARAM_EGT] = (n == 20U) ? INT32_MIN : INT32_MAX;
+        test_block.raw_value[EHMS_PARAM_FF] = -(int32_t)n;
+        test_block.flight_phase = (n < 25U) ? (uint32_t)EHMS_FLIGHT_PHASE_CLIMB :
+                                              (uint32_t)EHMS_FLIGHT_PHASE_CRUISE;
+        test_block.status[EHMS_PARAM_OIL_QTY] = (n >= 30U) ? (uint8_t)EHMS_PARAM_STALE :
+                                                             (uint8_t)EHMS_PARAM_VALID;
+        recorded[n] = test_block;
+        TEST_ASSERT_EQUAL(EHMS_OK, rs_append(&test_block, TEST_START_MS + (n * TEST_PERIOD_MS)));
+    }
+    
+    TEST_ASSERT_EQUAL(EHMS_OK, rs_take_chunk(EHMS_ENGINE_1, &test_chunk, &available));
+    TEST_ASSERT_FALSE(available);
+    
+    /* The final partial group is emitted by the flush */
+    TEST_ASSERT_EQUAL(EHMS_OK, rs_flush(EHMS_ENGINE_1));
+    TEST_ASSERT_EQUAL(EHMS_OK, rs_take_chunk(EHMS_ENGINE_1, &test_chunk, &available));
+    TEST_ASSERT_TRUE(available);
+    
+    TEST_ASSERT_EQUAL_UINT32(RS_CHUNK_MAGIC, test_chunk.header.magic);
+    TEST_ASSERT_EQUAL_UINT32(40U, test_chunk.header.sample_count);
+    TEST_ASSERT_EQUAL_UINT32(TEST_START_MS, test_chunk.header.first_time_ms);
+    TEST_ASSERT_EQUAL_UINT32(TEST_START_MS + (39U * TEST_PERIOD_MS),
+                             test_chunk.header.last_time_ms);
+    
+    for (uint32_t n = 0U; n < 40U; n++)
+    {
+        test_block = recorded[n];
+        TEST_ASSERT_EQUAL(EHMS_OK, rs_decode_sample(&test_chunk, n, &test_record));
+        assert_record_matches(TEST_START_MS + (n * TEST_PERIOD_MS));
+    }
+    
+    TEST_ASSERT_EQUAL(EHMS_ERROR_RANGE, rs_decode_sample(&test_chunk, 40U, &test_record));
+}
+
+/**
+ * @test Test full chunks are sealed and the next chunk decodes on its own
+ * @trace SRS-EHMS-300
+ */
+void test_rs_chunk_rollover(void)
+{
+    static ehms_engine_block_t recorded[4U * RS_GROUP_SAMPLES];
+    static rs_chunk_t first_chunk;
+    rs_statistics_t stats;
+    bool available = false;
+    
+    /* Full-width deltas: a chunk holds two such groups */
+    for (uint32_t n = 0U; n < (4U * RS_GROUP_SAMPLES); n++)
+    {
+        for (uint32_t p = 0U; p < EHMS_PARAM_COUNT; p++)
+        {
+            test_block.raw_value[p] = (int32_t)next_random();
+        }
+        recorded[n] = test_block;
+        TEST_ASSERT_EQUAL(EHMS_OK, rs_append(&test_block, TEST_START_MS + (n * TEST_PERIOD_MS)));
+    }
+    
+    TEST_ASSERT_EQUAL(EHMS_OK, rs_flush(EHMS_ENGINE_1));
+    TEST_ASSERT_EQUAL(EHMS_OK, rs_take_chunk(EHMS_ENGINE_1, &first_chunk, &available));
+    TEST_ASSERT_TRUE(available);
+    TEST_ASSERT_EQUAL(EHMS_OK, rs_take_chunk(EHMS_ENGINE_1, &test_chunk, &available));
+    TEST_ASSERT_TRUE(available);
+    
+    TEST_ASSERT_EQUAL_UINT32(0U, first_chunk.header.sequence);
+    TEST_ASSERT_EQUAL_UINT32(2U * RS_GROUP_SAMPLES, first_chunk.header.sample_count);
+    TEST_ASSERT_EQUAL_UINT32(1U, test_chunk.header.sequence);
+    TEST_ASSERT_EQUAL_UINT32(2U * RS_GROUP_SAMPLES, test_chunk.header.sample_count);
+    TEST_ASSERT_EQUAL_UINT32(TEST_START_MS + (2U * RS_GROUP_SAMPLES * TEST_PERIOD_MS),
+                             test_chunk.header.first_time_ms);
+    
+    test_block = recorded[2U * RS_GROUP_SAMPLES];
+    TEST_ASSERT_EQUAL(EHMS_OK, rs_decode_sample(&test_chunk, 0U, &test_record));
+    assert_record_matches(test_chunk.header.first_time_ms);
+    
+    test_block = recorded[(4U * RS_GROUP_SAMPLES) - 1U];
+    TEST_ASSERT_EQUAL(EHMS_OK, rs_decode_sample(&test_chunk, (2U * RS_GROUP_SAMPLES) - 1U,
+                                                &test_record));
+    assert_record_matches(test_chunk.header.last_time_ms);
+    
+    TEST_ASSERT_EQUAL(EHMS_OK, rs_get_statistics(EHMS_ENGINE_1, &stats));
+    TEST_ASSERT_EQUAL_UINT32(4U * RS_GROUP_SAMPLES, stats.samples);
+    TEST_ASSERT_EQUAL_UINT32(2U, stats.chunks_sealed);
+    TEST_ASSERT_EQUAL_UINT32(0U, stats.chunks_dropped);
+}
+
+/**
+ * @test Test whole-chunk decoding matches per-sample decoding
+ * @trace SRS-EHMS-108, SRS-EHMS-300
+ */
+void test_rs_decode_chunk(void)
+{
+    static rs_record_t records[3U * RS_GROUP_SAMPLES];
+    uint32_t samples = (2U * RS_GROUP_SAMPLES) + 5U;
+    uint32_t count = 0U;
+    bool available = false;
+    
+    /* Mixed column widths and a final partial group */
+    for (uint32_t n = 0U; n < samples; n++)
+    {
+        make_slow_sample(n);
+        test_block.raw_value[EHMS_PARAM_EGT] = (int32_t)next_random();
+        test_block.status[EHMS_PARAM_OIL_QTY] = (n >= 20U) ? (uint8_t)EHMS_PARAM_STALE :
+                                                            (uint8_t)EHMS_PARAM_VALID;
+        test_block.flight_phase = n / RS_GROUP_SAMPLES;
+        TEST_ASSERT_EQUAL(EHMS_OK, rs_append(&test_block, TEST_START_MS + (n * TEST_PERIOD_MS)));
+    }
+    
+    TEST_ASSERT_EQUAL(EHMS_OK, rs_flush(EHMS_ENGINE_1));
+    TEST_ASSERT_EQUAL(EHMS_OK, rs_take_chunk(EHMS_ENGINE_1, &test_chunk, &available));
+    TEST_ASSERT_TRUE(available);
+    
+    TEST_ASSERT_EQUAL(EHMS_OK, rs_decode_chunk(&test_chunk, records, 3U * RS_GROUP_SAMPLES,
+                                               &count));
+    TEST_ASSERT_EQUAL_UINT32(samples, count);
+    
+    for (uint32_t n = 0U; n < samples; n++)
+    {
+        TEST_ASSERT_EQUAL(EHMS_OK, rs_decode_sample(&test_chunk, n, &test_record));
+        TEST_ASSERT_EQUAL_MEMORY(&test_record, &records[n], sizeof(test_record));
+    }
+    
+    TEST_ASSERT_EQUAL(EHMS_ERROR_RANGE, rs_decode_chunk(&test_chunk, records, samples - 1U,
+                                                        &count));
+    
+    test_chunk.payload[test_chunk.header.payload_length - 1U] ^= 0x01U;
+    TEST_ASSERT_EQUAL(EHMS_ERROR_CRC, rs_decode_chunk(&test_chunk, records,
+                                                      3U * RS_GROUP_SAMPLES, &count));
+}
+
+/**
+ * @test Test slowly varying data is recorded far smaller than snapshots
+ * @trace SRS-EHMS-300
+ */
+void test_rs_compression(void)
+{
+    rs_statistics_t stats;
+    uint32_t samples = 100U * RS_GROUP_SAMPLES;
+    
+    for (uint32_t n = 0U; n < samples; n++)
+    {
+        make_slow_sample(n);
+        TEST_ASSERT_EQUAL(EHMS_OK, rs_append(&test_block, TEST_START_MS + (n * TEST_PERIOD_MS)));
+    }
+    
+    TEST_ASSERT_EQUAL(EHMS_OK, rs_flush(EHMS_ENGINE_1));
+    TEST_ASSERT_EQUAL(EHMS_OK, rs_get_statistics(EHMS_ENGINE_1, &stats));
+    
+    /* Sealed chunks beyond the queue depth are dropped, not blocked on */
+    TEST_ASSERT_EQUAL_UINT32(stats.chunks_sealed - RS_SEALED_CHUNKS, stats.chunks_dropped);
+    TEST_ASSERT_LESS_OR_EQUAL(sizeof(ehms_engine_snapshot_t) / 20U,
+                              stats.payload_bytes / samples);
+}
+
+/* ============================================================================
+ * INTEGRITY AND INDEX TESTS
+ * ============================================================================ */
+
+/**
+ * @test Test a corrupted chunk is rejected
+ * @trace SRS-EHMS-108
+ */
+void test_rs_crc_detects_corruption(void)
+{
+    bool available = false;
+    
+    make_slow_sample(0U);
+    TEST_ASSERT_EQUAL(EHMS_OK, rs_append(&test_block, TEST_START_MS));
+    TEST_ASSERT_EQUAL(EHMS_OK, rs_flush(EHMS_ENGINE_1));
+    TEST_ASSERT_EQUAL(EHMS_OK, rs_take_chunk(EHMS_ENGINE_1, &test_chunk, &available));
+    TEST_ASSERT_EQUAL(EHMS_OK, rs_decode_sample(&test_chunk, 0U, &test_record));
+    
+    test_chunk.payload[test_chunk.header.payload_length - 1U] ^= 0x01U;
+    TEST_ASSERT_EQUAL(EHMS_ERROR_CRC, rs_decode_sample(&test_chunk, 0U, &test_record));
+    
+    test_chunk.payload[test_chunk.header.payload_length - 1U] ^= 0x01U;
+    test_chunk.header.last_time_ms++;
+    TEST_ASSERT_EQUAL(EHMS_ERROR_CRC, rs_decode_sample(&test_chunk, 0U, &test_record));
+}
+
+/**
+ * @test Test chunks are located by time across a millisecond counter wrap
+ * @trace SRS-EHMS-300
+ */
+void test_rs_locate_chunk(void)
+{
+    rs_chunk_header_t index[4];
+    
+    (void)memset(index, 0, sizeof(index));
+    index[0].first_time_ms = 0xFFFFF000UL;
+    index[1].first_time_ms = 0xFFFFF800UL;
+    index[2].first_time_ms = 0x00000000UL;
+    index[3].first_time_ms = 0x00000800UL;
+    
+    TEST_ASSERT_EQUAL_UINT32(0U, rs_locate_chunk(index, 4U, 0xFFFFE000UL));
+    TEST_ASSERT_EQUAL_UINT32(0U, rs_locate_chunk(index, 4U, 0xFFFFF7FFUL));
+    TEST_ASSERT_EQUAL_UINT32(1U, rs_locate_chunk(index, 4U, 0xFFFFF800UL));
+    TEST_ASSERT_EQUAL_UINT32(2U, rs_locate_chunk(index, 4U, 0x00000010UL));
+    TEST_ASSERT_EQUAL_UINT32(3U, rs_locate_chunk(index, 4U, 0x00100000UL));
+    TEST_ASSERT_EQUAL_UINT32(0U, rs_locate_chunk(NULL, 4U, 0U));
+}
+
+/**
+ * @test Test invalid arguments are rejected
+ * @trace SRS-EHMS-300
+ */
+void test_rs_invalid_arguments(void)
+{
+    bool available;
+    rs_statistics_t stats;
+    uint32_t count;
+    
+    TEST_ASSERT_EQUAL(EHMS_ERROR_PARAM, rs_append(NULL, 0U));
+    test_block.engine_id = EHMS_ENGINE_COUNT;
+    TEST_ASSERT_EQUAL(EHMS_ERROR_RANGE, rs_append(&test_block, 0U));
+    TEST_ASSERT_EQUAL(EHMS_ERROR_RANGE, rs_flush(EHMS_ENGINE_COUNT));
+    TEST_ASSERT_EQUAL(EHMS_ERROR_PARAM, rs_take_chunk(EHMS_ENGINE_1, NULL, &available));
+    TEST_ASSERT_EQUAL(EHMS_ERROR_PARAM, rs_take_chunk(EHMS_ENGINE_1, &test_chunk, NULL));
+    TEST_ASSERT_EQUAL(EHMS_ERROR_PARAM, rs_decode_sample(NULL, 0U, &test_record));
+    TEST_ASSERT_EQUAL(EHMS_ERROR_PARAM, rs_decode_chunk(&test_chunk, NULL, 1U, &count));
+    TEST_ASSERT_EQUAL(EHMS_ERROR_PARAM, rs_get_statistics(EHMS_ENGINE_1, NULL));
+    TEST_ASSERT_EQUAL(EHMS_ERROR_RANGE, rs_get_statistics(EHMS_ENGINE_COUNT, &stats));
+}
+
+/* ============================================================================
+ * TEST RUNNER
+ * ============================================================================ */
+
+int main(void)
+{
+    UNITY_BEGIN();
+    
+    /* Encoding tests */
+    RUN_TEST(test_rs_round_trip);
+    RUN_TEST(test_rs_chunk_rollover);
+    RUN_TEST(test_rs_decode_chunk);
+    RUN_TEST(test_rs_compression);
+    
+    /* Integrity and index tests */
+    RUN_TEST(test_rs_crc_detects_corruption);
+    RUN_TEST(test_rs_locate_chunk);
+    RUN_TEST(test_rs_invalid_arguments);
+    
+    return UNITY_END();
+}
+
+/* END OF FILE */
@@ -0,0 +1,434 @@
+/**
+ * @file test_trend_engine.c
+ * @brief Unit Tests for Rolling Parameter Trend Statistics
+ *
+ * @copyright Copyright (c) 2026 AeroTech Avionics Inc.
+ *
+ * Test Framework: Unity Test Framework
+ * Coverage Target: 100% MC/DC
+ *
+ * Requirements Verified:
+ *   SRS-EHMS-060, SRS-EHMS-061
+ */
+
+#include "unity.h"
+#include "trend_engine.h"
+#include "ehms_types.h"
+
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+/* ============================================================================
+ * TEST FIXTURES
+ * ============================================================================ */
+
+#define TEST_CYCLE_MS           10U
+#define TEST_START_MS           120000U
+
+static ehms_engine_block_t test_block;
+static uint32_t test_time_ms;
+
+/**
+ * @brief Run one 100 Hz cycle with EGT set to a value
+ */
+static void run_cycle(float egt)
+{
+    test_block.eng_value[EHMS_PARAM_EGT] = egt;
+    test_block.timestamp_ms[EHMS_PARAM_EGT] = test_time_ms;
+    (void)trend_update(&test_block, test_time_ms);
+    test_time_ms += TEST_CYCLE_MS;
+}
+
+void setUp(void)
+{
+    (void)trend_init();
+    
+    (void)memset(&test_block, 0, sizeof(test_block));
+    test_block.engine_id = EHMS_ENGINE_3;
+    test_block.flight_phase = 2U;
+    (void)memset(test_block.status, (int)EHMS_PARAM_NCD, sizeof(test_block.status));
+    test_block.status[EHMS_PARAM_EGT] = (uint8_t)EHMS_PARAM_VALID;
+    test_time_ms = TEST_START_MS;
+}
+
+void tearDown(void)
+{
+}
+
+/* ============================================================================
+ * RUNNING STATISTICS TESTS
+ * ============================================================================ */
+
+/**
+ * @test Test Welford mean and variance, minimum and maximum
+ * @trace SRS-EHMS-061
+ */
+void test_trend_running_statistics(void)
+{
+    static const float samples[] = { 600.0f, 602.0f, 598.0f, 610.0f, 590.0f };
+    trend_statistics_t stats;
+    
+    for (uint32_t i = 0U; i < (sizeof(samples) / sizeof(samples[0])); i++)
+    {
+        run_cycle(samples[i]);
+    }
+    
+    TEST_ASSERT_EQUAL(EHMS_OK, trend_get_statistics(EHMS_ENGINE_3, EHMS_PARAM_EGT, &stats));
+    TEST_ASSERT_EQUAL_UINT32(5U, stats.count);
+    TEST_ASSERT_FLOAT_WITHIN(1.0e-3f, 600.0f, stats.mean);
+    TEST_ASSERT_FLOAT_WITHIN(1.0e-3f, 52.0f, stats.variance);
+    TEST_ASSERT_FLOAT_WITHIN(1.0e-3f, 590.0f, stats.min);
+    TEST_ASSERT_FLOAT_WITHIN(1.0e-3f, 610.0f, stats.max);
+    TEST_ASSERT_FLOAT_WITHIN(1.0e-3f, 590.0f, stats.last);
+}
+
+/**
+ * @test Test held and invalid samples are not counted
+ * @trace SRS-EHMS-061
+ */
+void test_trend_held_and_invalid_samples_ignored(void)
+{
+    trend_statistics_t stats;
+    
+    run_cycle(600.0f);
+    
+    /* Parameter not read this cycle: same timestamp */
+    test_block.eng_value[EHMS_PARAM_EGT] = 900.0f;
+    (void)trend_update(&test_block, test_time_ms);
+    
+    /* Parameter read but failed validation */
+    test_block.status[EHMS_PARAM_EGT] = (uint8_t)EHMS_PARAM_FAILED;
+    run_cycle(900.0f);
+    
+    TEST_ASSERT_EQUAL(EHMS_OK, trend_get_statistics(EHMS_ENGINE_3, EHMS_PARAM_EGT, &stats));
+    TEST_ASSERT_EQUAL_UINT32(1U, stats.count);
+    TEST_ASSERT_FLOAT_WITHIN(1.0e-3f, 600.0f, stats.max);
+    
+    TEST_ASSERT_EQUAL(EHMS_OK, trend_get_statistics(EHMS_ENGINE_3, EHMS_PARAM_N1, &stats));
+    TEST_ASSERT_EQUAL_UINT32(0U, stats.count);
+}
+
+/**
+ * @test Test the EWMA follows a step with its time constant at any rate
+ * @trace SRS-EHMS-061
+ */
+void test_trend_ewma_time_constant(void)
+{
+    trend_statistics_t stats;
+    uint32_t cycles = TREND_EWMA_TAU_MS / TEST_CYCLE_MS;
+    
+    run_cycle(0.0f);
+    
+    for (uint32_t i = 0U; i < cycles; i++)
+    {
+        run_cycle(100.0f);
+    }
+    
+    TEST_ASSERT_EQUAL(EHMS_OK, trend_get_statistics(EHMS_ENGINE_3, EHMS_PARAM_EGT, &stats));
+    TEST_ASSERT_FLOAT_WITHIN(0.5f, 100.0f * (1.0f - expf(-1.0f)), stats.ewma);
+    
+    /* Same step sampled at 10 Hz */
+    (void)trend_init();
+    run_cycle(0.0f);
+    
+    for (uint32_t i = 0U; i < (cycles / 10U); i++)
+    {
+        test_time_ms += 9U * TEST_CYCLE_MS;
+        run_cycle(100.0f);
+    }
+    
+    TEST_ASSERT_EQUAL(EHMS_OK, trend_get_statistics(EHMS_ENGINE_3, EHMS_PARAM_EGT, &stats));
+    TEST_ASSERT_FLOAT_WITHIN(2.0f, 100.0f * (1.0f - expf(-1.0f)), stats.ewma);
+}
+
+/* ============================================================================
+ * AGGREGATE RING TESTS
+ * ============================================================================ */
+
+/**
+ * @test Test closed second and minute aggregates
+ * @trace SRS-EHMS-060
+ */
+void test_trend_second_and_minute_rings(void)
+{
+    trend_aggregate_t aggregate;
+    uint32_t seconds = 125U;
+    
+    /* EGT equals the whole second it was sampled in */
+    for (uint32_t i = 0U; i < (seconds * 100U); i++)
+    {
+        run_cycle((float)(test_time_ms / 1000U));
+    }
+    
+    /* Closing cycle */
+    run_cycle(0.0f);
+    
+    TEST_ASSERT_EQUAL(EHMS_OK, trend_get_history(EHMS_ENGINE_3, EHMS_PARAM_EGT,
+                                                 TREND_RESOLUTION_SECOND, 0U, &aggregate));
+    TEST_ASSERT_EQUAL_UINT32((TEST_START_MS / 1000U) + seconds - 1U, aggregate.period);
+    TEST_ASSERT_EQUAL_UINT32(100U, aggregate.count);
+    TEST_ASSERT_FLOAT_WITHIN(1.0e-3f, (float)aggregate.period, aggregate.mean);
+    
+    TEST_ASSERT_EQUAL(EHMS_OK, trend_get_history(EHMS_ENGINE_3, EHMS_PARAM_EGT,
+                                                 TREND_RESOLUTION_SECOND,
+                                                 TREND_SECOND_DEPTH - 1U, &aggregate));
+    TEST_ASSERT_EQUAL_UINT32((TEST_START_MS / 1000U) + seconds - TREND_SECOND_DEPTH,
+                             aggregate.period);
+    TEST_ASSERT_EQUAL(EHMS_ERROR_RANGE, trend_get_history(EHMS_ENGINE_3, EHMS_PARAM_EGT,
+                                                          TREND_RESOLUTION_SECOND,
+                                                          TREND_SECOND_DEPTH, &aggregate));
+    
+    /* Minutes 2 and 3 are closed; minute 4 is still open */
+    TEST_ASSERT_EQUAL(EHMS_OK, trend_get_history(EHMS_ENGINE_3, EHMS_PARAM_EGT,
+                                                 TREND_RESOLUTION_MINUTE, 0U, &aggregate));
+    TEST_ASSERT_EQUAL_UINT32(3U, aggregate.period);
+    TEST_ASSERT_EQUAL_UINT32(6000U, aggregate.count);
+    TEST_ASSERT_FLOAT_WITHIN(1.0e-3f, 209.5f, aggregate.mean);
+    TEST_ASSERT_FLOAT_WITHIN(1.0e-3f, 180.0f, aggregate.min);
+    TEST_ASSERT_FLOAT_WITHIN(1.0e-3f, 239.0f, aggregate.max);
+    TEST_ASSERT_EQUAL(EHMS_OK, trend_get_history(EHMS_ENGINE_3, EHMS_PARAM_EGT,
+                                                 TREND_RESOLUTION_MINUTE, 1U, &aggregate));
+    TEST_ASSERT_EQUAL_UINT32(2U, aggregate.period);
+    TEST_ASSERT_EQUAL(EHMS_ERROR_RANGE, trend_get_history(EHMS_ENGINE_3, EHMS_PARAM_EGT,
+                                                          TREND_RESOLUTION_MINUTE, 2U,
+                                                          &aggregate));
+    
+    /* Parameters without samples close with empty periods */
+    TEST_ASSERT_EQUAL(EHMS_OK, trend_get_history(EHMS_ENGINE_3, EHMS_PARAM_N2,
+                                                 TREND_RESOLUTION_MINUTE, 0U, &aggregate));
+    TEST_ASSERT_EQUAL_UINT32(0U, aggregate.count);
+}
+
+/**
+ * @test Test flight phase aggregates close on phase change
+ * @trace SRS-EHMS-060
+ */
+void test_trend_phase_ring(void)
+{
+    trend_aggregate_t aggregate;
+    
+    for (uint32_t i = 0U; i < 50U; i++)
+    {
+        run_cycle(500.0f);
+    }
+    
+    TEST_ASSERT_EQUAL(EHMS_ERROR_RANGE, trend_get_history(EHMS_ENGINE_3, EHMS_PARAM_EGT,
+                                                          TREND_RESOLUTION_PHASE, 0U,
+                                                          &aggregate));
+    
+    test_block.flight_phase = 3U;
+    run_cycle(700.0f);
+    run_cycle(800.0f);
+    test_block.flight_phase = 4U;
+    run_cycle(900.0f);
+    
+    TEST_ASSERT_EQUAL(EHMS_OK, trend_get_history(EHMS_ENGINE_3, EHMS_PARAM_EGT,
+                                                 TREND_RESOLUTION_PHASE, 0U, &aggregate));
+    TEST_ASSERT_EQUAL_UINT32(3U, aggregate.period);
+    TEST_ASSERT_EQUAL_UINT32(2U, aggregate.count);
+    TEST_ASSERT_FLOAT_WITHIN(1.0e-3f, 750.0f, aggregate.mean);
+    
+    TEST_ASSERT_EQUAL(EHMS_OK, trend_get_history(EHMS_ENGINE_3, EHMS_PARAM_EGT,
+                                                 TREND_RESOLUTION_PHASE, 1U, &aggregate));
+    TEST_ASSERT_EQUAL_UINT32(2U, aggregate.period);
+    TEST_ASSERT_EQUAL_UINT32(50U, aggregate.count);
+    TEST_ASSERT_FLOAT_WITHIN(1.0e-3f, 500.0f, aggregate.max);
+}
+
+/* ============================================================================
+ * WARM START TESTS
+ * ============================================================================ */
+
+/**
+ * @test Test statistics and the open phase continue across a warm start
+ * @trace SRS-EHMS-016, SRS-EHMS-061
+ */
+void test_trend_warm_state_round_trip(void)
+{
+    static const float samples[] = { 600.0f, 602.0f, 598.0f, 610.0f, 590.0f };
+    trend_warm_engine_t state;
+    trend_statistics_t before;
+    trend_statistics_t after;
+    trend_aggregate_t aggregate;
+    
+    for (uint32_t i = 0U; i < (sizeof(samples) / sizeof(samples[0])); i++)
+    {
+        run_cycle(samples[i]);
+    }
+    
+    TEST_ASSERT_EQUAL(EHMS_OK, trend_save_warm_state(EHMS_ENGINE_3, &state));
+    TEST_ASSERT_EQUAL(EHMS_OK, trend_get_statistics(EHMS_ENGINE_3, EHMS_PARAM_EGT, &before));
+    
+    /* Power interruption; the clock restarts */
+    (void)trend_init();
+    test_time_ms = 500U;
+    TEST_ASSERT_EQUAL(EHMS_OK, trend_restore_warm_state(EHMS_ENGINE_3, &state, test_time_ms));
+    TEST_ASSERT_EQUAL(EHMS_OK, trend_get_statistics(EHMS_ENGINE_3, EHMS_PARAM_EGT, &after));
+    TEST_ASSERT_EQUAL_MEMORY(&before, &after, sizeof(before));
+    TEST_ASSERT_EQUAL(EHMS_ERROR_RANGE, trend_get_history(EHMS_ENGINE_3, EHMS_PARAM_EGT,
+                                                          TREND_RESOLUTION_SECOND, 0U,
+                                                          &aggregate));
+    
+    /* The phase period opened before the interruption closes with every sample */
+    test_time_ms += TEST_CYCLE_MS;
+    run_cycle(600.0f);
+    test_block.flight_phase = 3U;
+    run_cycle(700.0f);
+    
+    TEST_ASSERT_EQUAL(EHMS_OK, trend_get_history(EHMS_ENGINE_3, EHMS_PARAM_EGT,
+                                                 TREND_RESOLUTION_PHASE, 0U, &aggregate));
+    TEST_ASSERT_EQUAL_UINT32(2U, aggregate.period);
+    TEST_ASSERT_EQUAL_UINT32(6U, aggregate.count);
+    TEST_ASSERT_FLOAT_WITHIN(1.0e-3f, 600.0f, aggregate.mean);
+    TEST_ASSERT_EQUAL(EHMS_OK, trend_get_statistics(EHMS_ENGINE_3, EHMS_PARAM_EGT, &after));
+    TEST_ASSERT_EQUAL_UINT32(7U, after.count);
+    
+    state.started = 2U;
+    TEST_ASSERT_EQUAL(EHMS_ERROR_RANGE, trend_restore_warm_state(EHMS_ENGINE_3, &state, 0U));
+}
+
+/**
+ * @test Test invalid arguments are rejected
+ * @trace SRS-EHMS-061
+ */
+void test_trend_invalid_arguments(void)
+{
+    trend_statistics_t stats;
+    trend_aggregate_t aggregate;
+    
+    TEST_ASSERT_EQUAL(EHMS_ERROR_PARAM, trend_update(NULL, 0U));
+    test_block.engine_id = EHMS_ENGINE_COUNT;
+    TEST_ASSERT_EQUAL(EHMS_ERROR_RANGE, trend_update(&test_block, 0U));
+    TEST_ASSERT_EQUAL(EHMS_ERROR_PARAM, trend_get_statistics(EHMS_ENGINE_1, EHMS_PARAM_EGT,
+                                                             NULL));
+    TEST_ASSERT_EQUAL(EHMS_ERROR_RANGE, trend_get_statistics(EHMS_ENGINE_1, EHMS_PARAM_COUNT,
+                                                             &stats));
+    TEST_ASSERT_EQUAL(EHMS_ERROR_RANGE, trend_get_history(EHMS_ENGINE_1, EHMS_PARAM_EGT,
+                                                          TREND_RESOLUTION_COUNT, 0U,
+                                                          &aggregate));
+    TEST_ASSERT_EQUAL(EHMS_ERROR_PARAM, trend_get_history(EHMS_ENGINE_1, EHMS_PARAM_EGT,
+                                                          TREND_RESOLUTION_SECOND, 0U, NULL));
+}
+
+/* ============================================================================
+ * CONTEXT TESTS
+ * ============================================================================ */
+
+/**
+ * @test Test trend context initialization and argument checks
+ * @trace SRS-EHMS-061
+ */
+void test_trend_ctx_invalid(void)
+{
+    trend_context_t* ctx = (trend_context_t*)calloc(1U, trend_context_size());
+    trend_statistics_t stats;
+    trend_aggregate_t aggregate;
+    
+    TEST_ASSERT_NOT_NULL(ctx);
+    TEST_ASSERT_EQUAL(EHMS_ERROR_PARAM, trend_ctx_init(NULL));
+    
+    /* Zeroed storage is an uninitialized context */
+    TEST_ASSERT_EQUAL(EHMS_ERROR_NOT_INIT, trend_ctx_update(ctx, &test_block, 0U));
+    TEST_ASSERT_EQUAL(EHMS_ERROR_NOT_INIT, trend_ctx_get_statistics(ctx, EHMS_ENGINE_3,
+                                                                    EHMS_PARAM_EGT, &stats));
+    
+    TEST_ASSERT_EQUAL(EHMS_OK, trend_ctx_init(ctx));
+    TEST_ASSERT_EQUAL(EHMS_ERROR_PARAM, trend_ctx_update(NULL, &test_block, 0U));
+    TEST_ASSERT_EQUAL(EHMS_ERROR_PARAM, trend_ctx_update(ctx, NULL, 0U));
+    TEST_ASSERT_EQUAL(EHMS_ERROR_PARAM, trend_ctx_get_statistics(NULL, EHMS_ENGINE_3,
+                                                                 EHMS_PARAM_EGT, &stats));
+    TEST_ASSERT_EQUAL(EHMS_ERROR_PARAM, trend_ctx_get_history(NULL, EHMS_ENGINE_3,
+                                                              EHMS_PARAM_EGT,
+                                                              TREND_RESOLUTION_SECOND, 0U,
+                                                              &aggregate));
+    
+    free(ctx);
+}
+
+/**
+ * @test Test trend contexts share no state with each other or the onboard statistics
+ * @trace SRS-EHMS-060, SRS-EHMS-061
+ */
+void test_trend_ctx_independent(void)
+{
+    trend_context_t* high = (trend_context_t*)calloc(1U, trend_context_size());
+    trend_context_t* nominal = (trend_context_t*)calloc(1U, trend_context_size());
+    trend_statistics_t stats;
+    trend_aggregate_t aggregate;
+    
+    TEST_ASSERT_NOT_NULL(high);
+    TEST_ASSERT_NOT_NULL(nominal);
+    TEST_ASSERT_EQUAL(EHMS_OK, trend_ctx_init(high));
+    TEST_ASSERT_EQUAL(EHMS_OK, trend_ctx_init(nominal));
+    
+    /* Two seconds of samples, the onboard statistics fed a different value */
+    for (uint32_t i = 0U; i < 200U; i++)
+    {
+        test_block.eng_value[EHMS_PARAM_EGT] = 900.0f;
+        test_block.timestamp_ms[EHMS_PARAM_EGT] = test_time_ms;
+        TEST_ASSERT_EQUAL(EHMS_OK, trend_ctx_update(high, &test_block, test_time_ms));
+        test_block.eng_value[EHMS_PARAM_EGT] = 600.0f;
+        TEST_ASSERT_EQUAL(EHMS_OK, trend_ctx_update(nominal, &test_block, test_time_ms));
+        run_cycle(300.0f);
+    }
+    
+    TEST_ASSERT_EQUAL(EHMS_OK, trend_ctx_get_statistics(high, EHMS_ENGINE_3, EHMS_PARAM_EGT,
+                                                        &stats));
+    TEST_ASSERT_EQUAL_UINT32(200U, stats.count);
+    TEST_ASSERT_FLOAT_WITHIN(1.0e-3f, 900.0f, stats.mean);
+    TEST_ASSERT_EQUAL(EHMS_OK, trend_ctx_get_statistics(nominal, EHMS_ENGINE_3,
+                                                        EHMS_PARAM_EGT, &stats));
+    TEST_ASSERT_EQUAL_UINT32(200U, stats.count);
+    TEST_ASSERT_FLOAT_WITHIN(1.0e-3f, 600.0f, stats.max);
+    TEST_ASSERT_EQUAL(EHMS_OK, trend_get_statistics(EHMS_ENGINE_3, EHMS_PARAM_EGT, &stats));
+    TEST_ASSERT_EQUAL_UINT32(200U, stats.count);
+    TEST_ASSERT_FLOAT_WITHIN(1.0e-3f, 300.0f, stats.mean);
+    
+    TEST_ASSERT_EQUAL(EHMS_OK, trend_ctx_get_history(high, EHMS_ENGINE_3, EHMS_PARAM_EGT,
+                                                     TREND_RESOLUTION_SECOND, 0U, &aggregate));
+    TEST_ASSERT_EQUAL_UINT32(100U, aggregate.count);
+    TEST_ASSERT_FLOAT_WITHIN(1.0e-3f, 900.0f, aggregate.mean);
+    
+    /* Reinitializing one context leaves the other */
+    TEST_ASSERT_EQUAL(EHMS_OK, trend_ctx_init(high));
+    TEST_ASSERT_EQUAL(EHMS_OK, trend_ctx_get_statistics(high, EHMS_ENGINE_3, EHMS_PARAM_EGT,
+                                                        &stats));
+    TEST_ASSERT_EQUAL_UINT32(0U, stats.count);
+    TEST_ASSERT_EQUAL(EHMS_OK, trend_ctx_get_statistics(nominal, EHMS_ENGINE_3,
+                                                        EHMS_PARAM_EGT, &stats));
+    TEST_ASSERT_EQUAL_UINT32(200U, stats.count);
+    
+    free(high);
+    free(nominal);
+}
+
+/* ============================================================================
+ * TEST RUNNER
+ * ============================================================================ */
+
+int main(void)
+{
+    UNITY_BEGIN();
+    
+    /* Running statistics tests */
+    RUN_TEST(test_trend_running_statistics);
+    RUN_TEST(test_trend_held_and_invalid_samples_ignored);
+    RUN_TEST(test_trend_ewma_time_constant);
+    
+    /* Aggregate ring tests */
+    RUN_TEST(test_trend_second_and_minute_rings);
+    RUN_TEST(test_trend_phase_ring);
+    
+    /* Warm start tests */
+    RUN_TEST(test_trend_warm_state_round_trip);
+    RUN_TEST(test_trend_invalid_arguments);
+    
+    /* Context tests */
+    RUN_TEST(test_trend_ctx_invalid);
+    RUN_TEST(test_trend_ctx_independent);
+    
+    return UNITY_END();
+}
+
+/* END OF FILE */
@@ -0,0 +1,227 @@
+/**
+ * @file test_vibration_analysis.c
+ * @brief Unit Tests for Engine Order Vibration Analysis
+ *
+ * @copyright Copyright (c) 2026 AeroTech Avionics Inc.
+ *
+ * Test Framework: Unity Test Framework
+ * Coverage Target: 100% MC/DC
+ *
+ * Requirements Verified:
+ *   SRS-EHMS-100, SRS-EHMS-104
+ */
+
+#include "unity.h"
+#include "vibration_analysis.h"
+#include "ehms_types.h"
+
+#include <math.h>
+
+/* ============================================================================
+ * TEST FIXTURES
+ * ============================================================================ */
+
+#define TEST_PI                 3.14159265358979323846
+
+#define TEST_N1_PCT             80.0f
+#define TEST_N2_PCT             90.0f
+
+#define TEST_N1_AMPLITUDE       200.0
+#define TEST_N2_AMPLITUDE       50.0
+
+/** @brief Amplitude error allowed for window leakage between orders (counts) */
+#define TEST_AMPLITUDE_TOLERANCE    2.0
+
+/** @brief Bursts per spectral block */
+#define TEST_BURSTS_PER_BLOCK   (VIB_BLOCK_LENGTH / VIB_BURST_WORDS)
+
+static uint32_t test_sample_index;
+
+/**
+ * @brief Once-per-rev frequency of a shaft order
+ */
+static double order_frequency_hz(double speed_pct, double rpm_at_100pct)
+{
+    return (speed_pct / 100.0) * (rpm_at_100pct / 60.0);
+}
+
+/**
+ * @brief Fill one burst with N1 and N2 once-per-rev tones
+ */
+static void make_burst(uint16_t* words, double n1_amplitude, double n2_amplitude)
+{
+    double f1 = order_frequency_hz(TEST_N1_PCT, VIB_N1_RPM_AT_100PCT);
+    double f2 = order_frequency_hz(TEST_N2_PCT, VIB_N2_RPM_AT_100PCT);
+    
+    for (uint32_t i = 0U; i < VIB_BURST_WORDS; i++)
+    {
+        double t = (double)test_sample_index / (double)VIB_SAMPLE_RATE_HZ;
+        double x = (n1_amplitude * sin(2.0 * TEST_PI * f1 * t)) +
+                   (n2_amplitude * cos(2.0 * TEST_PI * f2 * t));
+        
+        words[i] = (uint16_t)(int16_t)lround(x);
+        test_sample_index++;
+    }
+}
+
+void setUp(void)
+{
+    test_sample_index = 0U;
+    (void)vib_init();
+}
+
+void tearDown(void)
+{
+}
+
+/* ============================================================================
+ * ORDER TRACKING TESTS
+ * ============================================================================ */
+
+/**
+ * @test Test bands complete once per block with the tone amplitudes
+ * @trace SRS-EHMS-104
+ */
+void test_vib_order_amplitudes(void)
+{
+    const float speed[VIB_ORDER_COUNT] = { TEST_N1_PCT, TEST_N2_PCT };
+    uint16_t words[VIB_BURST_WORDS];
+    uint32_t completed = 0U;
+    vib_band_t band;
+    
+    for (uint32_t b = 0U; b < TEST_BURSTS_PER_BLOCK; b++)
+    {
+        make_burst(words, TEST_N1_AMPLITUDE, TEST_N2_AMPLITUDE);
+        TEST_ASSERT_EQUAL(EHMS_OK, vib_write_samples(EHMS_ENGINE_1, VIB_SENSOR_FAN,
+                                                     words, VIB_BURST_WORDS));
+        TEST_ASSERT_EQUAL(EHMS_OK, vib_process(EHMS_ENGINE_1, speed, &completed));
+        
+        if (b < (TEST_BURSTS_PER_BLOCK - 1U))
+        {
+            TEST_ASSERT_EQUAL_HEX32(0U, completed);
+        }
+    }
+    
+    /* The core sensor received nothing and has not completed a block */
+    TEST_ASSERT_EQUAL_HEX32(0x3U, completed);
+    
+    TEST_ASSERT_EQUAL(EHMS_OK, vib_get_band(EHMS_ENGINE_1, VIB_SENSOR_FAN, VIB_ORDER_N1, &band));
+    TEST_ASSERT_EQUAL(EHMS_PARAM_VALID, band.status);
+    TEST_ASSERT_EQUAL_UINT32(1U, band.sequence);
+    TEST_ASSERT_FLOAT_WITHIN(0.01, order_frequency_hz(TEST_N1_PCT, VIB_N1_RPM_AT_100PCT),
+                             band.frequency_hz);
+    TEST_ASSERT_FLOAT_WITHIN(TEST_AMPLITUDE_TOLERANCE, TEST_N1_AMPLITUDE, band.amplitude);
+    
+    TEST_ASSERT_EQUAL(EHMS_OK, vib_get_band(EHMS_ENGINE_1, VIB_SENSOR_FAN, VIB_ORDER_N2, &band));
+    TEST_ASSERT_EQUAL(EHMS_PARAM_VALID, band.status);
+    TEST_ASSERT_FLOAT_WITHIN(TEST_AMPLITUDE_TOLERANCE, TEST_N2_AMPLITUDE, band.amplitude);
+    
+    TEST_ASSERT_EQUAL(EHMS_OK, vib_get_band(EHMS_ENGINE_1, VIB_SENSOR_CORE, VIB_ORDER_N1, &band));
+    TEST_ASSERT_EQUAL(EHMS_PARAM_NCD, band.status);
+    TEST_ASSERT_EQUAL_UINT32(0U, band.sequence);
+}
+
+/**
+ * @test Test orders below minimum shaft speed are reported as NCD
+ * @trace SRS-EHMS-104
+ */
+void test_vib_low_speed_ncd(void)
+{
+    const float speed[VIB_ORDER_COUNT] = { VIB_MIN_SHAFT_SPEED_PCT / 2.0f, TEST_N2_PCT };
+    uint16_t words[VIB_BURST_WORDS];
+    uint32_t completed = 0U;
+    vib_band_t band;
+    
+    for (uint32_t b = 0U; b < TEST_BURSTS_PER_BLOCK; b++)
+    {
+        make_burst(words, TEST_N1_AMPLITUDE, TEST_N2_AMPLITUDE);
+        (void)vib_write_samples(EHMS_ENGINE_2, VIB_SENSOR_CORE, words, VIB_BURST_WORDS);
+        TEST_ASSERT_EQUAL(EHMS_OK, vib_process(EHMS_ENGINE_2, speed, &completed));
+    }
+    
+    TEST_ASSERT_EQUAL_HEX32(0xCU, completed);
+    
+    TEST_ASSERT_EQUAL(EHMS_OK, vib_get_band(EHMS_ENGINE_2, VIB_SENSOR_CORE, VIB_ORDER_N1, &band));
+    TEST_ASSERT_EQUAL(EHMS_PARAM_NCD, band.status);
+    TEST_ASSERT_EQUAL_FLOAT(0.0f, band.amplitude);
+    TEST_ASSERT_EQUAL_UINT32(1U, band.sequence);
+    
+    TEST_ASSERT_EQUAL(EHMS_OK, vib_get_band(EHMS_ENGINE_2, VIB_SENSOR_CORE, VIB_ORDER_N2, &band));
+    TEST_ASSERT_EQUAL(EHMS_PARAM_VALID, band.status);
+    TEST_ASSERT_FLOAT_WITHIN(TEST_AMPLITUDE_TOLERANCE, TEST_N2_AMPLITUDE, band.amplitude);
+}
+
+/* ============================================================================
+ * BUFFERING TESTS
+ * ============================================================================ */
+
+/**
+ * @test Test samples beyond ring capacity are dropped and counted
+ * @trace SRS-EHMS-100
+ */
+void test_vib_ring_overrun(void)
+{
+    uint16_t words[VIB_BURST_WORDS] = { 0U };
+    vib_sensor_statistics_t stats;
+    ehms_result_t result = EHMS_OK;
+    uint32_t bursts = (VIB_RING_LENGTH / VIB_BURST_WORDS) + 1U;
+    
+    for (uint32_t b = 0U; b < bursts; b++)
+    {
+        result = vib_write_samples(EHMS_ENGINE_1, VIB_SENSOR_FAN, words, VIB_BURST_WORDS);
+    }
+    
+    TEST_ASSERT_EQUAL(EHMS_ERROR_BUSY, result);
+    TEST_ASSERT_EQUAL(EHMS_OK, vib_get_statistics(EHMS_ENGINE_1, VIB_SENSOR_FAN, &stats));
+    TEST_ASSERT_EQUAL_UINT32(VIB_RING_LENGTH, stats.samples_received);
+    TEST_ASSERT_EQUAL_UINT32(VIB_BURST_WORDS, stats.overrun_count);
+}
+
+/**
+ * @test Test invalid arguments are rejected
+ * @trace SRS-EHMS-104
+ */
+void test_vib_invalid_arguments(void)
+{
+    const float speed[VIB_ORDER_COUNT] = { TEST_N1_PCT, TEST_N2_PCT };
+    uint16_t words[VIB_BURST_WORDS] = { 0U };
+    uint32_t completed;
+    vib_band_t band;
+    
+    TEST_ASSERT_EQUAL(EHMS_ERROR_PARAM, vib_write_samples(EHMS_ENGINE_1, VIB_SENSOR_FAN,
+                                                          NULL, 1U));
+    TEST_ASSERT_EQUAL(EHMS_ERROR_RANGE, vib_write_samples(EHMS_ENGINE_COUNT, VIB_SENSOR_FAN,
+                                                          words, 1U));
+    TEST_ASSERT_EQUAL(EHMS_ERROR_RANGE, vib_write_samples(EHMS_ENGINE_1, VIB_SENSOR_COUNT,
+                                                          words, 1U));
+    TEST_ASSERT_EQUAL(EHMS_ERROR_PARAM, vib_process(EHMS_ENGINE_1, NULL, &completed));
+    TEST_ASSERT_EQUAL(EHMS_ERROR_PARAM, vib_process(EHMS_ENGINE_1, speed, NULL));
+    TEST_ASSERT_EQUAL(EHMS_ERROR_RANGE, vib_process(EHMS_ENGINE_COUNT, speed, &completed));
+    TEST_ASSERT_EQUAL(EHMS_ERROR_PARAM, vib_get_band(EHMS_ENGINE_1, VIB_SENSOR_FAN,
+                                                     VIB_ORDER_N1, NULL));
+    TEST_ASSERT_EQUAL(EHMS_ERROR_RANGE, vib_get_band(EHMS_ENGINE_1, VIB_SENSOR_FAN,
+                                                     VIB_ORDER_COUNT, &band));
+    TEST_ASSERT_EQUAL(EHMS_ERROR_PARAM, vib_get_statistics(EHMS_ENGINE_1, VIB_SENSOR_FAN,
+                                                           NULL));
+}
+
+/* ============================================================================
+ * TEST RUNNER
+ * ============================================================================ */
+
+int main(void)
+{
+    UNITY_BEGIN();
+    
+    /* Order tracking tests */
+    RUN_TEST(test_vib_order_amplitudes);
+    RUN_TEST(test_vib_low_speed_ncd);
+    
+    /* Buffering tests */
+    RUN_TEST(test_vib_ring_overrun);
+    RUN_TEST(test_vib_invalid_arguments);
+    
+    return UNITY_END();
+}
+
+/* END OF FILE */
@@ -0,0 +1,434 @@
+/**
+ * @file test_warm_start.c
+ * @brief Unit Tests for Warm Start Checkpoint
+ *
+ * @copyright Copyright (c) 2026 AeroTech Avionics Inc.
+ *
+ * Test Framework: Unity Test Framework
+ * Coverage Target: 100% MC/DC
+ *
+ * Requirements Verified:
+ *   SRS-EHMS-016, SRS-EHMS-108
+ */
+
+#include "unity.h"
+#include "warm_start.h"
+#include "ehms_types.h"
+#include "mock_data_acquisition_ext.h"
+#include "mock_alert_manager.h"
+#include "mock_alert_manager_ext.h"
+#include "mock_system_services.h"
+#if defined(DAQ_TREND_ENGINE)
+#include "mock_trend_engine.h"
+#endif
+
+#include <string.h>
+
+/* ============================================================================
+ * TEST FIXTURES
+ * ============================================================================ */
+
+/** @brief Versions of the module states checkpointed by the tests */
+#define TEST_VERSION_COUNT      2U
+
+/** @brief Monotonic time of the restore */
+#define TEST_RESTORE_MS         250U
+
+static ws_image_t test_image;
+static daq_warm_state_t test_daq[TEST_VERSION_COUNT];
+static alert_warm_state_t test_alert[TEST_VERSION_COUNT];
+#if defined(DAQ_TREND_ENGINE)
+static trend_warm_engine_t test_trend[TEST_VERSION_COUNT];
+#endif
+static const ehms_timestamp_t test_epoch = { 2026U, 10U, 14U, 8U, 0U, 0U, 0U };
+static const ehms_timestamp_t test_later_epoch = { 2026U, 10U, 14U, 11U, 30U, 0U, 0U };
+
+/**
+ * @brief Fill each version of the module states with distinct values
+ */
+static void make_states(void)
+{
+    for (uint32_t v = 0U; v < TEST_VERSION_COUNT; v++)
+    {
+        (void)memset(&test_daq[v], 0, sizeof(test_daq[v]));
+        (void)memset(&test_alert[v], 0, sizeof(test_alert[v]));
+        
+        for (uint32_t b = 0U; b < EHMS_ARINC429_BUS_COUNT; b++)
+        {
+            test_daq[v].source[b].is_active = 1U;
+            test_daq[v].source[b].total_samples = (1000U * (v + 1U)) + b;
+        }
+        
+        test_alert[v].next_alert_id = 40U + v;
+        test_alert[v].alert_count = 1U;
+        test_alert[v].master_warning = 1U;
+        test_alert[v].alerts[0].alert_id = 39U + v;
+
+#if defined(DAQ_TREND_ENGINE)
+        (void)memset(&test_trend[v], 0, sizeof(test_trend[v]));
+        test_trend[v].started = 1U;
+        test_trend[v].flight_phase = 3U + v;
+        
+        for (uint32_t p = 0U; p < EHMS_PARAM_COUNT; p++)
+        {
+            test_trend[v].param[p].count = (100U * (v + 1U)) + p;
+            test_trend[v].param[p].mean = 500.0 + (double)v;
+        }
+#endif
+    }
+}
+
+/**
+ * @brief Expect the start of a bank with a count of active alerts
+ */
+static void expect_bank_open(uint32_t active_alerts, const ehms_timestamp_t* now)
+{
+    alert_get_active_count_ExpectAndReturn(active_alerts);
+    
+    if (active_alerts == 0U)
+    {
+        system_get_timestamp_ExpectAndReturn(*now);
+    }
+}
+
+/**
+ * @brief Expect the module save of one segment, returning one version
+ */
+static void expect_segment(uint32_t segment, uint32_t version, ehms_result_t result)
+{
+    if (segment == 0U)
+    {
+        daq_save_warm_state_ExpectAnyArgsAndReturn(result);
+        daq_save_warm_state_ReturnThruPtr_state(&test_daq[version]);
+    }
+    else if (segment == 1U)
+    {
+        alert_save_warm_state_ExpectAnyArgsAndReturn(result);
+        alert_save_warm_state_ReturnThruPtr_state(&test_alert[version]);
+    }
+    else
+    {
+#if defined(DAQ_TREND_ENGINE)
+        trend_save_warm_state_ExpectAnyArgsAndReturn(result);
+        trend_save_warm_state_ReturnThruPtr_state(&test_trend[version]);
+#endif
+    }
+}
+
+/**
+ * @brief Write the segments of a started bank, one per cycle
+ */
+static void write_segments(uint32_t first, uint32_t version)
+{
+    for (uint32_t s = first; s < WS_SEGMENT_COUNT; s++)
+    {
+        expect_segment(s, version, EHMS_OK);
+        TEST_ASSERT_EQUAL(EHMS_OK, ws_checkpoint_cycle());
+    }
+}
+
+/**
+ * @brief Write one complete bank holding a version of the module states
+ */
+static void checkpoint_bank(uint32_t version)
+{
+    expect_bank_open(0U, &test_epoch);
+    write_segments(0U, version);
+}
+
+/**
+ * @brief Expect a version of the module states to be restored
+ */
+static void expect_restore(uint32_t version, const ehms_timestamp_t* epoch,
+                           ehms_result_t daq_result)
+{
+    daq_restore_warm_state_ExpectAndReturn(&test_daq[version], daq_result);
+    alert_restore_warm_state_ExpectAndReturn(epoch, &test_alert[version], EHMS_OK);
+
+#if defined(DAQ_TREND_ENGINE)
+    system_get_time_ms_ExpectAndReturn(TEST_RESTORE_MS);
+    
+    for (uint32_t e = 0U; e < EHMS_ENGINE_COUNT; e++)
+    {
+        trend_restore_warm_state_ExpectAndReturn((ehms_engine_id_t)e, &test_trend[version],
+                                                 TEST_RESTORE_MS, EHMS_OK);
+    }
+#endif
+}
+
+/**
+ * @brief Power interruption: the image survives, the module state does not
+ */
+static void power_cycle(void)
+{
+    system_get_timestamp_ExpectAndReturn(test_later_epoch);
+    TEST_ASSERT_EQUAL(EHMS_OK, ws_init(&test_image));
+}
+
+void setUp(void)
+{
+    mock_data_acquisition_ext_Init();
+    mock_alert_manager_Init();
+    mock_alert_manager_ext_Init();
+    mock_system_services_Init();
+#if defined(DAQ_TREND_ENGINE)
+    mock_trend_engine_Init();
+#endif
+    
+    /* Non-volatile RAM never written */
+    (void)memset(&test_image, 0, sizeof(test_image));
+    make_states();
+    
+    system_get_timestamp_ExpectAndReturn(test_epoch);
+    (void)ws_init(&test_image);
+}
+
+void tearDown(void)
+{
+    mock_data_acquisition_ext_Verify();
+    mock_alert_manager_Verify();
+    mock_alert_manager_ext_Verify();
+    mock_system_services_Verify();
+#if defined(DAQ_TREND_ENGINE)
+    mock_trend_engine_Verify();
+#endif
+    
+    mock_data_acquisition_ext_Destroy();
+    mock_alert_manager_Destroy();
+    mock_alert_manager_ext_Destroy();
+    mock_system_services_Destroy();
+#if defined(DAQ_TREND_ENGINE)
+    mock_trend_engine_Destroy();
+#endif
+}
+
+/* ============================================================================
+ * RESTORE TESTS
+ * ============================================================================ */
+
+/**
+ * @test Test a blank image gives a cold start and restores nothing
+ * @trace SRS-EHMS-016
+ */
+void test_ws_cold_start_blank_image(void)
+{
+    ws_statistics_t stats;
+    
+    TEST_ASSERT_EQUAL(EHMS_ERROR_CRC, ws_restore());
+    
+    TEST_ASSERT_EQUAL(EHMS_OK, ws_get_statistics(&stats));
+    TEST_ASSERT_FALSE(stats.warm_started);
+    TEST_ASSERT_EQUAL(EHMS_ERROR_CRC, stats.restore_result);
+    TEST_ASSERT_EQUAL_UINT32(0U, stats.sequence);
+}
+
+/**
+ * @test Test a completed bank is restored into every module
+ * @trace SRS-EHMS-016
+ */
+void test_ws_restore_round_trip(void)
+{
+    ws_statistics_t stats;
+    
+    checkpoint_bank(0U);
+    TEST_ASSERT_EQUAL(EHMS_OK, ws_get_statistics(&stats));
+    TEST_ASSERT_EQUAL_UINT32(1U, stats.images_written);
+    TEST_ASSERT_EQUAL_HEX32(WS_IMAGE_MAGIC, test_image.bank[0].header.magic);
+    
+    power_cycle();
+    expect_restore(0U, &test_epoch, EHMS_OK);
+    TEST_ASSERT_EQUAL(EHMS_OK, ws_restore());
+    
+    TEST_ASSERT_EQUAL(EHMS_OK, ws_get_statistics(&stats));
+    TEST_ASSERT_TRUE(stats.warm_started);
+    TEST_ASSERT_EQUAL(EHMS_OK, stats.restore_result);
+    TEST_ASSERT_EQUAL_UINT32(1U, stats.sequence);
+}
+
+/**
+ * @test Test the newest bank wins and checkpointing continues the image
+ * @trace SRS-EHMS-016
+ */
+void test_ws_newest_bank_restored(void)
+{
+    checkpoint_bank(0U);
+    checkpoint_bank(1U);
+    
+    power_cycle();
+    expect_restore(1U, &test_epoch, EHMS_OK);
+    TEST_ASSERT_EQUAL(EHMS_OK, ws_restore());
+    
+    /* The bank restored is kept; the older one is overwritten first */
+    checkpoint_bank(0U);
+    TEST_ASSERT_EQUAL_UINT32(2U, test_image.bank[0].header.sequence);
+    TEST_ASSERT_EQUAL_UINT32(1U, test_image.bank[1].header.sequence);
+    
+    power_cycle();
+    expect_restore(0U, &test_epoch, EHMS_OK);
+    TEST_ASSERT_EQUAL(EHMS_OK, ws_restore());
+}
+
+/**
+ * @test Test a bank interrupted while being written is not restored
+ * @trace SRS-EHMS-016, SRS-EHMS-108
+ */
+void test_ws_interrupted_bank_ignored(void)
+{
+    checkpoint_bank(0U);
+    checkpoint_bank(1U);
+    
+    /* Power lost after the first segment of the next bank */
+    expect_bank_open(0U, &test_epoch);
+    expect_segment(0U, 1U, EHMS_OK);
+    TEST_ASSERT_EQUAL(EHMS_OK, ws_checkpoint_cycle());
+    TEST_ASSERT_EQUAL_HEX32(0U, test_image.bank[0].header.magic);
+    
+    power_cycle();
+    expect_restore(1U, &test_epoch, EHMS_OK);
+    TEST_ASSERT_EQUAL(EHMS_OK, ws_restore());
+}
+
+/**
+ * @test Test a corrupted bank falls back to the other, then to a cold start
+ * @trace SRS-EHMS-108
+ */
+void test_ws_corrupted_bank_rejected(void)
+{
+    checkpoint_bank(0U);
+    checkpoint_bank(1U);
+    
+    ((uint8_t*)&test_image.bank[1].payload)[sizeof(ws_payload_t) - 1U] ^= 0x01U;
+    power_cycle();
+    expect_restore(0U, &test_epoch, EHMS_OK);
+    TEST_ASSERT_EQUAL(EHMS_OK, ws_restore());
+    
+    test_image.bank[0].header.sequence++;
+    power_cycle();
+    TEST_ASSERT_EQUAL(EHMS_ERROR_CRC, ws_restore());
+}
+
+/**
+ * @test Test a module restore error is reported and the others still restore
+ * @trace SRS-EHMS-016
+ */
+void test_ws_restore_module_error(void)
+{
+    ws_statistics_t stats;
+    
+    checkpoint_bank(0U);
+    
+    power_cycle();
+    expect_restore(0U, &test_epoch, EHMS_ERROR_RANGE);
+    TEST_ASSERT_EQUAL(EHMS_ERROR_RANGE, ws_restore());
+    
+    TEST_ASSERT_EQUAL(EHMS_OK, ws_get_statistics(&stats));
+    TEST_ASSERT_TRUE(stats.warm_started);
+    TEST_ASSERT_EQUAL(EHMS_ERROR_RANGE, stats.restore_result);
+}
+
+/* ============================================================================
+ * CHECKPOINT TESTS
+ * ============================================================================ */
+
+/**
+ * @test Test a segment that cannot be saved restarts the bank
+ * @trace SRS-EHMS-016
+ */
+void test_ws_segment_error_restarts_bank(void)
+{
+    ws_statistics_t stats;
+    
+    expect_bank_open(0U, &test_epoch);
+    expect_segment(0U, 0U, EHMS_ERROR_NOT_INIT);
+    TEST_ASSERT_EQUAL(EHMS_ERROR_NOT_INIT, ws_checkpoint_cycle());
+    
+    checkpoint_bank(0U);
+    
+    TEST_ASSERT_EQUAL(EHMS_OK, ws_get_statistics(&stats));
+    TEST_ASSERT_EQUAL_UINT32(1U, stats.segment_errors);
+    TEST_ASSERT_EQUAL_UINT32(1U, stats.images_written);
+}
+
+/**
+ * @test Test an alert the packed form cannot hold is counted, not fatal
+ * @trace SRS-EHMS-016
+ */
+void test_ws_alert_omitted_counted(void)
+{
+    ws_statistics_t stats;
+    
+    checkpoint_bank(0U);
+    
+    expect_bank_open(0U, &test_epoch);
+    expect_segment(0U, 1U, EHMS_OK);
+    TEST_ASSERT_EQUAL(EHMS_OK, ws_checkpoint_cycle());
+    expect_segment(1U, 1U, EHMS_ERROR_RANGE);
+    TEST_ASSERT_EQUAL(EHMS_OK, ws_checkpoint_cycle());
+    write_segments(2U, 1U);
+    
+    TEST_ASSERT_EQUAL(EHMS_OK, ws_get_statistics(&stats));
+    TEST_ASSERT_EQUAL_UINT32(1U, stats.alerts_omitted);
+    TEST_ASSERT_EQUAL_UINT32(2U, stats.images_written);
+}
+
+/**
+ * @test Test the epoch only moves up while no alert is held
+ * @trace SRS-EHMS-016
+ */
+void test_ws_epoch_held_while_alerts_active(void)
+{
+    checkpoint_bank(0U);
+    
+    expect_bank_open(0U, &test_later_epoch);
+    write_segments(0U, 0U);
+    expect_bank_open(1U, NULL);
+    write_segments(0U, 1U);
+    TEST_ASSERT_EQUAL_MEMORY(&test_later_epoch, &test_image.bank[0].header.epoch,
+                             sizeof(ehms_timestamp_t));
+    
+    power_cycle();
+    expect_restore(1U, &test_later_epoch, EHMS_OK);
+    TEST_ASSERT_EQUAL(EHMS_OK, ws_restore());
+}
+
+/**
+ * @test Test invalid arguments and a restore after checkpointing has started
+ * @trace SRS-EHMS-016
+ */
+void test_ws_invalid_arguments(void)
+{
+    TEST_ASSERT_EQUAL(EHMS_ERROR_PARAM, ws_init(NULL));
+    TEST_ASSERT_EQUAL(EHMS_ERROR_PARAM, ws_get_statistics(NULL));
+    
+    expect_bank_open(0U, &test_epoch);
+    expect_segment(0U, 0U, EHMS_OK);
+    TEST_ASSERT_EQUAL(EHMS_OK, ws_checkpoint_cycle());
+    TEST_ASSERT_EQUAL(EHMS_ERROR_BUSY, ws_restore());
+}
+
+/* ============================================================================
+ * TEST RUNNER
+ * ============================================================================ */
+
+int main(void)
+{
+    UNITY_BEGIN();
+    
+    /* Restore tests */
+    RUN_TEST(test_ws_cold_start_blank_image);
+    RUN_TEST(test_ws_restore_round_trip);
+    RUN_TEST(test_ws_newest_bank_restored);
+    RUN_TEST(test_ws_interrupted_bank_ignored);
+    RUN_TEST(test_ws_corrupted_bank_rejected);
+    RUN_TEST(test_ws_restore_module_error);
+    
+    /* Checkpoint tests */
+    RUN_TEST(test_ws_segment_error_restarts_bank);
+    RUN_TEST(test_ws_alert_omitted_counted);
+    RUN_TEST(test_ws_epoch_held_while_alerts_active);
+    RUN_TEST(test_ws_invalid_arguments);
+    
+    return UNITY_END();
+}
+
+/* END OF FILE */
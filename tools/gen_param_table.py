@@ -0,0 +1,297 @@
+#!/usr/bin/env python3
+"""Generate daq_param_table.h from an OEM configuration file.
+
+The generated header holds the platform's parameter configuration table
+and one decode routine per distinct label encoding, so that each platform
+build carries only its own labels and word decoding needs no runtime
+table lookup beyond the parameter's encoding.
+
+Usage:
+    tools/gen_param_table.py config/oem_configurations/airbus_a320neo.json \
+        -o daq_param_table.h
+
+The configuration is a JSON object with "platform", "description" and a
+"parameters" list. Each parameter entry has:
+    param        EHMS_PARAM_* name without the prefix (e.g. "N1")
+    label        ARINC 429 label, octal string (e.g. "310")
+    bus_primary  Primary ARINC 429 bus, 0 .. EHMS_ARINC429_BUS_COUNT - 1
+    bus_backup   Backup ARINC 429 bus (equal to bus_primary for none)
+    encoding     "BNR" with "bits" (1-18 significant bits), or
+                 "BCD" with "digits" (1-5)
+    resolution   Engineering value of one count (scale factor)
+    offset       Engineering value of zero counts
+"""
+
+import argparse
+import json
+import os
+import re
+import sys
+
+BNR_MAX_BITS = 18
+BCD_MAX_DIGITS = 5
+TYPES_HEADER = "ehms_types.h"
+
+
+class ConfigError(Exception):
+    """Invalid OEM configuration."""
+
+
+def read_param_ids(types_path):
+    """Return {name: value} of the ehms_param_id_t enumerators."""
+    with open(types_path, encoding="utf-8") as handle:
+        text = handle.read()
+
+    end = text.index("} ehms_param_id_t;")
+    start = text.rindex("typedef enum", 0, end)
+    ids = {}
+    for name, value in re.findall(r"EHMS_PARAM_(\w+)\s*=\s*(\d+)U", text[start:end]):
+        if name != "COUNT":
+            ids[name] = int(value)
+    return ids
+
+
+def read_bus_count(types_path):
+    """Return EHMS_ARINC429_BUS_COUNT, the buses data_acquisition.c routes."""
+    with open(types_path, encoding="utf-8") as handle:
+        text = handle.read()
+
+    match = re.search(r"#define\s+EHMS_ARINC429_BUS_COUNT\s+(\d+)U", text)
+    if match is None:
+        raise ConfigError("%s: EHMS_ARINC429_BUS_COUNT not defined" % types_path)
+    return int(match.group(1))
+
+
+def encoding_key(entry):
+    """Return (name, format, width) of a parameter's encoding."""
+    fmt = entry.get("encoding")
+    if fmt == "BNR":
+        bits = entry.get("bits")
+        if not isinstance(bits, int) or not 1 <= bits <= BNR_MAX_BITS:
+            raise ConfigError("%s: BNR bits shall be 1..%d" % (entry["param"], BNR_MAX_BITS))
+        return ("BNR%d" % bits, fmt, bits)
+    if fmt == "BCD":
+        digits = entry.get("digits")
+        if not isinstance(digits, int) or not 1 <= digits <= BCD_MAX_DIGITS:
+            raise ConfigError("%s: BCD digits shall be 1..%d" % (entry["param"], BCD_MAX_DIGITS))
+        return ("BCD%d" % digits, fmt, digits)
+    raise ConfigError("%s: unknown encoding %r" % (entry["param"], fmt))
+
+
+def load_config(config_path, param_ids, bus_count):
+    """Validate the configuration and return (config, entries, encodings)."""
+    with open(config_path, encoding="utf-8") as handle:
+        config = json.load(handle)
+
+    entries = []
+    encodings = []
+    seen_params = set()
+    seen_labels = {}
+    for entry in config["parameters"]:
+        name = entry["param"]
+        if name not in param_ids:
+            raise ConfigError("%s: not an EHMS_PARAM_* parameter" % name)
+        if name in seen_params:
+            raise ConfigError("%s: configured twice" % name)
+        seen_params.add(name)
+
+        label = int(entry["label"], 8)
+        if not 1 <= label <= 0o377:
+            raise ConfigError("%s: label %s out of range" % (name, entry["label"]))
+        buses = [entry["bus_primary"]]
+        if entry["bus_backup"] != entry["bus_primary"]:
+            buses.append(entry["bus_backup"])
+        for bus in buses:
+            if not 0 <= bus < bus_count:
+                raise ConfigError("%s: bus %d out of range (EHMS_ARINC429_BUS_COUNT %d)"
+                                  % (name, bus, bus_count))
+            if (bus, label) in seen_labels:
+                raise ConfigError("%s: label %s on bus %d already used by %s"
+                                  % (name, entry["label"], bus, seen_labels[(bus, label)]))
+            seen_labels[(bus, label)] = name
+        if not entry["resolution"] > 0.0:
+            raise ConfigError("%s: resolution shall be positive" % name)
+
+        key = encoding_key(entry)
+        if key not in encodings:
+            encodings.append(key)
+        entries.append((param_ids[name], name, label, entry, key))
+
+    entries.sort()
+    return config, entries, encodings
+
+
+def c_float(value):
+    """Format a float as a C float literal."""
+    text = repr(float(value))
+    return text + "f"
+
+
+def render(config, entries, encodings, config_rel):
+    """Return the generated header text."""
+    platform = config["platform"]
+    out = []
+    emit = out.append
+
+    emit("""/**
+ * @file daq_param_table.h
+ * @brief EHMS Parameter Configuration Table (%s)
+ *
+ * @copyright Copyright (c) 2026 AeroTech Avionics Inc.
+ * @note This file is subject to DO-178C Level B certification requirements
+ *
+ * GENERATED by tools/gen_param_table.py from %s.
+ * Do not edit; change the OEM configuration and regenerate.
+ *
+ * CSCI: EHMS-CORE
+ * CSC: DATA-ACQUISITION
+ *
+ * Requirements Trace:
+ *   SRS-EHMS-100: System shall acquire engine parameters at 100Hz
+ *   SRS-EHMS-103: System shall support redundant data sources
+ *
+ * %s.
+ *
+ * Private to data_acquisition.c, which is its only includer.
+ */
+
+#ifndef DAQ_PARAM_TABLE_H
+#define DAQ_PARAM_TABLE_H
+
+/* ============================================================================
+ * INCLUDES
+ * ============================================================================ */
+#include "ehms_types.h"
+#include "data_acquisition.h"
+#include "arinc429_driver.h"
+#include "arinc429_decode.h"
+
+/* ============================================================================
+ * CONSTANTS
+ * ============================================================================ */
+
+/** @brief Platform the table was generated for */
+#define DAQ_PARAM_TABLE_PLATFORM            "%s"
+
+/** @brief Alignment of the generated tables (cache line) */
+#ifndef DAQ_PARAM_TABLE_ALIGN
+#define DAQ_PARAM_TABLE_ALIGN               64U
+#endif
+
+/* ============================================================================
+ * TYPES
+ * ============================================================================ */
+
+/**
+ * @brief Data field encodings of the platform's labels
+ */
+typedef enum
+{
+    DAQ_ENCODING_UNUSED     = 0U,   /**< Parameter not acquired over ARINC 429 */""" % (
+        platform, config_rel, config["description"], platform))
+
+    for index, (name, fmt, width) in enumerate(encodings, start=1):
+        unit = "significant bits" if fmt == "BNR" else "digits"
+        emit("    DAQ_ENCODING_%-11s= %dU,   /**< %s, %d %s */"
+             % (name, index, fmt, width, unit))
+    emit("    DAQ_ENCODING_COUNT      = %dU" % (len(encodings) + 1))
+    emit("} daq_encoding_t;")
+    emit("")
+
+    emit("""/* ============================================================================
+ * DATA
+ * ============================================================================ */
+
+/** @brief Parameter configuration table */
+static _Alignas(DAQ_PARAM_TABLE_ALIGN)
+const daq_param_config_t s_param_config[EHMS_PARAM_COUNT] =
+{
+    /* param_id, arinc_label, bus_primary, bus_backup, scale_factor, offset */""")
+    width = max(len("EHMS_PARAM_%s" % name) for _, name, _, _, _ in entries)
+    for _, name, label, entry, _ in entries:
+        param = "EHMS_PARAM_%s" % name
+        emit("    %s = { %s 0o%03o, %d, %d, %-7s %-7s },"
+             % (("[%s]" % param).ljust(width + 2), (param + ",").ljust(width + 1),
+                label, entry["bus_primary"], entry["bus_backup"],
+                c_float(entry["resolution"]) + ",", c_float(entry["offset"])))
+    emit("};")
+    emit("")
+
+    emit("""/** @brief Data field encoding of each parameter, daq_encoding_t */
+static _Alignas(DAQ_PARAM_TABLE_ALIGN)
+const uint8_t s_param_encoding[EHMS_PARAM_COUNT] =
+{""")
+    for _, name, _, _, key in entries:
+        emit("    %s = (uint8_t)DAQ_ENCODING_%s,"
+             % (("[EHMS_PARAM_%s]" % name).ljust(width + 2), key[0]))
+    emit("};")
+    emit("")
+
+    emit("""/* ============================================================================
+ * FUNCTIONS
+ * ============================================================================ */
+
+/**
+ * @brief Decode the data field of a received word
+ *
+ * @param[in]  param   Parameter the word's label is routed to
+ * @param[in]  word    Received word
+ * @param[out] counts  Receives the value in counts of the parameter's resolution
+ * @return true if the data field is valid for the parameter's encoding
+ */
+static inline bool daq_decode_arinc429_word(uint32_t param, const arinc429_word_t* word,
+                                            int32_t* counts)
+{
+    bool valid = true;
+    
+    switch ((daq_encoding_t)s_param_encoding[param])
+    {""")
+    for name, fmt, width in encodings:
+        emit("        case DAQ_ENCODING_%s:" % name)
+        if fmt == "BNR":
+            emit("            *counts = arinc429_decode_bnr(word->data, %dU);" % width)
+        else:
+            emit("            valid = arinc429_decode_bcd(word->data, word->ssm, %dU, counts);"
+                 % width)
+        emit("            break;")
+    emit("""        default:
+            valid = false;
+            break;
+    }
+    
+    return valid;
+}
+
+#endif /* DAQ_PARAM_TABLE_H */
+
+/* END OF FILE */""")
+    return "\n".join(out) + "\n"
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("config", help="OEM configuration (JSON)")
+    parser.add_argument("-o", "--output", default="daq_param_table.h",
+                        help="generated header (default: %(default)s)")
+    parser.add_argument("--types", default=None,
+                        help="path of %s (default: next to the output)" % TYPES_HEADER)
+    args = parser.parse_args()
+
+    types_path = args.types or os.path.join(os.path.dirname(os.path.abspath(args.output)),
+                                            TYPES_HEADER)
+    try:
+        param_ids = read_param_ids(types_path)
+        bus_count = read_bus_count(types_path)
+        config, entries, encodings = load_config(args.config, param_ids, bus_count)
+    except (ConfigError, KeyError, ValueError) as error:
+        sys.stderr.write("%s: %s\n" % (args.config, error))
+        return 1
+
+    config_rel = os.path.normpath(args.config)
+    with open(args.output, "w", encoding="ascii", newline="\n") as handle:
+        handle.write(render(config, entries, encodings, config_rel.replace(os.sep, "/")))
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,75 @@
+#!/bin/sh
+# Build and run the host benchmarks for the checked-out commit.
+#
+# Reports the static memory footprint (text/data/bss) of each pipeline
+# module, then runs bench_crc32, bench_pipeline and bench_fleet. Compare the
+# pipeline digests between commits: they change only when pipeline output
+# does.
+#
+# Usage:
+#     tools/run_benchmarks.sh [cycles] [trace-file]
+#
+# Environment:
+#     EHMS_INCLUDE  directory of the platform headers (ehms_config.h and the
+#                   driver, database, error handler and consumer interfaces)
+#     CC            host compiler (default: cc)
+#     CFLAGS        build options, e.g. "-O2 -DDAQ_ARINC429_FIFO_READ"
+#                   (default: -O2)
+#     BUILD_DIR     output directory (default: build/bench)
+
+set -e
+
+ROOT=$(cd "$(dirname "$0")/.." && pwd)
+CC=${CC:-cc}
+CFLAGS=${CFLAGS:--O2}
+BUILD_DIR=${BUILD_DIR:-$ROOT/build/bench}
+INCLUDES="-I$ROOT"
+
+if [ -n "$EHMS_INCLUDE" ]; then
+    INCLUDES="$INCLUDES -I$EHMS_INCLUDE"
+fi
+
+PIPELINE="data_acquisition alert_manager param_validation anomaly_detection trend_engine ehms_crc32 ehms_packed"
+
+mkdir -p "$BUILD_DIR"
+
+for module in $PIPELINE replay_engine recorder_stream fleet_batch; do
+    # shellcheck disable=SC2086
+    $CC -std=c11 -Wall -Wextra $CFLAGS $INCLUDES -c "$ROOT/$module.c" -o "$BUILD_DIR/$module.o"
+done
+
+# shellcheck disable=SC2086
+$CC -std=c11 -Wall -Wextra $CFLAGS $INCLUDES "$ROOT/bench_crc32.c" "$BUILD_DIR/ehms_crc32.o" \
+    -o "$BUILD_DIR/bench_crc32"
+
+# shellcheck disable=SC2086
+$CC -std=c11 -Wall -Wextra $CFLAGS $INCLUDES -c "$ROOT/bench_pipeline.c" \
+    -o "$BUILD_DIR/bench_pipeline.o"
+objects=""
+for module in $PIPELINE replay_engine; do
+    objects="$objects $BUILD_DIR/$module.o"
+done
+# shellcheck disable=SC2086
+$CC "$BUILD_DIR/bench_pipeline.o" $objects -lm -o "$BUILD_DIR/bench_pipeline"
+
+# shellcheck disable=SC2086
+$CC -std=c11 -Wall -Wextra $CFLAGS $INCLUDES -c "$ROOT/bench_fleet.c" -o "$BUILD_DIR/bench_fleet.o"
+# shellcheck disable=SC2086
+$CC "$BUILD_DIR/bench_fleet.o" $objects "$BUILD_DIR/recorder_stream.o" "$BUILD_DIR/fleet_batch.o" \
+    -lm -pthread -o "$BUILD_DIR/bench_fleet"
+
+echo "Commit: $(git -C "$ROOT" describe --always --dirty 2>/dev/null || echo unknown)"
+echo "Build:  $CC $CFLAGS"
+echo
+echo "Static footprint of the pipeline modules (bytes)"
+for module in $PIPELINE; do
+    size "$BUILD_DIR/$module.o" | tail -n 1 | awk -v m="$module" \
+        '{ printf "  %-20s text %8d  data %8d  bss %8d\n", m, $1, $2, $3 }'
+done
+echo
+
+"$BUILD_DIR/bench_crc32"
+echo
+"$BUILD_DIR/bench_pipeline" "$@"
+echo
+"$BUILD_DIR/bench_fleet"
@@ -0,0 +1,93 @@
+#!/usr/bin/env python3
+"""Unit tests for tools/gen_param_table.py.
+
+Usage:
+    python3 tools/test_gen_param_table.py
+"""
+
+import importlib.util
+import json
+import os
+import subprocess
+import sys
+import tempfile
+import unittest
+
+TOOLS_DIR = os.path.dirname(os.path.abspath(__file__))
+ROOT = os.path.dirname(TOOLS_DIR)
+GENERATOR = os.path.join(TOOLS_DIR, "gen_param_table.py")
+TYPES_PATH = os.path.join(ROOT, "ehms_types.h")
+
+_SPEC = importlib.util.spec_from_file_location("gen_param_table", GENERATOR)
+gen = importlib.util.module_from_spec(_SPEC)
+_SPEC.loader.exec_module(gen)
+
+
+def parameter(param, label, bus_primary, bus_backup):
+    """Return a BNR parameter entry."""
+    return {"param": param, "label": label, "bus_primary": bus_primary,
+            "bus_backup": bus_backup, "encoding": "BNR", "bits": 18,
+            "resolution": 0.1, "offset": 0.0}
+
+
+class GenParamTableTest(unittest.TestCase):
+    """Configuration validation and table generation."""
+
+    def setUp(self):
+        self.tmp = tempfile.TemporaryDirectory()
+        self.param_ids = gen.read_param_ids(TYPES_PATH)
+        self.bus_count = gen.read_bus_count(TYPES_PATH)
+
+    def tearDown(self):
+        self.tmp.cleanup()
+
+    def write_config(self, parameters):
+        """Write a configuration and return its path."""
+        path = os.path.join(self.tmp.name, "config.json")
+        with open(path, "w", encoding="utf-8") as handle:
+            json.dump({"platform": "test", "description": "Test platform",
+                       "parameters": parameters}, handle)
+        return path
+
+    def run_generator(self, config_path):
+        """Run the generator; return (returncode, stderr, output path)."""
+        output = os.path.join(self.tmp.name, "daq_param_table.h")
+        proc = subprocess.run([sys.executable, GENERATOR, config_path, "-o", output,
+                               "--types", TYPES_PATH],
+                              capture_output=True, text=True, check=False)
+        return proc.returncode, proc.stderr, output
+
+    def test_bus_count_read_from_types(self):
+        self.assertEqual(4, self.bus_count)
+
+    def test_no_backup_accepted(self):
+        path = self.write_config([parameter("N1", "310", 0, 0),
+                                  parameter("N2", "311", 0, 1)])
+        _, entries, _ = gen.load_config(path, self.param_ids, self.bus_count)
+        self.assertEqual(2, len(entries))
+
+        returncode, stderr, output = self.run_generator(path)
+        self.assertEqual(0, returncode, stderr)
+        with open(output, encoding="ascii") as handle:
+            self.assertIn("EHMS_PARAM_N1, 0o310, 0, 0,", handle.read())
+
+    def test_label_reused_on_bus_rejected(self):
+        path = self.write_config([parameter("N1", "310", 0, 1),
+                                  parameter("N2", "310", 1, 1)])
+        with self.assertRaisesRegex(gen.ConfigError, "label 310 on bus 1 already used by N1"):
+            gen.load_config(path, self.param_ids, self.bus_count)
+
+    def test_bus_beyond_bus_count_rejected(self):
+        for primary, backup in ((self.bus_count, 0), (0, self.bus_count), (200, 200)):
+            path = self.write_config([parameter("N1", "310", primary, backup)])
+            with self.assertRaisesRegex(gen.ConfigError, "bus %d out of range"
+                                        % max(primary, backup)):
+                gen.load_config(path, self.param_ids, self.bus_count)
+
+        returncode, stderr, _ = self.run_generator(path)
+        self.assertEqual(1, returncode)
+        self.assertIn("EHMS_ARINC429_BUS_COUNT 4", stderr)
+
+
+if __name__ == "__main__":
+    unittest.main()
@@ -0,0 +1,561 @@
+/**
+ * @file trend_engine.c
+ * @brief EHMS Rolling Parameter Trend Statistics
+ *
+ * @copyright Copyright (c) 2026 AeroTech Avionics Inc.
+ * @note DO-178C Level B - Safety Critical Software
+ *
+ * CSCI: EHMS-CORE
+ * CSC: TREND-ENGINE
+ *
+ * Requirements Trace:
+ *   SRS-EHMS-060: System shall provide predictive maintenance data
+ *   SRS-EHMS-061: System shall maintain rolling parameter trend statistics
+ *   SRS-EHMS-016: System shall resume monitoring from checkpointed state
+ *                 after a power interruption
+ */
+
+/* ============================================================================
+ * INCLUDES
+ * ============================================================================ */
+#include "trend_engine.h"
+
+#include <string.h>
+
+/* ============================================================================
+ * PRIVATE CONSTANTS
+ * ============================================================================ */
+
+/** @brief Ring slots of all resolutions */
+#define TREND_HISTORY_SLOTS             (TREND_SECOND_DEPTH + TREND_MINUTE_DEPTH + \
+                                         TREND_PHASE_DEPTH)
+
+/** @brief Milliseconds per 1 s and 1 min period */
+#define TREND_MS_PER_SECOND             1000U
+#define TREND_MS_PER_MINUTE             60000U
+
+/* ============================================================================
+ * PRIVATE TYPES
+ * ============================================================================ */
+
+/**
+ * @brief Open period of one parameter at one resolution
+ *
+ * Phases last hours; the sum is kept in double so that 100 Hz samples
+ * still register against it.
+ */
+typedef struct
+{
+    uint32_t                count;              /**< Valid samples */
+    double                  sum;                /**< Sum of samples */
+    float                   min;                /**< Minimum */
+    float                   max;                /**< Maximum */
+} trend_accumulator_t;
+
+/**
+ * @brief Closed period of one parameter (period number held per engine)
+ */
+typedef struct
+{
+    uint32_t                count;              /**< Valid samples */
+    float                   mean;               /**< Mean */
+    float                   min;                /**< Minimum */
+    float                   max;                /**< Maximum */
+} trend_slot_t;
+
+/**
+ * @brief Trend state of one parameter
+ *
+ * The Welford mean and sum of squared deviations are double: after about
+ * 10^6 samples the per-sample correction falls below float resolution.
+ */
+typedef struct
+{
+    uint32_t                count;              /**< Valid samples used */
+    uint32_t                last_ms;            /**< Timestamp of latest sample used */
+    double                  mean;               /**< Welford mean */
+    double                  m2;                 /**< Welford sum of squared deviations */
+    float                   ewma;               /**< Exponentially weighted mean */
+    float                   min;                /**< Minimum */
+    float                   max;                /**< Maximum */
+    float                   last;               /**< Latest sample */
+    trend_accumulator_t     open[TREND_RESOLUTION_COUNT]; /**< Periods being built */
+    trend_slot_t            history[TREND_HISTORY_SLOTS]; /**< Closed period rings */
+} trend_param_state_t;
+
+/**
+ * @brief Trend state of one engine
+ *
+ * All parameters of an engine close their periods together, so the period
+ * numbers and ring positions are held once per engine.
+ */
+typedef struct
+{
+    bool                    started;            /**< A block has been folded in */
+    uint32_t                current[TREND_RESOLUTION_COUNT]; /**< Open period numbers */
+    uint32_t                head[TREND_RESOLUTION_COUNT];    /**< Next ring slot */
+    uint32_t                filled[TREND_RESOLUTION_COUNT];  /**< Closed periods held */
+    uint32_t                period[TREND_HISTORY_SLOTS];     /**< Period of each slot */
+    trend_param_state_t     param[EHMS_PARAM_COUNT];
+} trend_engine_state_t;
+
+/**
+ * @brief Trend context: the onboard module state, or one for each log
+ */
+struct trend_context
+{
+    bool                    is_initialized;
+    trend_engine_state_t    engine[EHMS_ENGINE_COUNT];
+};
+
+/* ============================================================================
+ * PRIVATE DATA
+ * ============================================================================ */
+
+/** @brief Onboard trend context - static allocation for safety */
+static trend_context_t s_trend_state;
+
+/** @brief Ring length of each resolution */
+static const uint32_t s_trend_depth[TREND_RESOLUTION_COUNT] =
+{
+    TREND_SECOND_DEPTH,
+    TREND_MINUTE_DEPTH,
+    TREND_PHASE_DEPTH,
+};
+
+/** @brief First history slot of each resolution */
+static const uint32_t s_trend_offset[TREND_RESOLUTION_COUNT] =
+{
+    0U,
+    TREND_SECOND_DEPTH,
+    TREND_SECOND_DEPTH + TREND_MINUTE_DEPTH,
+};
+
+/* ============================================================================
+ * PRIVATE FUNCTION PROTOTYPES
+ * ============================================================================ */
+
+static void trend_close_period(trend_engine_state_t* engine, uint32_t resolution);
+static void trend_add_sample(trend_param_state_t* param, float value, uint32_t time_ms);
+
+/* ============================================================================
+ * PUBLIC FUNCTIONS
+ * ============================================================================ */
+
+/**
+ * @brief Initialize the trend engine
+ * @trace SRS-EHMS-061
+ */
+ehms_result_t trend_init(void)
+{
+    return trend_ctx_init(&s_trend_state);
+}
+
+/**
+ * @brief Get the storage size of a trend context
+ * @return Size in bytes
+ */
+uint32_t trend_context_size(void)
+{
+    return (uint32_t)sizeof(trend_context_t);
+}
+
+/**
+ * @brief Initialize a trend context
+ * @trace SRS-EHMS-061
+ */
+ehms_result_t trend_ctx_init(trend_context_t* ctx)
+{
+    ehms_result_t result = EHMS_OK;
+    
+    if (ctx == NULL)
+    {
+        result = EHMS_ERROR_PARAM;
+    }
+    else
+    {
+        (void)memset(ctx, 0, sizeof(*ctx));
+        ctx->is_initialized = true;
+    }
+    
+    return result;
+}
+
+/**
+ * @brief Fold one acquisition cycle into the trend statistics
+ * @trace SRS-EHMS-061
+ */
+ehms_result_t trend_update(const ehms_engine_block_t* block, uint32_t time_ms)
+{
+    return trend_ctx_update(&s_trend_state, block, time_ms);
+}
+
+/**
+ * @brief Fold one acquisition cycle into the statistics of a trend context
+ * @trace SRS-EHMS-061
+ */
+ehms_result_t trend_ctx_update(trend_context_t* ctx, const ehms_engine_block_t* block,
+                               uint32_t time_ms)
+{
+    ehms_result_t result = EHMS_OK;
+    
+    if ((ctx == NULL) || (block == NULL))
+    {
+        result = EHMS_ERROR_PARAM;
+    }
+    else if (block->engine_id >= EHMS_ENGINE_COUNT)
+    {
+        result = EHMS_ERROR_RANGE;
+    }
+    else if (!ctx->is_initialized)
+    {
+        result = EHMS_ERROR_NOT_INIT;
+    }
+    else
+    {
+        trend_engine_state_t* engine = &ctx->engine[block->engine_id];
+        uint32_t period[TREND_RESOLUTION_COUNT];
+        
+        period[TREND_RESOLUTION_SECOND] = time_ms / TREND_MS_PER_SECOND;
+        period[TREND_RESOLUTION_MINUTE] = time_ms / TREND_MS_PER_MINUTE;
+        period[TREND_RESOLUTION_PHASE] = block->flight_phase;
+        
+        /* Close the periods this block has moved out of */
+        for (uint32_t r = 0U; r < TREND_RESOLUTION_COUNT; r++)
+        {
+            if (engine->started && (period[r] != engine->current[r]))
+            {
+                trend_close_period(engine, r);
+            }
+            
+            engine->current[r] = period[r];
+        }
+        
+        engine->started = true;
+        
+        for (uint32_t p = 0U; p < EHMS_PARAM_COUNT; p++)
+        {
+            trend_param_state_t* param = &engine->param[p];
+            
+            /* Use each valid sample once, however many cycles it is held */
+            if ((block->status[p] == (uint8_t)EHMS_PARAM_VALID) &&
+                ((param->count == 0U) || (block->timestamp_ms[p] != param->last_ms)))
+            {
+                trend_add_sample(param, block->eng_value[p], block->timestamp_ms[p]);
+            }
+        }
+    }
+    
+    return result;
+}
+
+/**
+ * @brief Get the running statistics of a parameter
+ * @trace SRS-EHMS-060
+ */
+ehms_result_t trend_get_statistics(ehms_engine_id_t engine_id,
+                                   ehms_param_id_t param_id,
+                                   trend_statistics_t* stats)
+{
+    return trend_ctx_get_statistics(&s_trend_state, engine_id, param_id, stats);
+}
+
+/**
+ * @brief Get the running statistics of a parameter in a trend context
+ * @trace SRS-EHMS-060
+ */
+ehms_result_t trend_ctx_get_statistics(const trend_context_t* ctx,
+                                       ehms_engine_id_t engine_id,
+                                       ehms_param_id_t param_id,
+                                       trend_statistics_t* stats)
+{
+    ehms_result_t result = EHMS_OK;
+    
+    if ((ctx == NULL) || (stats == NULL))
+    {
+        result = EHMS_ERROR_PARAM;
+    }
+    else if ((engine_id >= EHMS_ENGINE_COUNT) || (param_id >= EHMS_PARAM_COUNT))
+    {
+        result = EHMS_ERROR_RANGE;
+    }
+    else if (!ctx->is_initialized)
+    {
+        result = EHMS_ERROR_NOT_INIT;
+    }
+    else
+    {
+        const trend_param_state_t* param = &ctx->engine[engine_id].param[param_id];
+        
+        stats->count = param->count;
+        stats->mean = (float)param->mean;
+        stats->variance = (param->count > 1U) ?
+                          (float)(param->m2 / (double)(param->count - 1U)) : 0.0f;
+        stats->ewma = param->ewma;
+        stats->min = param->min;
+        stats->max = param->max;
+        stats->last = param->last;
+    }
+    
+    return result;
+}
+
+/**
+ * @brief Get a closed aggregate of a parameter
+ * @trace SRS-EHMS-060
+ */
+ehms_result_t trend_get_history(ehms_engine_id_t engine_id,
+                                ehms_param_id_t param_id,
+                                trend_resolution_t resolution,
+                                uint32_t age,
+                                trend_aggregate_t* aggregate)
+{
+    return trend_ctx_get_history(&s_trend_state, engine_id, param_id, resolution, age,
+                                 aggregate);
+}
+
+/**
+ * @brief Get a closed aggregate of a parameter in a trend context
+ * @trace SRS-EHMS-060
+ */
+ehms_result_t trend_ctx_get_history(const trend_context_t* ctx,
+                                    ehms_engine_id_t engine_id,
+                                    ehms_param_id_t param_id,
+                                    trend_resolution_t resolution,
+                                    uint32_t age,
+                                    trend_aggregate_t* aggregate)
+{
+    ehms_result_t result = EHMS_OK;
+    
+    if ((ctx == NULL) || (aggregate == NULL))
+    {
+        result = EHMS_ERROR_PARAM;
+    }
+    else if ((engine_id >= EHMS_ENGINE_COUNT) || (param_id >= EHMS_PARAM_COUNT) ||
+             (resolution >= TREND_RESOLUTION_COUNT))
+    {
+        result = EHMS_ERROR_RANGE;
+    }
+    else if (!ctx->is_initialized)
+    {
+        result = EHMS_ERROR_NOT_INIT;
+    }
+    else if (age >= ctx->engine[engine_id].filled[resolution])
+    {
+        result = EHMS_ERROR_RANGE;
+    }
+    else
+    {
+        const trend_engine_state_t* engine = &ctx->engine[engine_id];
+        uint32_t depth = s_trend_depth[resolution];
+        uint32_t slot = s_trend_offset[resolution] +
+                        (((engine->head[resolution] + depth) - 1U - age) % depth);
+        const trend_slot_t* closed = &engine->param[param_id].history[slot];
+        
+        aggregate->period = engine->period[slot];
+        aggregate->count = closed->count;
+        aggregate->mean = closed->mean;
+        aggregate->min = closed->min;
+        aggregate->max = closed->max;
+    }
+    
+    return result;
+}
+
+/**
+ * @brief Save the trend state of an engine for a warm start
+ * @trace SRS-EHMS-016, SRS-EHMS-061
+ */
+ehms_result_t trend_save_warm_state(ehms_engine_id_t engine_id, trend_warm_engine_t* state)
+{
+    ehms_result_t result = EHMS_OK;
+    
+    if (state == NULL)
+    {
+        result = EHMS_ERROR_PARAM;
+    }
+    else if (engine_id >= EHMS_ENGINE_COUNT)
+    {
+        result = EHMS_ERROR_RANGE;
+    }
+    else if (!s_trend_state.is_initialized)
+    {
+        result = EHMS_ERROR_NOT_INIT;
+    }
+    else
+    {
+        const trend_engine_state_t* engine = &s_trend_state.engine[engine_id];
+        
+        (void)memset(state, 0, sizeof(*state));
+        state->started = engine->started ? 1U : 0U;
+        state->flight_phase = engine->current[TREND_RESOLUTION_PHASE];
+        
+        for (uint32_t p = 0U; p < EHMS_PARAM_COUNT; p++)
+        {
+            const trend_param_state_t* param = &engine->param[p];
+            const trend_accumulator_t* phase = &param->open[TREND_RESOLUTION_PHASE];
+            trend_warm_param_t* out = &state->param[p];
+            
+            out->count = param->count;
+            out->mean = param->mean;
+            out->m2 = param->m2;
+            out->ewma = param->ewma;
+            out->min = param->min;
+            out->max = param->max;
+            out->last = param->last;
+            out->phase_count = phase->count;
+            out->phase_min = phase->min;
+            out->phase_max = phase->max;
+            out->phase_sum = phase->sum;
+        }
+    }
+    
+    return result;
+}
+
+/**
+ * @brief Restore the trend state of an engine saved by trend_save_warm_state
+ * @trace SRS-EHMS-016, SRS-EHMS-061
+ */
+ehms_result_t trend_restore_warm_state(ehms_engine_id_t engine_id,
+                                       const trend_warm_engine_t* state,
+                                       uint32_t time_ms)
+{
+    ehms_result_t result = EHMS_OK;
+    
+    if (state == NULL)
+    {
+        result = EHMS_ERROR_PARAM;
+    }
+    else if ((engine_id >= EHMS_ENGINE_COUNT) || (state->started > 1U))
+    {
+        result = EHMS_ERROR_RANGE;
+    }
+    else if (!s_trend_state.is_initialized)
+    {
+        result = EHMS_ERROR_NOT_INIT;
+    }
+    else
+    {
+        trend_engine_state_t* engine = &s_trend_state.engine[engine_id];
+        
+        (void)memset(engine, 0, sizeof(*engine));
+        engine->started = (state->started != 0U);
+        engine->current[TREND_RESOLUTION_SECOND] = time_ms / TREND_MS_PER_SECOND;
+        engine->current[TREND_RESOLUTION_MINUTE] = time_ms / TREND_MS_PER_MINUTE;
+        engine->current[TREND_RESOLUTION_PHASE] = state->flight_phase;
+        
+        for (uint32_t p = 0U; p < EHMS_PARAM_COUNT; p++)
+        {
+            const trend_warm_param_t* in = &state->param[p];
+            trend_param_state_t* param = &engine->param[p];
+            trend_accumulator_t* phase = &param->open[TREND_RESOLUTION_PHASE];
+            
+            param->count = in->count;
+            param->last_ms = time_ms;
+            param->mean = in->mean;
+            param->m2 = in->m2;
+            param->ewma = in->ewma;
+            param->min = in->min;
+            param->max = in->max;
+            param->last = in->last;
+            phase->count = in->phase_count;
+            phase->min = in->phase_min;
+            phase->max = in->phase_max;
+            phase->sum = in->phase_sum;
+        }
+    }
+    
+    return result;
+}
+
+/* ============================================================================
+ * PRIVATE FUNCTIONS
+ * ============================================================================ */
+
+/**
+ * @brief Close the open period of every parameter of an engine at one resolution
+ *
+ * The oldest slot of the ring is overwritten once the ring is full.
+ */
+static void trend_close_period(trend_engine_state_t* engine, uint32_t resolution)
+{
+    uint32_t slot = s_trend_offset[resolution] + engine->head[resolution];
+    
+    engine->period[slot] = engine->current[resolution];
+    
+    for (uint32_t p = 0U; p < EHMS_PARAM_COUNT; p++)
+    {
+        trend_accumulator_t* open = &engine->param[p].open[resolution];
+        trend_slot_t* closed = &engine->param[p].history[slot];
+        
+        closed->count = open->count;
+        closed->mean = (open->count > 0U) ? (float)(open->sum / (double)open->count) : 0.0f;
+        closed->min = open->min;
+        closed->max = open->max;
+        
+        (void)memset(open, 0, sizeof(*open));
+    }
+    
+    engine->head[resolution] = (engine->head[resolution] + 1U) % s_trend_depth[resolution];
+    
+    if (engine->filled[resolution] < s_trend_depth[resolution])
+    {
+        engine->filled[resolution]++;
+    }
+}
+
+/**
+ * @brief Add one valid sample to the statistics of a parameter
+ *
+ * The EWMA weight dt / (tau + dt) approximates 1 - exp(-dt / tau) without
+ * a transcendental call; it is exact as dt / tau tends to 0 and stays
+ * below 1 for any interval, such as a parameter returning after a gap.
+ */
+static void trend_add_sample(trend_param_state_t* param, float value, uint32_t time_ms)
+{
+    double delta = (double)value - param->mean;
+    
+    param->count++;
+    param->mean += delta / (double)param->count;
+    param->m2 += delta * ((double)value - param->mean);
+    
+    if (param->count == 1U)
+    {
+        param->ewma = value;
+        param->min = value;
+        param->max = value;
+    }
+    else
+    {
+        float dt = (float)(time_ms - param->last_ms);
+        
+        param->ewma += (dt / ((float)TREND_EWMA_TAU_MS + dt)) * (value - param->ewma);
+        param->min = (value < param->min) ? value : param->min;
+        param->max = (value > param->max) ? value : param->max;
+    }
+    
+    param->last = value;
+    param->last_ms = time_ms;
+    
+    for (uint32_t r = 0U; r < TREND_RESOLUTION_COUNT; r++)
+    {
+        trend_accumulator_t* open = &param->open[r];
+        
+        if (open->count == 0U)
+        {
+            open->min = value;
+            open->max = value;
+        }
+        else
+        {
+            open->min = (value < open->min) ? value : open->min;
+            open->max = (value > open->max) ? value : open->max;
+        }
+        
+        open->count++;
+        open->sum += (double)value;
+    }
+}
+
+/* END OF FILE */
@@ -0,0 +1,308 @@
+/**
+ * @file trend_engine.h
+ * @brief EHMS Rolling Parameter Trend Statistics
+ *
+ * @copyright Copyright (c) 2026 AeroTech Avionics Inc.
+ * @note This file is subject to DO-178C Level B certification requirements
+ *
+ * CSCI: EHMS-CORE
+ * CSC: TREND-ENGINE
+ *
+ * Requirements Trace:
+ *   SRS-EHMS-060: System shall provide predictive maintenance data
+ *   SRS-EHMS-061: System shall maintain rolling parameter trend statistics
+ *   SRS-EHMS-016: System shall resume monitoring from checkpointed state
+ *                 after a power interruption
+ *
+ * The trend engine is fed the engine parameter block once per acquisition
+ * cycle and updates its statistics in place; every new valid sample costs
+ * a fixed amount of work and no history is ever rescanned. For each engine
+ * and parameter it keeps:
+ *   - running count, mean, variance (Welford), minimum and maximum
+ *   - an exponentially weighted mean with time constant TREND_EWMA_TAU_MS,
+ *     weighted by the time between samples so that it behaves the same at
+ *     every rate group
+ *   - rings of closed 1 s, 1 min and flight phase aggregates (count, mean,
+ *     minimum, maximum)
+ *
+ * A sample is new when its timestamp differs from the last one used, so
+ * parameters not read in a cycle are not counted again; only VALID samples
+ * are used. Periods close for all parameters of an engine at once, when a
+ * block's time enters the next second or minute or its flight phase
+ * changes; a period without valid samples is recorded with a zero count.
+ *
+ * The trend_ctx_ functions keep the same statistics in a caller-owned
+ * context, so that recorded data of several aircraft can be trended on
+ * the ground, one context per log. The trend_ functions operate on the
+ * onboard context, which alone is carried over a warm start. The onboard
+ * state is static; the module performs no dynamic allocation.
+ */
+
+#ifndef TREND_ENGINE_H
+#define TREND_ENGINE_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* ============================================================================
+ * INCLUDES
+ * ============================================================================ */
+#include "ehms_types.h"
+
+/* ============================================================================
+ * CONSTANTS
+ * ============================================================================ */
+
+/** @brief Closed 1 s aggregates kept per parameter (last minute) */
+#ifndef TREND_SECOND_DEPTH
+#define TREND_SECOND_DEPTH                  60U
+#endif
+
+/** @brief Closed 1 min aggregates kept per parameter (last hour) */
+#ifndef TREND_MINUTE_DEPTH
+#define TREND_MINUTE_DEPTH                  60U
+#endif
+
+/** @brief Closed flight phase aggregates kept per parameter */
+#ifndef TREND_PHASE_DEPTH
+#define TREND_PHASE_DEPTH                   8U
+#endif
+
+/** @brief Time constant of the exponentially weighted mean */
+#ifndef TREND_EWMA_TAU_MS
+#define TREND_EWMA_TAU_MS                   10000U
+#endif
+
+_Static_assert((TREND_SECOND_DEPTH > 0U) && (TREND_MINUTE_DEPTH > 0U) &&
+               (TREND_PHASE_DEPTH > 0U), "Trend rings shall not be empty");
+_Static_assert(TREND_EWMA_TAU_MS > 0U, "EWMA time constant shall be positive");
+
+/* ============================================================================
+ * TYPES
+ * ============================================================================ */
+
+/**
+ * @brief Aggregate resolutions
+ */
+typedef enum
+{
+    TREND_RESOLUTION_SECOND = 0U,   /**< 1 s periods */
+    TREND_RESOLUTION_MINUTE = 1U,   /**< 1 min periods */
+    TREND_RESOLUTION_PHASE  = 2U,   /**< Flight phases */
+    TREND_RESOLUTION_COUNT  = 3U
+} trend_resolution_t;
+
+/**
+ * @brief Running statistics of one parameter
+ */
+typedef struct
+{
+    uint32_t            count;                  /**< Valid samples used */
+    float               mean;                   /**< Mean */
+    float               variance;               /**< Sample variance (0 below 2 samples) */
+    float               ewma;                   /**< Exponentially weighted mean */
+    float               min;                    /**< Minimum */
+    float               max;                    /**< Maximum */
+    float               last;                   /**< Latest sample */
+} trend_statistics_t;
+
+/**
+ * @brief One closed period of a parameter
+ */
+typedef struct
+{
+    uint32_t            period;                 /**< Second or minute number, or flight phase */
+    uint32_t            count;                  /**< Valid samples in the period */
+    float               mean;                   /**< Mean (0 if count is 0) */
+    float               min;                    /**< Minimum (0 if count is 0) */
+    float               max;                    /**< Maximum (0 if count is 0) */
+} trend_aggregate_t;
+
+/**
+ * @brief Running statistics and open flight phase period of one parameter,
+ *        carried over a warm start
+ */
+typedef struct
+{
+    uint32_t            count;                  /**< Valid samples used */
+    uint32_t            phase_count;            /**< Valid samples in the open phase */
+    double              mean;                   /**< Welford mean */
+    double              m2;                     /**< Welford sum of squared deviations */
+    double              phase_sum;              /**< Open phase sum of samples */
+    float               ewma;                   /**< Exponentially weighted mean */
+    float               min;                    /**< Minimum */
+    float               max;                    /**< Maximum */
+    float               last;                   /**< Latest sample */
+    float               phase_min;              /**< Open phase minimum */
+    float               phase_max;              /**< Open phase maximum */
+} trend_warm_param_t;
+
+/**
+ * @brief Trend state of one engine carried over a warm start
+ */
+typedef struct
+{
+    uint8_t             started;                /**< A block had been folded in (0 or 1) */
+    uint8_t             reserved[3];            /**< Zero */
+    uint32_t            flight_phase;           /**< Flight phase of the open phase period */
+    trend_warm_param_t  param[EHMS_PARAM_COUNT]; /**< By ehms_param_id_t */
+} trend_warm_engine_t;
+
+/**
+ * @brief Trend context: the statistics and rings of every engine
+ *
+ * Opaque; storage of trend_context_size() bytes is provided by the caller.
+ * Contexts share nothing, so different contexts may be used from
+ * different tasks concurrently; one context shall be used by one task at
+ * a time.
+ */
+typedef struct trend_context trend_context_t;
+
+/* ============================================================================
+ * FUNCTION PROTOTYPES
+ * ============================================================================ */
+
+/**
+ * @brief Initialize the trend engine, clearing every statistic and ring
+ *
+ * @return EHMS_OK on success, error code otherwise
+ *
+ * @trace SRS-EHMS-061
+ */
+ehms_result_t trend_init(void);
+
+/**
+ * @brief Fold one acquisition cycle into the trend statistics
+ *
+ * @param[in] block    Engine parameter block; engine taken from block->engine_id
+ * @param[in] time_ms  Monotonic time of the cycle (selects the 1 s and 1 min period)
+ * @return EHMS_OK on success, error code otherwise
+ *
+ * @trace SRS-EHMS-061
+ */
+ehms_result_t trend_update(const ehms_engine_block_t* block, uint32_t time_ms);
+
+/**
+ * @brief Get the running statistics of a parameter
+ *
+ * @param[in]  engine_id  Engine identifier
+ * @param[in]  param_id   Parameter identifier
+ * @param[out] stats      Receives statistics
+ * @return EHMS_OK on success, error code otherwise
+ *
+ * @trace SRS-EHMS-060
+ */
+ehms_result_t trend_get_statistics(ehms_engine_id_t engine_id,
+                                   ehms_param_id_t param_id,
+                                   trend_statistics_t* stats);
+
+/**
+ * @brief Get a closed aggregate of a parameter
+ *
+ * @param[in]  engine_id   Engine identifier
+ * @param[in]  param_id    Parameter identifier
+ * @param[in]  resolution  Aggregate resolution
+ * @param[in]  age         0 for the most recently closed period, 1 for the one before...
+ * @param[out] aggregate   Receives the aggregate
+ * @return EHMS_OK on success, EHMS_ERROR_RANGE if fewer than age + 1
+ *         periods are held, error code otherwise
+ *
+ * @trace SRS-EHMS-060
+ */
+ehms_result_t trend_get_history(ehms_engine_id_t engine_id,
+                                ehms_param_id_t param_id,
+                                trend_resolution_t resolution,
+                                uint32_t age,
+                                trend_aggregate_t* aggregate);
+
+/**
+ * @brief Save the trend state of an engine for a warm start
+ *
+ * The closed period rings are not saved.
+ *
+ * @param[in]  engine_id  Engine identifier
+ * @param[out] state      Receives the trend state; every byte is written
+ * @return EHMS_OK on success, error code otherwise
+ *
+ * @trace SRS-EHMS-016
+ * @trace SRS-EHMS-061
+ */
+ehms_result_t trend_save_warm_state(ehms_engine_id_t engine_id, trend_warm_engine_t* state);
+
+/**
+ * @brief Restore the trend state of an engine saved by trend_save_warm_state
+ *
+ * Called after trend_init. The running statistics resume as if the last
+ * sample saved had been taken at time_ms, so the interruption does not
+ * weigh on the exponentially weighted mean, and the open flight phase
+ * period continues if the engine is still in that phase. The 1 s and
+ * 1 min periods restart at time_ms; the history rings start empty.
+ *
+ * @param[in] engine_id  Engine identifier
+ * @param[in] state      Saved trend state
+ * @param[in] time_ms    Monotonic time the statistics resume at
+ * @return EHMS_OK on success, EHMS_ERROR_RANGE for an invalid state,
+ *         error code otherwise
+ *
+ * @trace SRS-EHMS-016
+ * @trace SRS-EHMS-061
+ */
+ehms_result_t trend_restore_warm_state(ehms_engine_id_t engine_id,
+                                       const trend_warm_engine_t* state,
+                                       uint32_t time_ms);
+
+/**
+ * @brief Get the storage size of a trend context
+ *
+ * @return Size in bytes
+ */
+uint32_t trend_context_size(void);
+
+/**
+ * @brief Initialize a trend context, clearing every statistic and ring
+ *
+ * @param[out] ctx  Context storage of trend_context_size() bytes
+ * @return EHMS_OK on success, EHMS_ERROR_PARAM if ctx is NULL
+ *
+ * @trace SRS-EHMS-061
+ */
+ehms_result_t trend_ctx_init(trend_context_t* ctx);
+
+/**
+ * @brief trend_update of a trend context
+ *
+ * @trace SRS-EHMS-061
+ */
+ehms_result_t trend_ctx_update(trend_context_t* ctx, const ehms_engine_block_t* block,
+                               uint32_t time_ms);
+
+/**
+ * @brief trend_get_statistics of a trend context
+ *
+ * @trace SRS-EHMS-060
+ */
+ehms_result_t trend_ctx_get_statistics(const trend_context_t* ctx,
+                                       ehms_engine_id_t engine_id,
+                                       ehms_param_id_t param_id,
+                                       trend_statistics_t* stats);
+
+/**
+ * @brief trend_get_history of a trend context
+ *
+ * @trace SRS-EHMS-060
+ */
+ehms_result_t trend_ctx_get_history(const trend_context_t* ctx,
+                                    ehms_engine_id_t engine_id,
+                                    ehms_param_id_t param_id,
+                                    trend_resolution_t resolution,
+                                    uint32_t age,
+                                    trend_aggregate_t* aggregate);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* TREND_ENGINE_H */
+
+/* END OF FILE */
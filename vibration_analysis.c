@@ -0,0 +1,378 @@
+/**
+ * @file vibration_analysis.c
+ * @brief EHMS Engine Order Vibration Analysis
+ *
+ * @copyright Copyright (c) 2026 AeroTech Avionics Inc.
+ * @note DO-178C Level B - Safety Critical Software
+ *
+ * CSCI: EHMS-CORE
+ * CSC: VIBRATION-ANALYSIS
+ *
+ * Requirements Trace:
+ *   SRS-EHMS-100: System shall acquire engine parameters at 100Hz
+ *   SRS-EHMS-104: System shall derive shaft order vibration amplitudes
+ */
+
+/* ============================================================================
+ * INCLUDES
+ * ============================================================================ */
+#include "vibration_analysis.h"
+
+#include <math.h>
+#include <string.h>
+
+/* ============================================================================
+ * PRIVATE CONSTANTS
+ * ============================================================================ */
+
+/** @brief 2*pi */
+#define VIB_TWO_PI                      6.28318530717958647692f
+
+/** @brief Hann window coherent gain (mean window value) */
+#define VIB_WINDOW_GAIN                 0.5f
+
+/** @brief Peak amplitude per unit Goertzel magnitude */
+#define VIB_AMPLITUDE_SCALE             (2.0f / (VIB_WINDOW_GAIN * (float)VIB_BLOCK_LENGTH))
+
+/* ============================================================================
+ * PRIVATE TYPES
+ * ============================================================================ */
+
+/**
+ * @brief Waveform ring of one sensor
+ *
+ * head and tail are free-running sample counts; the buffered samples are
+ * [tail, head) modulo VIB_RING_LENGTH.
+ */
+typedef struct
+{
+    int16_t                 sample[VIB_RING_LENGTH]; /**< Waveform samples */
+    uint32_t                head;               /**< Samples written */
+    uint32_t                tail;               /**< Samples consumed */
+} vib_ring_t;
+
+/**
+ * @brief Goertzel filter of one order band
+ */
+typedef struct
+{
+    float                   coeff;              /**< 2*cos(2*pi*f/fs) */
+    float                   s1;                 /**< Filter state, n-1 */
+    float                   s2;                 /**< Filter state, n-2 */
+    float                   frequency_hz;       /**< Frequency latched for the block */
+    bool                    tracking;           /**< Shaft speed valid at block start */
+} vib_goertzel_t;
+
+/**
+ * @brief Analysis state of one sensor
+ */
+typedef struct
+{
+    vib_ring_t              ring;               /**< Received waveform */
+    uint32_t                block_index;        /**< Samples into current block */
+    vib_goertzel_t          filter[VIB_ORDER_COUNT]; /**< Order filters */
+    vib_band_t              band[VIB_ORDER_COUNT];   /**< Published results */
+    vib_sensor_statistics_t stats;              /**< Buffering statistics */
+} vib_sensor_state_t;
+
+/**
+ * @brief Module state structure
+ */
+typedef struct
+{
+    bool                    is_initialized;
+    float                   window[VIB_BLOCK_LENGTH]; /**< Hann window */
+    vib_sensor_state_t      sensor[EHMS_ENGINE_COUNT][VIB_SENSOR_COUNT];
+} vib_state_t;
+
+/* ============================================================================
+ * PRIVATE DATA
+ * ============================================================================ */
+
+/** @brief Module state - static allocation for safety */
+static vib_state_t s_vib_state;
+
+/** @brief Shaft speed at 100%, in revolutions per second, per vib_order_t */
+static const float s_vib_rev_per_s[VIB_ORDER_COUNT] =
+{
+    VIB_N1_RPM_AT_100PCT / 60.0f,
+    VIB_N2_RPM_AT_100PCT / 60.0f,
+};
+
+/* ============================================================================
+ * PRIVATE FUNCTION PROTOTYPES
+ * ============================================================================ */
+
+static void vib_start_block(vib_sensor_state_t* sensor, const float* shaft_speed_pct);
+static void vib_finish_block(vib_sensor_state_t* sensor);
+
+/* ============================================================================
+ * PUBLIC FUNCTIONS
+ * ============================================================================ */
+
+/**
+ * @brief Initialize vibration analysis
+ * @trace SRS-EHMS-104
+ */
+ehms_result_t vib_init(void)
+{
+    (void)memset(&s_vib_state, 0, sizeof(s_vib_state));
+    
+    /* Periodic Hann window: sidelobes of one shaft order stay clear of the other */
+    for (uint32_t n = 0U; n < VIB_BLOCK_LENGTH; n++)
+    {
+        s_vib_state.window[n] = 0.5f -
+            (0.5f * cosf((VIB_TWO_PI * (float)n) / (float)VIB_BLOCK_LENGTH));
+    }
+    
+    for (uint32_t eng = 0U; eng < EHMS_ENGINE_COUNT; eng++)
+    {
+        for (uint32_t s = 0U; s < VIB_SENSOR_COUNT; s++)
+        {
+            for (uint32_t o = 0U; o < VIB_ORDER_COUNT; o++)
+            {
+                s_vib_state.sensor[eng][s].band[o].status = EHMS_PARAM_NCD;
+            }
+        }
+    }
+    
+    s_vib_state.is_initialized = true;
+    
+    return EHMS_OK;
+}
+
+/**
+ * @brief Append waveform samples received from the bus
+ * @trace SRS-EHMS-100
+ */
+ehms_result_t vib_write_samples(ehms_engine_id_t engine_id,
+                                vib_sensor_t sensor,
+                                const uint16_t* words,
+                                uint32_t count)
+{
+    ehms_result_t result = EHMS_OK;
+    
+    if (words == NULL)
+    {
+        result = EHMS_ERROR_PARAM;
+    }
+    else if ((engine_id >= EHMS_ENGINE_COUNT) || (sensor >= VIB_SENSOR_COUNT))
+    {
+        result = EHMS_ERROR_RANGE;
+    }
+    else if (!s_vib_state.is_initialized)
+    {
+        result = EHMS_ERROR_NOT_INIT;
+    }
+    else
+    {
+        vib_sensor_state_t* state = &s_vib_state.sensor[engine_id][sensor];
+        vib_ring_t* ring = &state->ring;
+        uint32_t space = VIB_RING_LENGTH - (ring->head - ring->tail);
+        uint32_t accepted = (count < space) ? count : space;
+        
+        for (uint32_t i = 0U; i < accepted; i++)
+        {
+            ring->sample[(ring->head + i) & (VIB_RING_LENGTH - 1U)] = (int16_t)words[i];
+        }
+        
+        ring->head += accepted;
+        state->stats.samples_received += accepted;
+        
+        if (accepted < count)
+        {
+            state->stats.overrun_count += count - accepted;
+            result = EHMS_ERROR_BUSY;
+        }
+    }
+    
+    return result;
+}
+
+/**
+ * @brief Feed buffered samples of one engine to the order filters
+ * @trace SRS-EHMS-104
+ */
+ehms_result_t vib_process(ehms_engine_id_t engine_id,
+                          const float shaft_speed_pct[VIB_ORDER_COUNT],
+                          uint32_t* completed)
+{
+    ehms_result_t result = EHMS_OK;
+    
+    if ((shaft_speed_pct == NULL) || (completed == NULL))
+    {
+        result = EHMS_ERROR_PARAM;
+    }
+    else if (engine_id >= EHMS_ENGINE_COUNT)
+    {
+        result = EHMS_ERROR_RANGE;
+    }
+    else if (!s_vib_state.is_initialized)
+    {
+        result = EHMS_ERROR_NOT_INIT;
+    }
+    else
+    {
+        *completed = 0U;
+        
+        for (uint32_t s = 0U; s < VIB_SENSOR_COUNT; s++)
+        {
+            vib_sensor_state_t* state = &s_vib_state.sensor[engine_id][s];
+            vib_ring_t* ring = &state->ring;
+            
+            while (ring->tail != ring->head)
+            {
+                if (state->block_index == 0U)
+                {
+                    vib_start_block(state, shaft_speed_pct);
+                }
+                
+                float x = (float)ring->sample[ring->tail & (VIB_RING_LENGTH - 1U)] *
+                          s_vib_state.window[state->block_index];
+                
+                for (uint32_t o = 0U; o < VIB_ORDER_COUNT; o++)
+                {
+                    vib_goertzel_t* filter = &state->filter[o];
+                    float s0 = x + (filter->coeff * filter->s1) - filter->s2;
+                    
+                    filter->s2 = filter->s1;
+                    filter->s1 = s0;
+                }
+                
+                ring->tail++;
+                state->block_index++;
+                
+                if (state->block_index == VIB_BLOCK_LENGTH)
+                {
+                    vib_finish_block(state);
+                    state->block_index = 0U;
+                    *completed |= ((1UL << VIB_ORDER_COUNT) - 1UL) << (s * VIB_ORDER_COUNT);
+                }
+            }
+        }
+    }
+    
+    return result;
+}
+
+/**
+ * @brief Get the latest result of an order band
+ * @trace SRS-EHMS-104
+ */
+ehms_result_t vib_get_band(ehms_engine_id_t engine_id,
+                           vib_sensor_t sensor,
+                           vib_order_t order,
+                           vib_band_t* band)
+{
+    ehms_result_t result = EHMS_OK;
+    
+    if (band == NULL)
+    {
+        result = EHMS_ERROR_PARAM;
+    }
+    else if ((engine_id >= EHMS_ENGINE_COUNT) || (sensor >= VIB_SENSOR_COUNT) ||
+             (order >= VIB_ORDER_COUNT))
+    {
+        result = EHMS_ERROR_RANGE;
+    }
+    else if (!s_vib_state.is_initialized)
+    {
+        result = EHMS_ERROR_NOT_INIT;
+    }
+    else
+    {
+        *band = s_vib_state.sensor[engine_id][sensor].band[order];
+    }
+    
+    return result;
+}
+
+/**
+ * @brief Get waveform buffering statistics of a sensor
+ * @trace SRS-EHMS-100
+ */
+ehms_result_t vib_get_statistics(ehms_engine_id_t engine_id,
+                                 vib_sensor_t sensor,
+                                 vib_sensor_statistics_t* stats)
+{
+    ehms_result_t result = EHMS_OK;
+    
+    if (stats == NULL)
+    {
+        result = EHMS_ERROR_PARAM;
+    }
+    else if ((engine_id >= EHMS_ENGINE_COUNT) || (sensor >= VIB_SENSOR_COUNT))
+    {
+        result = EHMS_ERROR_RANGE;
+    }
+    else if (!s_vib_state.is_initialized)
+    {
+        result = EHMS_ERROR_NOT_INIT;
+    }
+    else
+    {
+        *stats = s_vib_state.sensor[engine_id][sensor].stats;
+    }
+    
+    return result;
+}
+
+/* ============================================================================
+ * PRIVATE FUNCTIONS
+ * ============================================================================ */
+
+/**
+ * @brief Latch order filter frequencies from the shaft speeds and reset state
+ *
+ * Shaft speed changes within one block (80 ms) are small against the block's
+ * frequency resolution, so the filter frequency is held for the block.
+ */
+static void vib_start_block(vib_sensor_state_t* sensor, const float* shaft_speed_pct)
+{
+    for (uint32_t o = 0U; o < VIB_ORDER_COUNT; o++)
+    {
+        vib_goertzel_t* filter = &sensor->filter[o];
+        float frequency_hz = (shaft_speed_pct[o] / 100.0f) * s_vib_rev_per_s[o];
+        
+        filter->tracking = (shaft_speed_pct[o] >= VIB_MIN_SHAFT_SPEED_PCT) &&
+                           (frequency_hz < ((float)VIB_SAMPLE_RATE_HZ / 2.0f));
+        filter->frequency_hz = filter->tracking ? frequency_hz : 0.0f;
+        filter->coeff = 2.0f * cosf((VIB_TWO_PI * filter->frequency_hz) /
+                                    (float)VIB_SAMPLE_RATE_HZ);
+        filter->s1 = 0.0f;
+        filter->s2 = 0.0f;
+    }
+}
+
+/**
+ * @brief Publish the order bands of a completed block
+ */
+static void vib_finish_block(vib_sensor_state_t* sensor)
+{
+    for (uint32_t o = 0U; o < VIB_ORDER_COUNT; o++)
+    {
+        const vib_goertzel_t* filter = &sensor->filter[o];
+        vib_band_t* band = &sensor->band[o];
+        
+        if (filter->tracking)
+        {
+            float power = (filter->s1 * filter->s1) + (filter->s2 * filter->s2) -
+                          (filter->coeff * filter->s1 * filter->s2);
+            
+            band->amplitude = sqrtf((power > 0.0f) ? power : 0.0f) * VIB_AMPLITUDE_SCALE;
+            band->status = EHMS_PARAM_VALID;
+        }
+        else
+        {
+            band->amplitude = 0.0f;
+            band->status = EHMS_PARAM_NCD;
+        }
+        
+        band->frequency_hz = filter->frequency_hz;
+        band->sequence++;
+    }
+    
+    sensor->stats.blocks_completed++;
+}
+
+/* END OF FILE */
@@ -0,0 +1,209 @@
+/**
+ * @file vibration_analysis.h
+ * @brief EHMS Engine Order Vibration Analysis
+ *
+ * @copyright Copyright (c) 2026 AeroTech Avionics Inc.
+ * @note This file is subject to DO-178C Level B certification requirements
+ *
+ * CSCI: EHMS-CORE
+ * CSC: VIBRATION-ANALYSIS
+ *
+ * Requirements Trace:
+ *   SRS-EHMS-100: System shall acquire engine parameters at 100Hz
+ *   SRS-EHMS-104: System shall derive shaft order vibration amplitudes
+ *
+ * Vibration waveforms received in MIL-STD-1553B burst transfers are written
+ * to a fixed ring buffer per engine and sensor. Each acquisition cycle the
+ * buffered samples are windowed and fed to one Goertzel filter per tracked
+ * shaft order, so the spectral estimate is built incrementally and no cycle
+ * performs more than one burst of work per filter. A band is published when
+ * a block of VIB_BLOCK_LENGTH samples completes; the filter frequency is
+ * latched from the shaft speed at the start of each block.
+ *
+ * All storage is static; the module performs no dynamic allocation.
+ */
+
+#ifndef VIBRATION_ANALYSIS_H
+#define VIBRATION_ANALYSIS_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* ============================================================================
+ * INCLUDES
+ * ============================================================================ */
+#include "ehms_types.h"
+
+/* ============================================================================
+ * CONSTANTS
+ * ============================================================================ */
+
+/** @brief Waveform sample rate of each vibration sensor */
+#define VIB_SAMPLE_RATE_HZ                  3200U
+
+/** @brief Samples per sensor per acquisition cycle (one 1553 message) */
+#define VIB_BURST_WORDS                     32U
+
+/** @brief Ring buffer length per sensor (power of two) */
+#define VIB_RING_LENGTH                     256U
+
+/** @brief Samples per spectral block (80 ms, 12.5 Hz resolution) */
+#define VIB_BLOCK_LENGTH                    256U
+
+/** @brief Shaft speed below which no order band is computed (% RPM) */
+#define VIB_MIN_SHAFT_SPEED_PCT             10.0f
+
+/** @brief Low pressure spool speed at 100% N1 */
+#ifndef VIB_N1_RPM_AT_100PCT
+#define VIB_N1_RPM_AT_100PCT                5175.0f
+#endif
+
+/** @brief High pressure spool speed at 100% N2 */
+#ifndef VIB_N2_RPM_AT_100PCT
+#define VIB_N2_RPM_AT_100PCT                14460.0f
+#endif
+
+_Static_assert((VIB_RING_LENGTH & (VIB_RING_LENGTH - 1U)) == 0U,
+               "Vibration ring length shall be a power of two");
+_Static_assert(VIB_RING_LENGTH >= (2U * VIB_BURST_WORDS),
+               "Vibration ring shall hold two bursts");
+
+/* ============================================================================
+ * TYPES
+ * ============================================================================ */
+
+/**
+ * @brief Vibration sensors
+ */
+typedef enum
+{
+    VIB_SENSOR_FAN          = 0U,   /**< Fan frame accelerometer */
+    VIB_SENSOR_CORE         = 1U,   /**< Core (turbine rear frame) accelerometer */
+    VIB_SENSOR_COUNT        = 2U
+} vib_sensor_t;
+
+/**
+ * @brief Tracked shaft orders (once per revolution)
+ */
+typedef enum
+{
+    VIB_ORDER_N1            = 0U,   /**< Low pressure spool */
+    VIB_ORDER_N2            = 1U,   /**< High pressure spool */
+    VIB_ORDER_COUNT         = 2U
+} vib_order_t;
+
+/** @brief Bands per engine; band index = sensor * VIB_ORDER_COUNT + order */
+#define VIB_BAND_COUNT                      (VIB_SENSOR_COUNT * VIB_ORDER_COUNT)
+
+/**
+ * @brief Latest result of one order band
+ */
+typedef struct
+{
+    float                   amplitude;          /**< Peak amplitude (sensor counts) */
+    float                   frequency_hz;       /**< Tracked frequency */
+    uint32_t                sequence;           /**< Blocks completed */
+    ehms_param_status_t     status;             /**< VALID, or NCD below minimum speed */
+} vib_band_t;
+
+/**
+ * @brief Waveform buffering statistics of one sensor
+ */
+typedef struct
+{
+    uint32_t                samples_received;   /**< Samples written to the ring */
+    uint32_t                overrun_count;      /**< Samples dropped, ring full */
+    uint32_t                blocks_completed;   /**< Spectral blocks completed */
+} vib_sensor_statistics_t;
+
+/* ============================================================================
+ * FUNCTION PROTOTYPES
+ * ============================================================================ */
+
+/**
+ * @brief Initialize vibration analysis
+ *
+ * Clears all rings and bands and builds the analysis window.
+ *
+ * @return EHMS_OK on success, error code otherwise
+ *
+ * @trace SRS-EHMS-104
+ */
+ehms_result_t vib_init(void);
+
+/**
+ * @brief Append waveform samples received from the bus
+ *
+ * Words are two's complement samples. Samples that do not fit in the ring
+ * are dropped and counted as overruns.
+ *
+ * @param[in] engine_id  Engine identifier
+ * @param[in] sensor     Sensor the samples belong to
+ * @param[in] words      Sample words
+ * @param[in] count      Number of words
+ * @return EHMS_OK on success, EHMS_ERROR_BUSY if samples were dropped,
+ *         error code otherwise
+ *
+ * @trace SRS-EHMS-100
+ */
+ehms_result_t vib_write_samples(ehms_engine_id_t engine_id,
+                                vib_sensor_t sensor,
+                                const uint16_t* words,
+                                uint32_t count);
+
+/**
+ * @brief Feed buffered samples of one engine to the order filters
+ *
+ * Consumes every sample in the engine's rings; work per call is bounded by
+ * VIB_RING_LENGTH samples per sensor.
+ *
+ * @param[in]  engine_id        Engine identifier
+ * @param[in]  shaft_speed_pct  Speed of each vib_order_t shaft (% RPM);
+ *                              0 when the speed is not available
+ * @param[out] completed        Receives bit mask of bands updated by the call
+ * @return EHMS_OK on success, error code otherwise
+ *
+ * @trace SRS-EHMS-104
+ */
+ehms_result_t vib_process(ehms_engine_id_t engine_id,
+                          const float shaft_speed_pct[VIB_ORDER_COUNT],
+                          uint32_t* completed);
+
+/**
+ * @brief Get the latest result of an order band
+ *
+ * @param[in]  engine_id  Engine identifier
+ * @param[in]  sensor     Sensor
+ * @param[in]  order      Shaft order
+ * @param[out] band       Receives band result
+ * @return EHMS_OK on success, error code otherwise
+ *
+ * @trace SRS-EHMS-104
+ */
+ehms_result_t vib_get_band(ehms_engine_id_t engine_id,
+                           vib_sensor_t sensor,
+                           vib_order_t order,
+                           vib_band_t* band);
+
+/**
+ * @brief Get waveform buffering statistics of a sensor
+ *
+ * @param[in]  engine_id  Engine identifier
+ * @param[in]  sensor     Sensor
+ * @param[out] stats      Receives statistics
+ * @return EHMS_OK on success, error code otherwise
+ *
+ * @trace SRS-EHMS-100
+ */
+ehms_result_t vib_get_statistics(ehms_engine_id_t engine_id,
+                                 vib_sensor_t sensor,
+                                 vib_sensor_statistics_t* stats);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* VIBRATION_ANALYSIS_H */
+
+/* END OF FILE */
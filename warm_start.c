@@ -0,0 +1,395 @@
+/**
+ * @file warm_start.c
+ * @brief EHMS Warm Start Checkpoint
+ *
+ * @copyright Copyright (c) 2026 AeroTech Avionics Inc.
+ * @note DO-178C Level B - Safety Critical Software
+ *
+ * CSCI: EHMS-CORE
+ * CSC: WARM-START
+ *
+ * Requirements Trace:
+ *   SRS-EHMS-016: System shall resume monitoring from checkpointed state
+ *                 after a power interruption
+ *   SRS-EHMS-108: System shall verify snapshot data integrity by CRC
+ */
+
+/* ============================================================================
+ * INCLUDES
+ * ============================================================================ */
+#include "warm_start.h"
+#include "ehms_config.h"
+#include "alert_manager.h"
+#include "ehms_crc32.h"
+
+#include <stddef.h>
+#include <string.h>
+
+/* ============================================================================
+ * PRIVATE CONSTANTS
+ * ============================================================================ */
+
+/** @brief Segments of a bank, in payload order */
+#define WS_SEGMENT_DAQ                  0U
+#define WS_SEGMENT_ALERT                1U
+#define WS_SEGMENT_TREND                2U      /* First of one per engine */
+
+/** @brief Header bytes covered by the bank CRC */
+#define WS_HEADER_CRC_LENGTH            (offsetof(ws_bank_header_t, crc32))
+
+/* ============================================================================
+ * PRIVATE TYPES
+ * ============================================================================ */
+
+/**
+ * @brief Module state structure
+ */
+typedef struct
+{
+    bool                is_initialized;
+    ws_image_t*         image;                  /**< Image in non-volatile RAM */
+    uint32_t            bank;                   /**< Bank being written */
+    uint32_t            segment;                /**< Next segment of the bank */
+    uint32_t            written;                /**< Payload bytes of the bank written */
+    uint32_t            crc;                    /**< CRC register over the bank written */
+    ws_bank_header_t    header;                 /**< Header of the bank being written */
+    ehms_timestamp_t    epoch;                  /**< Time zero of packed alert times */
+    ws_statistics_t     stats;                  /**< Checkpoint statistics */
+} ws_state_t;
+
+/* ============================================================================
+ * PRIVATE DATA
+ * ============================================================================ */
+
+/** @brief Module state - static allocation for safety */
+static ws_state_t s_ws_state;
+
+/* ============================================================================
+ * PRIVATE FUNCTION PROTOTYPES
+ * ============================================================================ */
+
+static void ws_open_bank(ws_bank_t* bank);
+static ehms_result_t ws_save_segment(ws_payload_t* payload, uint32_t segment);
+static uint32_t ws_segment_length(uint32_t segment);
+static bool ws_bank_intact(const ws_bank_t* bank);
+static uint32_t ws_bank_crc(const ws_bank_t* bank);
+static ehms_result_t ws_restore_bank(const ws_bank_t* bank);
+
+/* ============================================================================
+ * PUBLIC FUNCTIONS
+ * ============================================================================ */
+
+/**
+ * @brief Initialize warm start checkpointing into an image
+ * @trace SRS-EHMS-016
+ */
+ehms_result_t ws_init(ws_image_t* image)
+{
+    ehms_result_t result = EHMS_OK;
+    
+    if (image == NULL)
+    {
+        result = EHMS_ERROR_PARAM;
+    }
+    else
+    {
+        (void)memset(&s_ws_state, 0, sizeof(s_ws_state));
+        s_ws_state.image = image;
+        s_ws_state.epoch = system_get_timestamp();
+        s_ws_state.stats.restore_result = EHMS_ERROR_NOT_INIT;
+        s_ws_state.is_initialized = true;
+    }
+    
+    return result;
+}
+
+/**
+ * @brief Restore the newest intact image
+ * @trace SRS-EHMS-016, SRS-EHMS-108
+ */
+ehms_result_t ws_restore(void)
+{
+    ehms_result_t result = EHMS_OK;
+    
+    if (!s_ws_state.is_initialized)
+    {
+        result = EHMS_ERROR_NOT_INIT;
+    }
+    else if ((s_ws_state.segment != 0U) || (s_ws_state.stats.images_written != 0U))
+    {
+        /* Checkpointing has started overwriting the image */
+        result = EHMS_ERROR_BUSY;
+    }
+    else
+    {
+        uint32_t newest = WS_BANK_COUNT;
+        
+        for (uint32_t b = 0U; b < WS_BANK_COUNT; b++)
+        {
+            const ws_bank_t* bank = &s_ws_state.image->bank[b];
+            
+            /* Sequence numbers wrap; the newer is less than 2^31 ahead */
+            if (ws_bank_intact(bank) &&
+                ((newest == WS_BANK_COUNT) ||
+                 ((int32_t)(bank->header.sequence -
+                            s_ws_state.image->bank[newest].header.sequence) > 0)))
+            {
+                newest = b;
+            }
+        }
+        
+        if (newest == WS_BANK_COUNT)
+        {
+            result = EHMS_ERROR_CRC;
+        }
+        else
+        {
+            const ws_bank_t* bank = &s_ws_state.image->bank[newest];
+            
+            result = ws_restore_bank(bank);
+            
+            /* Continue the image: same epoch, next sequence, other bank first */
+            s_ws_state.epoch = bank->header.epoch;
+            s_ws_state.stats.sequence = bank->header.sequence + 1U;
+            s_ws_state.bank = (newest + 1U) % WS_BANK_COUNT;
+            s_ws_state.stats.warm_started = true;
+        }
+        
+        s_ws_state.stats.restore_result = result;
+    }
+    
+    return result;
+}
+
+/**
+ * @brief Write the next segment of the checkpoint image
+ * @trace SRS-EHMS-016
+ */
+ehms_result_t ws_checkpoint_cycle(void)
+{
+    ehms_result_t result = EHMS_OK;
+    
+    if (!s_ws_state.is_initialized)
+    {
+        result = EHMS_ERROR_NOT_INIT;
+    }
+    else
+    {
+        ws_bank_t* bank = &s_ws_state.image->bank[s_ws_state.bank];
+        uint32_t length = ws_segment_length(s_ws_state.segment);
+        
+        if (s_ws_state.segment == 0U)
+        {
+            ws_open_bank(bank);
+        }
+        
+        result = ws_save_segment(&bank->payload, s_ws_state.segment);
+        
+        if (result == EHMS_OK)
+        {
+            /* The CRC is taken over the bytes as stored */
+            s_ws_state.crc = ehms_crc32_update(s_ws_state.crc,
+                                               (const uint8_t*)&bank->payload + s_ws_state.written,
+                                               length);
+            s_ws_state.written += length;
+            s_ws_state.segment++;
+        }
+        else
+        {
+            s_ws_state.stats.segment_errors++;
+            s_ws_state.segment = 0U;
+        }
+        
+        if (s_ws_state.segment == WS_SEGMENT_COUNT)
+        {
+            /* The CRC covers the payload, so a header stored ahead of the
+             * payload's last bytes does not validate the bank early */
+            s_ws_state.header.crc32 = s_ws_state.crc ^ EHMS_CRC32_INITIAL;
+            (void)memcpy(&bank->header, &s_ws_state.header, sizeof(bank->header));
+            
+            s_ws_state.stats.images_written++;
+            s_ws_state.stats.sequence++;
+            s_ws_state.bank = (s_ws_state.bank + 1U) % WS_BANK_COUNT;
+            s_ws_state.segment = 0U;
+        }
+    }
+    
+    return result;
+}
+
+/**
+ * @brief Get checkpoint statistics
+ * @trace SRS-EHMS-016
+ */
+ehms_result_t ws_get_statistics(ws_statistics_t* stats)
+{
+    ehms_result_t result = EHMS_OK;
+    
+    if (stats == NULL)
+    {
+        result = EHMS_ERROR_PARAM;
+    }
+    else
+    {
+        *stats = s_ws_state.stats;
+    }
+    
+    return result;
+}
+
+/* ============================================================================
+ * PRIVATE FUNCTIONS
+ * ============================================================================ */
+
+/**
+ * @brief Start writing a bank: invalidate it and start its CRC
+ *
+ * While no alert is held the epoch moves up to the present, keeping the
+ * packed alert times of long flights within range.
+ */
+static void ws_open_bank(ws_bank_t* bank)
+{
+    /* Invalidate the bank before its payload is overwritten */
+    bank->header.magic = 0U;
+    
+    if (alert_get_active_count() == 0U)
+    {
+        s_ws_state.epoch = system_get_timestamp();
+    }
+    
+    (void)memset(&s_ws_state.header, 0, sizeof(s_ws_state.header));
+    s_ws_state.header.magic = WS_IMAGE_MAGIC;
+    s_ws_state.header.version = WS_FORMAT_VERSION;
+    s_ws_state.header.payload_length = (uint32_t)sizeof(ws_payload_t);
+    s_ws_state.header.sequence = s_ws_state.stats.sequence;
+    s_ws_state.header.epoch = s_ws_state.epoch;
+    
+    s_ws_state.crc = ehms_crc32_update(EHMS_CRC32_INITIAL, &s_ws_state.header,
+                                       WS_HEADER_CRC_LENGTH);
+    s_ws_state.written = 0U;
+}
+
+/**
+ * @brief Save one segment into a bank's payload
+ *
+ * Alerts the packed form cannot hold are counted and left out; the rest
+ * of the alert segment is kept.
+ */
+static ehms_result_t ws_save_segment(ws_payload_t* payload, uint32_t segment)
+{
+    ehms_result_t result = EHMS_OK;
+    
+    if (segment == WS_SEGMENT_DAQ)
+    {
+        result = daq_save_warm_state(&payload->daq);
+    }
+    else if (segment == WS_SEGMENT_ALERT)
+    {
+        result = alert_save_warm_state(&s_ws_state.epoch, &payload->alert);
+        
+        if (result == EHMS_ERROR_RANGE)
+        {
+            s_ws_state.stats.alerts_omitted++;
+            result = EHMS_OK;
+        }
+    }
+    else
+    {
+#if defined(DAQ_TREND_ENGINE)
+        uint32_t engine = segment - WS_SEGMENT_TREND;
+        
+        result = trend_save_warm_state((ehms_engine_id_t)engine, &payload->trend[engine]);
+#endif
+    }
+    
+    return result;
+}
+
+/**
+ * @brief Payload bytes of a segment
+ */
+static uint32_t ws_segment_length(uint32_t segment)
+{
+    uint32_t length = 0U;
+    
+    if (segment == WS_SEGMENT_DAQ)
+    {
+        length = (uint32_t)sizeof(daq_warm_state_t);
+    }
+    else if (segment == WS_SEGMENT_ALERT)
+    {
+        length = (uint32_t)sizeof(alert_warm_state_t);
+    }
+    else
+    {
+#if defined(DAQ_TREND_ENGINE)
+        length = (uint32_t)sizeof(trend_warm_engine_t);
+#endif
+    }
+    
+    return length;
+}
+
+/**
+ * @brief Check a bank's header fields and CRC before restoring it
+ */
+static bool ws_bank_intact(const ws_bank_t* bank)
+{
+    bool intact = (bank->header.magic == WS_IMAGE_MAGIC) &&
+                  (bank->header.version == WS_FORMAT_VERSION) &&
+                  (bank->header.payload_length == (uint32_t)sizeof(ws_payload_t));
+    
+    if (intact)
+    {
+        intact = (ws_bank_crc(bank) == bank->header.crc32);
+    }
+    
+    return intact;
+}
+
+/**
+ * @brief CRC of a bank's header fields and payload
+ */
+static uint32_t ws_bank_crc(const ws_bank_t* bank)
+{
+    uint32_t crc = ehms_crc32_update(EHMS_CRC32_INITIAL, &bank->header, WS_HEADER_CRC_LENGTH);
+    
+    crc = ehms_crc32_update(crc, &bank->payload, (uint32_t)sizeof(ws_payload_t));
+    
+    return crc ^ EHMS_CRC32_INITIAL;
+}
+
+/**
+ * @brief Restore every segment of an intact bank
+ * @return EHMS_OK, or the first error of a module restore
+ */
+static ehms_result_t ws_restore_bank(const ws_bank_t* bank)
+{
+    ehms_result_t result = daq_restore_warm_state(&bank->payload.daq);
+    ehms_result_t segment_result = alert_restore_warm_state(&bank->header.epoch,
+                                                            &bank->payload.alert);
+    
+    if (result == EHMS_OK)
+    {
+        result = segment_result;
+    }
+
+#if defined(DAQ_TREND_ENGINE)
+    uint32_t time_ms = system_get_time_ms();
+    
+    for (uint32_t engine = 0U; engine < EHMS_ENGINE_COUNT; engine++)
+    {
+        segment_result = trend_restore_warm_state((ehms_engine_id_t)engine,
+                                                  &bank->payload.trend[engine], time_ms);
+        
+        if (result == EHMS_OK)
+        {
+            result = segment_result;
+        }
+    }
+
+#endif
+    return result;
+}
+
+/* END OF FILE */
@@ -0,0 +1,210 @@
+/**
+ * @file warm_start.h
+ * @brief EHMS Warm Start Checkpoint
+ *
+ * @copyright Copyright (c) 2026 AeroTech Avionics Inc.
+ * @note This file is subject to DO-178C Level B certification requirements
+ *
+ * CSCI: EHMS-CORE
+ * CSC: WARM-START
+ *
+ * Requirements Trace:
+ *   SRS-EHMS-016: System shall resume monitoring from checkpointed state
+ *                 after a power interruption
+ *   SRS-EHMS-108: System shall verify snapshot data integrity by CRC
+ *
+ * Checkpoints the state that a cold start loses and the buses do not
+ * refill within a cycle: the health of the ARINC 429 sources, the latched
+ * alerts and, with DAQ_TREND_ENGINE, the running trend statistics. After a
+ * power interruption ws_restore puts it back, so failed sources stay
+ * failed over, latched alerts stay displayed and trends continue.
+ *
+ * The image is held in non-volatile RAM mapped by the platform and is
+ * written in two banks. One segment of a bank is written per acquisition
+ * cycle (ws_checkpoint_cycle), so a cycle writes at most one segment and
+ * a bank is complete every WS_SEGMENT_COUNT cycles. The bank header,
+ * holding the CRC of the header fields and the payload, is written last.
+ * A bank interrupted while being written fails its CRC, and the other
+ * bank still holds the previous complete image.
+ *
+ * Each segment is saved by its module in one call, so it is consistent
+ * in itself; segments of one image are up to WS_SEGMENT_COUNT cycles
+ * apart.
+ */
+
+#ifndef WARM_START_H
+#define WARM_START_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* ============================================================================
+ * INCLUDES
+ * ============================================================================ */
+#include "ehms_types.h"
+#include "data_acquisition_ext.h"
+#include "alert_manager_ext.h"
+#if defined(DAQ_TREND_ENGINE)
+#include "trend_engine.h"
+#endif
+
+/* ============================================================================
+ * CONSTANTS
+ * ============================================================================ */
+
+/** @brief Bank header magic ("EHWS") */
+#define WS_IMAGE_MAGIC                      0x53574845UL
+
+/** @brief Image format version */
+#define WS_FORMAT_VERSION                   1U
+
+/** @brief Banks of the image */
+#define WS_BANK_COUNT                       2U
+
+/** @brief Segments of a bank: acquisition, alerts, then one per engine's trends */
+#if defined(DAQ_TREND_ENGINE)
+#define WS_SEGMENT_COUNT                    (2U + EHMS_ENGINE_COUNT)
+#else
+#define WS_SEGMENT_COUNT                    2U
+#endif
+
+/* ============================================================================
+ * TYPES
+ * ============================================================================ */
+
+/**
+ * @brief Checkpointed state, one member per segment
+ */
+typedef struct
+{
+    daq_warm_state_t    daq;                    /**< Source health */
+    alert_warm_state_t  alert;                  /**< Latched alerts */
+#if defined(DAQ_TREND_ENGINE)
+    trend_warm_engine_t trend[EHMS_ENGINE_COUNT]; /**< Trend statistics by engine */
+#endif
+} ws_payload_t;
+
+/**
+ * @brief Bank header
+ */
+typedef struct
+{
+    uint32_t            magic;                  /**< WS_IMAGE_MAGIC */
+    uint16_t            version;                /**< WS_FORMAT_VERSION */
+    uint16_t            reserved;               /**< Zero */
+    uint32_t            payload_length;         /**< sizeof(ws_payload_t) */
+    uint32_t            sequence;               /**< Images written before this one */
+    ehms_timestamp_t    epoch;                  /**< Time zero of the packed alert times */
+    uint32_t            crc32;                  /**< CRC of header fields above and payload */
+} ws_bank_header_t;
+
+/**
+ * @brief One bank of the image
+ */
+typedef struct
+{
+    ws_bank_header_t    header;                 /**< Written once the payload is complete */
+    ws_payload_t        payload;                /**< Checkpointed state */
+} ws_bank_t;
+
+/**
+ * @brief Checkpoint image in non-volatile RAM
+ */
+typedef struct
+{
+    ws_bank_t           bank[WS_BANK_COUNT];    /**< Written alternately */
+} ws_image_t;
+
+/**
+ * @brief Checkpoint statistics
+ */
+typedef struct
+{
+    uint32_t            images_written;         /**< Banks completed since ws_init */
+    uint32_t            sequence;               /**< Sequence of the next image */
+    uint32_t            segment_errors;         /**< Segments not saved; bank restarted */
+    uint32_t            alerts_omitted;         /**< Alert segments missing an alert */
+    bool                warm_started;           /**< ws_restore restored an image */
+    ehms_result_t       restore_result;         /**< Result of ws_restore */
+} ws_statistics_t;
+
+/* The CRC covers every payload byte; the segments leave no padding between them */
+#if defined(DAQ_TREND_ENGINE)
+_Static_assert(sizeof(ws_payload_t) == (sizeof(daq_warm_state_t) + sizeof(alert_warm_state_t) +
+                                        (EHMS_ENGINE_COUNT * sizeof(trend_warm_engine_t))),
+               "Warm start segments shall be contiguous");
+#else
+_Static_assert(sizeof(ws_payload_t) == (sizeof(daq_warm_state_t) + sizeof(alert_warm_state_t)),
+               "Warm start segments shall be contiguous");
+#endif
+
+/* ============================================================================
+ * FUNCTION PROTOTYPES
+ * ============================================================================ */
+
+/**
+ * @brief Initialize warm start checkpointing into an image
+ *
+ * The image is not modified; each bank is overwritten only once ws_restore
+ * has had the chance to read it. Called after daq_init and alert_init.
+ *
+ * @param[in,out] image  Image in non-volatile RAM
+ * @return EHMS_OK on success, EHMS_ERROR_PARAM if image is NULL
+ *
+ * @trace SRS-EHMS-016
+ */
+ehms_result_t ws_init(ws_image_t* image);
+
+/**
+ * @brief Restore the newest intact image
+ *
+ * Each bank is checked once, header fields and CRC, and the intact bank
+ * of highest sequence is restored into the acquisition, alert and trend
+ * modules. Called once after ws_init and before the first acquisition
+ * cycle; checkpointing then writes the other bank first, so the image
+ * restored stays intact until the next one is complete.
+ *
+ * @return EHMS_OK if an image was restored, EHMS_ERROR_CRC if neither
+ *         bank is intact (cold start), EHMS_ERROR_NOT_INIT before ws_init,
+ *         otherwise the first error of a module restore (the other
+ *         segments are still restored)
+ *
+ * @trace SRS-EHMS-016
+ * @trace SRS-EHMS-108
+ */
+ehms_result_t ws_restore(void);
+
+/**
+ * @brief Write the next segment of the checkpoint image
+ *
+ * Called once per acquisition cycle, after the cycle's alert processing,
+ * from the task that runs daq_execute_cycle (core 0's task with
+ * DAQ_PARALLEL_ENGINES, once daq_execute_cycle_core has returned).
+ *
+ * @return EHMS_OK on success, EHMS_ERROR_NOT_INIT before ws_init,
+ *         otherwise the error of the segment's save; a segment that could
+ *         not be saved restarts the bank. Alerts the packed form cannot
+ *         hold are left out of the segment and counted in alerts_omitted.
+ *
+ * @trace SRS-EHMS-016
+ */
+ehms_result_t ws_checkpoint_cycle(void);
+
+/**
+ * @brief Get checkpoint statistics
+ *
+ * @param[out] stats  Receives statistics
+ * @return EHMS_OK on success, EHMS_ERROR_PARAM if stats is NULL
+ *
+ * @trace SRS-EHMS-016
+ */
+ehms_result_t ws_get_statistics(ws_statistics_t* stats);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* WARM_START_H */
+
+/* END OF FILE */